@@ -395,6 +395,198 @@ namespace hipsparse
         return hipsparseZcsrmv(
             handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
     }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrmv_analysis(hipsparseHandle_t         handle,
+                                               hipsparseOperation_t      trans,
+                                               int                       m,
+                                               int                       n,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descr,
+                                               const float*              csr_val,
+                                               const int*                csr_row_ptr,
+                                               const int*                csr_col_ind,
+                                               csrmvInfo_t               info)
+    {
+        return hipsparseScsrmv_analysis(
+            handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrmv_analysis(hipsparseHandle_t         handle,
+                                               hipsparseOperation_t      trans,
+                                               int                       m,
+                                               int                       n,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descr,
+                                               const double*             csr_val,
+                                               const int*                csr_row_ptr,
+                                               const int*                csr_col_ind,
+                                               csrmvInfo_t               info)
+    {
+        return hipsparseDcsrmv_analysis(
+            handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrmv_analysis(hipsparseHandle_t         handle,
+                                               hipsparseOperation_t      trans,
+                                               int                       m,
+                                               int                       n,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descr,
+                                               const hipComplex*         csr_val,
+                                               const int*                csr_row_ptr,
+                                               const int*                csr_col_ind,
+                                               csrmvInfo_t               info)
+    {
+        return hipsparseCcsrmv_analysis(
+            handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrmv_analysis(hipsparseHandle_t         handle,
+                                               hipsparseOperation_t      trans,
+                                               int                       m,
+                                               int                       n,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descr,
+                                               const hipDoubleComplex*   csr_val,
+                                               const int*                csr_row_ptr,
+                                               const int*                csr_col_ind,
+                                               csrmvInfo_t               info)
+    {
+        return hipsparseZcsrmv_analysis(
+            handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrmvWithInfo(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      trans,
+                                              int                       m,
+                                              int                       n,
+                                              int                       nnz,
+                                              const float*              alpha,
+                                              const hipsparseMatDescr_t descr,
+                                              const float*              csr_val,
+                                              const int*                csr_row_ptr,
+                                              const int*                csr_col_ind,
+                                              csrmvInfo_t               info,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+    {
+        return hipsparseScsrmvWithInfo(handle,
+                                       trans,
+                                       m,
+                                       n,
+                                       nnz,
+                                       alpha,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       x,
+                                       beta,
+                                       y);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrmvWithInfo(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      trans,
+                                              int                       m,
+                                              int                       n,
+                                              int                       nnz,
+                                              const double*             alpha,
+                                              const hipsparseMatDescr_t descr,
+                                              const double*             csr_val,
+                                              const int*                csr_row_ptr,
+                                              const int*                csr_col_ind,
+                                              csrmvInfo_t               info,
+                                              const double*             x,
+                                              const double*             beta,
+                                              double*                   y)
+    {
+        return hipsparseDcsrmvWithInfo(handle,
+                                       trans,
+                                       m,
+                                       n,
+                                       nnz,
+                                       alpha,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       x,
+                                       beta,
+                                       y);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrmvWithInfo(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      trans,
+                                              int                       m,
+                                              int                       n,
+                                              int                       nnz,
+                                              const hipComplex*         alpha,
+                                              const hipsparseMatDescr_t descr,
+                                              const hipComplex*         csr_val,
+                                              const int*                csr_row_ptr,
+                                              const int*                csr_col_ind,
+                                              csrmvInfo_t               info,
+                                              const hipComplex*         x,
+                                              const hipComplex*         beta,
+                                              hipComplex*               y)
+    {
+        return hipsparseCcsrmvWithInfo(handle,
+                                       trans,
+                                       m,
+                                       n,
+                                       nnz,
+                                       alpha,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       x,
+                                       beta,
+                                       y);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrmvWithInfo(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      trans,
+                                              int                       m,
+                                              int                       n,
+                                              int                       nnz,
+                                              const hipDoubleComplex*   alpha,
+                                              const hipsparseMatDescr_t descr,
+                                              const hipDoubleComplex*   csr_val,
+                                              const int*                csr_row_ptr,
+                                              const int*                csr_col_ind,
+                                              csrmvInfo_t               info,
+                                              const hipDoubleComplex*   x,
+                                              const hipDoubleComplex*   beta,
+                                              hipDoubleComplex*         y)
+    {
+        return hipsparseZcsrmvWithInfo(handle,
+                                       trans,
+                                       m,
+                                       n,
+                                       nnz,
+                                       alpha,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       x,
+                                       beta,
+                                       y);
+    }
 #endif
 
     template <>
@@ -5684,6 +5876,662 @@ namespace hipsparse
                                  pBuffer);
     }
 
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                         int                       m,
+                                                         int                       nnz,
+                                                         const hipsparseMatDescr_t descrA,
+                                                         float*                    csrSortedValA,
+                                                         const int*                csrSortedRowPtrA,
+                                                         const int*                csrSortedColIndA,
+                                                         csrilu02Info_t            factorInfo,
+                                                         csrPrecondInfo_t          info,
+                                                         int* pBufferSizeInBytes)
+    {
+        return hipsparseScsrilu02Apply_bufferSize(handle,
+                                                  m,
+                                                  nnz,
+                                                  descrA,
+                                                  csrSortedValA,
+                                                  csrSortedRowPtrA,
+                                                  csrSortedColIndA,
+                                                  factorInfo,
+                                                  info,
+                                                  pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                         int                       m,
+                                                         int                       nnz,
+                                                         const hipsparseMatDescr_t descrA,
+                                                         double*                   csrSortedValA,
+                                                         const int*                csrSortedRowPtrA,
+                                                         const int*                csrSortedColIndA,
+                                                         csrilu02Info_t            factorInfo,
+                                                         csrPrecondInfo_t          info,
+                                                         int* pBufferSizeInBytes)
+    {
+        return hipsparseDcsrilu02Apply_bufferSize(handle,
+                                                  m,
+                                                  nnz,
+                                                  descrA,
+                                                  csrSortedValA,
+                                                  csrSortedRowPtrA,
+                                                  csrSortedColIndA,
+                                                  factorInfo,
+                                                  info,
+                                                  pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                         int                       m,
+                                                         int                       nnz,
+                                                         const hipsparseMatDescr_t descrA,
+                                                         hipComplex*               csrSortedValA,
+                                                         const int*                csrSortedRowPtrA,
+                                                         const int*                csrSortedColIndA,
+                                                         csrilu02Info_t            factorInfo,
+                                                         csrPrecondInfo_t          info,
+                                                         int* pBufferSizeInBytes)
+    {
+        return hipsparseCcsrilu02Apply_bufferSize(handle,
+                                                  m,
+                                                  nnz,
+                                                  descrA,
+                                                  csrSortedValA,
+                                                  csrSortedRowPtrA,
+                                                  csrSortedColIndA,
+                                                  factorInfo,
+                                                  info,
+                                                  pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                         int                       m,
+                                                         int                       nnz,
+                                                         const hipsparseMatDescr_t descrA,
+                                                         hipDoubleComplex*         csrSortedValA,
+                                                         const int*                csrSortedRowPtrA,
+                                                         const int*                csrSortedColIndA,
+                                                         csrilu02Info_t            factorInfo,
+                                                         csrPrecondInfo_t          info,
+                                                         int* pBufferSizeInBytes)
+    {
+        return hipsparseZcsrilu02Apply_bufferSize(handle,
+                                                  m,
+                                                  nnz,
+                                                  descrA,
+                                                  csrSortedValA,
+                                                  csrSortedRowPtrA,
+                                                  csrSortedColIndA,
+                                                  factorInfo,
+                                                  info,
+                                                  pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       nnz,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       const float*              csrSortedValA,
+                                                       const int*                csrSortedRowPtrA,
+                                                       const int*                csrSortedColIndA,
+                                                       csrilu02Info_t            factorInfo,
+                                                       csrPrecondInfo_t          info,
+                                                       hipsparseSolvePolicy_t    policy,
+                                                       void*                     pBuffer)
+    {
+        return hipsparseScsrilu02Apply_analysis(handle,
+                                                m,
+                                                nnz,
+                                                descrA,
+                                                csrSortedValA,
+                                                csrSortedRowPtrA,
+                                                csrSortedColIndA,
+                                                factorInfo,
+                                                info,
+                                                policy,
+                                                pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       nnz,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       const double*             csrSortedValA,
+                                                       const int*                csrSortedRowPtrA,
+                                                       const int*                csrSortedColIndA,
+                                                       csrilu02Info_t            factorInfo,
+                                                       csrPrecondInfo_t          info,
+                                                       hipsparseSolvePolicy_t    policy,
+                                                       void*                     pBuffer)
+    {
+        return hipsparseDcsrilu02Apply_analysis(handle,
+                                                m,
+                                                nnz,
+                                                descrA,
+                                                csrSortedValA,
+                                                csrSortedRowPtrA,
+                                                csrSortedColIndA,
+                                                factorInfo,
+                                                info,
+                                                policy,
+                                                pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       nnz,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       const hipComplex*         csrSortedValA,
+                                                       const int*                csrSortedRowPtrA,
+                                                       const int*                csrSortedColIndA,
+                                                       csrilu02Info_t            factorInfo,
+                                                       csrPrecondInfo_t          info,
+                                                       hipsparseSolvePolicy_t    policy,
+                                                       void*                     pBuffer)
+    {
+        return hipsparseCcsrilu02Apply_analysis(handle,
+                                                m,
+                                                nnz,
+                                                descrA,
+                                                csrSortedValA,
+                                                csrSortedRowPtrA,
+                                                csrSortedColIndA,
+                                                factorInfo,
+                                                info,
+                                                policy,
+                                                pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       nnz,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       const hipDoubleComplex*   csrSortedValA,
+                                                       const int*                csrSortedRowPtrA,
+                                                       const int*                csrSortedColIndA,
+                                                       csrilu02Info_t            factorInfo,
+                                                       csrPrecondInfo_t          info,
+                                                       hipsparseSolvePolicy_t    policy,
+                                                       void*                     pBuffer)
+    {
+        return hipsparseZcsrilu02Apply_analysis(handle,
+                                                m,
+                                                nnz,
+                                                descrA,
+                                                csrSortedValA,
+                                                csrSortedRowPtrA,
+                                                csrSortedColIndA,
+                                                factorInfo,
+                                                info,
+                                                policy,
+                                                pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       nnz,
+                                              const float*              alpha,
+                                              const hipsparseMatDescr_t descrA,
+                                              const float*              csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrilu02Info_t            factorInfo,
+                                              csrPrecondInfo_t          info,
+                                              const float*              f,
+                                              float*                    x,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+    {
+        return hipsparseScsrilu02Apply(handle,
+                                       m,
+                                       nnz,
+                                       alpha,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       f,
+                                       x,
+                                       policy,
+                                       pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       nnz,
+                                              const double*             alpha,
+                                              const hipsparseMatDescr_t descrA,
+                                              const double*             csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrilu02Info_t            factorInfo,
+                                              csrPrecondInfo_t          info,
+                                              const double*             f,
+                                              double*                   x,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+    {
+        return hipsparseDcsrilu02Apply(handle,
+                                       m,
+                                       nnz,
+                                       alpha,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       f,
+                                       x,
+                                       policy,
+                                       pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipComplex*         alpha,
+                                              const hipsparseMatDescr_t descrA,
+                                              const hipComplex*         csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrilu02Info_t            factorInfo,
+                                              csrPrecondInfo_t          info,
+                                              const hipComplex*         f,
+                                              hipComplex*               x,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+    {
+        return hipsparseCcsrilu02Apply(handle,
+                                       m,
+                                       nnz,
+                                       alpha,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       f,
+                                       x,
+                                       policy,
+                                       pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilu02Apply(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipDoubleComplex*   alpha,
+                                              const hipsparseMatDescr_t descrA,
+                                              const hipDoubleComplex*   csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrilu02Info_t            factorInfo,
+                                              csrPrecondInfo_t          info,
+                                              const hipDoubleComplex*   f,
+                                              hipDoubleComplex*         x,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+    {
+        return hipsparseZcsrilu02Apply(handle,
+                                       m,
+                                       nnz,
+                                       alpha,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       f,
+                                       x,
+                                       policy,
+                                       pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                        int                       m,
+                                                        int                       nnz,
+                                                        const hipsparseMatDescr_t descrA,
+                                                        float*                    csrSortedValA,
+                                                        const int*                csrSortedRowPtrA,
+                                                        const int*                csrSortedColIndA,
+                                                        csric02Info_t             factorInfo,
+                                                        csrPrecondInfo_t          info,
+                                                        int* pBufferSizeInBytes)
+    {
+        return hipsparseScsric02Apply_bufferSize(handle,
+                                                 m,
+                                                 nnz,
+                                                 descrA,
+                                                 csrSortedValA,
+                                                 csrSortedRowPtrA,
+                                                 csrSortedColIndA,
+                                                 factorInfo,
+                                                 info,
+                                                 pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                        int                       m,
+                                                        int                       nnz,
+                                                        const hipsparseMatDescr_t descrA,
+                                                        double*                   csrSortedValA,
+                                                        const int*                csrSortedRowPtrA,
+                                                        const int*                csrSortedColIndA,
+                                                        csric02Info_t             factorInfo,
+                                                        csrPrecondInfo_t          info,
+                                                        int* pBufferSizeInBytes)
+    {
+        return hipsparseDcsric02Apply_bufferSize(handle,
+                                                 m,
+                                                 nnz,
+                                                 descrA,
+                                                 csrSortedValA,
+                                                 csrSortedRowPtrA,
+                                                 csrSortedColIndA,
+                                                 factorInfo,
+                                                 info,
+                                                 pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                        int                       m,
+                                                        int                       nnz,
+                                                        const hipsparseMatDescr_t descrA,
+                                                        hipComplex*               csrSortedValA,
+                                                        const int*                csrSortedRowPtrA,
+                                                        const int*                csrSortedColIndA,
+                                                        csric02Info_t             factorInfo,
+                                                        csrPrecondInfo_t          info,
+                                                        int* pBufferSizeInBytes)
+    {
+        return hipsparseCcsric02Apply_bufferSize(handle,
+                                                 m,
+                                                 nnz,
+                                                 descrA,
+                                                 csrSortedValA,
+                                                 csrSortedRowPtrA,
+                                                 csrSortedColIndA,
+                                                 factorInfo,
+                                                 info,
+                                                 pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                        int                       m,
+                                                        int                       nnz,
+                                                        const hipsparseMatDescr_t descrA,
+                                                        hipDoubleComplex*         csrSortedValA,
+                                                        const int*                csrSortedRowPtrA,
+                                                        const int*                csrSortedColIndA,
+                                                        csric02Info_t             factorInfo,
+                                                        csrPrecondInfo_t          info,
+                                                        int* pBufferSizeInBytes)
+    {
+        return hipsparseZcsric02Apply_bufferSize(handle,
+                                                 m,
+                                                 nnz,
+                                                 descrA,
+                                                 csrSortedValA,
+                                                 csrSortedRowPtrA,
+                                                 csrSortedColIndA,
+                                                 factorInfo,
+                                                 info,
+                                                 pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       nnz,
+                                                      const hipsparseMatDescr_t descrA,
+                                                      const float*              csrSortedValA,
+                                                      const int*                csrSortedRowPtrA,
+                                                      const int*                csrSortedColIndA,
+                                                      csric02Info_t             factorInfo,
+                                                      csrPrecondInfo_t          info,
+                                                      hipsparseSolvePolicy_t    policy,
+                                                      void*                     pBuffer)
+    {
+        return hipsparseScsric02Apply_analysis(handle,
+                                               m,
+                                               nnz,
+                                               descrA,
+                                               csrSortedValA,
+                                               csrSortedRowPtrA,
+                                               csrSortedColIndA,
+                                               factorInfo,
+                                               info,
+                                               policy,
+                                               pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       nnz,
+                                                      const hipsparseMatDescr_t descrA,
+                                                      const double*             csrSortedValA,
+                                                      const int*                csrSortedRowPtrA,
+                                                      const int*                csrSortedColIndA,
+                                                      csric02Info_t             factorInfo,
+                                                      csrPrecondInfo_t          info,
+                                                      hipsparseSolvePolicy_t    policy,
+                                                      void*                     pBuffer)
+    {
+        return hipsparseDcsric02Apply_analysis(handle,
+                                               m,
+                                               nnz,
+                                               descrA,
+                                               csrSortedValA,
+                                               csrSortedRowPtrA,
+                                               csrSortedColIndA,
+                                               factorInfo,
+                                               info,
+                                               policy,
+                                               pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       nnz,
+                                                      const hipsparseMatDescr_t descrA,
+                                                      const hipComplex*         csrSortedValA,
+                                                      const int*                csrSortedRowPtrA,
+                                                      const int*                csrSortedColIndA,
+                                                      csric02Info_t             factorInfo,
+                                                      csrPrecondInfo_t          info,
+                                                      hipsparseSolvePolicy_t    policy,
+                                                      void*                     pBuffer)
+    {
+        return hipsparseCcsric02Apply_analysis(handle,
+                                               m,
+                                               nnz,
+                                               descrA,
+                                               csrSortedValA,
+                                               csrSortedRowPtrA,
+                                               csrSortedColIndA,
+                                               factorInfo,
+                                               info,
+                                               policy,
+                                               pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       nnz,
+                                                      const hipsparseMatDescr_t descrA,
+                                                      const hipDoubleComplex*   csrSortedValA,
+                                                      const int*                csrSortedRowPtrA,
+                                                      const int*                csrSortedColIndA,
+                                                      csric02Info_t             factorInfo,
+                                                      csrPrecondInfo_t          info,
+                                                      hipsparseSolvePolicy_t    policy,
+                                                      void*                     pBuffer)
+    {
+        return hipsparseZcsric02Apply_analysis(handle,
+                                               m,
+                                               nnz,
+                                               descrA,
+                                               csrSortedValA,
+                                               csrSortedRowPtrA,
+                                               csrSortedColIndA,
+                                               factorInfo,
+                                               info,
+                                               policy,
+                                               pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnz,
+                                             const float*              alpha,
+                                             const hipsparseMatDescr_t descrA,
+                                             const float*              csrSortedValA,
+                                             const int*                csrSortedRowPtrA,
+                                             const int*                csrSortedColIndA,
+                                             csric02Info_t             factorInfo,
+                                             csrPrecondInfo_t          info,
+                                             const float*              f,
+                                             float*                    x,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+    {
+        return hipsparseScsric02Apply(handle,
+                                      m,
+                                      nnz,
+                                      alpha,
+                                      descrA,
+                                      csrSortedValA,
+                                      csrSortedRowPtrA,
+                                      csrSortedColIndA,
+                                      factorInfo,
+                                      info,
+                                      f,
+                                      x,
+                                      policy,
+                                      pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnz,
+                                             const double*             alpha,
+                                             const hipsparseMatDescr_t descrA,
+                                             const double*             csrSortedValA,
+                                             const int*                csrSortedRowPtrA,
+                                             const int*                csrSortedColIndA,
+                                             csric02Info_t             factorInfo,
+                                             csrPrecondInfo_t          info,
+                                             const double*             f,
+                                             double*                   x,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+    {
+        return hipsparseDcsric02Apply(handle,
+                                      m,
+                                      nnz,
+                                      alpha,
+                                      descrA,
+                                      csrSortedValA,
+                                      csrSortedRowPtrA,
+                                      csrSortedColIndA,
+                                      factorInfo,
+                                      info,
+                                      f,
+                                      x,
+                                      policy,
+                                      pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnz,
+                                             const hipComplex*         alpha,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipComplex*         csrSortedValA,
+                                             const int*                csrSortedRowPtrA,
+                                             const int*                csrSortedColIndA,
+                                             csric02Info_t             factorInfo,
+                                             csrPrecondInfo_t          info,
+                                             const hipComplex*         f,
+                                             hipComplex*               x,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+    {
+        return hipsparseCcsric02Apply(handle,
+                                      m,
+                                      nnz,
+                                      alpha,
+                                      descrA,
+                                      csrSortedValA,
+                                      csrSortedRowPtrA,
+                                      csrSortedColIndA,
+                                      factorInfo,
+                                      info,
+                                      f,
+                                      x,
+                                      policy,
+                                      pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsric02Apply(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnz,
+                                             const hipDoubleComplex*   alpha,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipDoubleComplex*   csrSortedValA,
+                                             const int*                csrSortedRowPtrA,
+                                             const int*                csrSortedColIndA,
+                                             csric02Info_t             factorInfo,
+                                             csrPrecondInfo_t          info,
+                                             const hipDoubleComplex*   f,
+                                             hipDoubleComplex*         x,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+    {
+        return hipsparseZcsric02Apply(handle,
+                                      m,
+                                      nnz,
+                                      alpha,
+                                      descrA,
+                                      csrSortedValA,
+                                      csrSortedRowPtrA,
+                                      csrSortedColIndA,
+                                      factorInfo,
+                                      info,
+                                      f,
+                                      x,
+                                      policy,
+                                      pBuffer);
+    }
+
     template <>
     hipsparseStatus_t hipsparseXnnz(hipsparseHandle_t         handle,
                                     hipsparseDirection_t      dirA,
@@ -7151,6 +7999,64 @@ namespace hipsparse
                                  bsrColIndC);
     }
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+    template <>
+    hipsparseStatus_t hipsparseXcsr2blockedEll(hipsparseHandle_t handle,
+                                               int               m,
+                                               int               nnz,
+                                               const float*      csrValA,
+                                               int               ellBlockSize,
+                                               int               ellCols,
+                                               float*            ellValue,
+                                               const void*       pBuffer)
+    {
+        return hipsparseScsr2blockedEll(
+            handle, m, nnz, csrValA, ellBlockSize, ellCols, ellValue, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsr2blockedEll(hipsparseHandle_t handle,
+                                               int               m,
+                                               int               nnz,
+                                               const double*     csrValA,
+                                               int               ellBlockSize,
+                                               int               ellCols,
+                                               double*           ellValue,
+                                               const void*       pBuffer)
+    {
+        return hipsparseDcsr2blockedEll(
+            handle, m, nnz, csrValA, ellBlockSize, ellCols, ellValue, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsr2blockedEll(hipsparseHandle_t handle,
+                                               int               m,
+                                               int               nnz,
+                                               const hipComplex* csrValA,
+                                               int               ellBlockSize,
+                                               int               ellCols,
+                                               hipComplex*       ellValue,
+                                               const void*       pBuffer)
+    {
+        return hipsparseCcsr2blockedEll(
+            handle, m, nnz, csrValA, ellBlockSize, ellCols, ellValue, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsr2blockedEll(hipsparseHandle_t       handle,
+                                               int                     m,
+                                               int                     nnz,
+                                               const hipDoubleComplex* csrValA,
+                                               int                     ellBlockSize,
+                                               int                     ellCols,
+                                               hipDoubleComplex*       ellValue,
+                                               const void*             pBuffer)
+    {
+        return hipsparseZcsr2blockedEll(
+            handle, m, nnz, csrValA, ellBlockSize, ellCols, ellValue, pBuffer);
+    }
+#endif
+
     template <>
     hipsparseStatus_t hipsparseXbsr2csr(hipsparseHandle_t         handle,
                                         hipsparseDirection_t      dirA,
@@ -8089,6 +8995,66 @@ namespace hipsparse
                                                   buffer);
     }
 
+    template <>
+    hipsparseStatus_t hipsparseXpruneCsr2csrThresholdByPercentage(hipsparseHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  int               nnzA,
+                                                                  const hipsparseMatDescr_t descrA,
+                                                                  const float* csrValA,
+                                                                  const int* csrRowPtrA,
+                                                                  const int* csrColIndA,
+                                                                  float percentage,
+                                                                  const hipsparseMatDescr_t descrC,
+                                                                  int*  csrRowPtrC,
+                                                                  float* threshold,
+                                                                  void* buffer)
+    {
+        return hipsparseSpruneCsr2csrThresholdByPercentage(handle,
+                                                           m,
+                                                           n,
+                                                           nnzA,
+                                                           descrA,
+                                                           csrValA,
+                                                           csrRowPtrA,
+                                                           csrColIndA,
+                                                           percentage,
+                                                           descrC,
+                                                           csrRowPtrC,
+                                                           threshold,
+                                                           buffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXpruneCsr2csrThresholdByPercentage(hipsparseHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  int               nnzA,
+                                                                  const hipsparseMatDescr_t descrA,
+                                                                  const double* csrValA,
+                                                                  const int* csrRowPtrA,
+                                                                  const int* csrColIndA,
+                                                                  double percentage,
+                                                                  const hipsparseMatDescr_t descrC,
+                                                                  int*  csrRowPtrC,
+                                                                  double* threshold,
+                                                                  void* buffer)
+    {
+        return hipsparseDpruneCsr2csrThresholdByPercentage(handle,
+                                                           m,
+                                                           n,
+                                                           nnzA,
+                                                           descrA,
+                                                           csrValA,
+                                                           csrRowPtrA,
+                                                           csrColIndA,
+                                                           percentage,
+                                                           descrC,
+                                                           csrRowPtrC,
+                                                           threshold,
+                                                           buffer);
+    }
+
     template <>
     hipsparseStatus_t hipsparseXgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
                                                        hipsparseDirection_t      dirA,
@@ -8565,6 +9531,39 @@ namespace hipsparse
             handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
     }
 
+#if(!defined(CUDART_VERSION))
+    template <>
+    hipsparseStatus_t hipsparseXcsru2csrValues(
+        hipsparseHandle_t handle, int nnz, float* csrVal, csru2csrInfo_t info, void* pBuffer)
+    {
+        return hipsparseScsru2csrValues(handle, nnz, csrVal, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsru2csrValues(
+        hipsparseHandle_t handle, int nnz, double* csrVal, csru2csrInfo_t info, void* pBuffer)
+    {
+        return hipsparseDcsru2csrValues(handle, nnz, csrVal, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsru2csrValues(
+        hipsparseHandle_t handle, int nnz, hipComplex* csrVal, csru2csrInfo_t info, void* pBuffer)
+    {
+        return hipsparseCcsru2csrValues(handle, nnz, csrVal, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsru2csrValues(hipsparseHandle_t handle,
+                                               int               nnz,
+                                               hipDoubleComplex* csrVal,
+                                               csru2csrInfo_t    info,
+                                               void*             pBuffer)
+    {
+        return hipsparseZcsru2csrValues(handle, nnz, csrVal, info, pBuffer);
+    }
+#endif
+
     template <>
     hipsparseStatus_t hipsparseXgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
                                                                    int               algo,
@@ -8701,6 +9700,218 @@ namespace hipsparse
             handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
     }
 
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                    hipsparseDirection_t dirA,
+                                                                    int                  blockDim,
+                                                                    int                  m,
+                                                                    const float*         dl,
+                                                                    const float*         d,
+                                                                    const float*         du,
+                                                                    const float*         x,
+                                                                    int                  batchCount,
+                                                                    int batchStride,
+                                                                    size_t* pBufferSizeInBytes)
+    {
+        return hipsparseSgtsvBlockStridedBatch_bufferSizeExt(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                    hipsparseDirection_t dirA,
+                                                                    int                  blockDim,
+                                                                    int                  m,
+                                                                    const double*        dl,
+                                                                    const double*        d,
+                                                                    const double*        du,
+                                                                    const double*        x,
+                                                                    int                  batchCount,
+                                                                    int batchStride,
+                                                                    size_t* pBufferSizeInBytes)
+    {
+        return hipsparseDgtsvBlockStridedBatch_bufferSizeExt(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                    hipsparseDirection_t dirA,
+                                                                    int                  blockDim,
+                                                                    int                  m,
+                                                                    const hipComplex*    dl,
+                                                                    const hipComplex*    d,
+                                                                    const hipComplex*    du,
+                                                                    const hipComplex*    x,
+                                                                    int                  batchCount,
+                                                                    int batchStride,
+                                                                    size_t* pBufferSizeInBytes)
+    {
+        return hipsparseCgtsvBlockStridedBatch_bufferSizeExt(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t       handle,
+                                                                    hipsparseDirection_t    dirA,
+                                                                    int blockDim,
+                                                                    int                     m,
+                                                                    const hipDoubleComplex* dl,
+                                                                    const hipDoubleComplex* d,
+                                                                    const hipDoubleComplex* du,
+                                                                    const hipDoubleComplex* x,
+                                                                    int batchCount,
+                                                                    int batchStride,
+                                                                    size_t* pBufferSizeInBytes)
+    {
+        return hipsparseZgtsvBlockStridedBatch_bufferSizeExt(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                               hipsparseDirection_t dirA,
+                                                               int                  blockDim,
+                                                               int                  m,
+                                                               const float*         dl,
+                                                               const float*         d,
+                                                               const float*         du,
+                                                               const float*         x,
+                                                               int                  batchCount,
+                                                               int                  batchStride,
+                                                               gtsvBlockInfo_t      info,
+                                                               void*                pBuffer)
+    {
+        return hipsparseSgtsvBlockStridedBatch_analysis(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                      hipsparseDirection_t dirA,
+                                                      int                  blockDim,
+                                                      int                  m,
+                                                      const float*         dl,
+                                                      const float*         d,
+                                                      const float*         du,
+                                                      float*               x,
+                                                      int                  batchCount,
+                                                      int                  batchStride,
+                                                      gtsvBlockInfo_t      info,
+                                                      void*                pBuffer)
+    {
+        return hipsparseSgtsvBlockStridedBatch(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                               hipsparseDirection_t dirA,
+                                                               int                  blockDim,
+                                                               int                  m,
+                                                               const double*        dl,
+                                                               const double*        d,
+                                                               const double*        du,
+                                                               const double*        x,
+                                                               int                  batchCount,
+                                                               int                  batchStride,
+                                                               gtsvBlockInfo_t      info,
+                                                               void*                pBuffer)
+    {
+        return hipsparseDgtsvBlockStridedBatch_analysis(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                      hipsparseDirection_t dirA,
+                                                      int                  blockDim,
+                                                      int                  m,
+                                                      const double*        dl,
+                                                      const double*        d,
+                                                      const double*        du,
+                                                      double*              x,
+                                                      int                  batchCount,
+                                                      int                  batchStride,
+                                                      gtsvBlockInfo_t      info,
+                                                      void*                pBuffer)
+    {
+        return hipsparseDgtsvBlockStridedBatch(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                               hipsparseDirection_t dirA,
+                                                               int                  blockDim,
+                                                               int                  m,
+                                                               const hipComplex*    dl,
+                                                               const hipComplex*    d,
+                                                               const hipComplex*    du,
+                                                               const hipComplex*    x,
+                                                               int                  batchCount,
+                                                               int                  batchStride,
+                                                               gtsvBlockInfo_t      info,
+                                                               void*                pBuffer)
+    {
+        return hipsparseCgtsvBlockStridedBatch_analysis(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                      hipsparseDirection_t dirA,
+                                                      int                  blockDim,
+                                                      int                  m,
+                                                      const hipComplex*    dl,
+                                                      const hipComplex*    d,
+                                                      const hipComplex*    du,
+                                                      hipComplex*          x,
+                                                      int                  batchCount,
+                                                      int                  batchStride,
+                                                      gtsvBlockInfo_t      info,
+                                                      void*                pBuffer)
+    {
+        return hipsparseCgtsvBlockStridedBatch(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_analysis(hipsparseHandle_t       handle,
+                                                               hipsparseDirection_t    dirA,
+                                                               int                     blockDim,
+                                                               int                     m,
+                                                               const hipDoubleComplex* dl,
+                                                               const hipDoubleComplex* d,
+                                                               const hipDoubleComplex* du,
+                                                               const hipDoubleComplex* x,
+                                                               int                     batchCount,
+                                                               int                     batchStride,
+                                                               gtsvBlockInfo_t         info,
+                                                               void*                   pBuffer)
+    {
+        return hipsparseZgtsvBlockStridedBatch_analysis(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, info, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch(hipsparseHandle_t       handle,
+                                                      hipsparseDirection_t    dirA,
+                                                      int                     blockDim,
+                                                      int                     m,
+                                                      const hipDoubleComplex* dl,
+                                                      const hipDoubleComplex* d,
+                                                      const hipDoubleComplex* du,
+                                                      hipDoubleComplex*       x,
+                                                      int                     batchCount,
+                                                      int                     batchStride,
+                                                      gtsvBlockInfo_t         info,
+                                                      void*                   pBuffer)
+    {
+        return hipsparseZgtsvBlockStridedBatch(
+            handle, dirA, blockDim, m, dl, d, du, x, batchCount, batchStride, info, pBuffer);
+    }
+
     template <>
     hipsparseStatus_t hipsparseXgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
                                                                 int               m,
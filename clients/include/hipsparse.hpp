@@ -141,6 +141,34 @@ namespace hipsparse
                                       const T*                  x,
                                       const T*                  beta,
                                       T*                        y);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrmv_analysis(hipsparseHandle_t         handle,
+                                               hipsparseOperation_t      trans,
+                                               int                       m,
+                                               int                       n,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descr,
+                                               const T*                  csr_val,
+                                               const int*                csr_row_ptr,
+                                               const int*                csr_col_ind,
+                                               csrmvInfo_t               info);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrmvWithInfo(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      trans,
+                                              int                       m,
+                                              int                       n,
+                                              int                       nnz,
+                                              const T*                  alpha,
+                                              const hipsparseMatDescr_t descr,
+                                              const T*                  csr_val,
+                                              const int*                csr_row_ptr,
+                                              const int*                csr_col_ind,
+                                              csrmvInfo_t               info,
+                                              const T*                  x,
+                                              const T*                  beta,
+                                              T*                        y);
 #endif
 
     template <typename T>
@@ -830,6 +858,88 @@ namespace hipsparse
                                         hipsparseSolvePolicy_t policy,
                                         void*                  pBuffer);
 
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                         int                       m,
+                                                         int                       nnz,
+                                                         const hipsparseMatDescr_t descrA,
+                                                         T*                        csrSortedValA,
+                                                         const int*                csrSortedRowPtrA,
+                                                         const int*                csrSortedColIndA,
+                                                         csrilu02Info_t            factorInfo,
+                                                         csrPrecondInfo_t          info,
+                                                         int* pBufferSizeInBytes);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       nnz,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       const T*                  csrSortedValA,
+                                                       const int*                csrSortedRowPtrA,
+                                                       const int*                csrSortedColIndA,
+                                                       csrilu02Info_t            factorInfo,
+                                                       csrPrecondInfo_t          info,
+                                                       hipsparseSolvePolicy_t    policy,
+                                                       void*                     pBuffer);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrilu02Apply(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       nnz,
+                                              const T*                  alpha,
+                                              const hipsparseMatDescr_t descrA,
+                                              const T*                  csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrilu02Info_t            factorInfo,
+                                              csrPrecondInfo_t          info,
+                                              const T*                  f,
+                                              T*                        x,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                        int                       m,
+                                                        int                       nnz,
+                                                        const hipsparseMatDescr_t descrA,
+                                                        T*                        csrSortedValA,
+                                                        const int*                csrSortedRowPtrA,
+                                                        const int*                csrSortedColIndA,
+                                                        csric02Info_t             factorInfo,
+                                                        csrPrecondInfo_t          info,
+                                                        int* pBufferSizeInBytes);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       nnz,
+                                                      const hipsparseMatDescr_t descrA,
+                                                      const T*                  csrSortedValA,
+                                                      const int*                csrSortedRowPtrA,
+                                                      const int*                csrSortedColIndA,
+                                                      csric02Info_t             factorInfo,
+                                                      csrPrecondInfo_t          info,
+                                                      hipsparseSolvePolicy_t    policy,
+                                                      void*                     pBuffer);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsric02Apply(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnz,
+                                             const T*                  alpha,
+                                             const hipsparseMatDescr_t descrA,
+                                             const T*                  csrSortedValA,
+                                             const int*                csrSortedRowPtrA,
+                                             const int*                csrSortedColIndA,
+                                             csric02Info_t             factorInfo,
+                                             csrPrecondInfo_t          info,
+                                             const T*                  f,
+                                             T*                        x,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer);
+
     template <typename T>
     hipsparseStatus_t hipsparseXnnz(hipsparseHandle_t         handle,
                                     hipsparseDirection_t      dirA,
@@ -1109,6 +1219,18 @@ namespace hipsparse
                                         int*                      bsrRowPtrC,
                                         int*                      bsrColIndC);
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsr2blockedEll(hipsparseHandle_t handle,
+                                               int               m,
+                                               int               nnz,
+                                               const T*          csrValA,
+                                               int               ellBlockSize,
+                                               int               ellCols,
+                                               T*                ellValue,
+                                               const void*       pBuffer);
+#endif
+
     template <typename T>
     hipsparseStatus_t hipsparseXbsr2csr(hipsparseHandle_t         handle,
                                         hipsparseDirection_t      dirA,
@@ -1297,6 +1419,21 @@ namespace hipsparse
                                                          pruneInfo_t               info,
                                                          void*                     buffer);
 
+    template <typename T>
+    hipsparseStatus_t hipsparseXpruneCsr2csrThresholdByPercentage(hipsparseHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  int               nnzA,
+                                                                  const hipsparseMatDescr_t descrA,
+                                                                  const T*                  csrValA,
+                                                                  const int* csrRowPtrA,
+                                                                  const int* csrColIndA,
+                                                                  T          percentage,
+                                                                  const hipsparseMatDescr_t descrC,
+                                                                  int*  csrRowPtrC,
+                                                                  T*    threshold,
+                                                                  void* buffer);
+
     template <typename T>
     hipsparseStatus_t hipsparseXgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
                                                        hipsparseDirection_t      dirA,
@@ -1368,6 +1505,12 @@ namespace hipsparse
                                          csru2csrInfo_t            info,
                                          void*                     pBuffer);
 
+#if(!defined(CUDART_VERSION))
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsru2csrValues(
+        hipsparseHandle_t handle, int nnz, T* csrVal, csru2csrInfo_t info, void* pBuffer);
+#endif
+
     template <typename T>
     hipsparseStatus_t hipsparseXgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
                                                                    int               algo,
@@ -1394,6 +1537,47 @@ namespace hipsparse
                                                      int               batchCount,
                                                      void*             pBuffer);
 
+    template <typename T>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                    hipsparseDirection_t dirA,
+                                                                    int                  blockDim,
+                                                                    int                  m,
+                                                                    const T*             dl,
+                                                                    const T*             d,
+                                                                    const T*             du,
+                                                                    const T*             x,
+                                                                    int                  batchCount,
+                                                                    int batchStride,
+                                                                    size_t* pBufferSizeInBytes);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                               hipsparseDirection_t dirA,
+                                                               int                  blockDim,
+                                                               int                  m,
+                                                               const T*             dl,
+                                                               const T*             d,
+                                                               const T*             du,
+                                                               const T*             x,
+                                                               int                  batchCount,
+                                                               int                  batchStride,
+                                                               gtsvBlockInfo_t      info,
+                                                               void*                pBuffer);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                      hipsparseDirection_t dirA,
+                                                      int                  blockDim,
+                                                      int                  m,
+                                                      const T*             dl,
+                                                      const T*             d,
+                                                      const T*             du,
+                                                      T*                   x,
+                                                      int                  batchCount,
+                                                      int                  batchStride,
+                                                      gtsvBlockInfo_t      info,
+                                                      void*                pBuffer);
+
     template <typename T>
     hipsparseStatus_t hipsparseXgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
                                                                 int               m,
@@ -77,6 +77,22 @@ namespace hipsparse_test
         }
     };
 
+    struct handle_pool_struct
+    {
+        hipsparseHandlePool_t pool;
+        handle_pool_struct()
+        {
+            hipsparseStatus_t status = hipsparseCreateHandlePool(&pool);
+            verify_hipsparse_status_success(status, "ERROR: handle_pool_struct constructor");
+        }
+
+        ~handle_pool_struct()
+        {
+            hipsparseStatus_t status = hipsparseDestroyHandlePool(pool);
+            verify_hipsparse_status_success(status, "ERROR: handle_pool_struct destructor");
+        }
+    };
+
     struct descr_struct
     {
         hipsparseMatDescr_t descr;
@@ -289,6 +305,56 @@ namespace hipsparse_test
         }
     };
 
+    struct csrprecond_struct
+    {
+        csrPrecondInfo_t info;
+        csrprecond_struct()
+        {
+            hipsparseStatus_t status = hipsparseCreateCsrPrecondInfo(&info);
+            verify_hipsparse_status_success(status, "ERROR: csrprecond_struct constructor");
+        }
+
+        ~csrprecond_struct()
+        {
+            hipsparseStatus_t status = hipsparseDestroyCsrPrecondInfo(info);
+            verify_hipsparse_status_success(status, "ERROR: csrprecond_struct destructor");
+        }
+    };
+
+    struct gtsv_block_struct
+    {
+        gtsvBlockInfo_t info;
+        gtsv_block_struct()
+        {
+            hipsparseStatus_t status = hipsparseCreateGtsvBlockInfo(&info);
+            verify_hipsparse_status_success(status, "ERROR: gtsv_block_struct constructor");
+        }
+
+        ~gtsv_block_struct()
+        {
+            hipsparseStatus_t status = hipsparseDestroyGtsvBlockInfo(info);
+            verify_hipsparse_status_success(status, "ERROR: gtsv_block_struct destructor");
+        }
+    };
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
+    struct csrmv_struct
+    {
+        csrmvInfo_t info;
+        csrmv_struct()
+        {
+            hipsparseStatus_t status = hipsparseCreateCsrmvInfo(&info);
+            verify_hipsparse_status_success(status, "ERROR: csrmv_struct constructor");
+        }
+
+        ~csrmv_struct()
+        {
+            hipsparseStatus_t status = hipsparseDestroyCsrmvInfo(info);
+            verify_hipsparse_status_success(status, "ERROR: csrmv_struct destructor");
+        }
+    };
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
     struct spgemm_struct
     {
@@ -307,6 +373,60 @@ namespace hipsparse_test
     };
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+    struct sprap_struct
+    {
+        hipsparseSpRAPDescr_t descr;
+        sprap_struct()
+        {
+            hipsparseStatus_t status = hipsparseSpRAP_createDescr(&descr);
+            verify_hipsparse_status_success(status, "ERROR: sprap_struct constructor");
+        }
+
+        ~sprap_struct()
+        {
+            hipsparseStatus_t status = hipsparseSpRAP_destroyDescr(descr);
+            verify_hipsparse_status_success(status, "ERROR: sprap_struct destructor");
+        }
+    };
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    struct spgs_struct
+    {
+        hipsparseSpGSDescr_t descr;
+        spgs_struct()
+        {
+            hipsparseStatus_t status = hipsparseSpGS_createDescr(&descr);
+            verify_hipsparse_status_success(status, "ERROR: spgs_struct constructor");
+        }
+
+        ~spgs_struct()
+        {
+            hipsparseStatus_t status = hipsparseSpGS_destroyDescr(descr);
+            verify_hipsparse_status_success(status, "ERROR: spgs_struct destructor");
+        }
+    };
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    struct spassemble_struct
+    {
+        hipsparseSpAssembleDescr_t descr;
+        spassemble_struct()
+        {
+            hipsparseStatus_t status = hipsparseSpAssemble_createDescr(&descr);
+            verify_hipsparse_status_success(status, "ERROR: spassemble_struct constructor");
+        }
+
+        ~spassemble_struct()
+        {
+            hipsparseStatus_t status = hipsparseSpAssemble_destroyDescr(descr);
+            verify_hipsparse_status_success(status, "ERROR: spassemble_struct destructor");
+        }
+    };
+#endif
+
 } // namespace hipsparse_test
 
 using hipsparse_unique_ptr = std::unique_ptr<void, void (*)(void*)>;
@@ -281,6 +281,23 @@ void testing_bsric02_bad_arg(void)
         status = hipsparseXbsric02_zeroPivot(handle_null, info, &position);
         verify_hipsparse_status_invalid_handle(status);
     }
+
+    // testing hipsparseXbsric02_trim
+
+    // testing for(nullptr == info)
+    {
+        bsric02Info_t info_null = nullptr;
+
+        status = hipsparseXbsric02_trim(handle, info_null);
+        verify_hipsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        hipsparseHandle_t handle_null = nullptr;
+
+        status = hipsparseXbsric02_trim(handle_null, info);
+        verify_hipsparse_status_invalid_handle(status);
+    }
 }
 
 template <typename T>
@@ -0,0 +1,376 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSR2BLOCKEDELL_HPP
+#define TESTING_CSR2BLOCKEDELL_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <typeinfo>
+#include <vector>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+void testing_csr2blockedell_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+    int               m          = 100;
+    int               n          = 100;
+    int               nnz        = 100;
+    int               block_dim  = 2;
+    int               ell_cols   = 4;
+    int               safe_size  = 100;
+    int               ell_cols_out;
+    size_t            buffer_size;
+    hipsparseStatus_t status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    auto csr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto csr_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto csr_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto ell_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto ell_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto buffer_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+
+    int*  csr_row_ptr = (int*)csr_row_ptr_managed.get();
+    int*  csr_col_ind = (int*)csr_col_ind_managed.get();
+    T*    csr_val     = (T*)csr_val_managed.get();
+    int*  ell_col_ind = (int*)ell_col_ind_managed.get();
+    T*    ell_val     = (T*)ell_val_managed.get();
+    void* buffer      = (void*)buffer_managed.get();
+
+    if(!csr_row_ptr || !csr_col_ind || !csr_val || !ell_col_ind || !ell_val || !buffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Buffer size
+    status = hipsparseXcsr2blockedEll_bufferSize(
+        nullptr, m, n, descr, csr_row_ptr, csr_col_ind, block_dim, &ell_cols_out, &buffer_size);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsr2blockedEll_bufferSize(
+        handle, -1, n, descr, csr_row_ptr, csr_col_ind, block_dim, &ell_cols_out, &buffer_size);
+    verify_hipsparse_status_invalid_size(status, "Error: m is invalid");
+
+    status = hipsparseXcsr2blockedEll_bufferSize(
+        handle, m, n, descr, csr_row_ptr, csr_col_ind, 0, &ell_cols_out, &buffer_size);
+    verify_hipsparse_status_invalid_size(status, "Error: block_dim is invalid");
+
+    status = hipsparseXcsr2blockedEll_bufferSize(
+        handle, m, n, nullptr, csr_row_ptr, csr_col_ind, block_dim, &ell_cols_out, &buffer_size);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+
+    status = hipsparseXcsr2blockedEll_bufferSize(
+        handle, m, n, descr, nullptr, csr_col_ind, block_dim, &ell_cols_out, &buffer_size);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+
+    status = hipsparseXcsr2blockedEll_bufferSize(
+        handle, m, n, descr, csr_row_ptr, csr_col_ind, block_dim, nullptr, &buffer_size);
+    verify_hipsparse_status_invalid_pointer(status, "Error: ell_cols is nullptr");
+
+    status = hipsparseXcsr2blockedEll_bufferSize(
+        handle, m, n, descr, csr_row_ptr, csr_col_ind, block_dim, &ell_cols_out, nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: buffer_size is nullptr");
+
+    // Column indices
+    status = hipsparseXcsr2blockedEllColInd(
+        nullptr, m, n, descr, csr_row_ptr, csr_col_ind, block_dim, ell_cols, ell_col_ind, buffer);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsr2blockedEllColInd(
+        handle, m, n, descr, csr_row_ptr, csr_col_ind, block_dim, 3, ell_col_ind, buffer);
+    verify_hipsparse_status_invalid_size(status, "Error: ell_cols is invalid");
+
+    status = hipsparseXcsr2blockedEllColInd(
+        handle, m, n, nullptr, csr_row_ptr, csr_col_ind, block_dim, ell_cols, ell_col_ind, buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+
+    status = hipsparseXcsr2blockedEllColInd(
+        handle, m, n, descr, csr_row_ptr, csr_col_ind, block_dim, ell_cols, nullptr, buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: ell_col_ind is nullptr");
+
+    status = hipsparseXcsr2blockedEllColInd(
+        handle, m, n, descr, csr_row_ptr, csr_col_ind, block_dim, ell_cols, ell_col_ind, nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: buffer is nullptr");
+
+    // Values
+    status
+        = hipsparseXcsr2blockedEll(nullptr, m, nnz, csr_val, block_dim, ell_cols, ell_val, buffer);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status
+        = hipsparseXcsr2blockedEll(handle, m, -1, csr_val, block_dim, ell_cols, ell_val, buffer);
+    verify_hipsparse_status_invalid_size(status, "Error: nnz is invalid");
+
+    status = hipsparseXcsr2blockedEll(
+        handle, m, nnz, (const T*)nullptr, block_dim, ell_cols, ell_val, buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
+
+    status = hipsparseXcsr2blockedEll(
+        handle, m, nnz, csr_val, block_dim, ell_cols, (T*)nullptr, buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: ell_val is nullptr");
+
+    status
+        = hipsparseXcsr2blockedEll(handle, m, nnz, csr_val, block_dim, ell_cols, ell_val, nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: buffer is nullptr");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t
+    testing_csr2blockedell(int m, int n, int block_dim, hipsparseIndexBase_t idx_base)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+    int ncol = 4;
+
+    T h_alpha = make_DataType<T>(1.0);
+    T h_beta  = make_DataType<T>(0.0);
+
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, idx_base));
+
+    // Random sparsity pattern with a varying number of entries per row
+    std::vector<int> hcsr_row_ptr(m + 1);
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    srand(12345ULL);
+
+    hcsr_row_ptr[0] = idx_base;
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = 0; j < n; ++j)
+        {
+            if(rand() % (1 + i % 8 + 2) == 0)
+            {
+                hcsr_col_ind.push_back(j + idx_base);
+                hcsr_val.push_back(random_generator<T>());
+            }
+        }
+
+        hcsr_row_ptr[i + 1] = (int)hcsr_col_ind.size() + idx_base;
+    }
+
+    int nnz = (int)hcsr_col_ind.size();
+
+    // Dense matrix B and C
+    std::vector<T> hB(n * ncol);
+    std::vector<T> hC(m * ncol, make_DataType<T>(0.0));
+    std::vector<T> hC_gold(m * ncol, make_DataType<T>(0.0));
+
+    for(int i = 0; i < n * ncol; ++i)
+    {
+        hB[i] = random_generator<T>();
+    }
+
+    // Allocate memory on device
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dB_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * n * ncol), device_free};
+    auto dC_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m * ncol), device_free};
+
+    int* dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int* dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    T*   dcsr_val     = (T*)dcsr_val_managed.get();
+    T*   dB           = (T*)dB_managed.get();
+    T*   dC           = (T*)dC_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dB || !dC)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || "
+                                        "!dB || !dC");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * n * ncol, hipMemcpyHostToDevice));
+
+    // Blocked-ELL analysis
+    int    ell_cols;
+    size_t buffer_size;
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsr2blockedEll_bufferSize(handle,
+                                                              m,
+                                                              n,
+                                                              descr,
+                                                              dcsr_row_ptr,
+                                                              dcsr_col_ind,
+                                                              block_dim,
+                                                              &ell_cols,
+                                                              &buffer_size));
+
+    int mb = (m + block_dim - 1) / block_dim;
+
+    auto dell_col_ind_managed = hipsparse_unique_ptr{
+        device_malloc(sizeof(int) * std::max(mb * ell_cols / block_dim, 1)), device_free};
+    auto dell_val_managed = hipsparse_unique_ptr{
+        device_malloc(sizeof(T) * std::max(mb * block_dim * ell_cols, 1)), device_free};
+    auto dbuffer_managed = hipsparse_unique_ptr{device_malloc(buffer_size), device_free};
+
+    int*  dell_col_ind = (int*)dell_col_ind_managed.get();
+    T*    dell_val     = (T*)dell_val_managed.get();
+    void* dbuffer      = (void*)dbuffer_managed.get();
+
+    if(!dell_col_ind || !dell_val || !dbuffer)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dell_col_ind || !dell_val || !dbuffer");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // Blocked-ELL conversion
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsr2blockedEllColInd(handle,
+                                                         m,
+                                                         n,
+                                                         descr,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         block_dim,
+                                                         ell_cols,
+                                                         dell_col_ind,
+                                                         dbuffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsr2blockedEll(
+        handle, m, nnz, dcsr_val, block_dim, ell_cols, dell_val, dbuffer));
+
+    // Multiply the Blocked-ELL matrix with B and compare against the CSR product
+    hipsparseSpMatDescr_t A;
+    hipsparseDnMatDescr_t B, C;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateBlockedEll(&A,
+                                                    mb * block_dim,
+                                                    n,
+                                                    block_dim,
+                                                    ell_cols,
+                                                    dell_col_ind,
+                                                    dell_val,
+                                                    HIPSPARSE_INDEX_32I,
+                                                    idx_base,
+                                                    typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, n, ncol, n, dB, typeT, HIPSPARSE_ORDER_COLUMN));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(
+        &C, mb * block_dim, ncol, mb * block_dim, dC, typeT, HIPSPARSE_ORDER_COLUMN));
+
+    size_t spmm_buffer_size;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_bufferSize(handle,
+                                                   HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                   HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                   &h_alpha,
+                                                   A,
+                                                   B,
+                                                   &h_beta,
+                                                   C,
+                                                   typeT,
+                                                   HIPSPARSE_SPMM_BLOCKED_ELL_ALG1,
+                                                   &spmm_buffer_size));
+
+    void* spmm_buffer;
+    CHECK_HIP_ERROR(hipMalloc(&spmm_buffer, spmm_buffer_size));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM(handle,
+                                        HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                        HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                        &h_alpha,
+                                        A,
+                                        B,
+                                        &h_beta,
+                                        C,
+                                        typeT,
+                                        HIPSPARSE_SPMM_BLOCKED_ELL_ALG1,
+                                        spmm_buffer));
+
+    // Copy output from device to host, skipping padded rows
+    for(int j = 0; j < ncol; ++j)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(hC.data() + j * m,
+                                  dC + j * mb * block_dim,
+                                  sizeof(T) * m,
+                                  hipMemcpyDeviceToHost));
+    }
+
+    // CPU
+    host_csrmm(m,
+               ncol,
+               n,
+               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+               h_alpha,
+               hcsr_row_ptr.data(),
+               hcsr_col_ind.data(),
+               hcsr_val.data(),
+               hB.data(),
+               n,
+               h_beta,
+               hC_gold.data(),
+               m,
+               HIPSPARSE_ORDER_COLUMN,
+               idx_base);
+
+    unit_check_near(1, m * ncol, 1, hC_gold.data(), hC.data());
+
+    CHECK_HIP_ERROR(hipFree(spmm_buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSR2BLOCKEDELL_HPP
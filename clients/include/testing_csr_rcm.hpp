@@ -0,0 +1,387 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+
+#pragma once
+#ifndef TESTING_CSR_RCM_HPP
+#define TESTING_CSR_RCM_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hipsparse.h>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_csr_rcm_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcsr_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcsr_val_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dperm_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+
+    int*   dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int*   dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    float* dcsr_val     = (float*)dcsr_val_managed.get();
+    int*   dperm        = (int*)dperm_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dperm)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // A and the rectangular R share the same arrays, since only the arguments are checked
+    hipsparseSpMatDescr_t A;
+    hipsparseSpMatDescr_t R;
+    verify_hipsparse_status_success(hipsparseCreateCsr(&A,
+                                                       n,
+                                                       n,
+                                                       nnz,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       dcsr_val,
+                                                       idxType,
+                                                       idxType,
+                                                       idxBase,
+                                                       dataType),
+                                    "success");
+    verify_hipsparse_status_success(hipsparseCreateCsr(&R,
+                                                       n,
+                                                       n - 1,
+                                                       nnz,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       dcsr_val,
+                                                       idxType,
+                                                       idxType,
+                                                       idxBase,
+                                                       dataType),
+                                    "success");
+
+    // Ordering
+    verify_hipsparse_status_invalid_handle(hipsparseCsrRcm(nullptr, A, dperm));
+    verify_hipsparse_status_invalid_pointer(hipsparseCsrRcm(handle, nullptr, dperm),
+                                            "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCsrRcm(handle, A, nullptr),
+                                            "Error: perm is nullptr");
+    verify_hipsparse_status_invalid_size(hipsparseCsrRcm(handle, R, dperm),
+                                         "Error: A is not square");
+
+    // Permutation
+    verify_hipsparse_status_invalid_handle(hipsparseCsrPermute(nullptr, A, dperm, A));
+    verify_hipsparse_status_invalid_pointer(hipsparseCsrPermute(handle, nullptr, dperm, A),
+                                            "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCsrPermute(handle, A, nullptr, A),
+                                            "Error: perm is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCsrPermute(handle, A, dperm, nullptr),
+                                            "Error: B is nullptr");
+    verify_hipsparse_status_invalid_size(hipsparseCsrPermute(handle, R, dperm, R),
+                                         "Error: A is not square");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(R), "success");
+#endif
+}
+
+// Largest distance of a non-zero entry from the diagonal
+inline int csr_bandwidth(const std::vector<int>& row_ptr,
+                         const std::vector<int>& col_ind,
+                         hipsparseIndexBase_t    idx_base)
+{
+    int bandwidth = 0;
+
+    for(size_t i = 0; i + 1 < row_ptr.size(); ++i)
+    {
+        for(int j = row_ptr[i] - idx_base; j < row_ptr[i + 1] - idx_base; ++j)
+        {
+            bandwidth = std::max(bandwidth, std::abs(col_ind[j] - idx_base - (int)i));
+        }
+    }
+
+    return bandwidth;
+}
+
+template <typename T>
+hipsparseStatus_t testing_csr_rcm(int ndim, hipsparseIndexBase_t idxBase)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    hipsparseIndexType_t typeI = HIPSPARSE_INDEX_32I;
+
+    // Data type
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    std::vector<int> hcsr_row_ptr_L;
+    std::vector<int> hcsr_col_ind_L;
+    std::vector<T>   hcsr_val_L;
+
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr_L, hcsr_col_ind_L, hcsr_val_L, idxBase);
+    int nnz = hcsr_row_ptr_L[m] - idxBase;
+
+    // Scramble the natural ordering of the Laplacian with a random symmetric permutation,
+    // which destroys its banded structure
+    std::vector<int> hshuffle(m);
+
+    for(int i = 0; i < m; ++i)
+    {
+        hshuffle[i] = i;
+    }
+
+    for(int i = m - 1; i > 0; --i)
+    {
+        std::swap(hshuffle[i], hshuffle[rand() % (i + 1)]);
+    }
+
+    std::vector<int> hinv_shuffle(m);
+
+    for(int i = 0; i < m; ++i)
+    {
+        hinv_shuffle[hshuffle[i]] = i;
+    }
+
+    std::vector<int> hcsr_row_ptr_A(m + 1);
+    std::vector<int> hcsr_col_ind_A(nnz);
+    std::vector<T>   hcsr_val_A(nnz);
+
+    hcsr_row_ptr_A[0] = idxBase;
+
+    for(int i = 0; i < m; ++i)
+    {
+        int row_begin = hcsr_row_ptr_L[hshuffle[i]] - idxBase;
+        int row_end   = hcsr_row_ptr_L[hshuffle[i] + 1] - idxBase;
+        int offset    = hcsr_row_ptr_A[i] - idxBase;
+
+        for(int j = row_begin; j < row_end; ++j)
+        {
+            hcsr_col_ind_A[offset + j - row_begin]
+                = hinv_shuffle[hcsr_col_ind_L[j] - idxBase] + idxBase;
+            hcsr_val_A[offset + j - row_begin] = random_generator<T>();
+        }
+
+        hcsr_row_ptr_A[i + 1] = hcsr_row_ptr_A[i] + row_end - row_begin;
+    }
+
+    std::vector<T> hx(m);
+    hipsparseInit<T>(hx, 1, m);
+
+    // allocate memory on device
+    auto dcsr_row_ptr_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsr_row_ptr_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_B_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dperm_managed      = hipsparse_unique_ptr{device_malloc(sizeof(int) * m), device_free};
+    auto dx_managed         = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dxp_managed        = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dz_managed         = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    int* dcsr_row_ptr_A = (int*)dcsr_row_ptr_A_managed.get();
+    int* dcsr_col_ind_A = (int*)dcsr_col_ind_A_managed.get();
+    T*   dcsr_val_A     = (T*)dcsr_val_A_managed.get();
+    int* dcsr_row_ptr_B = (int*)dcsr_row_ptr_B_managed.get();
+    int* dcsr_col_ind_B = (int*)dcsr_col_ind_B_managed.get();
+    T*   dcsr_val_B     = (T*)dcsr_val_B_managed.get();
+    int* dperm          = (int*)dperm_managed.get();
+    T*   dx             = (T*)dx_managed.get();
+    T*   dxp            = (T*)dxp_managed.get();
+    T*   dz             = (T*)dz_managed.get();
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_B || !dcsr_col_ind_B
+       || !dcsr_val_B || !dperm || !dx || !dxp || !dz)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || "
+                                        "!dcsr_row_ptr_B || !dcsr_col_ind_B || !dcsr_val_B || "
+                                        "!dperm || !dx || !dxp || !dz");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_A, hcsr_val_A.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dz, 0, sizeof(T) * m));
+
+    hipsparseSpMatDescr_t A, B;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &A, m, m, nnz, dcsr_row_ptr_A, dcsr_col_ind_A, dcsr_val_A, typeI, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &B, m, m, nnz, dcsr_row_ptr_B, dcsr_col_ind_B, dcsr_val_B, typeI, typeI, idxBase, typeT));
+
+    // Reverse Cuthill-McKee ordering and symmetric permutation of A
+    CHECK_HIPSPARSE_ERROR(hipsparseCsrRcm(handle, A, dperm));
+    CHECK_HIPSPARSE_ERROR(hipsparseCsrPermute(handle, A, dperm, B));
+
+    // Permute x into the new ordering and back again, using perm as indices
+    hipsparseDnVecDescr_t x, z;
+    hipsparseSpVecDescr_t xp;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&z, m, dz, typeT));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateSpVec(&xp, m, m, dperm, dxp, typeI, HIPSPARSE_INDEX_BASE_ZERO, typeT));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseGather(handle, x, xp));
+    CHECK_HIPSPARSE_ERROR(hipsparseScatter(handle, xp, z));
+
+    // Copy output from device to CPU
+    std::vector<int> hperm(m);
+    std::vector<int> hcsr_row_ptr_B(m + 1);
+    std::vector<int> hcsr_col_ind_B(nnz);
+    std::vector<T>   hcsr_val_B(nnz);
+    std::vector<T>   hxp(m);
+    std::vector<T>   hz(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hperm.data(), dperm, sizeof(int) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_row_ptr_B.data(), dcsr_row_ptr_B, sizeof(int) * (m + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_col_ind_B.data(), dcsr_col_ind_B, sizeof(int) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_B.data(), dcsr_val_B, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hxp.data(), dxp, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hz.data(), dz, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    // perm has to be a permutation
+    std::vector<int> hinv_perm(m, -1);
+
+    for(int i = 0; i < m; ++i)
+    {
+        if(hperm[i] < 0 || hperm[i] >= m || hinv_perm[hperm[i]] != -1)
+        {
+            verify_hipsparse_status_success(HIPSPARSE_STATUS_INTERNAL_ERROR,
+                                            "perm is not a permutation");
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+
+        hinv_perm[hperm[i]] = i;
+    }
+
+    // Host symmetric permutation, with sorted column indices
+    std::vector<int> hcsr_row_ptr_B_gold(m + 1);
+    std::vector<int> hcsr_col_ind_B_gold(nnz);
+    std::vector<T>   hcsr_val_B_gold(nnz);
+
+    hcsr_row_ptr_B_gold[0] = idxBase;
+
+    for(int i = 0; i < m; ++i)
+    {
+        int row_begin = hcsr_row_ptr_A[hperm[i]] - idxBase;
+        int row_end   = hcsr_row_ptr_A[hperm[i] + 1] - idxBase;
+        int offset    = hcsr_row_ptr_B_gold[i] - idxBase;
+
+        // Insertion sort by permuted column index
+        for(int j = row_begin; j < row_end; ++j)
+        {
+            int col = hinv_perm[hcsr_col_ind_A[j] - idxBase] + idxBase;
+            int k   = offset + j - row_begin;
+
+            while(k > offset && hcsr_col_ind_B_gold[k - 1] > col)
+            {
+                hcsr_col_ind_B_gold[k] = hcsr_col_ind_B_gold[k - 1];
+                hcsr_val_B_gold[k]     = hcsr_val_B_gold[k - 1];
+                --k;
+            }
+
+            hcsr_col_ind_B_gold[k] = col;
+            hcsr_val_B_gold[k]     = hcsr_val_A[j];
+        }
+
+        hcsr_row_ptr_B_gold[i + 1] = hcsr_row_ptr_B_gold[i] + row_end - row_begin;
+    }
+
+    std::vector<T> hxp_gold(m);
+
+    for(int i = 0; i < m; ++i)
+    {
+        hxp_gold[i] = hx[hperm[i]];
+    }
+
+    unit_check_general(1, m + 1, 1, hcsr_row_ptr_B_gold.data(), hcsr_row_ptr_B.data());
+    unit_check_general(1, nnz, 1, hcsr_col_ind_B_gold.data(), hcsr_col_ind_B.data());
+    unit_check_general(1, nnz, 1, hcsr_val_B_gold.data(), hcsr_val_B.data());
+    unit_check_general(1, m, 1, hxp_gold.data(), hxp.data());
+    unit_check_general(1, m, 1, hx.data(), hz.data());
+
+    // The level sets of the Laplacian started from a corner are its anti-diagonals, thus
+    // the reordered matrix has a bandwidth of at most 2 * ndim, regardless of the scrambling
+    int bandwidth = csr_bandwidth(hcsr_row_ptr_B, hcsr_col_ind_B, idxBase);
+
+    if(bandwidth > 2 * ndim)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_INTERNAL_ERROR,
+                                        "bandwidth of the reordered matrix is too large");
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(z));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpVec(xp));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSR_RCM_HPP
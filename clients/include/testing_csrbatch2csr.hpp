@@ -0,0 +1,342 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRBATCH2CSR_HPP
+#define TESTING_CSRBATCH2CSR_HPP
+
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <limits>
+#include <vector>
+
+using namespace hipsparse_test;
+
+void testing_csrbatch2csr_bad_arg(void)
+{
+    int               batch_count = 2;
+    int               m[]         = {10, 20};
+    int               n[]         = {10, 20};
+    int               nnz[]       = {10, 20};
+    int               safe_size   = 100;
+    hipsparseStatus_t status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto csr_row_ptr_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto csr_col_ind_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto csr_row_ptr_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto csr_col_ind_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+
+    int* csr_row_ptr_A = (int*)csr_row_ptr_A_managed.get();
+    int* csr_col_ind_A = (int*)csr_col_ind_A_managed.get();
+    int* csr_row_ptr_C = (int*)csr_row_ptr_C_managed.get();
+    int* csr_col_ind_C = (int*)csr_col_ind_C_managed.get();
+
+    if(!csr_row_ptr_A || !csr_col_ind_A || !csr_row_ptr_C || !csr_col_ind_C)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    status = hipsparseXcsrbatch2csr(nullptr,
+                                    batch_count,
+                                    m,
+                                    n,
+                                    nnz,
+                                    HIPSPARSE_INDEX_BASE_ZERO,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsrbatch2csr(handle,
+                                    -1,
+                                    m,
+                                    n,
+                                    nnz,
+                                    HIPSPARSE_INDEX_BASE_ZERO,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+    verify_hipsparse_status_invalid_size(status, "Error: batch_count is invalid");
+
+    status = hipsparseXcsrbatch2csr(handle,
+                                    batch_count,
+                                    nullptr,
+                                    n,
+                                    nnz,
+                                    HIPSPARSE_INDEX_BASE_ZERO,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+    verify_hipsparse_status_invalid_pointer(status, "Error: m is nullptr");
+
+    status = hipsparseXcsrbatch2csr(handle,
+                                    batch_count,
+                                    m,
+                                    n,
+                                    nnz,
+                                    HIPSPARSE_INDEX_BASE_ZERO,
+                                    nullptr,
+                                    csr_col_ind_A,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csr_row_ptr_A is nullptr");
+
+    status = hipsparseXcsrbatch2csr(handle,
+                                    batch_count,
+                                    m,
+                                    n,
+                                    nnz,
+                                    HIPSPARSE_INDEX_BASE_ZERO,
+                                    csr_row_ptr_A,
+                                    nullptr,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csr_col_ind_A is nullptr");
+
+    status = hipsparseXcsrbatch2csr(handle,
+                                    batch_count,
+                                    m,
+                                    n,
+                                    nnz,
+                                    HIPSPARSE_INDEX_BASE_ZERO,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    nullptr,
+                                    csr_col_ind_C);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csr_row_ptr_C is nullptr");
+
+    status = hipsparseXcsrbatch2csr(handle,
+                                    batch_count,
+                                    m,
+                                    n,
+                                    nnz,
+                                    HIPSPARSE_INDEX_BASE_ZERO,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    csr_row_ptr_C,
+                                    nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csr_col_ind_C is nullptr");
+
+    // Total number of columns exceeds the 32 bit index range
+    int n_large[] = {std::numeric_limits<int>::max(), 20};
+
+    status = hipsparseXcsrbatch2csr(handle,
+                                    batch_count,
+                                    m,
+                                    n_large,
+                                    nnz,
+                                    HIPSPARSE_INDEX_BASE_ZERO,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+    verify_hipsparse_status_invalid_value(status, "Error: total number of columns is invalid");
+
+    // Column index of the second matrix exceeds its declared number of columns
+    int              m_small[]   = {1, 1};
+    int              n_small[]   = {1, 1};
+    int              nnz_small[] = {1, 1};
+    std::vector<int> hcsr_row_ptr_small = {0, 1, 0, 1};
+    std::vector<int> hcsr_col_ind_small = {0, 1};
+
+    CHECK_HIP_ERROR(hipMemcpy(csr_row_ptr_A,
+                              hcsr_row_ptr_small.data(),
+                              sizeof(int) * hcsr_row_ptr_small.size(),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(csr_col_ind_A,
+                              hcsr_col_ind_small.data(),
+                              sizeof(int) * hcsr_col_ind_small.size(),
+                              hipMemcpyHostToDevice));
+
+    status = hipsparseXcsrbatch2csr(handle,
+                                    batch_count,
+                                    m_small,
+                                    n_small,
+                                    nnz_small,
+                                    HIPSPARSE_INDEX_BASE_ZERO,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+    verify_hipsparse_status_invalid_value(status, "Error: column index exceeds n");
+}
+
+hipsparseStatus_t testing_csrbatch2csr(int batch_count, hipsparseIndexBase_t idx_base)
+{
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Batch of small matrices of varying size, stored contiguously
+    std::vector<int> hm(batch_count);
+    std::vector<int> hn(batch_count);
+    std::vector<int> hnnz(batch_count);
+
+    std::vector<int> hcsr_row_ptr_A;
+    std::vector<int> hcsr_col_ind_A;
+
+    srand(12345ULL);
+    for(int i = 0; i < batch_count; ++i)
+    {
+        int m = 1 + rand() % 64;
+        int n = 1 + rand() % 64;
+
+        // Roughly 20% of the entries of each matrix are non-zero
+        hcsr_row_ptr_A.push_back(idx_base);
+
+        int nnz = 0;
+        for(int r = 0; r < m; ++r)
+        {
+            for(int c = 0; c < n; ++c)
+            {
+                if(rand() % 5 == 0 || (r == 0 && c == 0))
+                {
+                    hcsr_col_ind_A.push_back(c + idx_base);
+                    ++nnz;
+                }
+            }
+
+            hcsr_row_ptr_A.push_back(nnz + idx_base);
+        }
+
+        hm[i]   = m;
+        hn[i]   = n;
+        hnnz[i] = nnz;
+    }
+
+    int total_m   = 0;
+    int total_nnz = 0;
+    for(int i = 0; i < batch_count; ++i)
+    {
+        total_m += hm[i];
+        total_nnz += hnnz[i];
+    }
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * hcsr_row_ptr_A.size()), device_free};
+    auto dcsr_col_ind_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * total_nnz), device_free};
+    auto dcsr_row_ptr_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (total_m + 1)), device_free};
+    auto dcsr_col_ind_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * total_nnz), device_free};
+
+    int* dcsr_row_ptr_A = (int*)dcsr_row_ptr_A_managed.get();
+    int* dcsr_col_ind_A = (int*)dcsr_col_ind_A_managed.get();
+    int* dcsr_row_ptr_C = (int*)dcsr_row_ptr_C_managed.get();
+    int* dcsr_col_ind_C = (int*)dcsr_col_ind_C_managed.get();
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_row_ptr_C || !dcsr_col_ind_C)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_row_ptr_A || !dcsr_col_ind_A || "
+                                        "!dcsr_row_ptr_C || !dcsr_col_ind_C");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_A,
+                              hcsr_row_ptr_A.data(),
+                              sizeof(int) * hcsr_row_ptr_A.size(),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_A,
+                              hcsr_col_ind_A.data(),
+                              sizeof(int) * total_nnz,
+                              hipMemcpyHostToDevice));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrbatch2csr(handle,
+                                                 batch_count,
+                                                 hm.data(),
+                                                 hn.data(),
+                                                 hnnz.data(),
+                                                 idx_base,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 dcsr_row_ptr_C,
+                                                 dcsr_col_ind_C));
+
+    // Copy output from device to host
+    std::vector<int> hcsr_row_ptr_C(total_m + 1);
+    std::vector<int> hcsr_col_ind_C(total_nnz);
+
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C.data(),
+                              dcsr_row_ptr_C,
+                              sizeof(int) * (total_m + 1),
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C.data(),
+                              dcsr_col_ind_C,
+                              sizeof(int) * total_nnz,
+                              hipMemcpyDeviceToHost));
+
+    // CPU block diagonal assembly
+    std::vector<int> hcsr_row_ptr_gold(total_m + 1);
+    std::vector<int> hcsr_col_ind_gold(total_nnz);
+
+    int row_offset = 0;
+    int col_offset = 0;
+    int nnz_offset = 0;
+    int ptr_offset = 0;
+
+    for(int i = 0; i < batch_count; ++i)
+    {
+        for(int j = 0; j < hm[i]; ++j)
+        {
+            hcsr_row_ptr_gold[row_offset + j] = hcsr_row_ptr_A[ptr_offset + j] + nnz_offset;
+        }
+
+        for(int j = 0; j < hnnz[i]; ++j)
+        {
+            hcsr_col_ind_gold[nnz_offset + j] = hcsr_col_ind_A[nnz_offset + j] + col_offset;
+        }
+
+        ptr_offset += hm[i] + 1;
+        row_offset += hm[i];
+        col_offset += hn[i];
+        nnz_offset += hnnz[i];
+    }
+
+    hcsr_row_ptr_gold[total_m] = total_nnz + idx_base;
+
+    // Unit check
+    unit_check_general(1, total_m + 1, 1, hcsr_row_ptr_gold.data(), hcsr_row_ptr_C.data());
+    unit_check_general(1, total_nnz, 1, hcsr_col_ind_gold.data(), hcsr_col_ind_C.data());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSRBATCH2CSR_HPP
@@ -1276,4 +1276,273 @@ hipsparseStatus_t testing_csrgeam2(Arguments argus)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+template <typename T>
+hipsparseStatus_t testing_csrgeam2_same_pattern(int ndim, hipsparseIndexBase_t idx_base)
+{
+    T h_alpha = make_DataType<T>(2.0);
+    T h_beta  = make_DataType<T>(-0.5);
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr_A(new descr_struct);
+    hipsparseMatDescr_t           descr_A = test_descr_A->descr;
+
+    std::unique_ptr<descr_struct> test_descr_B(new descr_struct);
+    hipsparseMatDescr_t           descr_B = test_descr_B->descr;
+
+    std::unique_ptr<descr_struct> test_descr_C(new descr_struct);
+    hipsparseMatDescr_t           descr_C = test_descr_C->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_A, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_B, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_C, idx_base));
+
+    // A is a 2D laplacian, B shares its pattern with different values
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val_A;
+
+    srand(12345ULL);
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val_A, idx_base);
+    int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hcsr_val_B(nnz);
+    for(int i = 0; i < nnz; ++i)
+    {
+        hcsr_val_B[i] = random_generator<T>();
+    }
+
+    // Allocate memory on device
+    auto dptr_managed   = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed   = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dAval_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dBval_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dCptr_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dCcol_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dCval_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dalpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto dbeta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto dnnz_C_managed = hipsparse_unique_ptr{device_malloc(sizeof(int)), device_free};
+
+    int* dptr   = (int*)dptr_managed.get();
+    int* dcol   = (int*)dcol_managed.get();
+    T*   dAval  = (T*)dAval_managed.get();
+    T*   dBval  = (T*)dBval_managed.get();
+    int* dCptr  = (int*)dCptr_managed.get();
+    int* dCcol  = (int*)dCcol_managed.get();
+    T*   dCval  = (T*)dCval_managed.get();
+    T*   dalpha = (T*)dalpha_managed.get();
+    T*   dbeta  = (T*)dbeta_managed.get();
+    int* dnnz_C = (int*)dnnz_C_managed.get();
+
+    if(!dptr || !dcol || !dAval || !dBval || !dCptr || !dCcol || !dCval || !dalpha || !dbeta
+       || !dnnz_C)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dptr || !dcol || !dAval || !dBval || "
+                                        "!dCptr || !dCcol || !dCval || "
+                                        "!dalpha || !dbeta || !dnnz_C");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAval, hcsr_val_A.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBval, hcsr_val_B.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // A laplacian has all properties
+    int properties      = 0;
+    int properties_gold = HIPSPARSE_MAT_PROPERTY_SORTED | HIPSPARSE_MAT_PROPERTY_UNIQUE
+                          | HIPSPARSE_MAT_PROPERTY_SYMMETRIC_PATTERN
+                          | HIPSPARSE_MAT_PROPERTY_FULL_DIAGONAL;
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseXcsrCheckProperties(handle, m, m, nnz, descr_A, dptr, dcol, &properties));
+    unit_check_general(1, 1, 1, &properties_gold, &properties);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatProperties(descr_A, properties));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatProperties(descr_B, properties));
+
+    properties = hipsparseGetMatProperties(descr_A);
+    unit_check_general(1, 1, 1, &properties_gold, &properties);
+
+    // Tag A and B with an id of their common pattern
+    uint64_t pattern_id = 42;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatPatternId(descr_A, pattern_id));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatPatternId(descr_B, pattern_id));
+
+    uint64_t pattern_id_A = hipsparseGetMatPatternId(descr_A);
+    uint64_t pattern_id_B = hipsparseGetMatPatternId(descr_B);
+    unit_check_general(1, 1, 1, &pattern_id, &pattern_id_A);
+    unit_check_general(1, 1, 1, &pattern_id, &pattern_id_B);
+
+    // Host reference, C has the pattern of A
+    std::vector<T> hcsr_val_C_gold(nnz);
+    for(int i = 0; i < nnz; ++i)
+    {
+        hcsr_val_C_gold[i] = testing_fma(h_alpha, hcsr_val_A[i], h_beta * hcsr_val_B[i]);
+    }
+
+    size_t size;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrgeam2_bufferSizeExt(handle,
+                                                           m,
+                                                           m,
+                                                           &h_alpha,
+                                                           descr_A,
+                                                           nnz,
+                                                           dAval,
+                                                           dptr,
+                                                           dcol,
+                                                           &h_beta,
+                                                           descr_B,
+                                                           nnz,
+                                                           dBval,
+                                                           dptr,
+                                                           dcol,
+                                                           descr_C,
+                                                           dCval,
+                                                           dCptr,
+                                                           dCcol,
+                                                           &size));
+
+    auto dbuffer_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED, "!dbuffer");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    for(int pass = 0; pass < 2; ++pass)
+    {
+        hipsparsePointerMode_t mode
+            = (pass == 0) ? HIPSPARSE_POINTER_MODE_HOST : HIPSPARSE_POINTER_MODE_DEVICE;
+
+        CHECK_HIP_ERROR(hipMemset(dCptr, 0, sizeof(int) * (m + 1)));
+        CHECK_HIP_ERROR(hipMemset(dCcol, 0, sizeof(int) * nnz));
+        CHECK_HIP_ERROR(hipMemset(dCval, 0, sizeof(T) * nnz));
+
+        int hnnz_C = -1;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsrgeam2Nnz(handle,
+                                                    m,
+                                                    m,
+                                                    descr_A,
+                                                    nnz,
+                                                    dptr,
+                                                    dcol,
+                                                    descr_B,
+                                                    nnz,
+                                                    dptr,
+                                                    dcol,
+                                                    descr_C,
+                                                    dCptr,
+                                                    (pass == 0) ? &hnnz_C : dnnz_C,
+                                                    dbuffer));
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsrgeam2(handle,
+                                                 m,
+                                                 m,
+                                                 (pass == 0) ? &h_alpha : dalpha,
+                                                 descr_A,
+                                                 nnz,
+                                                 dAval,
+                                                 dptr,
+                                                 dcol,
+                                                 (pass == 0) ? &h_beta : dbeta,
+                                                 descr_B,
+                                                 nnz,
+                                                 dBval,
+                                                 dptr,
+                                                 dcol,
+                                                 descr_C,
+                                                 dCval,
+                                                 dCptr,
+                                                 dCcol,
+                                                 dbuffer));
+
+        if(pass == 1)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(&hnnz_C, dnnz_C, sizeof(int), hipMemcpyDeviceToHost));
+        }
+
+        std::vector<int> hcsr_row_ptr_C(m + 1);
+        std::vector<int> hcsr_col_ind_C(nnz);
+        std::vector<T>   hcsr_val_C(nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_row_ptr_C.data(), dCptr, sizeof(int) * (m + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_col_ind_C.data(), dCcol, sizeof(int) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C.data(), dCval, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        unit_check_general(1, 1, 1, &nnz, &hnnz_C);
+        unit_check_general(1, m + 1, 1, hcsr_row_ptr.data(), hcsr_row_ptr_C.data());
+        unit_check_general(1, nnz, 1, hcsr_col_ind.data(), hcsr_col_ind_C.data());
+        unit_check_near(1, nnz, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
+    }
+
+    // In place update A = alpha * A + beta * B, where C aliases A
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrgeam2(handle,
+                                             m,
+                                             m,
+                                             &h_alpha,
+                                             descr_A,
+                                             nnz,
+                                             dAval,
+                                             dptr,
+                                             dcol,
+                                             &h_beta,
+                                             descr_B,
+                                             nnz,
+                                             dBval,
+                                             dptr,
+                                             dcol,
+                                             descr_A,
+                                             dAval,
+                                             dptr,
+                                             dcol,
+                                             dbuffer));
+
+    std::vector<T> hcsr_val_A_inplace(nnz);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_A_inplace.data(), dAval, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    unit_check_near(1, nnz, 1, hcsr_val_C_gold.data(), hcsr_val_A_inplace.data());
+
+    // The values of C must not alias those of both A and B
+    verify_hipsparse_status_invalid_value(hipsparseXcsrgeam2(handle,
+                                                             m,
+                                                             m,
+                                                             &h_alpha,
+                                                             descr_A,
+                                                             nnz,
+                                                             dAval,
+                                                             dptr,
+                                                             dcol,
+                                                             &h_beta,
+                                                             descr_B,
+                                                             nnz,
+                                                             dAval,
+                                                             dptr,
+                                                             dcol,
+                                                             descr_C,
+                                                             dAval,
+                                                             dCptr,
+                                                             dCcol,
+                                                             dbuffer),
+                                          "Error: C aliases A and B");
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 #endif // TESTING_CSRGEAM2_HPP
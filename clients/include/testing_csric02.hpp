@@ -278,6 +278,23 @@ void testing_csric02_bad_arg(void)
         status = hipsparseXcsric02_zeroPivot(handle_null, info, &position);
         verify_hipsparse_status_invalid_handle(status);
     }
+
+    // testing hipsparseXcsric02_trim
+
+    // testing for(nullptr == info)
+    {
+        csric02Info_t info_null = nullptr;
+
+        status = hipsparseXcsric02_trim(handle, info_null);
+        verify_hipsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        hipsparseHandle_t handle_null = nullptr;
+
+        status = hipsparseXcsric02_trim(handle_null, info);
+        verify_hipsparse_status_invalid_handle(status);
+    }
 }
 
 template <typename T>
@@ -599,6 +616,105 @@ hipsparseStatus_t testing_csric02(Arguments argus)
         {
             unit_check_near(1, nnz, 1, hcsr_val.data(), result_1.data());
             unit_check_near(1, nnz, 1, hcsr_val.data(), result_2.data());
+
+            // Apply the preconditioner, both triangular solves in a single call
+            std::unique_ptr<csrprecond_struct> unique_ptr_csrprecond(new csrprecond_struct);
+            csrPrecondInfo_t                   info_P = unique_ptr_csrprecond->info;
+
+            int size_apply;
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsric02Apply_bufferSize(
+                handle, m, nnz, descr, dval_1, dptr, dcol, info, info_P, &size_apply));
+
+            auto dbuffer_apply_managed
+                = hipsparse_unique_ptr{device_malloc(sizeof(char) * size_apply), device_free};
+            auto dx_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+            auto dy_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+            void* dbuffer_apply = (void*)dbuffer_apply_managed.get();
+            T*    dx            = (T*)dx_managed.get();
+            T*    dy            = (T*)dy_managed.get();
+
+            if(!dbuffer_apply || !dx || !dy)
+            {
+                verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                                "!dbuffer_apply || !dx || !dy");
+                return HIPSPARSE_STATUS_ALLOC_FAILED;
+            }
+
+            T              h_alpha = make_DataType<T>(2.0);
+            std::vector<T> hx(m);
+            std::vector<T> hy(m);
+            hipsparseInit<T>(hx, 1, m);
+
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsric02Apply_analysis(
+                handle, m, nnz, descr, dval_1, dptr, dcol, info, info_P, policy, dbuffer_apply));
+
+            // The factorization analysis is not needed by the preconditioner apply
+#ifndef __HIP_PLATFORM_NVIDIA__
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsric02_trim(handle, info));
+#else
+            // cuSPARSE keeps the factorization analysis until the info is destroyed
+            verify_hipsparse_status_not_supported(hipsparseXcsric02_trim(handle, info),
+                                                  "Error: trim is not supported");
+#endif
+
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsric02Apply(handle,
+                                                         m,
+                                                         nnz,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dval_1,
+                                                         dptr,
+                                                         dcol,
+                                                         info,
+                                                         info_P,
+                                                         dx,
+                                                         dy,
+                                                         policy,
+                                                         dbuffer_apply));
+
+            CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+            // Host L * L^H solve, where the transposed solve works on the conjugated factor
+            hipDeviceProp_t prop;
+            hipGetDeviceProperties(&prop, 0);
+
+            std::vector<T> hz_gold(m);
+            std::vector<T> hy_gold(m);
+            std::vector<T> hcsr_val_conj(nnz);
+
+            for(int i = 0; i < nnz; ++i)
+            {
+                hcsr_val_conj[i] = testing_conj(hcsr_val[i]);
+            }
+
+            csr_lsolve(HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                       m,
+                       hcsr_row_ptr.data(),
+                       hcsr_col_ind.data(),
+                       hcsr_val.data(),
+                       h_alpha,
+                       hx.data(),
+                       hz_gold.data(),
+                       idx_base,
+                       HIPSPARSE_DIAG_TYPE_NON_UNIT,
+                       prop.warpSize);
+            csr_usolve(HIPSPARSE_OPERATION_TRANSPOSE,
+                       m,
+                       hcsr_row_ptr.data(),
+                       hcsr_col_ind.data(),
+                       hcsr_val_conj.data(),
+                       make_DataType<T>(1.0),
+                       hz_gold.data(),
+                       hy_gold.data(),
+                       idx_base,
+                       HIPSPARSE_DIAG_TYPE_NON_UNIT,
+                       prop.warpSize);
+
+            unit_check_near(1, m, 1, hy_gold.data(), hy.data());
         }
     }
 
@@ -481,6 +481,86 @@ hipsparseStatus_t testing_csrilusv(Arguments argus)
     unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
     unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
 
+    // Apply the preconditioner, both triangular solves in a single call
+    std::unique_ptr<csrprecond_struct> test_csrprecond(new csrprecond_struct);
+    csrPrecondInfo_t                   info_P = test_csrprecond->info;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrilu02Apply_bufferSize(
+        handle, m, nnz, descr_M, dval, dptr, dcol, info_M, info_P, &size));
+
+    auto dbuffer_apply_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer_apply = (void*)dbuffer_apply_managed.get();
+
+    if(!dbuffer_apply)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED, "!dbuffer_apply");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrilu02Apply_analysis(handle,
+                                                           m,
+                                                           nnz,
+                                                           descr_M,
+                                                           dval,
+                                                           dptr,
+                                                           dcol,
+                                                           info_M,
+                                                           info_P,
+                                                           HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                                           dbuffer_apply));
+
+    // The factorization analysis is not needed by the preconditioner apply
+#ifndef __HIP_PLATFORM_NVIDIA__
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrilu02_trim(handle, info_M));
+#else
+    // cuSPARSE keeps the factorization analysis until the info is destroyed
+    verify_hipsparse_status_not_supported(hipsparseXcsrilu02_trim(handle, info_M),
+                                          "Error: trim is not supported");
+#endif
+
+    // host pointer mode
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrilu02Apply(handle,
+                                                  m,
+                                                  nnz,
+                                                  &h_alpha,
+                                                  descr_M,
+                                                  dval,
+                                                  dptr,
+                                                  dcol,
+                                                  info_M,
+                                                  info_P,
+                                                  dx,
+                                                  dy_1,
+                                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                                  dbuffer_apply));
+
+    // device pointer mode
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrilu02Apply(handle,
+                                                  m,
+                                                  nnz,
+                                                  d_alpha,
+                                                  descr_M,
+                                                  dval,
+                                                  dptr,
+                                                  dcol,
+                                                  info_M,
+                                                  info_P,
+                                                  dx,
+                                                  dy_2,
+                                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                                  dbuffer_apply));
+
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    // Check y
+    unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+    unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
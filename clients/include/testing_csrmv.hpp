@@ -351,6 +351,9 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
     {
         CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
 
+        // Keep initial y for the analysed csrmv
+        std::vector<T> hy_orig = hy_2;
+
         // ROCSPARSE pointer mode host
         CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
         CHECK_HIPSPARSE_ERROR(hipsparseXcsrmv(
@@ -472,6 +475,60 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
 
         unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
         unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+
+        // Analysed csrmv, where the analysis data in info is re-used by all subsequent calls
+        std::unique_ptr<csrmv_struct> unique_ptr_csrmv(new csrmv_struct);
+        csrmvInfo_t                   info = unique_ptr_csrmv->info;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsrmv_analysis(
+            handle, transA, nrow, ncol, nnz, descr, dval, dptr, dcol, info));
+
+        for(int iter = 0; iter < 2; ++iter)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_orig.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_orig.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+            // ROCSPARSE pointer mode host
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrmvWithInfo(handle,
+                                                          transA,
+                                                          nrow,
+                                                          ncol,
+                                                          nnz,
+                                                          &h_alpha,
+                                                          descr,
+                                                          dval,
+                                                          dptr,
+                                                          dcol,
+                                                          info,
+                                                          dx,
+                                                          &h_beta,
+                                                          dy_1));
+
+            // ROCSPARSE pointer mode device
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrmvWithInfo(handle,
+                                                          transA,
+                                                          nrow,
+                                                          ncol,
+                                                          nnz,
+                                                          d_alpha,
+                                                          descr,
+                                                          dval,
+                                                          dptr,
+                                                          dcol,
+                                                          info,
+                                                          dx,
+                                                          d_beta,
+                                                          dy_2));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+            unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+            unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+        }
     }
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -188,6 +188,23 @@ void testing_csru2csr_bad_arg(void)
         "Error: nnz is invalid");
 #endif
 
+#if(!defined(CUDART_VERSION))
+    // Testing csru2csrValues for bad args
+    verify_hipsparse_status_invalid_handle(
+        hipsparseXcsru2csrValues(nullptr, nnz, csr_val, info, buffer));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsru2csrValues(handle, nnz, (float*)nullptr, info, buffer),
+        "Error: csr_val is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsru2csrValues(handle, nnz, csr_val, nullptr, buffer),
+        "Error: info is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsru2csrValues(handle, nnz, csr_val, info, nullptr),
+        "Error: buffer is nullptr");
+    verify_hipsparse_status_invalid_size(
+        hipsparseXcsru2csrValues(handle, -1, csr_val, info, buffer), "Error: nnz is invalid");
+#endif
+
     // Testing csr2csru for bad args
 #ifndef __HIP_PLATFORM_NVIDIA__
     // cusparse seem to not have any error checking for some parts
@@ -389,6 +406,17 @@ hipsparseStatus_t testing_csru2csr(void)
     unit_check_general(1, nnz, 1, hcsr_col_ind_unsorted.data(), hcsr_col_ind_unsorted_gold.data());
     unit_check_general(1, nnz, 1, hcsr_val_unsorted.data(), hcsr_val_unsorted_gold.data());
 
+#if(!defined(CUDART_VERSION))
+    // Sort the unsorted values again, reusing the permutation stored in info
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsru2csrValues(handle, nnz, dcsr_val, info, dbuffer));
+
+    std::vector<T> hcsr_val_resorted(nnz);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_resorted.data(), dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, nnz, 1, hcsr_val_resorted.data(), hcsr_val_gold.data());
+#endif
+
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_GTSV_BLOCK_STRIDED_BATCH_HPP
+#define TESTING_GTSV_BLOCK_STRIDED_BATCH_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+void testing_gtsv_block_strided_batch_bad_arg(void)
+{
+    // Dont do bad argument checking for cuda
+#if(!defined(CUDART_VERSION))
+    int                  safe_size    = 100;
+    int                  block_dim    = 2;
+    int                  m            = 4;
+    int                  batch_count  = 2;
+    int                  batch_stride = m;
+    hipsparseDirection_t dir          = HIPSPARSE_DIRECTION_ROW;
+
+    // Create handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<gtsv_block_struct> unique_ptr_info(new gtsv_block_struct);
+    gtsvBlockInfo_t                    info = unique_ptr_info->info;
+
+    auto ddl_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dd_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto ddu_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuf_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    T*    ddl  = (T*)ddl_managed.get();
+    T*    dd   = (T*)dd_managed.get();
+    T*    ddu  = (T*)ddu_managed.get();
+    T*    dx   = (T*)dx_managed.get();
+    void* dbuf = (void*)dbuf_managed.get();
+
+    if(!ddl || !dd || !ddu || !dx || !dbuf)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    size_t bsize;
+
+    // gtsvBlockStridedBatch_bufferSize
+    verify_hipsparse_status_invalid_handle(hipsparseXgtsvBlockStridedBatch_bufferSizeExt(
+        nullptr, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, &bsize));
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch_bufferSizeExt(
+            handle, dir, 0, m, ddl, dd, ddu, dx, batch_count, batch_stride, &bsize),
+        "Error: block_dim is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch_bufferSizeExt(
+            handle, dir, block_dim, -1, ddl, dd, ddu, dx, batch_count, batch_stride, &bsize),
+        "Error: m is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch_bufferSizeExt(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, -1, batch_stride, &bsize),
+        "Error: batch_count is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch_bufferSizeExt(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, m - 1, &bsize),
+        "Error: batch_stride is invalid");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch_bufferSizeExt(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, nullptr),
+        "Error: bsize is nullptr");
+
+    // gtsvBlockStridedBatch
+    verify_hipsparse_status_invalid_handle(hipsparseXgtsvBlockStridedBatch(
+        nullptr, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, info, dbuf));
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch(
+            handle, dir, 0, m, ddl, dd, ddu, dx, batch_count, batch_stride, info, dbuf),
+        "Error: block_dim is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch(
+            handle, dir, block_dim, -1, ddl, dd, ddu, dx, batch_count, batch_stride, info, dbuf),
+        "Error: m is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, -1, batch_stride, info, dbuf),
+        "Error: batch_count is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, m - 1, info, dbuf),
+        "Error: batch_stride is invalid");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch(handle,
+                                        dir,
+                                        block_dim,
+                                        m,
+                                        (const T*)nullptr,
+                                        dd,
+                                        ddu,
+                                        dx,
+                                        batch_count,
+                                        batch_stride,
+                                        info,
+                                        dbuf),
+        "Error: ddl is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch(handle,
+                                        dir,
+                                        block_dim,
+                                        m,
+                                        ddl,
+                                        (const T*)nullptr,
+                                        ddu,
+                                        dx,
+                                        batch_count,
+                                        batch_stride,
+                                        info,
+                                        dbuf),
+        "Error: dd is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch(handle,
+                                        dir,
+                                        block_dim,
+                                        m,
+                                        ddl,
+                                        dd,
+                                        (const T*)nullptr,
+                                        dx,
+                                        batch_count,
+                                        batch_stride,
+                                        info,
+                                        dbuf),
+        "Error: ddu is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch(handle,
+                                        dir,
+                                        block_dim,
+                                        m,
+                                        ddl,
+                                        dd,
+                                        ddu,
+                                        (T*)nullptr,
+                                        batch_count,
+                                        batch_stride,
+                                        info,
+                                        dbuf),
+        "Error: dx is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, info, nullptr),
+        "Error: dbuf is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, nullptr, dbuf),
+        "Error: info is nullptr");
+
+    // gtsvBlockStridedBatch_analysis
+    verify_hipsparse_status_invalid_handle(hipsparseXgtsvBlockStridedBatch_analysis(
+        nullptr, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, info, dbuf));
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch_analysis(
+            handle, dir, 0, m, ddl, dd, ddu, dx, batch_count, batch_stride, info, dbuf),
+        "Error: block_dim is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseXgtsvBlockStridedBatch_analysis(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, m - 1, info, dbuf),
+        "Error: batch_stride is invalid");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch_analysis(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, nullptr, dbuf),
+        "Error: info is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch_analysis(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, info, nullptr),
+        "Error: dbuf is nullptr");
+
+    // gtsvBlockStridedBatch_zeroPivot
+    int position;
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXgtsvBlockStridedBatch_zeroPivot(handle, nullptr, &position),
+        "Error: info is nullptr");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_gtsv_block_strided_batch(hipsparseDirection_t dir,
+                                                   int                  block_dim,
+                                                   int                  m,
+                                                   int                  batch_count,
+                                                   int                  batch_stride)
+{
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::unique_ptr<gtsv_block_struct> test_info(new gtsv_block_struct);
+    gtsvBlockInfo_t                    info = test_info->info;
+
+    int bb     = block_dim * block_dim;
+    int nblock = batch_stride * batch_count;
+
+    // Host structures, the diagonal blocks are made block diagonally dominant such
+    // that the factorization without pivoting is stable
+    std::vector<T> hdl(nblock * bb);
+    std::vector<T> hd(nblock * bb);
+    std::vector<T> hdu(nblock * bb);
+    std::vector<T> hx(nblock * block_dim);
+
+    srand(12345ULL);
+    hipsparseInit<T>(hdl, nblock * bb, 1);
+    hipsparseInit<T>(hd, nblock * bb, 1);
+    hipsparseInit<T>(hdu, nblock * bb, 1);
+    hipsparseInit<T>(hx, nblock * block_dim, 1);
+
+    for(int i = 0; i < nblock; ++i)
+    {
+        for(int r = 0; r < block_dim; ++r)
+        {
+            hd[i * bb + r * block_dim + r]
+                = hd[i * bb + r * block_dim + r] + make_DataType<T>(40.0 * block_dim);
+        }
+    }
+
+    std::vector<T> hx_gold = hx;
+
+    // allocate memory on device
+    auto ddl_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nblock * bb), device_free};
+    auto dd_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nblock * bb), device_free};
+    auto ddu_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nblock * bb), device_free};
+    auto dx_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(T) * nblock * block_dim), device_free};
+
+    T* ddl = (T*)ddl_managed.get();
+    T* dd  = (T*)dd_managed.get();
+    T* ddu = (T*)ddu_managed.get();
+    T* dx  = (T*)dx_managed.get();
+
+    if(!ddl || !dd || !ddu || !dx)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!ddl || !dd || !ddu || !dx");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(ddl, hdl.data(), sizeof(T) * nblock * bb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dd, hd.data(), sizeof(T) * nblock * bb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(ddu, hdu.data(), sizeof(T) * nblock * bb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx, hx.data(), sizeof(T) * nblock * block_dim, hipMemcpyHostToDevice));
+
+    // Query buffer size
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseXgtsvBlockStridedBatch_bufferSizeExt(
+        handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXgtsvBlockStridedBatch_analysis(
+        handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, info, buffer));
+
+    // The second solve reuses the analysis with new right-hand sides
+    for(int solve = 0; solve < 2; ++solve)
+    {
+        if(solve > 0)
+        {
+            hipsparseInit<T>(hx, nblock * block_dim, 1);
+            hx_gold = hx;
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(dx, hx.data(), sizeof(T) * nblock * block_dim, hipMemcpyHostToDevice));
+        }
+
+        CHECK_HIPSPARSE_ERROR(hipsparseXgtsvBlockStridedBatch(
+            handle, dir, block_dim, m, ddl, dd, ddu, dx, batch_count, batch_stride, info, buffer));
+
+        // The pivot blocks are non-singular
+        int position;
+        CHECK_HIPSPARSE_ERROR(hipsparseXgtsvBlockStridedBatch_zeroPivot(handle, info, &position));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(
+            hipMemcpy(hx.data(), dx, sizeof(T) * nblock * block_dim, hipMemcpyDeviceToHost));
+
+        // Host block tridiagonal solve, the padding between the systems is left untouched
+        host_gtsv_block_strided_batch(dir,
+                                      block_dim,
+                                      m,
+                                      hdl.data(),
+                                      hd.data(),
+                                      hdu.data(),
+                                      hx_gold.data(),
+                                      batch_count,
+                                      batch_stride);
+
+        // Check
+        unit_check_near<T>(1, nblock * block_dim, 1, hx_gold.data(), hx.data());
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_GTSV_BLOCK_STRIDED_BATCH_HPP
@@ -0,0 +1,199 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_HANDLE_POOL_HPP
+#define TESTING_HANDLE_POOL_HPP
+
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hipsparse.h>
+#include <thread>
+#include <vector>
+
+using namespace hipsparse_test;
+
+void testing_handle_pool_bad_arg(void)
+{
+    hipsparseHandle_t handle;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              foreign_handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<handle_pool_struct> unique_ptr_pool(new handle_pool_struct);
+    hipsparseHandlePool_t               pool = unique_ptr_pool->pool;
+
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateHandlePool(nullptr),
+                                            "Error: pool is nullptr");
+
+    verify_hipsparse_status_invalid_pointer(hipsparseHandlePoolAcquire(nullptr, 0, &handle),
+                                            "Error: pool is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseHandlePoolAcquire(pool, 0, nullptr),
+                                            "Error: handle is nullptr");
+
+    verify_hipsparse_status_invalid_pointer(hipsparseHandlePoolRelease(nullptr, foreign_handle),
+                                            "Error: pool is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseHandlePoolRelease(pool, nullptr),
+                                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseHandlePoolRelease(pool, foreign_handle),
+                                          "Error: handle has not been acquired from pool");
+
+    // Destroying a pool with outstanding handles must fail
+    verify_hipsparse_status_success(hipsparseHandlePoolAcquire(pool, 0, &handle), "Success");
+    verify_hipsparse_status_invalid_value(hipsparseDestroyHandlePool(pool),
+                                          "Error: pool has outstanding handles");
+
+    // Releasing twice must fail
+    verify_hipsparse_status_success(hipsparseHandlePoolRelease(pool, handle), "Success");
+    verify_hipsparse_status_invalid_value(hipsparseHandlePoolRelease(pool, handle),
+                                          "Error: handle has already been released");
+}
+
+hipsparseStatus_t testing_handle_pool(int num_threads, int num_iter)
+{
+    int n = 10000;
+
+    std::unique_ptr<handle_pool_struct> unique_ptr_pool(new handle_pool_struct);
+    hipsparseHandlePool_t               pool = unique_ptr_pool->pool;
+
+    // One stream and one output array per thread
+    std::vector<hipStream_t> streams(num_threads);
+    for(int t = 0; t < num_threads; ++t)
+    {
+        CHECK_HIP_ERROR(hipStreamCreate(&streams[t]));
+    }
+
+    auto dp_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * n * num_threads), device_free};
+    int* dp = (int*)dp_managed.get();
+
+    if(!dp)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED, "!dp");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    std::vector<hipsparseStatus_t>              status(num_threads, HIPSPARSE_STATUS_SUCCESS);
+    std::vector<std::vector<hipsparseHandle_t>> used(num_threads);
+
+    auto worker = [&](int t) {
+        for(int i = 0; i < num_iter; ++i)
+        {
+            hipsparseHandle_t handle;
+            hipsparseStatus_t stat = hipsparseHandlePoolAcquire(pool, streams[t], &handle);
+            if(stat != HIPSPARSE_STATUS_SUCCESS)
+            {
+                status[t] = stat;
+                return;
+            }
+
+            used[t].push_back(handle);
+
+            // Acquired handles must be bound to the requested stream and use host
+            // pointer mode, independent of their previous user
+            hipStream_t            stream;
+            hipsparsePointerMode_t mode;
+            hipsparseGetStream(handle, &stream);
+            hipsparseGetPointerMode(handle, &mode);
+
+            if(stream != streams[t] || mode != HIPSPARSE_POINTER_MODE_HOST)
+            {
+                status[t] = HIPSPARSE_STATUS_INTERNAL_ERROR;
+            }
+
+            // Change the handle state, such that subsequent users would observe it
+            hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE);
+
+            stat = hipsparseCreateIdentityPermutation(handle, n, dp + n * t);
+            if(stat != HIPSPARSE_STATUS_SUCCESS)
+            {
+                status[t] = stat;
+            }
+
+            hipStreamSynchronize(streams[t]);
+
+            stat = hipsparseHandlePoolRelease(pool, handle);
+            if(stat != HIPSPARSE_STATUS_SUCCESS)
+            {
+                status[t] = stat;
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < num_threads; ++t)
+    {
+        threads.push_back(std::thread(worker, t));
+    }
+
+    for(int t = 0; t < num_threads; ++t)
+    {
+        threads[t].join();
+    }
+
+    for(int t = 0; t < num_threads; ++t)
+    {
+        verify_hipsparse_status_success(status[t], "hipsparseHandlePool worker");
+        CHECK_HIP_ERROR(hipStreamDestroy(streams[t]));
+    }
+
+    // Copy output from device to host
+    std::vector<int> hp(n * num_threads);
+    CHECK_HIP_ERROR(hipMemcpy(hp.data(), dp, sizeof(int) * n * num_threads, hipMemcpyDeviceToHost));
+
+    // Host reference
+    std::vector<int> hp_gold(n * num_threads);
+    for(int t = 0; t < num_threads; ++t)
+    {
+        for(int i = 0; i < n; ++i)
+        {
+            hp_gold[n * t + i] = i;
+        }
+    }
+
+    unit_check_general(1, n * num_threads, 1, hp_gold.data(), hp.data());
+
+    // The pool must never hold more handles than threads using it concurrently
+    std::vector<hipsparseHandle_t> distinct;
+    for(int t = 0; t < num_threads; ++t)
+    {
+        distinct.insert(distinct.end(), used[t].begin(), used[t].end());
+    }
+
+    std::sort(distinct.begin(), distinct.end());
+    distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+    if((int)distinct.size() > num_threads)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_INTERNAL_ERROR,
+                                        "Error: pool created more handles than threads");
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_HANDLE_POOL_HPP
@@ -609,6 +609,97 @@ void testing_prune_csr2csr_by_percentage_bad_arg(void)
                                                 info,
                                                 nullptr);
     verify_hipsparse_status_invalid_pointer(status, "Error: buffer is nullptr");
+
+    // Test hipsparseXpruneCsr2csrThresholdByPercentage
+    status = hipsparseXpruneCsr2csrThresholdByPercentage(nullptr,
+                                                         M,
+                                                         N,
+                                                         nnz_A,
+                                                         descr_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         percentage,
+                                                         descr_C,
+                                                         csr_row_ptr_C,
+                                                         csr_val_C,
+                                                         temp_buffer);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXpruneCsr2csrThresholdByPercentage(handle,
+                                                         -1,
+                                                         N,
+                                                         nnz_A,
+                                                         descr_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         percentage,
+                                                         descr_C,
+                                                         csr_row_ptr_C,
+                                                         csr_val_C,
+                                                         temp_buffer);
+    verify_hipsparse_status_invalid_size(status, "Error: M is invalid");
+
+    status = hipsparseXpruneCsr2csrThresholdByPercentage(handle,
+                                                         M,
+                                                         N,
+                                                         nnz_A,
+                                                         descr_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         (T)-1,
+                                                         descr_C,
+                                                         csr_row_ptr_C,
+                                                         csr_val_C,
+                                                         temp_buffer);
+    verify_hipsparse_status_invalid_size(status, "Error: percentage is invalid");
+
+    status = hipsparseXpruneCsr2csrThresholdByPercentage(handle,
+                                                         M,
+                                                         N,
+                                                         nnz_A,
+                                                         descr_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         (T)101,
+                                                         descr_C,
+                                                         csr_row_ptr_C,
+                                                         csr_val_C,
+                                                         temp_buffer);
+    verify_hipsparse_status_invalid_size(status, "Error: percentage is invalid");
+
+    status = hipsparseXpruneCsr2csrThresholdByPercentage(handle,
+                                                         M,
+                                                         N,
+                                                         nnz_A,
+                                                         descr_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         percentage,
+                                                         descr_C,
+                                                         nullptr,
+                                                         csr_val_C,
+                                                         temp_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csr_row_ptr_C is nullptr");
+
+    status = hipsparseXpruneCsr2csrThresholdByPercentage(handle,
+                                                         M,
+                                                         N,
+                                                         nnz_A,
+                                                         descr_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         percentage,
+                                                         descr_C,
+                                                         csr_row_ptr_C,
+                                                         (T*)nullptr,
+                                                         temp_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: threshold is nullptr");
 #endif
 }
 
@@ -980,6 +1071,47 @@ hipsparseStatus_t testing_prune_csr2csr_by_percentage(Arguments argus)
                                     h_csr_col_ind_C.data());
             unit_check_general<T>(
                 1, h_nnz_total_dev_host_ptr[0], 1, h_csr_val_cpu.data(), h_csr_val_C.data());
+
+            // The selection-based threshold has to reproduce the same sparsity pattern
+            T threshold;
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseXpruneCsr2csrThresholdByPercentage(handle,
+                                                            M,
+                                                            N,
+                                                            nnz_A,
+                                                            descr_A,
+                                                            d_csr_val_A,
+                                                            d_csr_row_ptr_A,
+                                                            d_csr_col_ind_A,
+                                                            percentage,
+                                                            descr_C,
+                                                            d_csr_row_ptr_C,
+                                                            &threshold,
+                                                            d_temp_buffer));
+
+            int nnz_C_threshold;
+            CHECK_HIPSPARSE_ERROR(hipsparseXpruneCsr2csrNnz(handle,
+                                                            M,
+                                                            N,
+                                                            nnz_A,
+                                                            descr_A,
+                                                            d_csr_val_A,
+                                                            d_csr_row_ptr_A,
+                                                            d_csr_col_ind_A,
+                                                            &threshold,
+                                                            descr_C,
+                                                            d_csr_row_ptr_C,
+                                                            &nnz_C_threshold,
+                                                            d_temp_buffer));
+
+            CHECK_HIP_ERROR(hipMemcpy(h_csr_row_ptr_C.data(),
+                                      d_csr_row_ptr_C,
+                                      sizeof(int) * (M + 1),
+                                      hipMemcpyDeviceToHost));
+
+            unit_check_general<int>(1, 1, 1, h_nnz_C_cpu.data(), &nnz_C_threshold);
+            unit_check_general<int>(
+                1, (M + 1), 1, h_csr_row_ptr_cpu.data(), h_csr_row_ptr_C.data());
         }
     }
 
@@ -0,0 +1,457 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_SPASSEMBLE_CSR_HPP
+#define TESTING_SPASSEMBLE_CSR_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hipsparse.h>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_spassemble_csr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    int64_t              m         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    float                alpha     = 1.0f;
+    float                beta      = 0.0f;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<spassemble_struct> unique_ptr_descr(new spassemble_struct);
+    hipsparseSpAssembleDescr_t         descr = unique_ptr_descr->descr;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dind = (int*)dind_managed.get();
+    float* dval = (float*)dval_managed.get();
+
+    if(!dptr || !dind || !dval)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // COO and CSR matrix share the same arrays, since only the arguments are checked
+    hipsparseSpMatDescr_t C, A;
+    verify_hipsparse_status_success(
+        hipsparseCreateCoo(&C, m, m, nnz, dind, dind, dval, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, m, nnz, dptr, dind, dval, idxType, idxType, idxBase, dataType),
+        "success");
+
+    // Analysis
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpAssemble_analysis(nullptr, C, A, dataType, descr));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpAssemble_analysis(handle, nullptr, A, dataType, descr),
+        "Error: C is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpAssemble_analysis(handle, C, nullptr, dataType, descr),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpAssemble_analysis(handle, C, A, dataType, nullptr),
+        "Error: descr is nullptr");
+
+    // Compute
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpAssemble_compute(nullptr, &alpha, C, &beta, A, dataType, descr));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpAssemble_compute(handle, nullptr, C, &beta, A, dataType, descr),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpAssemble_compute(handle, &alpha, nullptr, &beta, A, dataType, descr),
+        "Error: C is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpAssemble_compute(handle, &alpha, C, nullptr, A, dataType, descr),
+        "Error: beta is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpAssemble_compute(handle, &alpha, C, &beta, nullptr, dataType, descr),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpAssemble_compute(handle, &alpha, C, &beta, A, dataType, nullptr),
+        "Error: descr is nullptr");
+
+    // Compute before analysis
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpAssemble_compute(handle, &alpha, C, &beta, A, dataType, descr),
+        "Error: analysis has not been called");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(C), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_spassemble_csr(int ndim, hipsparseIndexBase_t idxBase)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    T                    h_alpha = make_DataType<T>(2.0);
+    T                    h_beta  = make_DataType<T>(1.0);
+    T                    h_zero  = make_DataType<T>(0.0);
+    hipsparseIndexType_t typeI   = HIPSPARSE_INDEX_32I;
+
+    // Data type
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::unique_ptr<spassemble_struct> unique_ptr_descr(new spassemble_struct);
+    hipsparseSpAssembleDescr_t         descr = unique_ptr_descr->descr;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    // Bilinear quadrilateral elements on a ndim x ndim grid of nodes. Each element
+    // contributes a dense 4 x 4 block, such that interior couplings appear up to four times.
+    int m = ndim * ndim;
+
+    std::vector<int> hcoo_row_ind;
+    std::vector<int> hcoo_col_ind;
+
+    for(int ey = 0; ey < ndim - 1; ++ey)
+    {
+        for(int ex = 0; ex < ndim - 1; ++ex)
+        {
+            int node[4] = {ey * ndim + ex,
+                           ey * ndim + ex + 1,
+                           (ey + 1) * ndim + ex + 1,
+                           (ey + 1) * ndim + ex};
+
+            for(int a = 0; a < 4; ++a)
+            {
+                for(int b = 0; b < 4; ++b)
+                {
+                    hcoo_row_ind.push_back(node[a] + idxBase);
+                    hcoo_col_ind.push_back(node[b] + idxBase);
+                }
+            }
+        }
+    }
+
+    int nnz_coo = hcoo_row_ind.size();
+
+    // Sparsity pattern of the assembled matrix, with the columns of each row in reverse
+    // order to cover unsorted patterns
+    std::vector<std::vector<int>> rows(m);
+
+    for(int e = 0; e < nnz_coo; ++e)
+    {
+        rows[hcoo_row_ind[e] - idxBase].push_back(hcoo_col_ind[e]);
+    }
+
+    std::vector<int> hcsr_row_ptr(m + 1);
+    std::vector<int> hcsr_col_ind;
+
+    hcsr_row_ptr[0] = idxBase;
+
+    for(int i = 0; i < m; ++i)
+    {
+        std::sort(rows[i].begin(), rows[i].end());
+        rows[i].erase(std::unique(rows[i].begin(), rows[i].end()), rows[i].end());
+        std::reverse(rows[i].begin(), rows[i].end());
+
+        hcsr_col_ind.insert(hcsr_col_ind.end(), rows[i].begin(), rows[i].end());
+        hcsr_row_ptr[i + 1] = hcsr_row_ptr[i] + rows[i].size();
+    }
+
+    int nnz = hcsr_row_ptr[m] - idxBase;
+
+    std::vector<T> hcoo_val(nnz_coo);
+    std::vector<T> hcsr_val(nnz);
+
+    hipsparseInit<T>(hcoo_val, 1, nnz_coo);
+    hipsparseInit<T>(hcsr_val, 1, nnz);
+
+    // allocate memory on device
+    auto dcoo_row_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_coo), device_free};
+    auto dcoo_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_coo), device_free};
+    auto dcoo_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_coo), device_free};
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto d_alpha_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed       = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dcoo_row_ind = (int*)dcoo_row_ind_managed.get();
+    int* dcoo_col_ind = (int*)dcoo_col_ind_managed.get();
+    T*   dcoo_val     = (T*)dcoo_val_managed.get();
+    int* dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int* dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    T*   dcsr_val     = (T*)dcsr_val_managed.get();
+    T*   d_alpha      = (T*)d_alpha_managed.get();
+    T*   d_beta       = (T*)d_beta_managed.get();
+
+    if(!dcoo_row_ind || !dcoo_col_ind || !dcoo_val || !dcsr_row_ptr || !dcsr_col_ind || !dcsr_val
+       || !d_alpha || !d_beta)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcoo_row_ind || !dcoo_col_ind || !dcoo_val || "
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || "
+                                        "!d_alpha || !d_beta");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcoo_row_ind, hcoo_row_ind.data(), sizeof(int) * nnz_coo, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcoo_col_ind, hcoo_col_ind.data(), sizeof(int) * nnz_coo, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcoo_val, hcoo_val.data(), sizeof(T) * nnz_coo, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    hipsparseSpMatDescr_t C, A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCoo(
+        &C, m, m, nnz_coo, dcoo_row_ind, dcoo_col_ind, dcoo_val, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &A, m, m, nnz, dcsr_row_ptr, dcsr_col_ind, dcsr_val, typeI, typeI, idxBase, typeT));
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+    // Cache the transpose of A with its initial values, the assembly has to refresh it
+    std::vector<T> hx(m);
+    hipsparseInit<T>(hx, 1, m);
+
+    auto dx_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+
+    if(!dx || !dy)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED, "!dx || !dy");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    size_t budget = 64 << 20;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_TRANSPOSE_CACHE, &budget, sizeof(budget)));
+
+    hipsparseDnVecDescr_t x, y;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, m, dy, typeT));
+
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(handle,
+                                                   HIPSPARSE_OPERATION_TRANSPOSE,
+                                                   &h_beta,
+                                                   A,
+                                                   x,
+                                                   &h_zero,
+                                                   y,
+                                                   typeT,
+                                                   HIPSPARSE_MV_ALG_DEFAULT,
+                                                   &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_preprocess(handle,
+                                                   HIPSPARSE_OPERATION_TRANSPOSE,
+                                                   &h_beta,
+                                                   A,
+                                                   x,
+                                                   &h_zero,
+                                                   y,
+                                                   typeT,
+                                                   HIPSPARSE_MV_ALG_DEFAULT,
+                                                   buffer));
+#endif
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpAssemble_analysis(handle, C, A, typeT, descr));
+
+    // Overwrite the values of A, pointer mode host
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpAssemble_compute(handle, &h_alpha, C, &h_zero, A, typeT, descr));
+
+    std::vector<T> hcsr_val_1(nnz);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_1.data(), dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    // Accumulate new values into A, pointer mode device
+    std::vector<T> hcoo_val_2(nnz_coo);
+    hipsparseInit<T>(hcoo_val_2, 1, nnz_coo);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcoo_val, hcoo_val_2.data(), sizeof(T) * nnz_coo, hipMemcpyHostToDevice));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpAssemble_compute(handle, d_alpha, C, d_beta, A, typeT, descr));
+
+    std::vector<T> hcsr_val_2(nnz);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_2.data(), dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    // Host assembly
+    std::vector<T> hcsr_val_1_gold(nnz, h_zero);
+
+    for(int e = 0; e < nnz_coo; ++e)
+    {
+        int row = hcoo_row_ind[e] - idxBase;
+
+        for(int j = hcsr_row_ptr[row] - idxBase; j < hcsr_row_ptr[row + 1] - idxBase; ++j)
+        {
+            if(hcsr_col_ind[j] == hcoo_col_ind[e])
+            {
+                hcsr_val_1_gold[j] = hcsr_val_1_gold[j] + h_alpha * hcoo_val[e];
+            }
+        }
+    }
+
+    std::vector<T> hcsr_val_2_gold(hcsr_val_1_gold);
+
+    for(int e = 0; e < nnz_coo; ++e)
+    {
+        int row = hcoo_row_ind[e] - idxBase;
+
+        for(int j = hcsr_row_ptr[row] - idxBase; j < hcsr_row_ptr[row + 1] - idxBase; ++j)
+        {
+            if(hcsr_col_ind[j] == hcoo_col_ind[e])
+            {
+                hcsr_val_2_gold[j] = hcsr_val_2_gold[j] + h_alpha * hcoo_val_2[e];
+            }
+        }
+    }
+
+    unit_check_near(1, nnz, 1, hcsr_val_1_gold.data(), hcsr_val_1.data());
+    unit_check_near(1, nnz, 1, hcsr_val_2_gold.data(), hcsr_val_2.data());
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+    // Transposed product with the assembled values
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV(handle,
+                                        HIPSPARSE_OPERATION_TRANSPOSE,
+                                        &h_beta,
+                                        A,
+                                        x,
+                                        &h_zero,
+                                        y,
+                                        typeT,
+                                        HIPSPARSE_MV_ALG_DEFAULT,
+                                        buffer));
+
+    std::vector<T> hy(m);
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    std::vector<T> hy_gold(m, h_zero);
+
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = hcsr_row_ptr[i] - idxBase; j < hcsr_row_ptr[i + 1] - idxBase; ++j)
+        {
+            int col = hcsr_col_ind[j] - idxBase;
+
+            hy_gold[col] = testing_fma(hcsr_val_2_gold[j], hx[i], hy_gold[col]);
+        }
+    }
+
+    unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+#endif
+
+    // Without entries, the values of A are only scaled by beta
+    hipsparseSpMatDescr_t C_empty;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCoo(&C_empty, m, m, 0, nullptr, nullptr, nullptr, typeI, idxBase, typeT));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpAssemble_analysis(handle, C_empty, A, typeT, descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpAssemble_compute(handle, &h_beta, C_empty, &h_alpha, A, typeT, descr));
+
+    std::vector<T> hcsr_val_3(nnz);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_3.data(), dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    std::vector<T> hcsr_val_3_gold(nnz);
+
+    for(int j = 0; j < nnz; ++j)
+    {
+        hcsr_val_3_gold[j] = h_alpha * hcsr_val_2_gold[j];
+    }
+
+    unit_check_near(1, nnz, 1, hcsr_val_3_gold.data(), hcsr_val_3.data());
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C_empty));
+
+    // An entry outside of the pattern is rejected
+    if(ndim > 2)
+    {
+        int outside = (m - 1) + idxBase;
+        CHECK_HIP_ERROR(hipMemcpy(dcoo_col_ind, &outside, sizeof(int), hipMemcpyHostToDevice));
+
+        verify_hipsparse_status_invalid_value(
+            hipsparseSpAssemble_analysis(handle, C, A, typeT, descr),
+            "Error: COO entry outside of the pattern");
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPASSEMBLE_CSR_HPP
@@ -333,6 +333,50 @@ void testing_spgemm_csr_bad_arg(void)
             handle, transA, transB, &alpha, A, B, &beta, nullptr, dataType, alg, descr),
         "Error: C is nullptr");
 
+    // SpGEMM chunked
+    int64_t nnz_C_chunked;
+    size_t  limit = 1 << 20;
+    verify_hipsparse_status_invalid_handle(hipsparseSpGEMM_chunkedNnz(
+        nullptr, transA, transB, &alpha, A, B, C, dataType, alg, limit, &nnz_C_chunked));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_chunkedNnz(
+            handle, transA, transB, nullptr, A, B, C, dataType, alg, limit, &nnz_C_chunked),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_chunkedNnz(
+            handle, transA, transB, &alpha, nullptr, B, C, dataType, alg, limit, &nnz_C_chunked),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_chunkedNnz(
+            handle, transA, transB, &alpha, A, nullptr, C, dataType, alg, limit, &nnz_C_chunked),
+        "Error: B is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_chunkedNnz(
+            handle, transA, transB, &alpha, A, B, nullptr, dataType, alg, limit, &nnz_C_chunked),
+        "Error: C is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_chunkedNnz(
+            handle, transA, transB, &alpha, A, B, C, dataType, alg, limit, nullptr),
+        "Error: nnzC is nullptr");
+    verify_hipsparse_status_invalid_handle(hipsparseSpGEMM_chunkedCompute(
+        nullptr, transA, transB, &alpha, A, B, C, dataType, alg, limit));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_chunkedCompute(
+            handle, transA, transB, nullptr, A, B, C, dataType, alg, limit),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_chunkedCompute(
+            handle, transA, transB, &alpha, nullptr, B, C, dataType, alg, limit),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_chunkedCompute(
+            handle, transA, transB, &alpha, A, nullptr, C, dataType, alg, limit),
+        "Error: B is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGEMM_chunkedCompute(
+            handle, transA, transB, &alpha, A, B, nullptr, dataType, alg, limit),
+        "Error: C is nullptr");
+
     // Destruct
     verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
     verify_hipsparse_status_success(hipsparseDestroySpMat(B), "success");
@@ -767,4 +811,255 @@ hipsparseStatus_t testing_spgemm_csr(void)
 #endif
 }
 
+template <typename T>
+hipsparseStatus_t testing_spgemm_csr_chunked(size_t device_memory_limit)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    T                    h_alpha  = make_DataType<T>(2.0);
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOperation_t transB   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idxBaseA = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexBase_t idxBaseB = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexBase_t idxBaseC = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t typeI    = HIPSPARSE_INDEX_32I;
+    hipsparseSpGEMMAlg_t alg      = HIPSPARSE_SPGEMM_DEFAULT;
+
+    // Matrices are stored at the same path in matrices directory
+    std::string filename = hipsparse_exepath() + "../matrices/nos6.bin";
+
+    // Data type
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr_A;
+    std::vector<int> hcsr_col_ind_A;
+    std::vector<T>   hcsr_val_A;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    // Some sparse matrix A
+    int m;
+    int k;
+    int nnz_A;
+
+    if(read_bin_matrix(
+           filename.c_str(), m, k, nnz_A, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idxBaseA)
+       != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Sparse matrix B as the transpose of A
+    int n     = m;
+    int nnz_B = nnz_A;
+
+    std::vector<int> hcsr_row_ptr_B(k + 1);
+    std::vector<int> hcsr_col_ind_B(nnz_B);
+    std::vector<T>   hcsr_val_B(nnz_B);
+
+    transpose_csr(m,
+                  k,
+                  nnz_A,
+                  hcsr_row_ptr_A.data(),
+                  hcsr_col_ind_A.data(),
+                  hcsr_val_A.data(),
+                  hcsr_row_ptr_B.data(),
+                  hcsr_col_ind_B.data(),
+                  hcsr_val_B.data(),
+                  idxBaseA,
+                  idxBaseB);
+
+    // allocate memory on device
+    auto dcsr_row_ptr_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_A), device_free};
+    auto dcsr_val_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+    auto dcsr_row_ptr_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (k + 1)), device_free};
+    auto dcsr_col_ind_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_B), device_free};
+    auto dcsr_val_B_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dcsr_row_ptr_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+
+    int* dcsr_row_ptr_A = (int*)dcsr_row_ptr_A_managed.get();
+    int* dcsr_col_ind_A = (int*)dcsr_col_ind_A_managed.get();
+    T*   dcsr_val_A     = (T*)dcsr_val_A_managed.get();
+    int* dcsr_row_ptr_B = (int*)dcsr_row_ptr_B_managed.get();
+    int* dcsr_col_ind_B = (int*)dcsr_col_ind_B_managed.get();
+    T*   dcsr_val_B     = (T*)dcsr_val_B_managed.get();
+    int* dcsr_row_ptr_C = (int*)dcsr_row_ptr_C_managed.get();
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_B || !dcsr_col_ind_B
+       || !dcsr_val_B || !dcsr_row_ptr_C)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || "
+                                        "!dcsr_row_ptr_B || !dcsr_col_ind_B || !dcsr_val_B || "
+                                        "!dcsr_row_ptr_C");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A.data(), sizeof(int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_A, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_B, hcsr_row_ptr_B.data(), sizeof(int) * (k + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_B, hcsr_col_ind_B.data(), sizeof(int) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_B, hcsr_val_B.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A, B, C;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             k,
+                                             nnz_A,
+                                             dcsr_row_ptr_A,
+                                             dcsr_col_ind_A,
+                                             dcsr_val_A,
+                                             typeI,
+                                             typeI,
+                                             idxBaseA,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&B,
+                                             k,
+                                             n,
+                                             nnz_B,
+                                             dcsr_row_ptr_B,
+                                             dcsr_col_ind_B,
+                                             dcsr_val_B,
+                                             typeI,
+                                             typeI,
+                                             idxBaseB,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &C, m, n, 0, dcsr_row_ptr_C, nullptr, nullptr, typeI, typeI, idxBaseC, typeT));
+
+    // Number of non-zero entries of C
+    int64_t nnz_C;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_chunkedNnz(
+        handle, transA, transB, &h_alpha, A, B, C, typeT, alg, device_memory_limit, &nnz_C));
+
+    // Allocate C
+    auto dcsr_col_ind_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_C), device_free};
+    auto dcsr_val_C_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+
+    int* dcsr_col_ind_C = (int*)dcsr_col_ind_C_managed.get();
+    T*   dcsr_val_C     = (T*)dcsr_val_C_managed.get();
+
+    if(!dcsr_col_ind_C || !dcsr_val_C)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_col_ind_C || !dcsr_val_C");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&C,
+                                             m,
+                                             n,
+                                             nnz_C,
+                                             dcsr_row_ptr_C,
+                                             dcsr_col_ind_C,
+                                             dcsr_val_C,
+                                             typeI,
+                                             typeI,
+                                             idxBaseC,
+                                             typeT));
+
+    // Compute C panel wise
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_chunkedCompute(
+        handle, transA, transB, &h_alpha, A, B, C, typeT, alg, device_memory_limit));
+
+    // Copy output from device to CPU
+    std::vector<int> hcsr_row_ptr_C(m + 1);
+    std::vector<int> hcsr_col_ind_C(nnz_C);
+    std::vector<T>   hcsr_val_C(nnz_C);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_row_ptr_C.data(), dcsr_row_ptr_C, sizeof(int) * (m + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_col_ind_C.data(), dcsr_col_ind_C, sizeof(int) * nnz_C, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_C.data(), dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+    // Compute SpGEMM on host
+    std::vector<int> hcsr_row_ptr_C_gold(m + 1);
+
+    int64_t nnz_C_gold = csrgemm2_nnz(m,
+                                      n,
+                                      k,
+                                      &h_alpha,
+                                      hcsr_row_ptr_A.data(),
+                                      hcsr_col_ind_A.data(),
+                                      hcsr_row_ptr_B.data(),
+                                      hcsr_col_ind_B.data(),
+                                      (const T*)nullptr,
+                                      (const int*)nullptr,
+                                      (const int*)nullptr,
+                                      hcsr_row_ptr_C_gold.data(),
+                                      idxBaseA,
+                                      idxBaseB,
+                                      idxBaseC,
+                                      HIPSPARSE_INDEX_BASE_ZERO);
+
+    std::vector<int> hcsr_col_ind_C_gold(nnz_C_gold);
+    std::vector<T>   hcsr_val_C_gold(nnz_C_gold);
+
+    csrgemm2(m,
+             n,
+             k,
+             &h_alpha,
+             hcsr_row_ptr_A.data(),
+             hcsr_col_ind_A.data(),
+             hcsr_val_A.data(),
+             hcsr_row_ptr_B.data(),
+             hcsr_col_ind_B.data(),
+             hcsr_val_B.data(),
+             (const T*)nullptr,
+             (const int*)nullptr,
+             (const int*)nullptr,
+             (const T*)nullptr,
+             hcsr_row_ptr_C_gold.data(),
+             hcsr_col_ind_C_gold.data(),
+             hcsr_val_C_gold.data(),
+             idxBaseA,
+             idxBaseB,
+             idxBaseC,
+             HIPSPARSE_INDEX_BASE_ZERO);
+
+    // Verify results
+    unit_check_general(1, 1, 1, &nnz_C_gold, &nnz_C);
+    unit_check_general(1, m + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C.data());
+    unit_check_general(1, nnz_C_gold, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C.data());
+    unit_check_general(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 #endif // TESTING_SPGEMM_CSR_HPP
@@ -0,0 +1,458 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_SPGS_CSR_HPP
+#define TESTING_SPGS_CSR_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_spgs_csr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    int                  ncolors   = 2;
+    float                omega     = 1.0f;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+    hipsparseSpGSSweep_t sweep     = HIPSPARSE_SPGS_SWEEP_FORWARD;
+    int                  color_ptr[3];
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<spgs_struct> unique_ptr_descr(new spgs_struct);
+    hipsparseSpGSDescr_t         descr = unique_ptr_descr->descr;
+
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcsr_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcsr_val_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int*   dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    float* dcsr_val     = (float*)dcsr_val_managed.get();
+    float* dx           = (float*)dx_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // A and B share the same arrays, since only the arguments are checked
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x;
+    verify_hipsparse_status_success(hipsparseCreateCsr(&A,
+                                                       n,
+                                                       n,
+                                                       nnz,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       dcsr_val,
+                                                       idxType,
+                                                       idxType,
+                                                       idxBase,
+                                                       dataType),
+                                    "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dx, dataType), "success");
+
+    // Color permutation
+    verify_hipsparse_status_invalid_handle(
+        hipsparseCsrColorPermute(nullptr, A, ncolors, dcsr_col_ind, nullptr, color_ptr, A));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCsrColorPermute(handle, nullptr, ncolors, dcsr_col_ind, nullptr, color_ptr, A),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCsrColorPermute(handle, A, ncolors, nullptr, nullptr, color_ptr, A),
+        "Error: coloring is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCsrColorPermute(handle, A, ncolors, dcsr_col_ind, nullptr, nullptr, A),
+        "Error: colorPtr is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCsrColorPermute(handle, A, ncolors, dcsr_col_ind, nullptr, color_ptr, nullptr),
+        "Error: B is nullptr");
+    verify_hipsparse_status_invalid_size(
+        hipsparseCsrColorPermute(handle, A, -1, dcsr_col_ind, nullptr, color_ptr, A),
+        "Error: ncolors is invalid");
+
+    // Analysis
+    color_ptr[0] = 0;
+    color_ptr[1] = n / 2;
+    color_ptr[2] = n;
+
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpGS_analysis(nullptr, A, ncolors, color_ptr, dataType, descr));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGS_analysis(handle, nullptr, ncolors, color_ptr, dataType, descr),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGS_analysis(handle, A, ncolors, nullptr, dataType, descr),
+        "Error: colorPtr is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGS_analysis(handle, A, ncolors, color_ptr, dataType, nullptr),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_size(
+        hipsparseSpGS_analysis(handle, A, -1, color_ptr, dataType, descr),
+        "Error: ncolors is invalid");
+
+    color_ptr[2] = n - 1;
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGS_analysis(handle, A, ncolors, color_ptr, dataType, descr),
+        "Error: colorPtr does not cover all rows");
+
+    // Sweep
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpGS_sweep(nullptr, sweep, &omega, A, x, x, dataType, descr));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGS_sweep(handle, sweep, nullptr, A, x, x, dataType, descr),
+        "Error: omega is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGS_sweep(handle, sweep, &omega, nullptr, x, x, dataType, descr),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGS_sweep(handle, sweep, &omega, A, nullptr, x, dataType, descr),
+        "Error: b is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGS_sweep(handle, sweep, &omega, A, x, nullptr, dataType, descr),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpGS_sweep(handle, sweep, &omega, A, x, x, dataType, nullptr),
+        "Error: descr is nullptr");
+
+    // Sweep before analysis
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGS_sweep(handle, sweep, &omega, A, x, x, dataType, descr),
+        "Error: analysis has not been called");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_spgs_csr(int                  ndim,
+                                   hipsparseIndexBase_t idxBase,
+                                   hipsparseSpGSSweep_t sweep,
+                                   double               omega)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    T                    h_omega   = make_DataType<T>(omega);
+    int                  num_sweep = 3;
+    hipsparseIndexType_t typeI     = HIPSPARSE_INDEX_32I;
+
+    // Data type
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_mat_descr(new descr_struct);
+    hipsparseMatDescr_t           mat_descr = unique_ptr_mat_descr->descr;
+
+    std::unique_ptr<spgs_struct> unique_ptr_descr(new spgs_struct);
+    hipsparseSpGSDescr_t         descr = unique_ptr_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(mat_descr, idxBase));
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    std::vector<int> hcsr_row_ptr_A;
+    std::vector<int> hcsr_col_ind_A;
+    std::vector<T>   hcsr_val_A;
+
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idxBase);
+    int nnz = hcsr_row_ptr_A[m] - idxBase;
+
+    // Randomize the diagonal, such that the permutation of the values is tested
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = hcsr_row_ptr_A[i] - idxBase; j < hcsr_row_ptr_A[i + 1] - idxBase; ++j)
+        {
+            if(hcsr_col_ind_A[j] - idxBase == i)
+            {
+                hcsr_val_A[j] = hcsr_val_A[j] + random_generator<T>();
+            }
+        }
+    }
+
+    std::vector<T> hb(m);
+    std::vector<T> hx(m);
+
+    hipsparseInit<T>(hb, 1, m);
+    hipsparseInit<T>(hx, 1, m);
+
+    // allocate memory on device
+    auto dcsr_row_ptr_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsr_row_ptr_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_B_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcoloring_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * m), device_free};
+    auto dperm_managed      = hipsparse_unique_ptr{device_malloc(sizeof(int) * m), device_free};
+    auto db_managed         = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_managed         = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    int* dcsr_row_ptr_A = (int*)dcsr_row_ptr_A_managed.get();
+    int* dcsr_col_ind_A = (int*)dcsr_col_ind_A_managed.get();
+    T*   dcsr_val_A     = (T*)dcsr_val_A_managed.get();
+    int* dcsr_row_ptr_B = (int*)dcsr_row_ptr_B_managed.get();
+    int* dcsr_col_ind_B = (int*)dcsr_col_ind_B_managed.get();
+    T*   dcsr_val_B     = (T*)dcsr_val_B_managed.get();
+    int* dcoloring      = (int*)dcoloring_managed.get();
+    int* dperm          = (int*)dperm_managed.get();
+    T*   db             = (T*)db_managed.get();
+    T*   dx             = (T*)dx_managed.get();
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_B || !dcsr_col_ind_B
+       || !dcsr_val_B || !dcoloring || !dperm || !db || !dx)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || "
+                                        "!dcsr_row_ptr_B || !dcsr_col_ind_B || !dcsr_val_B || "
+                                        "!dcoloring || !dperm || !db || !dx");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_A, hcsr_val_A.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Color the matrix
+    hipsparseColorInfo_t colorInfo;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateColorInfo(&colorInfo));
+
+    floating_data_t<T> fractionToColor = make_DataType<floating_data_t<T>>(1.0);
+
+    int ncolors;
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrcolor(handle,
+                                             m,
+                                             nnz,
+                                             mat_descr,
+                                             dcsr_val_A,
+                                             dcsr_row_ptr_A,
+                                             dcsr_col_ind_A,
+                                             &fractionToColor,
+                                             &ncolors,
+                                             dcoloring,
+                                             dperm,
+                                             colorInfo));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyColorInfo(colorInfo));
+
+    // Permute A into color blocked form
+    hipsparseSpMatDescr_t A, B;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &A, m, m, nnz, dcsr_row_ptr_A, dcsr_col_ind_A, dcsr_val_A, typeI, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &B, m, m, nnz, dcsr_row_ptr_B, dcsr_col_ind_B, dcsr_val_B, typeI, typeI, idxBase, typeT));
+
+    std::vector<int> hcolor_ptr(ncolors + 1);
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCsrColorPermute(handle, A, ncolors, dcoloring, dperm, hcolor_ptr.data(), B));
+
+    // Multicolor Gauss-Seidel sweeps
+    hipsparseDnVecDescr_t b, x;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&b, m, db, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpGS_analysis(handle, B, ncolors, hcolor_ptr.data(), typeT, descr));
+
+    for(int s = 0; s < num_sweep; ++s)
+    {
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpGS_sweep(handle, sweep, &h_omega, B, b, x, typeT, descr));
+    }
+
+    // Copy output from device to CPU
+    std::vector<int> hcoloring(m);
+    std::vector<int> hperm(m);
+    std::vector<int> hcsr_row_ptr_B(m + 1);
+    std::vector<int> hcsr_col_ind_B(nnz);
+    std::vector<T>   hcsr_val_B(nnz);
+    std::vector<T>   hx_gpu(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hcoloring.data(), dcoloring, sizeof(int) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hperm.data(), dperm, sizeof(int) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_row_ptr_B.data(), dcsr_row_ptr_B, sizeof(int) * (m + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_col_ind_B.data(), dcsr_col_ind_B, sizeof(int) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_B.data(), dcsr_val_B, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hx_gpu.data(), dx, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    // Host color permutation, rows are sorted stably by color
+    std::vector<int> hcolor_ptr_gold(ncolors + 1, 0);
+    std::vector<int> hperm_gold;
+    std::vector<int> hinv_perm(m);
+
+    for(int i = 0; i < m; ++i)
+    {
+        ++hcolor_ptr_gold[hcoloring[i] + 1];
+    }
+
+    for(int c = 0; c < ncolors; ++c)
+    {
+        hcolor_ptr_gold[c + 1] += hcolor_ptr_gold[c];
+
+        for(int i = 0; i < m; ++i)
+        {
+            if(hcoloring[i] == c)
+            {
+                hinv_perm[i] = hperm_gold.size();
+                hperm_gold.push_back(i);
+            }
+        }
+    }
+
+    std::vector<int> hcsr_row_ptr_B_gold(m + 1);
+    std::vector<int> hcsr_col_ind_B_gold(nnz);
+    std::vector<T>   hcsr_val_B_gold(nnz);
+
+    hcsr_row_ptr_B_gold[0] = idxBase;
+
+    for(int i = 0; i < m; ++i)
+    {
+        int row_begin = hcsr_row_ptr_A[hperm_gold[i]] - idxBase;
+        int row_end   = hcsr_row_ptr_A[hperm_gold[i] + 1] - idxBase;
+        int offset    = hcsr_row_ptr_B_gold[i] - idxBase;
+
+        // Insertion sort by permuted column index
+        for(int j = row_begin; j < row_end; ++j)
+        {
+            int col = hinv_perm[hcsr_col_ind_A[j] - idxBase] + idxBase;
+            int k   = offset + j - row_begin;
+
+            while(k > offset && hcsr_col_ind_B_gold[k - 1] > col)
+            {
+                hcsr_col_ind_B_gold[k] = hcsr_col_ind_B_gold[k - 1];
+                hcsr_val_B_gold[k]     = hcsr_val_B_gold[k - 1];
+                --k;
+            }
+
+            hcsr_col_ind_B_gold[k] = col;
+            hcsr_val_B_gold[k]     = hcsr_val_A[j];
+        }
+
+        hcsr_row_ptr_B_gold[i + 1] = hcsr_row_ptr_B_gold[i] + row_end - row_begin;
+    }
+
+    // Host Gauss-Seidel. Rows of the same color are decoupled, thus a sequential sweep
+    // over the rows of B is equivalent to the multicolor sweep.
+    for(int s = 0; s < num_sweep; ++s)
+    {
+        for(int pass = 0; pass < 2; ++pass)
+        {
+            if((pass == 0 && sweep == HIPSPARSE_SPGS_SWEEP_BACKWARD)
+               || (pass == 1 && sweep == HIPSPARSE_SPGS_SWEEP_FORWARD))
+            {
+                continue;
+            }
+
+            for(int r = 0; r < m; ++r)
+            {
+                int i = (pass == 0) ? r : m - 1 - r;
+
+                // The backward pass of the symmetric sweep skips the last color
+                if(pass == 1 && sweep == HIPSPARSE_SPGS_SWEEP_SYMMETRIC
+                   && i >= hcolor_ptr_gold[ncolors - 1])
+                {
+                    continue;
+                }
+
+                T sum  = hb[i];
+                T diag = make_DataType<T>(1.0);
+
+                for(int j = hcsr_row_ptr_B_gold[i] - idxBase;
+                    j < hcsr_row_ptr_B_gold[i + 1] - idxBase;
+                    ++j)
+                {
+                    int col = hcsr_col_ind_B_gold[j] - idxBase;
+
+                    sum = sum - hcsr_val_B_gold[j] * hx[col];
+
+                    if(col == i)
+                    {
+                        diag = hcsr_val_B_gold[j];
+                    }
+                }
+
+                hx[i] = hx[i] + h_omega * sum / diag;
+            }
+        }
+    }
+
+    // Unit check
+    unit_check_general(1, ncolors + 1, 1, hcolor_ptr_gold.data(), hcolor_ptr.data());
+    unit_check_general(1, m, 1, hperm_gold.data(), hperm.data());
+    unit_check_general(1, m + 1, 1, hcsr_row_ptr_B_gold.data(), hcsr_row_ptr_B.data());
+    unit_check_general(1, nnz, 1, hcsr_col_ind_B_gold.data(), hcsr_col_ind_B.data());
+    unit_check_general(1, nnz, 1, hcsr_val_B_gold.data(), hcsr_val_B.data());
+    unit_check_near(1, m, 1, hx.data(), hx_gpu.data());
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(b));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPGS_CSR_HPP
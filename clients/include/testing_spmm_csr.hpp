@@ -390,4 +390,149 @@ hipsparseStatus_t testing_spmm_csr()
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmm_csr_streamed()
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    T                    h_alpha  = make_DataType<T>(2.0);
+    T                    h_beta   = make_DataType<T>(1.0);
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOperation_t transB   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOrder_t     order    = HIPSPARSE_ORDER_COLUMN;
+    hipsparseIndexBase_t idx_base = HIPSPARSE_INDEX_BASE_ZERO;
+#if(CUDART_VERSION >= 11003)
+    hipsparseSpMMAlg_t alg = HIPSPARSE_SPMM_CSR_ALG1;
+#else
+    hipsparseSpMMAlg_t alg = HIPSPARSE_MM_ALG_DEFAULT;
+#endif
+
+    // Matrices are stored at the same path in matrices directory
+    std::string filename = hipsparse_exepath() + "../matrices/nos3.bin";
+
+    // Index and data type
+    hipsparseIndexType_t typeI
+        = (typeid(I) == typeid(int32_t)) ? HIPSPARSE_INDEX_32I : HIPSPARSE_INDEX_64I;
+    hipsparseIndexType_t typeJ
+        = (typeid(J) == typeid(int32_t)) ? HIPSPARSE_INDEX_32I : HIPSPARSE_INDEX_64I;
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    J m;
+    J k;
+    I nnz;
+
+    if(read_bin_matrix(filename.c_str(), m, k, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+       != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    J n   = 5;
+    J ldb = k;
+    J ldc = m;
+
+    std::vector<T> hB(k * n);
+    std::vector<T> hC(m * n);
+    std::vector<T> hC_gold(m * n);
+
+    hipsparseInit<T>(hB, k, n);
+    hipsparseInit<T>(hC, m, n);
+
+    hC_gold = hC;
+
+    // allocate memory on device, A stays in host memory
+    auto dB_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * k * n), device_free};
+    auto dC_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m * n), device_free};
+
+    T* dB = (T*)dB_managed.get();
+    T* dC = (T*)dC_managed.get();
+
+    if(!dB || !dC)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED, "!dB || !dC");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * k * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * m * n, hipMemcpyHostToDevice));
+
+    // Host resident matrix
+    hipsparseSpMatDescr_t hA;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&hA,
+                                             m,
+                                             k,
+                                             nnz,
+                                             hcsr_row_ptr.data(),
+                                             hcsr_col_ind.data(),
+                                             hcsr_val.data(),
+                                             typeI,
+                                             typeJ,
+                                             idx_base,
+                                             typeT));
+
+    // Create dense matrices
+    hipsparseDnMatDescr_t B, C;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, k, n, ldb, dB, typeT, order));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C, m, n, ldc, dC, typeT, order));
+
+    // The work space of the whole matrix bounds the work space of every chunk. The size
+    // query does not access the arrays of A.
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_bufferSize(
+        handle, transA, transB, &h_alpha, hA, B, &h_beta, C, typeT, alg, &bufferSize));
+
+    // Streamed SpMM, with a memory limit that splits the matrix into many chunks
+    size_t limit = 2 * (sizeof(I) + sizeof(J) + sizeof(T)) * (nnz / 16 + 1) + bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_streamed(
+        handle, transA, transB, &h_alpha, hA, B, &h_beta, C, typeT, alg, limit));
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * m * n, hipMemcpyDeviceToHost));
+
+    // CPU
+    host_csrmm(m,
+               n,
+               k,
+               transA,
+               transB,
+               h_alpha,
+               hcsr_row_ptr.data(),
+               hcsr_col_ind.data(),
+               hcsr_val.data(),
+               hB.data(),
+               ldb,
+               h_beta,
+               hC_gold.data(),
+               ldc,
+               order,
+               idx_base);
+
+    unit_check_near(1, m * n, 1, hC_gold.data(), hC.data());
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(hA));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 #endif // TESTING_SPMM_CSR_HPP
@@ -383,4 +383,673 @@ hipsparseStatus_t testing_spmv_csr(void)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+// Mixed precision SpMV with 8 bit integer matrix and vector values and single
+// precision accumulation
+hipsparseStatus_t testing_spmv_csr_mixed(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    float                h_alpha  = 2.0f;
+    float                h_beta   = 1.0f;
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseSpMVAlg_t   alg      = HIPSPARSE_SPMV_ALG_DEFAULT;
+
+    int m = 2000;
+    int n = 2000;
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Banded matrix with small integer entries, such that all results are exact
+    srand(12345ULL);
+
+    std::vector<int>    hcsr_row_ptr(m + 1, 0);
+    std::vector<int>    hcol_ind;
+    std::vector<int8_t> hval;
+
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = std::max(0, i - 3); j < std::min(n, i + 4); ++j)
+        {
+            hcol_ind.push_back(j);
+            hval.push_back(static_cast<int8_t>(rand() % 11 - 5));
+        }
+
+        hcsr_row_ptr[i + 1] = hcol_ind.size();
+    }
+
+    int nnz = hcsr_row_ptr[m];
+
+    std::vector<int8_t> hx(n);
+    std::vector<float>  hy_1(m);
+    std::vector<float>  hy_2(m);
+    std::vector<float>  hy_gold(m);
+
+    for(int i = 0; i < n; ++i)
+    {
+        hx[i] = static_cast<int8_t>(rand() % 11 - 5);
+    }
+
+    for(int i = 0; i < m; ++i)
+    {
+        hy_1[i] = static_cast<float>(rand() % 11 - 5);
+    }
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(int8_t) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(int8_t) * n), device_free};
+    auto dy_1_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto dy_2_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(float)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(float)), device_free};
+
+    int*    dptr    = (int*)dptr_managed.get();
+    int*    dcol    = (int*)dcol_managed.get();
+    int8_t* dval    = (int8_t*)dval_managed.get();
+    int8_t* dx      = (int8_t*)dx_managed.get();
+    float*  dy_1    = (float*)dy_1_managed.get();
+    float*  dy_2    = (float*)dy_2_managed.get();
+    float*  d_alpha = (float*)d_alpha_managed.get();
+    float*  d_beta  = (float*)d_beta_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dval || !dptr || !dcol || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(int8_t) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(int8_t) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             n,
+                                             nnz,
+                                             dptr,
+                                             dcol,
+                                             dval,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             HIP_R_8I));
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, n, dx, HIP_R_8I));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, m, dy_1, HIP_R_32F));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, m, dy_2, HIP_R_32F));
+
+    // Query SpMV buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, HIP_R_32F, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    // ROCSPARSE pointer mode host
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, HIP_R_32F, alg, buffer));
+
+    // ROCSPARSE pointer mode device
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV(handle, transA, d_alpha, A, x, d_beta, y2, HIP_R_32F, alg, buffer));
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(float) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(float) * m, hipMemcpyDeviceToHost));
+
+    // CPU SpMV, accumulated in single precision
+    for(int i = 0; i < m; ++i)
+    {
+        float sum = 0.0f;
+
+        for(int j = hcsr_row_ptr[i]; j < hcsr_row_ptr[i + 1]; ++j)
+        {
+            sum += static_cast<float>(hval[j]) * static_cast<float>(hx[hcol_ind[j]]);
+        }
+
+        hy_gold[i] = h_alpha * sum + h_beta * hy_gold[i];
+    }
+
+    unit_check_general(1, m, 1, hy_gold.data(), hy_1.data());
+    unit_check_general(1, m, 1, hy_gold.data(), hy_2.data());
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmv_csr_streamed(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    T                    h_alpha  = make_DataType<T>(2.0);
+    T                    h_beta   = make_DataType<T>(1.0);
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseSpMVAlg_t   alg      = HIPSPARSE_SPMV_ALG_DEFAULT;
+
+    // Matrices are stored at the same path in matrices directory
+    std::string filename = hipsparse_exepath() + "../matrices/nos3.bin";
+
+    // Index and data type
+    hipsparseIndexType_t typeI
+        = (typeid(I) == typeid(int32_t)) ? HIPSPARSE_INDEX_32I : HIPSPARSE_INDEX_64I;
+    hipsparseIndexType_t typeJ
+        = (typeid(J) == typeid(int32_t)) ? HIPSPARSE_INDEX_32I : HIPSPARSE_INDEX_64I;
+    hipDataType typeT = (typeid(T) == typeid(float)) ? HIP_R_32F : HIP_R_64F;
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    J m;
+    J n;
+    I nnz;
+
+    if(read_bin_matrix(filename.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    std::vector<T> hx(n);
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+
+    hipsparseInit<T>(hx, 1, n);
+    hipsparseInit<T>(hy_1, 1, m);
+
+    hy_2 = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_1_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    I* dptr = (I*)dptr_managed.get();
+    J* dcol = (J*)dcol_managed.get();
+    T* dval = (T*)dval_managed.get();
+    T* dx   = (T*)dx_managed.get();
+    T* dy_1 = (T*)dy_1_managed.get();
+    T* dy_2 = (T*)dy_2_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy_1 || !dy_2)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dval || !dptr || !dcol || !dx || !dy_1 || !dy_2");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Device resident and host resident matrix
+    hipsparseSpMatDescr_t A, hA;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeJ, idx_base, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&hA,
+                                             m,
+                                             n,
+                                             nnz,
+                                             hcsr_row_ptr.data(),
+                                             hcol_ind.data(),
+                                             hval.data(),
+                                             typeI,
+                                             typeJ,
+                                             idx_base,
+                                             typeT));
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, n, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, m, dy_1, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, m, dy_2, typeT));
+
+    // Reference SpMV with the device resident matrix
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+    // Streamed SpMV, with a memory limit that splits the matrix into many chunks. The
+    // work space of the whole matrix bounds the work space of every chunk.
+    size_t limit = 2 * (sizeof(I) + sizeof(J) + sizeof(T)) * (nnz / 16 + 1) + bufferSize;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV_streamed(handle, transA, &h_alpha, hA, x, &h_beta, y2, typeT, alg, limit));
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    unit_check_near(1, m, 1, hy_1.data(), hy_2.data());
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(hA));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// SpMV with a symmetric matrix, where only the lower triangular part is stored. A non zero
+// budget enables the transpose cache of the half stored matrix.
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmv_csr_symmetric(hipsparseOperation_t transA, size_t budget)
+{
+#if(!defined(CUDART_VERSION))
+    T                     h_alpha  = make_DataType<T>(2.0);
+    T                     h_beta   = make_DataType<T>(1.0);
+    hipsparseIndexBase_t  idx_base = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseSpMVAlg_t    alg      = HIPSPARSE_SPMV_ALG_DEFAULT;
+    hipsparseMatrixType_t type     = HIPSPARSE_MATRIX_TYPE_SYMMETRIC;
+    hipsparseFillMode_t   fill     = HIPSPARSE_FILL_MODE_LOWER;
+
+    // nos3 is symmetric
+    std::string filename = hipsparse_exepath() + "../matrices/nos3.bin";
+
+    // Index and data type
+    hipsparseIndexType_t typeI
+        = (typeid(I) == typeid(int32_t)) ? HIPSPARSE_INDEX_32I : HIPSPARSE_INDEX_64I;
+    hipsparseIndexType_t typeJ
+        = (typeid(J) == typeid(int32_t)) ? HIPSPARSE_INDEX_32I : HIPSPARSE_INDEX_64I;
+    hipDataType typeT = (typeid(T) == typeid(float)) ? HIP_R_32F : HIP_R_64F;
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    J m;
+    J n;
+    I nnz;
+
+    if(read_bin_matrix(filename.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Extract the lower triangular part, including the diagonal
+    std::vector<I> hcsr_row_ptr_L(m + 1, 0);
+    std::vector<J> hcol_ind_L;
+    std::vector<T> hval_L;
+
+    for(J i = 0; i < m; ++i)
+    {
+        for(I j = hcsr_row_ptr[i]; j < hcsr_row_ptr[i + 1]; ++j)
+        {
+            if(hcol_ind[j] <= i)
+            {
+                hcol_ind_L.push_back(hcol_ind[j]);
+                hval_L.push_back(hval[j]);
+            }
+        }
+
+        hcsr_row_ptr_L[i + 1] = hcol_ind_L.size();
+    }
+
+    I nnz_L = hcsr_row_ptr_L[m];
+
+    std::vector<T> hx(n);
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+
+    hipsparseInit<T>(hx, 1, n);
+    hipsparseInit<T>(hy_1, 1, m);
+
+    hy_2 = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed   = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed   = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dptr_L_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_L_managed = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_L), device_free};
+    auto dval_L_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_L), device_free};
+    auto dx_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_1_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    I* dptr   = (I*)dptr_managed.get();
+    J* dcol   = (J*)dcol_managed.get();
+    T* dval   = (T*)dval_managed.get();
+    I* dptr_L = (I*)dptr_L_managed.get();
+    J* dcol_L = (J*)dcol_L_managed.get();
+    T* dval_L = (T*)dval_L_managed.get();
+    T* dx     = (T*)dx_managed.get();
+    T* dy_1   = (T*)dy_1_managed.get();
+    T* dy_2   = (T*)dy_2_managed.get();
+
+    if(!dval || !dptr || !dcol || !dval_L || !dptr_L || !dcol_L || !dx || !dy_1 || !dy_2)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dval || !dptr || !dcol || !dval_L || !dptr_L || "
+                                        "!dcol_L || !dx || !dy_1 || !dy_2");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr_L, hcsr_row_ptr_L.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol_L, hcol_ind_L.data(), sizeof(J) * nnz_L, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_L, hval_L.data(), sizeof(T) * nnz_L, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Fully stored matrix and half stored symmetric matrix
+    hipsparseSpMatDescr_t A, L;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeJ, idx_base, typeT));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&L, m, n, nnz_L, dptr_L, dcol_L, dval_L, typeI, typeJ, idx_base, typeT));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(L, HIPSPARSE_SPMAT_MATRIX_TYPE, &type, sizeof(type)));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(L, HIPSPARSE_SPMAT_FILL_MODE, &fill, sizeof(fill)));
+
+    if(budget > 0)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMatSetAttribute(
+            L, HIPSPARSE_SPMAT_TRANSPOSE_CACHE, &budget, sizeof(budget)));
+    }
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, n, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, m, dy_1, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, m, dy_2, typeT));
+
+    size_t bufferSize_A, bufferSize_L;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, &bufferSize_A));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, L, x, &h_beta, y2, typeT, alg, &bufferSize_L));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, std::max(bufferSize_A, bufferSize_L)));
+
+    // Reference SpMV with the fully stored matrix
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+    // SpMV with the half stored symmetric matrix
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV(handle, transA, &h_alpha, L, x, &h_beta, y2, typeT, alg, buffer));
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    unit_check_near(1, m, 1, hy_1.data(), hy_2.data());
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(L));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Transposed SpMV with a cached transpose, that is refreshed after the values changed
+template <typename T>
+hipsparseStatus_t testing_spmv_csr_transpose_cache(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+    T                    h_alpha  = make_DataType<T>(2.0);
+    T                    h_beta   = make_DataType<T>(1.0);
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = HIPSPARSE_INDEX_BASE_ONE;
+    hipsparseSpMVAlg_t   alg      = HIPSPARSE_SPMV_ALG_DEFAULT;
+    hipDataType          typeT    = (typeid(T) == typeid(float)) ? HIP_R_32F : HIP_R_64F;
+
+    int    m      = 1500;
+    int    n      = 700;
+    size_t budget = 64 << 20;
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Random rectangular matrix
+    srand(12345ULL);
+
+    std::vector<int> hcsr_row_ptr(m + 1, idx_base);
+    std::vector<int> hcol_ind;
+    std::vector<T>   hval;
+
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = 0; j < n; ++j)
+        {
+            if(rand() % 50 == 0)
+            {
+                hcol_ind.push_back(j + idx_base);
+                hval.push_back(random_generator<T>());
+            }
+        }
+
+        hcsr_row_ptr[i + 1] = hcol_ind.size() + idx_base;
+    }
+
+    int nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Second set of values, that replaces the first one
+    std::vector<T> hval_2(nnz);
+
+    for(int i = 0; i < nnz; ++i)
+    {
+        hval_2[i] = random_generator<T>();
+    }
+
+    std::vector<T> hx(m);
+    std::vector<T> hy(n);
+    std::vector<T> hy_1(n);
+    std::vector<T> hy_2(n);
+    std::vector<T> hy_gold(n);
+
+    hipsparseInit<T>(hx, 1, m);
+    hipsparseInit<T>(hy, 1, n);
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval_2_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_1_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_2_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dptr    = (int*)dptr_managed.get();
+    int* dcol    = (int*)dcol_managed.get();
+    T*   dval    = (T*)dval_managed.get();
+    T*   dval_2  = (T*)dval_2_managed.get();
+    T*   dx      = (T*)dx_managed.get();
+    T*   dy_1    = (T*)dy_1_managed.get();
+    T*   dy_2    = (T*)dy_2_managed.get();
+    T*   d_alpha = (T*)d_alpha_managed.get();
+    T*   d_beta  = (T*)d_beta_managed.get();
+
+    if(!dval || !dval_2 || !dptr || !dcol || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dval || !dval_2 || !dptr || !dcol || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_2, hval_2.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create matrix and enable the transpose cache
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             n,
+                                             nnz,
+                                             dptr,
+                                             dcol,
+                                             dval,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_TRANSPOSE_CACHE, &budget, sizeof(budget)));
+
+    size_t budget_A;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetAttribute(
+        A, HIPSPARSE_SPMAT_TRANSPOSE_CACHE, &budget_A, sizeof(budget_A)));
+    unit_check_general(1, 1, 1, &budget, &budget_A);
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, n, dy_1, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, n, dy_2, typeT));
+
+    // Query SpMV buffer, this builds the transposed copy
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV_preprocess(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+    for(int pass = 0; pass < 2; ++pass)
+    {
+        // Replace the values of the matrix in the second pass, which refreshes the copy
+        if(pass == 1)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMatSetValues(A, dval_2));
+            hval = hval_2;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+
+        // ROCSPARSE pointer mode host
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+        // ROCSPARSE pointer mode device
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, d_alpha, A, x, d_beta, y2, typeT, alg, buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * n, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * n, hipMemcpyDeviceToHost));
+
+        // Host transposed SpMV
+        for(int i = 0; i < n; ++i)
+        {
+            hy_gold[i] = h_beta * hy[i];
+        }
+
+        for(int i = 0; i < m; ++i)
+        {
+            for(int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+            {
+                int col = hcol_ind[j] - idx_base;
+
+                hy_gold[col] = testing_fma(h_alpha * hval[j], hx[i], hy_gold[col]);
+            }
+        }
+
+        unit_check_near(1, n, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, n, 1, hy_gold.data(), hy_2.data());
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 #endif // TESTING_SPMV_CSR_HPP
@@ -0,0 +1,486 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_SPRAP_CSR_HPP
+#define TESTING_SPRAP_CSR_HPP
+
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_sprap_csr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    float                alpha     = 0.6;
+    float                beta      = 0.0;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+    hipsparseSpGEMMAlg_t alg       = HIPSPARSE_SPGEMM_DEFAULT;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<sprap_struct> unique_ptr_descr(new sprap_struct);
+    hipsparseSpRAPDescr_t         descr = unique_ptr_descr->descr;
+
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcsr_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcsr_val_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int*   dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    float* dcsr_val     = (float*)dcsr_val_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // R, A, P and C share the same arrays, since only the arguments are checked
+    hipsparseSpMatDescr_t A;
+    verify_hipsparse_status_success(hipsparseCreateCsr(&A,
+                                                       n,
+                                                       n,
+                                                       nnz,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       dcsr_val,
+                                                       idxType,
+                                                       idxType,
+                                                       idxBase,
+                                                       dataType),
+                                    "success");
+
+    // SpRAP nnz
+    verify_hipsparse_status_invalid_handle(hipsparseSpRAP_nnz(nullptr, A, A, A, A, alg, descr));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_nnz(handle, nullptr, A, A, A, alg, descr), "Error: R is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_nnz(handle, A, nullptr, A, A, alg, descr), "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_nnz(handle, A, A, nullptr, A, alg, descr), "Error: P is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_nnz(handle, A, A, A, nullptr, alg, descr), "Error: C is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_nnz(handle, A, A, A, A, alg, nullptr), "Error: descr is nullptr");
+
+    // SpRAP copy
+    verify_hipsparse_status_invalid_handle(hipsparseSpRAP_copy(nullptr, A, A, A, A, alg, descr));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_copy(handle, nullptr, A, A, A, alg, descr), "Error: R is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_copy(handle, A, nullptr, A, A, alg, descr), "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_copy(handle, A, A, nullptr, A, alg, descr), "Error: P is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_copy(handle, A, A, A, nullptr, alg, descr), "Error: C is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_copy(handle, A, A, A, A, alg, nullptr), "Error: descr is nullptr");
+
+    // Copy before nnz
+    verify_hipsparse_status_invalid_value(hipsparseSpRAP_copy(handle, A, A, A, A, alg, descr),
+                                          "Error: nnz stage has not been called");
+
+    // SpRAP compute
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpRAP_compute(nullptr, &alpha, A, A, A, &beta, A, dataType, alg, descr));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_compute(handle, nullptr, A, A, A, &beta, A, dataType, alg, descr),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_compute(handle, &alpha, nullptr, A, A, &beta, A, dataType, alg, descr),
+        "Error: R is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_compute(handle, &alpha, A, nullptr, A, &beta, A, dataType, alg, descr),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_compute(handle, &alpha, A, A, nullptr, &beta, A, dataType, alg, descr),
+        "Error: P is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_compute(handle, &alpha, A, A, A, nullptr, A, dataType, alg, descr),
+        "Error: beta is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_compute(handle, &alpha, A, A, A, &beta, nullptr, dataType, alg, descr),
+        "Error: C is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpRAP_compute(handle, &alpha, A, A, A, &beta, A, dataType, alg, nullptr),
+        "Error: descr is nullptr");
+
+    // Compute before nnz and copy
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpRAP_compute(handle, &alpha, A, A, A, &beta, A, dataType, alg, descr),
+        "Error: symbolic stages have not been called");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_sprap_csr(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+    T                    h_alpha = make_DataType<T>(2.0);
+    T                    h_beta  = make_DataType<T>(0.0);
+    hipsparseOperation_t trans   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idxBase = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t typeI   = HIPSPARSE_INDEX_32I;
+    hipsparseSpGEMMAlg_t alg     = HIPSPARSE_SPGEMM_DEFAULT;
+
+    // Matrices are stored at the same path in matrices directory
+    std::string filename = hipsparse_exepath() + "../matrices/nos6.bin";
+
+    // Data type
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::unique_ptr<sprap_struct> unique_ptr_descr(new sprap_struct);
+    hipsparseSpRAPDescr_t         descr = unique_ptr_descr->descr;
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr_A;
+    std::vector<int> hcsr_col_ind_A;
+    std::vector<T>   hcsr_val_A;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    // Fine level operator A
+    int m;
+    int n;
+    int nnz_A;
+
+    if(read_bin_matrix(
+           filename.c_str(), m, n, nnz_A, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idxBase)
+       != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Prolongation P, aggregating pairs of consecutive rows, and restriction R = P^T
+    int mc    = (m + 1) / 2;
+    int nnz_P = m;
+
+    std::vector<int> hcsr_row_ptr_P(m + 1);
+    std::vector<int> hcsr_col_ind_P(nnz_P);
+    std::vector<T>   hcsr_val_P(nnz_P);
+
+    for(int i = 0; i < m; ++i)
+    {
+        hcsr_row_ptr_P[i] = i;
+        hcsr_col_ind_P[i] = i / 2;
+        hcsr_val_P[i]     = random_generator<T>();
+    }
+
+    hcsr_row_ptr_P[m] = nnz_P;
+
+    std::vector<int> hcsr_row_ptr_R(mc + 1);
+    std::vector<int> hcsr_col_ind_R(nnz_P);
+    std::vector<T>   hcsr_val_R(nnz_P);
+
+    transpose_csr(m,
+                  mc,
+                  nnz_P,
+                  hcsr_row_ptr_P.data(),
+                  hcsr_col_ind_P.data(),
+                  hcsr_val_P.data(),
+                  hcsr_row_ptr_R.data(),
+                  hcsr_col_ind_R.data(),
+                  hcsr_val_R.data(),
+                  idxBase,
+                  idxBase);
+
+    // allocate memory on device
+    auto dcsr_row_ptr_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_A), device_free};
+    auto dcsr_val_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+    auto dcsr_row_ptr_P_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_P_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_P), device_free};
+    auto dcsr_val_P_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_P), device_free};
+    auto dcsr_row_ptr_R_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (mc + 1)), device_free};
+    auto dcsr_col_ind_R_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_P), device_free};
+    auto dcsr_val_R_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_P), device_free};
+    auto dcsr_row_ptr_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (mc + 1)), device_free};
+
+    int* dcsr_row_ptr_A = (int*)dcsr_row_ptr_A_managed.get();
+    int* dcsr_col_ind_A = (int*)dcsr_col_ind_A_managed.get();
+    T*   dcsr_val_A     = (T*)dcsr_val_A_managed.get();
+    int* dcsr_row_ptr_P = (int*)dcsr_row_ptr_P_managed.get();
+    int* dcsr_col_ind_P = (int*)dcsr_col_ind_P_managed.get();
+    T*   dcsr_val_P     = (T*)dcsr_val_P_managed.get();
+    int* dcsr_row_ptr_R = (int*)dcsr_row_ptr_R_managed.get();
+    int* dcsr_col_ind_R = (int*)dcsr_col_ind_R_managed.get();
+    T*   dcsr_val_R     = (T*)dcsr_val_R_managed.get();
+    int* dcsr_row_ptr_C = (int*)dcsr_row_ptr_C_managed.get();
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_P || !dcsr_col_ind_P
+       || !dcsr_val_P || !dcsr_row_ptr_R || !dcsr_col_ind_R || !dcsr_val_R || !dcsr_row_ptr_C)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || "
+                                        "!dcsr_row_ptr_P || !dcsr_col_ind_P || !dcsr_val_P || "
+                                        "!dcsr_row_ptr_R || !dcsr_col_ind_R || !dcsr_val_R || "
+                                        "!dcsr_row_ptr_C");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A.data(), sizeof(int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_A, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_P, hcsr_row_ptr_P.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_P, hcsr_col_ind_P.data(), sizeof(int) * nnz_P, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_P, hcsr_val_P.data(), sizeof(T) * nnz_P, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_R, hcsr_row_ptr_R.data(), sizeof(int) * (mc + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_R, hcsr_col_ind_R.data(), sizeof(int) * nnz_P, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_R, hcsr_val_R.data(), sizeof(T) * nnz_P, hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A, P, R, C;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &A, m, n, nnz_A, dcsr_row_ptr_A, dcsr_col_ind_A, dcsr_val_A, typeI, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&P,
+                                             m,
+                                             mc,
+                                             nnz_P,
+                                             dcsr_row_ptr_P,
+                                             dcsr_col_ind_P,
+                                             dcsr_val_P,
+                                             typeI,
+                                             typeI,
+                                             idxBase,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&R,
+                                             mc,
+                                             m,
+                                             nnz_P,
+                                             dcsr_row_ptr_R,
+                                             dcsr_col_ind_R,
+                                             dcsr_val_R,
+                                             typeI,
+                                             typeI,
+                                             idxBase,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &C, mc, mc, 0, dcsr_row_ptr_C, nullptr, nullptr, typeI, typeI, idxBase, typeT));
+
+    // Symbolic stages
+    CHECK_HIPSPARSE_ERROR(hipsparseSpRAP_nnz(handle, R, A, P, C, alg, descr));
+
+    int64_t rows_C, cols_C, nnz_C;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetSize(C, &rows_C, &cols_C, &nnz_C));
+
+    auto dcsr_col_ind_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_C), device_free};
+    auto dcsr_val_C_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+
+    int* dcsr_col_ind_C = (int*)dcsr_col_ind_C_managed.get();
+    T*   dcsr_val_C     = (T*)dcsr_val_C_managed.get();
+
+    if(!dcsr_col_ind_C || !dcsr_val_C)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_col_ind_C || !dcsr_val_C");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCsrSetPointers(C, dcsr_row_ptr_C, dcsr_col_ind_C, dcsr_val_C));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpRAP_copy(handle, R, A, P, C, alg, descr));
+
+    // Numerical stage
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpRAP_compute(handle, &h_alpha, R, A, P, &h_beta, C, typeT, alg, descr));
+
+    // Change the values of A and repeat the numerical stage only
+    for(int i = 0; i < nnz_A; ++i)
+    {
+        hcsr_val_A[i] = hcsr_val_A[i] * make_DataType<T>(2.0);
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_A, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpRAP_compute(handle, &h_alpha, R, A, P, &h_beta, C, typeT, alg, descr));
+
+    // Copy output from device to CPU
+    std::vector<int> hcsr_row_ptr_C(mc + 1);
+    std::vector<int> hcsr_col_ind_C(nnz_C);
+    std::vector<T>   hcsr_val_C(nnz_C);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_row_ptr_C.data(), dcsr_row_ptr_C, sizeof(int) * (mc + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_col_ind_C.data(), dcsr_col_ind_C, sizeof(int) * nnz_C, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_C.data(), dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+    // Compute A * P on host
+    T h_one = make_DataType<T>(1.0);
+
+    std::vector<int> hcsr_row_ptr_AP(m + 1);
+
+    int nnz_AP = csrgemm2_nnz(m,
+                              mc,
+                              n,
+                              &h_one,
+                              hcsr_row_ptr_A.data(),
+                              hcsr_col_ind_A.data(),
+                              hcsr_row_ptr_P.data(),
+                              hcsr_col_ind_P.data(),
+                              (const T*)nullptr,
+                              (const int*)nullptr,
+                              (const int*)nullptr,
+                              hcsr_row_ptr_AP.data(),
+                              idxBase,
+                              idxBase,
+                              idxBase,
+                              HIPSPARSE_INDEX_BASE_ZERO);
+
+    std::vector<int> hcsr_col_ind_AP(nnz_AP);
+    std::vector<T>   hcsr_val_AP(nnz_AP);
+
+    csrgemm2(m,
+             mc,
+             n,
+             &h_one,
+             hcsr_row_ptr_A.data(),
+             hcsr_col_ind_A.data(),
+             hcsr_val_A.data(),
+             hcsr_row_ptr_P.data(),
+             hcsr_col_ind_P.data(),
+             hcsr_val_P.data(),
+             (const T*)nullptr,
+             (const int*)nullptr,
+             (const int*)nullptr,
+             (const T*)nullptr,
+             hcsr_row_ptr_AP.data(),
+             hcsr_col_ind_AP.data(),
+             hcsr_val_AP.data(),
+             idxBase,
+             idxBase,
+             idxBase,
+             HIPSPARSE_INDEX_BASE_ZERO);
+
+    // Compute R * (A * P) on host
+    std::vector<int> hcsr_row_ptr_C_gold(mc + 1);
+
+    int64_t nnz_C_gold = csrgemm2_nnz(mc,
+                                      mc,
+                                      m,
+                                      &h_alpha,
+                                      hcsr_row_ptr_R.data(),
+                                      hcsr_col_ind_R.data(),
+                                      hcsr_row_ptr_AP.data(),
+                                      hcsr_col_ind_AP.data(),
+                                      (const T*)nullptr,
+                                      (const int*)nullptr,
+                                      (const int*)nullptr,
+                                      hcsr_row_ptr_C_gold.data(),
+                                      idxBase,
+                                      idxBase,
+                                      idxBase,
+                                      HIPSPARSE_INDEX_BASE_ZERO);
+
+    std::vector<int> hcsr_col_ind_C_gold(nnz_C_gold);
+    std::vector<T>   hcsr_val_C_gold(nnz_C_gold);
+
+    csrgemm2(mc,
+             mc,
+             m,
+             &h_alpha,
+             hcsr_row_ptr_R.data(),
+             hcsr_col_ind_R.data(),
+             hcsr_val_R.data(),
+             hcsr_row_ptr_AP.data(),
+             hcsr_col_ind_AP.data(),
+             hcsr_val_AP.data(),
+             (const T*)nullptr,
+             (const int*)nullptr,
+             (const int*)nullptr,
+             (const T*)nullptr,
+             hcsr_row_ptr_C_gold.data(),
+             hcsr_col_ind_C_gold.data(),
+             hcsr_val_C_gold.data(),
+             idxBase,
+             idxBase,
+             idxBase,
+             HIPSPARSE_INDEX_BASE_ZERO);
+
+    // Verify results
+    unit_check_general(1, 1, 1, &nnz_C_gold, &nnz_C);
+    unit_check_general(1, mc + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C.data());
+    unit_check_general(1, nnz_C_gold, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C.data());
+    unit_check_near(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(P));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(R));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPRAP_CSR_HPP
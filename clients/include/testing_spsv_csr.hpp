@@ -158,6 +158,39 @@ void testing_spsv_csr_bad_arg(void)
         "Error: dbuf is nullptr");
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+    // SpSV Jacobi sweeps
+    verify_hipsparse_status_invalid_pointer(hipsparseSpSV_setJacobiSweeps(nullptr, 5),
+                                            "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_size(hipsparseSpSV_setJacobiSweeps(descr, -1),
+                                         "Error: sweeps is invalid");
+    verify_hipsparse_status_not_supported(
+        hipsparseSpSV_analysis(handle,
+                               HIPSPARSE_OPERATION_TRANSPOSE,
+                               &alpha,
+                               A,
+                               x,
+                               y,
+                               dataType,
+                               HIPSPARSE_SPSV_ALG_JACOBI,
+                               descr,
+                               dbuf),
+        "Error: transposed Jacobi sweeps");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpSV_solve(
+            handle, transA, &alpha, A, x, y, dataType, HIPSPARSE_SPSV_ALG_JACOBI, descr, dbuf),
+        "Error: Jacobi solve without analysis");
+
+    // Memory usage
+    size_t bytes;
+    verify_hipsparse_status_invalid_pointer(hipsparseSpSV_getMemoryUsage(nullptr, &bytes),
+                                            "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseSpSV_getMemoryUsage(descr, nullptr),
+                                            "Error: bytes is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseSpSV_getMemoryUsage(descr, &bytes),
+                                          "Error: descr holds no Jacobi analysis");
+#endif
+
     // Destruct
     verify_hipsparse_status_success(hipsparseSpSV_destroyDescr(descr), "success");
     verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
@@ -346,4 +379,186 @@ hipsparseStatus_t testing_spsv_csr(void)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+template <typename T>
+hipsparseStatus_t testing_spsv_csr_jacobi(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+    int                  ndim     = 16;
+    T                    h_alpha  = make_DataType<T>(2.3);
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = HIPSPARSE_INDEX_BASE_ONE;
+    hipsparseDiagType_t  diag     = HIPSPARSE_DIAG_TYPE_NON_UNIT;
+    hipsparseSpSVAlg_t   alg      = HIPSPARSE_SPSV_ALG_JACOBI;
+
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // 2D Laplacian, its triangles are diagonally dominant
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcol_ind;
+    std::vector<T>   hval;
+
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcol_ind, hval, idx_base);
+    int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hx(m);
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+    std::vector<T> hy_gold_1(m);
+    std::vector<T> hy_gold_2(m);
+
+    srand(12345ULL);
+    hipsparseInit<T>(hx, 1, m);
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dptr    = (int*)dptr_managed.get();
+    int* dcol    = (int*)dcol_managed.get();
+    T*   dval    = (T*)dval_managed.get();
+    T*   dx      = (T*)dx_managed.get();
+    T*   dy      = (T*)dy_managed.get();
+    T*   d_alpha = (T*)d_alpha_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy || !d_alpha)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dval || !dptr || !dcol || !dx || !dy || !d_alpha");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    hipsparseSpSVDescr_t descr;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_createDescr(&descr));
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             m,
+                                             nnz,
+                                             dptr,
+                                             dcol,
+                                             dval,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             typeT));
+
+    hipsparseDnVecDescr_t x, y;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, m, dy, typeT));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_DIAG_TYPE, &diag, sizeof(diag)));
+
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_bufferSize(
+        handle, transA, &h_alpha, A, x, y, typeT, alg, descr, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, std::max(bufferSize, sizeof(int))));
+
+    // Lower triangle with the default number of sweeps, HIPSPARSE pointer mode host
+    hipsparseFillMode_t uplo = HIPSPARSE_FILL_MODE_LOWER;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_FILL_MODE, &uplo, sizeof(uplo)));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpSV_analysis(handle, transA, &h_alpha, A, x, y, typeT, alg, descr, buffer));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpSV_solve(handle, transA, &h_alpha, A, x, y, typeT, alg, descr, buffer));
+
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    // The descriptor holds at least the strictly lower triangle of A, the inverse diagonal
+    // and both work vectors
+    int    nnz_L = (nnz - m) / 2;
+    size_t bytes;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_getMemoryUsage(descr, &bytes));
+
+    if(bytes < sizeof(int) * (m + 1 + nnz_L) + sizeof(T) * (nnz_L + 3 * m))
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_INTERNAL_ERROR,
+                                        "memory usage of the descriptor is too small");
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    host_csrsv_jacobi(m,
+                      5,
+                      h_alpha,
+                      hcsr_row_ptr.data(),
+                      hcol_ind.data(),
+                      hval.data(),
+                      hx.data(),
+                      hy_gold_1.data(),
+                      diag,
+                      uplo,
+                      idx_base);
+
+    // Upper triangle with as many sweeps as the longest dependency chain, which is exact,
+    // HIPSPARSE pointer mode device
+    uplo = HIPSPARSE_FILL_MODE_UPPER;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_FILL_MODE, &uplo, sizeof(uplo)));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_setJacobiSweeps(descr, 2 * ndim - 1));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpSV_analysis(handle, transA, d_alpha, A, x, y, typeT, alg, descr, buffer));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpSV_solve(handle, transA, d_alpha, A, x, y, typeT, alg, descr, buffer));
+
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    int struct_pivot  = -1;
+    int numeric_pivot = -1;
+    host_csrsv(transA,
+               m,
+               nnz,
+               h_alpha,
+               hcsr_row_ptr.data(),
+               hcol_ind.data(),
+               hval.data(),
+               hx.data(),
+               hy_gold_2.data(),
+               diag,
+               uplo,
+               idx_base,
+               &struct_pivot,
+               &numeric_pivot);
+
+    unit_check_near(1, m, 1, hy_gold_1.data(), hy_1.data());
+    unit_check_near(1, m, 1, hy_gold_2.data(), hy_2.data());
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_destroyDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 #endif // TESTING_SPSV_CSR_HPP
@@ -1177,7 +1177,8 @@ void host_prune_dense2csr_by_percentage(int                   m,
         }
     }
 
-    std::sort(sorted_A.begin(), sorted_A.end());
+    // Only the order statistic at pos is required, thus select instead of sort
+    std::nth_element(sorted_A.begin(), sorted_A.begin() + pos, sorted_A.end());
 
     T threshold = sorted_A[pos];
     host_prune_dense2csr<T>(m, n, A, lda, base, threshold, nnz, csr_val, csr_row_ptr, csr_col_ind);
@@ -1406,7 +1407,8 @@ void host_prune_csr_to_csr_by_percentage(int                     M,
         sorted_A[i] = testing_abs(csr_val_A[i]);
     }
 
-    std::sort(sorted_A.begin(), sorted_A.end());
+    // Only the order statistic at pos is required, thus select instead of sort
+    std::nth_element(sorted_A.begin(), sorted_A.begin() + pos, sorted_A.end());
 
     T threshold = sorted_A[pos];
 
@@ -4274,6 +4276,183 @@ void host_coosv(hipsparseOperation_t  trans,
                numeric_pivot);
 }
 
+// Approximate triangular solve by a fixed number of Jacobi sweeps,
+// y = D^-1 * (alpha * x - N * y), starting from y = D^-1 * alpha * x
+template <typename I, typename J, typename T>
+void host_csrsv_jacobi(J                    M,
+                       int                  sweeps,
+                       T                    alpha,
+                       const I*             csr_row_ptr,
+                       const J*             csr_col_ind,
+                       const T*             csr_val,
+                       const T*             x,
+                       T*                   y,
+                       hipsparseDiagType_t  diag_type,
+                       hipsparseFillMode_t  fill_mode,
+                       hipsparseIndexBase_t base)
+{
+    std::vector<T> diag(M, make_DataType<T>(1));
+    std::vector<T> y_old(M);
+
+    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+    {
+        for(J i = 0; i < M; ++i)
+        {
+            for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                if(csr_col_ind[j] - base == i)
+                {
+                    diag[i] = csr_val[j];
+                }
+            }
+        }
+    }
+
+    for(J i = 0; i < M; ++i)
+    {
+        y[i] = alpha * x[i] / diag[i];
+    }
+
+    for(int k = 0; k < sweeps; ++k)
+    {
+        y_old.assign(y, y + M);
+
+        for(J i = 0; i < M; ++i)
+        {
+            T sum = alpha * x[i];
+
+            for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                J col = csr_col_ind[j] - base;
+
+                if((fill_mode == HIPSPARSE_FILL_MODE_LOWER && col < i)
+                   || (fill_mode == HIPSPARSE_FILL_MODE_UPPER && col > i))
+                {
+                    sum = sum - csr_val[j] * y_old[col];
+                }
+            }
+
+            y[i] = sum / diag[i];
+        }
+    }
+}
+
+template <typename T>
+void host_gtsv_block_strided_batch(hipsparseDirection_t dir,
+                                   int                  block_dim,
+                                   int                  m,
+                                   const T*             dl,
+                                   const T*             d,
+                                   const T*             du,
+                                   T*                   x,
+                                   int                  batch_count,
+                                   int                  batch_stride)
+{
+    int bb = block_dim * block_dim;
+    int nc = block_dim + 1;
+
+    // Block element (r, c) of the block starting at p
+    auto blk = [&](const T* p, int r, int c) {
+        return dir == HIPSPARSE_DIRECTION_ROW ? p[r * block_dim + c] : p[c * block_dim + r];
+    };
+
+    for(int k = 0; k < batch_count; ++k)
+    {
+        // Block Thomas algorithm, c holds the modified upper blocks and the rhs is
+        // carried along as the last column of each row
+        std::vector<T> c(m * block_dim * nc);
+
+        for(int i = 0; i < m; ++i)
+        {
+            int row = k * batch_stride + i;
+
+            const T* L = dl + row * bb;
+            const T* D = d + row * bb;
+            const T* U = du + row * bb;
+
+            std::vector<T> S(bb);
+            T*             C = c.data() + i * block_dim * nc;
+
+            for(int r = 0; r < block_dim; ++r)
+            {
+                for(int s = 0; s < block_dim; ++s)
+                {
+                    T sum = blk(D, r, s);
+
+                    for(int q = 0; q < block_dim && i > 0; ++q)
+                    {
+                        sum = sum - blk(L, r, q) * c[((i - 1) * block_dim + q) * nc + s];
+                    }
+
+                    S[r * block_dim + s] = sum;
+                    C[r * nc + s]        = (i < m - 1) ? blk(U, r, s) : make_DataType<T>(0);
+                }
+
+                T sum = x[row * block_dim + r];
+
+                for(int q = 0; q < block_dim && i > 0; ++q)
+                {
+                    sum = sum - blk(L, r, q) * c[((i - 1) * block_dim + q) * nc + block_dim];
+                }
+
+                C[r * nc + block_dim] = sum;
+            }
+
+            // Gaussian elimination of S without pivoting, applied to all columns of C
+            for(int p = 0; p < block_dim; ++p)
+            {
+                for(int r = p + 1; r < block_dim; ++r)
+                {
+                    T f = S[r * block_dim + p] / S[p * block_dim + p];
+
+                    for(int s = p; s < block_dim; ++s)
+                    {
+                        S[r * block_dim + s] = S[r * block_dim + s] - f * S[p * block_dim + s];
+                    }
+
+                    for(int s = 0; s < nc; ++s)
+                    {
+                        C[r * nc + s] = C[r * nc + s] - f * C[p * nc + s];
+                    }
+                }
+            }
+
+            for(int p = block_dim - 1; p >= 0; --p)
+            {
+                for(int s = 0; s < nc; ++s)
+                {
+                    T sum = C[p * nc + s];
+
+                    for(int q = p + 1; q < block_dim; ++q)
+                    {
+                        sum = sum - S[p * block_dim + q] * C[q * nc + s];
+                    }
+
+                    C[p * nc + s] = sum / S[p * block_dim + p];
+                }
+            }
+        }
+
+        // Back substitution
+        for(int i = m - 1; i >= 0; --i)
+        {
+            int row = k * batch_stride + i;
+
+            for(int r = 0; r < block_dim; ++r)
+            {
+                T sum = c[(i * block_dim + r) * nc + block_dim];
+
+                for(int q = 0; q < block_dim && i < m - 1; ++q)
+                {
+                    sum = sum - c[(i * block_dim + r) * nc + q] * x[(row + 1) * block_dim + q];
+                }
+
+                x[row * block_dim + r] = sum;
+            }
+        }
+    }
+}
+
 template <typename I, typename J, typename T>
 void host_csrsm(J                     M,
                 J                     nrhs,
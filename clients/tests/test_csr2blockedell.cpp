@@ -0,0 +1,57 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csr2blockedell.hpp"
+
+#include <hipsparse.h>
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+TEST(csr2blockedell_bad_arg, csr2blockedell_float)
+{
+    testing_csr2blockedell_bad_arg<float>();
+}
+#endif
+
+#if(!defined(CUDART_VERSION))
+TEST(csr2blockedell, csr2blockedell_float)
+{
+    hipsparseStatus_t status
+        = testing_csr2blockedell<float>(250, 200, 4, HIPSPARSE_INDEX_BASE_ZERO);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(csr2blockedell, csr2blockedell_double)
+{
+    hipsparseStatus_t status
+        = testing_csr2blockedell<double>(130, 150, 2, HIPSPARSE_INDEX_BASE_ONE);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(csr2blockedell, csr2blockedell_hipComplex)
+{
+    hipsparseStatus_t status
+        = testing_csr2blockedell<hipComplex>(97, 64, 8, HIPSPARSE_INDEX_BASE_ZERO);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
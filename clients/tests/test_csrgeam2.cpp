@@ -152,6 +152,25 @@ TEST_P(parameterized_csrgeam2_bin, csrgeam2_bin_double)
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
 
+TEST(csrgeam2_same_pattern, csrgeam2_same_pattern_float)
+{
+    hipsparseStatus_t status = testing_csrgeam2_same_pattern<float>(13, HIPSPARSE_INDEX_BASE_ZERO);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(csrgeam2_same_pattern, csrgeam2_same_pattern_double)
+{
+    hipsparseStatus_t status = testing_csrgeam2_same_pattern<double>(27, HIPSPARSE_INDEX_BASE_ONE);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(csrgeam2_same_pattern, csrgeam2_same_pattern_double_complex)
+{
+    hipsparseStatus_t status
+        = testing_csrgeam2_same_pattern<hipDoubleComplex>(9, HIPSPARSE_INDEX_BASE_ZERO);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
 INSTANTIATE_TEST_SUITE_P(csrgeam2,
                          parameterized_csrgeam2,
                          testing::Combine(testing::ValuesIn(csrgeam2_M_range),
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gtsv_block_strided_batch.hpp"
+
+#include <hipsparse.h>
+
+TEST(gtsv_block_strided_batch_bad_arg, gtsv_block_strided_batch_float)
+{
+    testing_gtsv_block_strided_batch_bad_arg<float>();
+}
+
+TEST(gtsv_block_strided_batch, gtsv_block_strided_batch_float)
+{
+    hipsparseStatus_t status
+        = testing_gtsv_block_strided_batch<float>(HIPSPARSE_DIRECTION_ROW, 3, 64, 32, 64);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(gtsv_block_strided_batch, gtsv_block_strided_batch_double)
+{
+    hipsparseStatus_t status
+        = testing_gtsv_block_strided_batch<double>(HIPSPARSE_DIRECTION_COLUMN, 5, 33, 17, 36);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(gtsv_block_strided_batch, gtsv_block_strided_batch_hipComplex)
+{
+    hipsparseStatus_t status
+        = testing_gtsv_block_strided_batch<hipComplex>(HIPSPARSE_DIRECTION_ROW, 4, 20, 8, 25);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(gtsv_block_strided_batch, gtsv_block_strided_batch_hipDoubleComplex)
+{
+    hipsparseStatus_t status = testing_gtsv_block_strided_batch<hipDoubleComplex>(
+        HIPSPARSE_DIRECTION_COLUMN, 2, 100, 10, 100);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_spassemble_csr.hpp"
+
+#include <hipsparse.h>
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+TEST(spassemble_csr_bad_arg, spassemble_csr_float)
+{
+    testing_spassemble_csr_bad_arg();
+}
+
+TEST(spassemble_csr, spassemble_csr_float)
+{
+    hipsparseStatus_t status = testing_spassemble_csr<float>(16, HIPSPARSE_INDEX_BASE_ZERO);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spassemble_csr, spassemble_csr_double)
+{
+    hipsparseStatus_t status = testing_spassemble_csr<double>(41, HIPSPARSE_INDEX_BASE_ONE);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spassemble_csr, spassemble_csr_hipComplex)
+{
+    hipsparseStatus_t status = testing_spassemble_csr<hipComplex>(8, HIPSPARSE_INDEX_BASE_ONE);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spassemble_csr, spassemble_csr_hipDoubleComplex)
+{
+    hipsparseStatus_t status
+        = testing_spassemble_csr<hipDoubleComplex>(25, HIPSPARSE_INDEX_BASE_ZERO);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
@@ -54,4 +54,28 @@ TEST(spgemm_csr, spgemm_csr_i64_i64_hipDoubleComplex)
     hipsparseStatus_t status = testing_spgemm_csr<int64_t, int64_t, hipDoubleComplex>();
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
+
+TEST(spgemm_csr_chunked, spgemm_csr_chunked_float)
+{
+    hipsparseStatus_t status = testing_spgemm_csr_chunked<float>(1 << 16);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spgemm_csr_chunked, spgemm_csr_chunked_double)
+{
+    hipsparseStatus_t status = testing_spgemm_csr_chunked<double>(1 << 20);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spgemm_csr_chunked, spgemm_csr_chunked_hipComplex)
+{
+    hipsparseStatus_t status = testing_spgemm_csr_chunked<hipComplex>(1 << 16);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spgemm_csr_chunked, spgemm_csr_chunked_hipDoubleComplex)
+{
+    hipsparseStatus_t status = testing_spgemm_csr_chunked<hipDoubleComplex>(1 << 16);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
 #endif
@@ -0,0 +1,69 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_spgs_csr.hpp"
+
+#include <hipsparse.h>
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11010)
+TEST(spgs_csr_bad_arg, spgs_csr_float)
+{
+    testing_spgs_csr_bad_arg();
+}
+
+TEST(spgs_csr, spgs_csr_forward_float)
+{
+    hipsparseStatus_t status = testing_spgs_csr<float>(
+        32, HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_SPGS_SWEEP_FORWARD, 1.0);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spgs_csr, spgs_csr_backward_double)
+{
+    hipsparseStatus_t status = testing_spgs_csr<double>(
+        50, HIPSPARSE_INDEX_BASE_ONE, HIPSPARSE_SPGS_SWEEP_BACKWARD, 1.0);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spgs_csr, spgs_csr_symmetric_sor_double)
+{
+    hipsparseStatus_t status = testing_spgs_csr<double>(
+        64, HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_SPGS_SWEEP_SYMMETRIC, 1.3);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spgs_csr, spgs_csr_symmetric_hipComplex)
+{
+    hipsparseStatus_t status = testing_spgs_csr<hipComplex>(
+        24, HIPSPARSE_INDEX_BASE_ONE, HIPSPARSE_SPGS_SWEEP_SYMMETRIC, 0.8);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spgs_csr, spgs_csr_forward_sor_hipDoubleComplex)
+{
+    hipsparseStatus_t status = testing_spgs_csr<hipDoubleComplex>(
+        40, HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_SPGS_SWEEP_FORWARD, 1.5);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
@@ -49,4 +49,16 @@ TEST(spmm_csr, spmm_csr_i32_i32_hipComplex)
     hipsparseStatus_t status = testing_spmm_csr<int32_t, int32_t, hipComplex>();
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
+
+TEST(spmm_csr, spmm_csr_streamed_i32_i32_float)
+{
+    hipsparseStatus_t status = testing_spmm_csr_streamed<int32_t, int32_t, float>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spmm_csr, spmm_csr_streamed_i64_i32_double)
+{
+    hipsparseStatus_t status = testing_spmm_csr_streamed<int64_t, int32_t, double>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
 #endif
\ No newline at end of file
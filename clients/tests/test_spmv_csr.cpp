@@ -51,4 +51,66 @@ TEST(spmv_csr, spmv_csr_i64_i64_hipComplex)
     hipsparseStatus_t status = testing_spmv_csr<int64_t, int64_t, hipComplex>();
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
+
+TEST(spmv_csr, spmv_csr_i32_i32_i8_float)
+{
+    hipsparseStatus_t status = testing_spmv_csr_mixed();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spmv_csr, spmv_csr_streamed_i32_i32_float)
+{
+    hipsparseStatus_t status = testing_spmv_csr_streamed<int32_t, int32_t, float>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+#if(!defined(CUDART_VERSION))
+TEST(spmv_csr, spmv_csr_streamed_i64_i32_double)
+{
+    hipsparseStatus_t status = testing_spmv_csr_streamed<int64_t, int32_t, double>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spmv_csr, spmv_csr_symmetric_i32_i32_float)
+{
+    hipsparseStatus_t status = testing_spmv_csr_symmetric<int32_t, int32_t, float>(
+        HIPSPARSE_OPERATION_NON_TRANSPOSE, 0);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spmv_csr, spmv_csr_symmetric_i64_i32_double)
+{
+    hipsparseStatus_t status = testing_spmv_csr_symmetric<int64_t, int32_t, double>(
+        HIPSPARSE_OPERATION_NON_TRANSPOSE, 0);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spmv_csr, spmv_csr_symmetric_transpose_cache_float)
+{
+    hipsparseStatus_t status = testing_spmv_csr_symmetric<int32_t, int32_t, float>(
+        HIPSPARSE_OPERATION_TRANSPOSE, 64 << 20);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spmv_csr, spmv_csr_symmetric_transpose_cache_double)
+{
+    hipsparseStatus_t status = testing_spmv_csr_symmetric<int32_t, int32_t, double>(
+        HIPSPARSE_OPERATION_TRANSPOSE, 64 << 20);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+TEST(spmv_csr, spmv_csr_transpose_cache_float)
+{
+    hipsparseStatus_t status = testing_spmv_csr_transpose_cache<float>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spmv_csr, spmv_csr_transpose_cache_double)
+{
+    hipsparseStatus_t status = testing_spmv_csr_transpose_cache<double>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
 #endif
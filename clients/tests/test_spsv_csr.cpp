@@ -51,4 +51,18 @@ TEST(spsv_csr, spsv_csr_i64_i64_hipComplex)
     hipsparseStatus_t status = testing_spsv_csr<int64_t, int64_t, hipComplex>();
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+TEST(spsv_csr, spsv_csr_jacobi_float)
+{
+    hipsparseStatus_t status = testing_spsv_csr_jacobi<float>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spsv_csr, spsv_csr_jacobi_hipDoubleComplex)
+{
+    hipsparseStatus_t status = testing_spsv_csr_jacobi<hipDoubleComplex>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
 #endif
@@ -161,6 +161,32 @@ typedef struct pruneInfo* pruneInfo_t;
  */
 struct csru2csrInfo;
 typedef struct csru2csrInfo* csru2csrInfo_t;
+/*! \ingroup types_module
+ *  \brief csrPrecond info to hold the triangular solve data of a preconditioner apply.
+ */
+struct csrPrecondInfo;
+typedef struct csrPrecondInfo* csrPrecondInfo_t;
+/*! \ingroup types_module
+ *  \brief gtsvBlock info to hold the analysis data of a batched block tridiagonal solve.
+ */
+struct gtsvBlockInfo;
+typedef struct gtsvBlockInfo* gtsvBlockInfo_t;
+/*! \ingroup types_module
+ *  \brief csrmv info to hold the analysis data of a load balanced csrmv.
+ */
+struct csrmvInfo;
+typedef struct csrmvInfo* csrmvInfo_t;
+/*! \ingroup types_module
+ *  \brief Pool of hipSPARSE handles.
+ *
+ *  \details
+ *  The hipSPARSE handle pool recycles library contexts across threads. It must be
+ *  initialized using hipsparseCreateHandlePool(). Handles are obtained using
+ *  hipsparseHandlePoolAcquire() and returned using hipsparseHandlePoolRelease(). The
+ *  pool should be destroyed at the end using hipsparseDestroyHandlePool().
+ */
+struct hipsparseHandlePool;
+typedef struct hipsparseHandlePool* hipsparseHandlePool_t;
 
 // clang-format off
 
@@ -304,6 +330,24 @@ typedef enum {
     HIPSPARSE_INDEX_BASE_ONE  = 1
 } hipsparseIndexBase_t;
 
+/*! \ingroup types_module
+ *  \brief Specify structural properties of a matrix.
+ *
+ *  \details
+ *  The \ref hipsparseMatProperty_t flags describe structural properties that are known
+ *  to hold for the matrix of a \ref hipsparseMatDescr_t. They can be combined with a
+ *  bitwise or, set using hipsparseSetMatProperties() and obtained by
+ *  hipsparseGetMatProperties(). Routines use them to skip work that is only needed in
+ *  the general case. The properties are not validated, they can be determined with
+ *  hipsparseXcsrCheckProperties().
+ */
+typedef enum {
+    HIPSPARSE_MAT_PROPERTY_SORTED            = 1, // Column indices of each row are sorted
+    HIPSPARSE_MAT_PROPERTY_UNIQUE            = 2, // No duplicated column indices in a row
+    HIPSPARSE_MAT_PROPERTY_SYMMETRIC_PATTERN = 4, // Sparsity pattern is symmetric
+    HIPSPARSE_MAT_PROPERTY_FULL_DIAGONAL     = 8 // All diagonal entries are stored
+} hipsparseMatProperty_t;
+
 /*! \ingroup types_module
  *  \brief Specify whether the matrix is to be transposed or not.
  *
@@ -449,6 +493,62 @@ hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePoi
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode);
 
+/*! \ingroup aux_module
+ *  \brief Create a hipsparse handle pool
+ *
+ *  \details
+ *  \p hipsparseCreateHandlePool creates a pool of hipSPARSE library contexts for the
+ *  current device. The pool is initially empty, handles are created on demand by
+ *  hipsparseHandlePoolAcquire(). The pool should be destroyed at the end using
+ *  hipsparseDestroyHandlePool().
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateHandlePool(hipsparseHandlePool_t* pool);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a hipsparse handle pool
+ *
+ *  \details
+ *  \p hipsparseDestroyHandlePool destroys all handles held by the pool and releases the
+ *  pool. All handles acquired from the pool must have been released beforehand, otherwise
+ *  \ref HIPSPARSE_STATUS_INVALID_VALUE is returned and the pool is left untouched.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyHandlePool(hipsparseHandlePool_t pool);
+
+/*! \ingroup aux_module
+ *  \brief Acquire a hipsparse handle from a handle pool
+ *
+ *  \details
+ *  \p hipsparseHandlePoolAcquire hands out a handle that is used exclusively by the
+ *  calling thread until it is returned using hipsparseHandlePoolRelease(). An idle handle
+ *  of the pool is reused if available, otherwise a new handle is created. The handle is
+ *  bound to \p streamId and its pointer mode is reset to \ref HIPSPARSE_POINTER_MODE_HOST.
+ *  The current device must match the device the pool has been created on.
+ *
+ *  \note
+ *  This function is thread-safe. Concurrent threads acquiring from the same pool receive
+ *  distinct handles, such that stream and pointer mode settings do not race.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseHandlePoolAcquire(hipsparseHandlePool_t pool,
+                                             hipStream_t           streamId,
+                                             hipsparseHandle_t*    handle);
+
+/*! \ingroup aux_module
+ *  \brief Release a hipsparse handle to a handle pool
+ *
+ *  \details
+ *  \p hipsparseHandlePoolRelease returns a handle, that has been obtained using
+ *  hipsparseHandlePoolAcquire(), to the pool such that it can be reused by other
+ *  threads. Work that has been submitted using the handle is not synchronized.
+ *
+ *  \note
+ *  This function is thread-safe.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseHandlePoolRelease(hipsparseHandlePool_t pool, hipsparseHandle_t handle);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix descriptor
  *  \details
@@ -560,6 +660,57 @@ hipsparseStatus_t hipsparseSetMatIndexBase(hipsparseMatDescr_t descrA, hipsparse
 HIPSPARSE_EXPORT
 hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA);
 
+/*! \ingroup aux_module
+ *  \brief Specify the structural properties of a matrix descriptor
+ *
+ *  \details
+ *  \p hipsparseSetMatProperties sets the \ref hipsparseMatProperty_t flags of a matrix
+ *  descriptor, replacing previously set flags. The flags are a promise of the caller;
+ *  results are undefined if the matrix does not have the properties.
+ *
+ *  Currently, \ref HIPSPARSE_MAT_PROPERTY_SORTED lets hipsparseXcsrsort() and
+ *  hipsparseXcsru2csr() return without sorting. The other properties are informational.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetMatProperties(hipsparseMatDescr_t descrA, int properties);
+
+/*! \ingroup aux_module
+ *  \brief Get the structural properties of a matrix descriptor
+ *
+ *  \details
+ *  \p hipsparseGetMatProperties returns the \ref hipsparseMatProperty_t flags of a
+ *  matrix descriptor, which are 0 unless set by hipsparseSetMatProperties().
+ */
+HIPSPARSE_EXPORT
+int hipsparseGetMatProperties(const hipsparseMatDescr_t descrA);
+
+/*! \ingroup aux_module
+ *  \brief Specify the sparsity pattern id of a matrix descriptor
+ *
+ *  \details
+ *  \p hipsparseSetMatPatternId tags a matrix descriptor with an id of its sparsity
+ *  pattern, chosen by the application. Matrices whose descriptors carry the same non-zero
+ *  id are assumed to have identical row offsets and column indices. An id of 0 marks the
+ *  pattern as unknown, which is the default.
+ *
+ *  If \p descrA and \p descrB carry the same pattern id and all three descriptors share
+ *  the index base, hipsparseXcsrgeam2Nnz() copies the row offsets of A and
+ *  hipsparseXcsrgeam2() computes the values of C as a plain vector sum. The arrays of C
+ *  may then alias those of A or those of B, e.g. to update a matrix in place, but the
+ *  values of C must not alias the values of both A and B.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetMatPatternId(hipsparseMatDescr_t descrA, uint64_t patternId);
+
+/*! \ingroup aux_module
+ *  \brief Get the sparsity pattern id of a matrix descriptor
+ *
+ *  \details
+ *  \p hipsparseGetMatPatternId returns the sparsity pattern id of a matrix descriptor.
+ */
+HIPSPARSE_EXPORT
+uint64_t hipsparseGetMatPatternId(const hipsparseMatDescr_t descrA);
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
 /*! \ingroup aux_module
  *  \brief Create a \p HYB matrix structure
@@ -772,6 +923,71 @@ hipsparseStatus_t hipsparseCreateCsru2csrInfo(csru2csrInfo_t* info);
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseDestroyCsru2csrInfo(csru2csrInfo_t info);
 
+/* Info structures */
+/*! \ingroup aux_module
+ *  \brief Create a csrPrecond info structure
+ *
+ *  \details
+ *  \p hipsparseCreateCsrPrecondInfo creates a structure that holds the triangular solve
+ *  data of hipsparseXcsrilu02Apply() and hipsparseXcsric02Apply(). It should be destroyed
+ *  at the end using hipsparseDestroyCsrPrecondInfo().
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateCsrPrecondInfo(csrPrecondInfo_t* info);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a csrPrecond info structure
+ *
+ *  \details
+ *  \p hipsparseDestroyCsrPrecondInfo destroys a csrPrecond info structure.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyCsrPrecondInfo(csrPrecondInfo_t info);
+
+/* Info structures */
+/*! \ingroup aux_module
+ *  \brief Create a gtsvBlock info structure
+ *
+ *  \details
+ *  \p hipsparseCreateGtsvBlockInfo creates a structure that holds the analysis data of
+ *  hipsparseXgtsvBlockStridedBatch(). It should be destroyed at the end using
+ *  hipsparseDestroyGtsvBlockInfo().
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateGtsvBlockInfo(gtsvBlockInfo_t* info);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a gtsvBlock info structure
+ *
+ *  \details
+ *  \p hipsparseDestroyGtsvBlockInfo destroys a gtsvBlock info structure.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyGtsvBlockInfo(gtsvBlockInfo_t info);
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
+/* Info structures */
+/*! \ingroup aux_module
+ *  \brief Create a csrmv info structure
+ *
+ *  \details
+ *  \p hipsparseCreateCsrmvInfo creates a structure that holds the csrmv info data
+ *  that is gathered during hipsparseXcsrmv_analysis(). It should be destroyed
+ *  at the end using hipsparseDestroyCsrmvInfo().
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateCsrmvInfo(csrmvInfo_t* info);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a csrmv info structure
+ *
+ *  \details
+ *  \p hipsparseDestroyCsrmvInfo destroys a csrmv info structure.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyCsrmvInfo(csrmvInfo_t info);
+#endif
+
 /* Info structures */
 /*! \ingroup aux_module
  *  \brief Create a color info structure
@@ -1276,6 +1492,13 @@ hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
 *  \endcode
 *
 *  \note
+*  If the matrix type of \p descrA is \ref HIPSPARSE_MATRIX_TYPE_SYMMETRIC or
+*  \ref HIPSPARSE_MATRIX_TYPE_HERMITIAN, only the lower or upper triangular part of the
+*  matrix, selected by the fill mode of \p descrA, is stored and accessed. The strictly
+*  triangular entries are applied twice, such that the product with the full matrix is
+*  computed.
+*
+*  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
@@ -1344,6 +1567,152 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y);
 /**@}*/
+
+/*! \ingroup level2_module
+*  \brief Sparse matrix vector multiplication using CSR storage format
+*
+*  \details
+*  \p hipsparseXcsrmv_analysis performs the analysis step for hipsparseXcsrmvWithInfo().
+*  The gathered meta data is stored in the \p info structure and can be re-used by
+*  all subsequent calls to hipsparseXcsrmvWithInfo() with the same sparsity pattern.
+*  This is worthwhile when the matrix is multiplied many times, e.g. in iterative
+*  solvers.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrmv_analysis(hipsparseHandle_t         handle,
+                                           hipsparseOperation_t      transA,
+                                           int                       m,
+                                           int                       n,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const float*              csrSortedValA,
+                                           const int*                csrSortedRowPtrA,
+                                           const int*                csrSortedColIndA,
+                                           csrmvInfo_t               info);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrmv_analysis(hipsparseHandle_t         handle,
+                                           hipsparseOperation_t      transA,
+                                           int                       m,
+                                           int                       n,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const double*             csrSortedValA,
+                                           const int*                csrSortedRowPtrA,
+                                           const int*                csrSortedColIndA,
+                                           csrmvInfo_t               info);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrmv_analysis(hipsparseHandle_t         handle,
+                                           hipsparseOperation_t      transA,
+                                           int                       m,
+                                           int                       n,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const hipComplex*         csrSortedValA,
+                                           const int*                csrSortedRowPtrA,
+                                           const int*                csrSortedColIndA,
+                                           csrmvInfo_t               info);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrmv_analysis(hipsparseHandle_t         handle,
+                                           hipsparseOperation_t      transA,
+                                           int                       m,
+                                           int                       n,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const hipDoubleComplex*   csrSortedValA,
+                                           const int*                csrSortedRowPtrA,
+                                           const int*                csrSortedColIndA,
+                                           csrmvInfo_t               info);
+/**@}*/
+
+/*! \ingroup level2_module
+*  \brief Sparse matrix vector multiplication using CSR storage format
+*
+*  \details
+*  \p hipsparseXcsrmvWithInfo computes the same product as hipsparseXcsrmv, i.e.
+*  \f[
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+*  \f]
+*  using the meta data gathered by hipsparseXcsrmv_analysis() in \p info. This selects
+*  the load balanced csrmv kernel, which is robust against matrices with irregular row
+*  lengths. If \p info has not been analysed, hipsparseXcsrmvWithInfo falls back to
+*  hipsparseXcsrmv.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  Currently, only \p trans == \ref HIPSPARSE_OPERATION_NON_TRANSPOSE is supported.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrmvWithInfo(hipsparseHandle_t         handle,
+                                          hipsparseOperation_t      transA,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnz,
+                                          const float*              alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const float*              csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrmvInfo_t               info,
+                                          const float*              x,
+                                          const float*              beta,
+                                          float*                    y);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrmvWithInfo(hipsparseHandle_t         handle,
+                                          hipsparseOperation_t      transA,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnz,
+                                          const double*             alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const double*             csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrmvInfo_t               info,
+                                          const double*             x,
+                                          const double*             beta,
+                                          double*                   y);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrmvWithInfo(hipsparseHandle_t         handle,
+                                          hipsparseOperation_t      transA,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnz,
+                                          const hipComplex*         alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipComplex*         csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrmvInfo_t               info,
+                                          const hipComplex*         x,
+                                          const hipComplex*         beta,
+                                          hipComplex*               y);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrmvWithInfo(hipsparseHandle_t         handle,
+                                          hipsparseOperation_t      transA,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnz,
+                                          const hipDoubleComplex*   alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipDoubleComplex*   csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrmvInfo_t               info,
+                                          const hipDoubleComplex*   x,
+                                          const hipDoubleComplex*   beta,
+                                          hipDoubleComplex*         y);
+/**@}*/
 #endif
 
 /*! \ingroup level2_module
@@ -4435,6 +4804,25 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t
     hipsparseXbsrilu02_zeroPivot(hipsparseHandle_t handle, bsrilu02Info_t info, int* position);
 
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR
+*  storage format
+*
+*  \details
+*  \p hipsparseXbsrilu02_trim releases the analysis data of hipsparseXbsrilu02_analysis()
+*  that is held in \p info, once the factorization has been computed. The factors are
+*  stored in the user arrays and are not affected. Long running applications that cache
+*  many factorizations can use it to reduce the device memory held by the info objects.
+*
+*  \note
+*  hipsparseXbsrilu02_analysis() has to be called again before the factorization is
+*  recomputed. If the backend cannot release the analysis data separately,
+*  \ref HIPSPARSE_STATUS_NOT_SUPPORTED is returned and the data is released by
+*  hipsparseDestroyBsrilu02Info().
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXbsrilu02_trim(hipsparseHandle_t handle, bsrilu02Info_t info);
+
 /*! \ingroup precond_module
  *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
  *  format
@@ -4710,6 +5098,27 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t
     hipsparseXcsrilu02_zeroPivot(hipsparseHandle_t handle, csrilu02Info_t info, int* position);
 
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p hipsparseXcsrilu02_trim releases the analysis data of hipsparseXcsrilu02_analysis()
+*  that is held in \p info, once the factorization has been computed. The factors are
+*  stored in the user arrays and are not affected. The analysis of the triangular solves of
+*  hipsparseXcsrilu02Apply_analysis(), which may share data with the factorization
+*  analysis, is kept. Long running applications that cache many factorizations can use it
+*  to reduce the device memory held by the info objects.
+*
+*  \note
+*  hipsparseXcsrilu02_analysis() has to be called again before the factorization is
+*  recomputed. If the backend cannot release the analysis data separately,
+*  \ref HIPSPARSE_STATUS_NOT_SUPPORTED is returned and the data is released by
+*  hipsparseDestroyCsrilu02Info().
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsrilu02_trim(hipsparseHandle_t handle, csrilu02Info_t info);
+
 /*! \ingroup precond_module
  *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR storage
  *  format
@@ -5022,6 +5431,25 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t
     hipsparseXbsric02_zeroPivot(hipsparseHandle_t handle, bsric02Info_t info, int* position);
 
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+*  storage format
+*
+*  \details
+*  \p hipsparseXbsric02_trim releases the analysis data of hipsparseXbsric02_analysis()
+*  that is held in \p info, once the factorization has been computed. The factors are
+*  stored in the user arrays and are not affected. Long running applications that cache
+*  many factorizations can use it to reduce the device memory held by the info objects.
+*
+*  \note
+*  hipsparseXbsric02_analysis() has to be called again before the factorization is
+*  recomputed. If the backend cannot release the analysis data separately,
+*  \ref HIPSPARSE_STATUS_NOT_SUPPORTED is returned and the data is released by
+*  hipsparseDestroyBsric02Info().
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXbsric02_trim(hipsparseHandle_t handle, bsric02Info_t info);
+
 /*! \ingroup precond_module
  *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
  *  storage format
@@ -5247,6 +5675,27 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t
     hipsparseXcsric02_zeroPivot(hipsparseHandle_t handle, csric02Info_t info, int* position);
 
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p hipsparseXcsric02_trim releases the analysis data of hipsparseXcsric02_analysis()
+*  that is held in \p info, once the factorization has been computed. The factors are
+*  stored in the user arrays and are not affected. The analysis of the triangular solves of
+*  hipsparseXcsric02Apply_analysis(), which may share data with the factorization analysis,
+*  is kept. Long running applications that cache many factorizations can use it to reduce
+*  the device memory held by the info objects.
+*
+*  \note
+*  hipsparseXcsric02_analysis() has to be called again before the factorization is
+*  recomputed. If the backend cannot release the analysis data separately,
+*  \ref HIPSPARSE_STATUS_NOT_SUPPORTED is returned and the data is released by
+*  hipsparseDestroyCsric02Info().
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsric02_trim(hipsparseHandle_t handle, csric02Info_t info);
+
 /*! \ingroup precond_module
 *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
 *  storage format
@@ -5491,67 +5940,477 @@ hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Tridiagonal solver with pivoting
+*  \brief Apply an ILU0 preconditioner using CSR storage format
 *
 *  \details
-*  \p hipsparseXgtsv2_bufferSize returns the size of the temporary storage buffer
-*  that is required by hipsparseXgtsv2(). The temporary storage buffer must be
-*  allocated by the user.
+*  \p hipsparseXcsrilu02Apply_bufferSize returns the size of the temporary storage buffer that
+*  is required by hipsparseXcsrilu02Apply_analysis() and hipsparseXcsrilu02Apply(). The temporary
+*  storage buffer must be allocated by the user.
 */
 /**@{*/
 HIPSPARSE_EXPORT
-hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
-                                                int               m,
-                                                int               n,
-                                                const float*      dl,
-                                                const float*      d,
-                                                const float*      du,
-                                                const float*      B,
-                                                int               ldb,
-                                                size_t*           pBufferSizeInBytes);
-
-HIPSPARSE_EXPORT
-hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
-                                                int               m,
-                                                int               n,
-                                                const double*     dl,
-                                                const double*     d,
-                                                const double*     du,
-                                                const double*     B,
-                                                int               db,
-                                                size_t*           pBufferSizeInBytes);
-
-HIPSPARSE_EXPORT
-hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
-                                                int               m,
-                                                int               n,
-                                                const hipComplex* dl,
-                                                const hipComplex* d,
-                                                const hipComplex* du,
-                                                const hipComplex* B,
-                                                int               ldb,
-                                                size_t*           pBufferSizeInBytes);
-
-HIPSPARSE_EXPORT
-hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
-                                                int                     m,
-                                                int                     n,
-                                                const hipDoubleComplex* dl,
-                                                const hipDoubleComplex* d,
-                                                const hipDoubleComplex* du,
-                                                const hipDoubleComplex* B,
-                                                int                     ldb,
-                                                size_t*                 pBufferSizeInBytes);
+hipsparseStatus_t hipsparseScsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       nnz,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     float*                    csrSortedValA,
+                                                     const int*                csrSortedRowPtrA,
+                                                     const int*                csrSortedColIndA,
+                                                     csrilu02Info_t            factorInfo,
+                                                     csrPrecondInfo_t          info,
+                                                     int*                      pBufferSizeInBytes);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       nnz,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     double*                   csrSortedValA,
+                                                     const int*                csrSortedRowPtrA,
+                                                     const int*                csrSortedColIndA,
+                                                     csrilu02Info_t            factorInfo,
+                                                     csrPrecondInfo_t          info,
+                                                     int*                      pBufferSizeInBytes);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       nnz,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     hipComplex*               csrSortedValA,
+                                                     const int*                csrSortedRowPtrA,
+                                                     const int*                csrSortedColIndA,
+                                                     csrilu02Info_t            factorInfo,
+                                                     csrPrecondInfo_t          info,
+                                                     int*                      pBufferSizeInBytes);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       nnz,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     hipDoubleComplex*         csrSortedValA,
+                                                     const int*                csrSortedRowPtrA,
+                                                     const int*                csrSortedColIndA,
+                                                     csrilu02Info_t            factorInfo,
+                                                     csrPrecondInfo_t          info,
+                                                     int*                      pBufferSizeInBytes);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Tridiagonal solver with pivoting
+*  \brief Apply an ILU0 preconditioner using CSR storage format
 *
 *  \details
-*  \p hipsparseXgtsv2 solves a tridiagonal system for multiple right hand sides using pivoting.
+*  \p hipsparseXcsrilu02Apply_analysis performs the analysis step of both triangular solves of
+*  hipsparseXcsrilu02Apply(). The factor \p factorInfo has to be computed by hipsparseXcsrilu02()
+*  beforehand. The analysis only depends on the sparsity pattern and stays valid when the
+*  factorization is recomputed for new values.
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
+*  If the backend supports it, the analysis of the lower triangular solve is shared with
+*  the analysis of hipsparseXcsrilu02() that is stored in \p factorInfo.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const float*              csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            factorInfo,
+                                                   csrPrecondInfo_t          info,
+                                                   hipsparseSolvePolicy_t    policy,
+                                                   void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const double*             csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            factorInfo,
+                                                   csrPrecondInfo_t          info,
+                                                   hipsparseSolvePolicy_t    policy,
+                                                   void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const hipComplex*         csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            factorInfo,
+                                                   csrPrecondInfo_t          info,
+                                                   hipsparseSolvePolicy_t    policy,
+                                                   void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const hipDoubleComplex*   csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            factorInfo,
+                                                   csrPrecondInfo_t          info,
+                                                   hipsparseSolvePolicy_t    policy,
+                                                   void*                     pBuffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Apply an ILU0 preconditioner using CSR storage format
+*
+*  \details
+*  \p hipsparseXcsrilu02Apply solves
+*  \f[
+*    LU \cdot x = \alpha \cdot f,
+*  \f]
+*  where \f$LU\f$ is the incomplete LU factorization of \f$A\f$ computed in place
+*  by hipsparseXcsrilu02(). Both triangular solves share a single temporary storage buffer, that
+*  also holds the intermediate vector, and the analysis data of \p info and
+*  \p factorInfo. \p f and \p x may point to the same vector.
+*
+*  \note
+*  Zero pivots of the factor are reported by hipsparseXcsrilu02_zeroPivot().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrilu02Apply(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       nnz,
+                                          const float*              alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const float*              csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrilu02Info_t            factorInfo,
+                                          csrPrecondInfo_t          info,
+                                          const float*              f,
+                                          float*                    x,
+                                          hipsparseSolvePolicy_t    policy,
+                                          void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrilu02Apply(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       nnz,
+                                          const double*             alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const double*             csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrilu02Info_t            factorInfo,
+                                          csrPrecondInfo_t          info,
+                                          const double*             f,
+                                          double*                   x,
+                                          hipsparseSolvePolicy_t    policy,
+                                          void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrilu02Apply(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipComplex*         alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipComplex*         csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrilu02Info_t            factorInfo,
+                                          csrPrecondInfo_t          info,
+                                          const hipComplex*         f,
+                                          hipComplex*               x,
+                                          hipsparseSolvePolicy_t    policy,
+                                          void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrilu02Apply(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipDoubleComplex*   alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipDoubleComplex*   csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrilu02Info_t            factorInfo,
+                                          csrPrecondInfo_t          info,
+                                          const hipDoubleComplex*   f,
+                                          hipDoubleComplex*         x,
+                                          hipsparseSolvePolicy_t    policy,
+                                          void*                     pBuffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Apply an IC0 preconditioner using CSR storage format
+*
+*  \details
+*  \p hipsparseXcsric02Apply_bufferSize returns the size of the temporary storage buffer that
+*  is required by hipsparseXcsric02Apply_analysis() and hipsparseXcsric02Apply(). The temporary
+*  storage buffer must be allocated by the user.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       nnz,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    float*                    csrSortedValA,
+                                                    const int*                csrSortedRowPtrA,
+                                                    const int*                csrSortedColIndA,
+                                                    csric02Info_t             factorInfo,
+                                                    csrPrecondInfo_t          info,
+                                                    int*                      pBufferSizeInBytes);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       nnz,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    double*                   csrSortedValA,
+                                                    const int*                csrSortedRowPtrA,
+                                                    const int*                csrSortedColIndA,
+                                                    csric02Info_t             factorInfo,
+                                                    csrPrecondInfo_t          info,
+                                                    int*                      pBufferSizeInBytes);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       nnz,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    hipComplex*               csrSortedValA,
+                                                    const int*                csrSortedRowPtrA,
+                                                    const int*                csrSortedColIndA,
+                                                    csric02Info_t             factorInfo,
+                                                    csrPrecondInfo_t          info,
+                                                    int*                      pBufferSizeInBytes);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       nnz,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    hipDoubleComplex*         csrSortedValA,
+                                                    const int*                csrSortedRowPtrA,
+                                                    const int*                csrSortedColIndA,
+                                                    csric02Info_t             factorInfo,
+                                                    csrPrecondInfo_t          info,
+                                                    int*                      pBufferSizeInBytes);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Apply an IC0 preconditioner using CSR storage format
+*
+*  \details
+*  \p hipsparseXcsric02Apply_analysis performs the analysis step of both triangular solves of
+*  hipsparseXcsric02Apply(). The factor \p factorInfo has to be computed by hipsparseXcsric02()
+*  beforehand. The analysis only depends on the sparsity pattern and stays valid when the
+*  factorization is recomputed for new values.
+*
+*  \note
+*  If the backend supports it, the analysis of the lower triangular solve is shared with
+*  the analysis of hipsparseXcsric02() that is stored in \p factorInfo.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const float*              csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             factorInfo,
+                                                  csrPrecondInfo_t          info,
+                                                  hipsparseSolvePolicy_t    policy,
+                                                  void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const double*             csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             factorInfo,
+                                                  csrPrecondInfo_t          info,
+                                                  hipsparseSolvePolicy_t    policy,
+                                                  void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const hipComplex*         csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             factorInfo,
+                                                  csrPrecondInfo_t          info,
+                                                  hipsparseSolvePolicy_t    policy,
+                                                  void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const hipDoubleComplex*   csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             factorInfo,
+                                                  csrPrecondInfo_t          info,
+                                                  hipsparseSolvePolicy_t    policy,
+                                                  void*                     pBuffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Apply an IC0 preconditioner using CSR storage format
+*
+*  \details
+*  \p hipsparseXcsric02Apply solves
+*  \f[
+*    LL^H \cdot x = \alpha \cdot f,
+*  \f]
+*  where \f$LL^H\f$ is the incomplete Cholesky factorization of \f$A\f$ computed in place
+*  by hipsparseXcsric02(). Both triangular solves share a single temporary storage buffer, that
+*  also holds the intermediate vector, and the analysis data of \p info and
+*  \p factorInfo. \p f and \p x may point to the same vector.
+*
+*  \note
+*  Zero pivots of the factor are reported by hipsparseXcsric02_zeroPivot().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsric02Apply(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       nnz,
+                                         const float*              alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csric02Info_t             factorInfo,
+                                         csrPrecondInfo_t          info,
+                                         const float*              f,
+                                         float*                    x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsric02Apply(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       nnz,
+                                         const double*             alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csric02Info_t             factorInfo,
+                                         csrPrecondInfo_t          info,
+                                         const double*             f,
+                                         double*                   x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsric02Apply(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipComplex*         alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csric02Info_t             factorInfo,
+                                         csrPrecondInfo_t          info,
+                                         const hipComplex*         f,
+                                         hipComplex*               x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsric02Apply(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipDoubleComplex*   alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csric02Info_t             factorInfo,
+                                         csrPrecondInfo_t          info,
+                                         const hipDoubleComplex*   f,
+                                         hipDoubleComplex*         x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Tridiagonal solver with pivoting
+*
+*  \details
+*  \p hipsparseXgtsv2_bufferSize returns the size of the temporary storage buffer
+*  that is required by hipsparseXgtsv2(). The temporary storage buffer must be
+*  allocated by the user.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                const float*      dl,
+                                                const float*      d,
+                                                const float*      du,
+                                                const float*      B,
+                                                int               ldb,
+                                                size_t*           pBufferSizeInBytes);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                const double*     dl,
+                                                const double*     d,
+                                                const double*     du,
+                                                const double*     B,
+                                                int               db,
+                                                size_t*           pBufferSizeInBytes);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                const hipComplex* dl,
+                                                const hipComplex* d,
+                                                const hipComplex* du,
+                                                const hipComplex* B,
+                                                int               ldb,
+                                                size_t*           pBufferSizeInBytes);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
+                                                int                     m,
+                                                int                     n,
+                                                const hipDoubleComplex* dl,
+                                                const hipDoubleComplex* d,
+                                                const hipDoubleComplex* du,
+                                                const hipDoubleComplex* B,
+                                                int                     ldb,
+                                                size_t*                 pBufferSizeInBytes);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Tridiagonal solver with pivoting
+*
+*  \details
+*  \p hipsparseXgtsv2 solves a tridiagonal system for multiple right hand sides using pivoting.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 */
 /**@{*/
@@ -6058,6 +6917,241 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
 
 /**@}*/
 
+/*! \ingroup precond_module
+*  \brief Strided Batch block tridiagonal solver (no pivoting)
+*
+*  \details
+*  \p hipsparseXgtsvBlockStridedBatch_bufferSizeExt returns the size of the temporary storage
+*  buffer that is required by hipsparseXgtsvBlockStridedBatch_analysis() and
+*  hipsparseXgtsvBlockStridedBatch(). The temporary storage buffer must be allocated by the
+*  user.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                hipsparseDirection_t dirA,
+                                                                int                  blockDim,
+                                                                int                  m,
+                                                                const float*         dl,
+                                                                const float*         d,
+                                                                const float*         du,
+                                                                const float*         x,
+                                                                int                  batchCount,
+                                                                int                  batchStride,
+                                                                size_t* pBufferSizeInBytes);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                hipsparseDirection_t dirA,
+                                                                int                  blockDim,
+                                                                int                  m,
+                                                                const double*        dl,
+                                                                const double*        d,
+                                                                const double*        du,
+                                                                const double*        x,
+                                                                int                  batchCount,
+                                                                int                  batchStride,
+                                                                size_t* pBufferSizeInBytes);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                hipsparseDirection_t dirA,
+                                                                int                  blockDim,
+                                                                int                  m,
+                                                                const hipComplex*    dl,
+                                                                const hipComplex*    d,
+                                                                const hipComplex*    du,
+                                                                const hipComplex*    x,
+                                                                int                  batchCount,
+                                                                int                  batchStride,
+                                                                size_t* pBufferSizeInBytes);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t       handle,
+                                                                hipsparseDirection_t    dirA,
+                                                                int                     blockDim,
+                                                                int                     m,
+                                                                const hipDoubleComplex* dl,
+                                                                const hipDoubleComplex* d,
+                                                                const hipDoubleComplex* du,
+                                                                const hipDoubleComplex* x,
+                                                                int                     batchCount,
+                                                                int                     batchStride,
+                                                                size_t* pBufferSizeInBytes);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Strided Batch block tridiagonal solver (no pivoting)
+*
+*  \details
+*  \p hipsparseXgtsvBlockStridedBatch_analysis performs the analysis step for
+*  hipsparseXgtsvBlockStridedBatch(). It stores the block pattern of the batch in the
+*  temporary storage buffer and the analysis data in \p info. Only \p dirA, \p blockDim,
+*  \p m, \p batchCount and \p batchStride are used, the values are not accessed. The
+*  analysis can be reused by all subsequent solves with the same sizes, the same \p info
+*  and the same, unmodified buffer.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                           hipsparseDirection_t dirA,
+                                                           int                  blockDim,
+                                                           int                  m,
+                                                           const float*         dl,
+                                                           const float*         d,
+                                                           const float*         du,
+                                                           const float*         x,
+                                                           int                  batchCount,
+                                                           int                  batchStride,
+                                                           gtsvBlockInfo_t      info,
+                                                           void*                pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                           hipsparseDirection_t dirA,
+                                                           int                  blockDim,
+                                                           int                  m,
+                                                           const double*        dl,
+                                                           const double*        d,
+                                                           const double*        du,
+                                                           const double*        x,
+                                                           int                  batchCount,
+                                                           int                  batchStride,
+                                                           gtsvBlockInfo_t      info,
+                                                           void*                pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                           hipsparseDirection_t dirA,
+                                                           int                  blockDim,
+                                                           int                  m,
+                                                           const hipComplex*    dl,
+                                                           const hipComplex*    d,
+                                                           const hipComplex*    du,
+                                                           const hipComplex*    x,
+                                                           int                  batchCount,
+                                                           int                  batchStride,
+                                                           gtsvBlockInfo_t      info,
+                                                           void*                pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZgtsvBlockStridedBatch_analysis(hipsparseHandle_t       handle,
+                                                           hipsparseDirection_t    dirA,
+                                                           int                     blockDim,
+                                                           int                     m,
+                                                           const hipDoubleComplex* dl,
+                                                           const hipDoubleComplex* d,
+                                                           const hipDoubleComplex* du,
+                                                           const hipDoubleComplex* x,
+                                                           int                     batchCount,
+                                                           int                     batchStride,
+                                                           gtsvBlockInfo_t         info,
+                                                           void*                   pBuffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Strided Batch block tridiagonal solver (no pivoting)
+*
+*  \details
+*  \p hipsparseXgtsvBlockStridedBatch_zeroPivot returns \ref HIPSPARSE_STATUS_ZERO_PIVOT,
+*  if the last call to hipsparseXgtsvBlockStridedBatch() met a singular pivot block.
+*  \p position is set to \f$k \cdot m + i\f$ for block row \f$i\f$ of system \f$k\f$,
+*  or to -1 if all pivot blocks are non-singular.
+*
+*  \note
+*  \p hipsparseXgtsvBlockStridedBatch_zeroPivot is a blocking function. It might influence
+*  performance negatively.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_zeroPivot(hipsparseHandle_t handle,
+                                                            gtsvBlockInfo_t   info,
+                                                            int*              position);
+
+/*! \ingroup precond_module
+*  \brief Strided Batch block tridiagonal solver (no pivoting)
+*
+*  \details
+*  \p hipsparseXgtsvBlockStridedBatch solves a batch of block tridiagonal linear systems
+*  with \p m block rows of dense \p blockDim x \p blockDim blocks, stored in \p dirA order.
+*  Row \f$i\f$ of system \f$k\f$ consists of the blocks \p dl, \p d and \p du starting at
+*  element \f$(k \cdot batchStride + i) \cdot blockDim^2\f$, and its right-hand side starts at
+*  element \f$(k \cdot batchStride + i) \cdot blockDim\f$ of \p x, which is overwritten
+*  by the solution. The first block of \p dl and the last block of \p du of each system are
+*  ignored.
+*
+*  The systems are solved by a block LU factorization without pivoting, which requires
+*  non-singular pivot blocks, e.g. for block diagonally dominant systems. A singular pivot
+*  block can be queried with hipsparseXgtsvBlockStridedBatch_zeroPivot().
+*
+*  \p info and the temporary storage buffer have to be prepared by
+*  hipsparseXgtsvBlockStridedBatch_analysis(). The values of \p dl, \p d, \p du and \p x
+*  may change between calls, each call factorizes and solves the current systems.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                  hipsparseDirection_t dirA,
+                                                  int                  blockDim,
+                                                  int                  m,
+                                                  const float*         dl,
+                                                  const float*         d,
+                                                  const float*         du,
+                                                  float*               x,
+                                                  int                  batchCount,
+                                                  int                  batchStride,
+                                                  gtsvBlockInfo_t      info,
+                                                  void*                pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                  hipsparseDirection_t dirA,
+                                                  int                  blockDim,
+                                                  int                  m,
+                                                  const double*        dl,
+                                                  const double*        d,
+                                                  const double*        du,
+                                                  double*              x,
+                                                  int                  batchCount,
+                                                  int                  batchStride,
+                                                  gtsvBlockInfo_t      info,
+                                                  void*                pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                  hipsparseDirection_t dirA,
+                                                  int                  blockDim,
+                                                  int                  m,
+                                                  const hipComplex*    dl,
+                                                  const hipComplex*    d,
+                                                  const hipComplex*    du,
+                                                  hipComplex*          x,
+                                                  int                  batchCount,
+                                                  int                  batchStride,
+                                                  gtsvBlockInfo_t      info,
+                                                  void*                pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZgtsvBlockStridedBatch(hipsparseHandle_t       handle,
+                                                  hipsparseDirection_t    dirA,
+                                                  int                     blockDim,
+                                                  int                     m,
+                                                  const hipDoubleComplex* dl,
+                                                  const hipDoubleComplex* d,
+                                                  const hipDoubleComplex* du,
+                                                  hipDoubleComplex*       x,
+                                                  int                     batchCount,
+                                                  int                     batchStride,
+                                                  gtsvBlockInfo_t         info,
+                                                  void*                   pBuffer);
+/**@}*/
+
 /*
 * ===========================================================================
 *    Sparse Format Conversions
@@ -6802,6 +7896,179 @@ hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
                                     int*                 cooRowInd,
                                     hipsparseIndexBase_t idxBase);
 
+/*! \ingroup conv_module
+*  \brief Convert a batch of independent sparse CSR matrices into a single block diagonal
+*  sparse CSR matrix
+*
+*  \details
+*  \p hipsparseXcsrbatch2csr assembles \p batchCount independent CSR matrices of
+*  varying sizes into one block diagonal CSR matrix with \f$\sum m_i\f$ rows,
+*  \f$\sum n_i\f$ columns and \f$\sum nnz_i\f$ non-zero entries. The batch is stored
+*  contiguously, i.e. \p csrRowPtrA holds the \f$m_i+1\f$ local row offsets of each
+*  matrix one after another and \p csrColIndA holds the local column indices of each
+*  matrix one after another.
+*
+*  The non-zero entries keep their position, such that the concatenated values of the
+*  batch are the values of the block diagonal matrix. Likewise, the concatenated
+*  vectors \f$x_i\f$ and \f$y_i\f$ of the batch form the dense vectors of the block
+*  diagonal matrix. Thus, a single call to hipsparseXcsrmv() or hipsparseSpMV() computes
+*  the sparse matrix vector products of the whole batch at once, replacing
+*  \p batchCount individual, latency bound launches.
+*
+*  \note
+*  The arrays \p m, \p n and \p nnz are host arrays of size \p batchCount.
+*
+*  \note
+*  The local column indices of matrix \f$i\f$ have to lie within its \f$n_i\f$
+*  columns, and \f$\sum m_i\f$, \f$\sum n_i\f$ and \f$\sum nnz_i\f$ have to fit
+*  into a 32 bit integer. Otherwise, \ref HIPSPARSE_STATUS_INVALID_VALUE is returned.
+*
+*  \note
+*  The block diagonal sparsity pattern only needs to be assembled once for a fixed
+*  batch pattern. This function blocks the host until the conversion has finished.
+*
+*  \note
+*  \p csrColIndC may point to the same memory as \p csrColIndA.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsrbatch2csr(hipsparseHandle_t    handle,
+                                         int                  batchCount,
+                                         const int*           m,
+                                         const int*           n,
+                                         const int*           nnz,
+                                         hipsparseIndexBase_t idxBase,
+                                         const int*           csrRowPtrA,
+                                         const int*           csrColIndA,
+                                         int*                 csrRowPtrC,
+                                         int*                 csrColIndC);
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse Blocked-ELL matrix
+*
+*  \details
+*  \p hipsparseXcsr2blockedEll_bufferSize returns the number of columns \p ellCols of the
+*  Blocked-ELL matrix with block size \p ellBlockSize that is required to hold the
+*  sparse CSR matrix, as well as the size of the temporary storage buffer required by
+*  hipsparseXcsr2blockedEllColInd() and hipsparseXcsr2blockedEll().
+*
+*  The number of stored entries of the Blocked-ELL matrix, including explicit zeros, is
+*  \f$\lceil m / ellBlockSize \rceil \cdot ellBlockSize \cdot ellCols\f$. Querying
+*  different block sizes allows to choose the block size with the least padding for
+*  the matrix at hand.
+*
+*  \note
+*  This function blocks the host until the analysis has finished.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsr2blockedEll_bufferSize(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       n,
+                                                      const hipsparseMatDescr_t descrA,
+                                                      const int*                csrRowPtrA,
+                                                      const int*                csrColIndA,
+                                                      int                       ellBlockSize,
+                                                      int*                      ellCols,
+                                                      size_t*                   pBufferSizeInBytes);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse Blocked-ELL matrix
+*
+*  \details
+*  \p hipsparseXcsr2blockedEllColInd computes the block column indices \p ellColInd of the
+*  Blocked-ELL matrix with block size \p ellBlockSize and \p ellCols columns, that
+*  holds the sparse CSR matrix. \p ellColInd is an array of
+*  \f$\lceil m / ellBlockSize \rceil \cdot ellCols / ellBlockSize\f$ entries, using the
+*  index base of \p descrA. Additionally, the position of each CSR entry within the
+*  Blocked-ELL values is stored in the temporary storage buffer \p pBuffer, such that
+*  the values can be converted by hipsparseXcsr2blockedEll() without any further
+*  analysis.
+*
+*  The resulting arrays can be passed to hipsparseCreateBlockedEll(), using
+*  \f$\lceil m / ellBlockSize \rceil \cdot ellBlockSize\f$ rows and
+*  \f$\lceil n / ellBlockSize \rceil \cdot ellBlockSize\f$ columns.
+*
+*  \note
+*  \p ellCols has to be a multiple of \p ellBlockSize and has to be at least the
+*  number of columns returned by hipsparseXcsr2blockedEll_bufferSize().
+*
+*  \note
+*  The \p pBuffer has to be kept for subsequent value conversions, e.g. if the values of
+*  the CSR matrix change, but its sparsity pattern does not.
+*
+*  \note
+*  This function blocks the host until the conversion has finished.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsr2blockedEllColInd(hipsparseHandle_t         handle,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const int*                csrRowPtrA,
+                                                 const int*                csrColIndA,
+                                                 int                       ellBlockSize,
+                                                 int                       ellCols,
+                                                 int*                      ellColInd,
+                                                 void*                     pBuffer);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse Blocked-ELL matrix
+*
+*  \details
+*  \p hipsparseXcsr2blockedEll converts the \p nnz values \p csrValA of the sparse CSR
+*  matrix into the values \p ellValue of the Blocked-ELL matrix, using the positions
+*  stored in \p pBuffer by hipsparseXcsr2blockedEllColInd(). \p ellValue is an array of
+*  \f$\lceil m / ellBlockSize \rceil \cdot ellBlockSize \cdot ellCols\f$ entries, with
+*  padded entries set to zero.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsr2blockedEll(hipsparseHandle_t handle,
+                                           int               m,
+                                           int               nnz,
+                                           const float*      csrValA,
+                                           int               ellBlockSize,
+                                           int               ellCols,
+                                           float*            ellValue,
+                                           const void*       pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsr2blockedEll(hipsparseHandle_t handle,
+                                           int               m,
+                                           int               nnz,
+                                           const double*     csrValA,
+                                           int               ellBlockSize,
+                                           int               ellCols,
+                                           double*           ellValue,
+                                           const void*       pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsr2blockedEll(hipsparseHandle_t handle,
+                                           int               m,
+                                           int               nnz,
+                                           const hipComplex* csrValA,
+                                           int               ellBlockSize,
+                                           int               ellCols,
+                                           hipComplex*       ellValue,
+                                           const void*       pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsr2blockedEll(hipsparseHandle_t       handle,
+                                           int                     m,
+                                           int                     nnz,
+                                           const hipDoubleComplex* csrValA,
+                                           int                     ellBlockSize,
+                                           int                     ellCols,
+                                           hipDoubleComplex*       ellValue,
+                                           const void*             pBuffer);
+/**@}*/
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
 /*! \ingroup conv_module
 *  \brief Convert a sparse CSR matrix into a sparse CSC matrix
@@ -7908,6 +9175,62 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      void*                     buffer);
 /**@}*/
 
+/*! \ingroup conv_module
+ *  \brief Compute the pruning threshold of a sparse CSR matrix for a given percentage
+ *
+ *  \details
+ *  \p hipsparseXpruneCsr2csrThresholdByPercentage computes the threshold that
+ *  hipsparseXpruneCsr2csrNnzByPercentage() and hipsparseXpruneCsr2csrByPercentage() would
+ *  use to prune \p percentage percent of the entries of A, i.e. the order statistic of
+ *  the absolute values of A at position \f$\lceil nnzA \cdot percentage / 100 \rceil - 1\f$.
+ *  The threshold is determined by a bisection over the bit pattern of the values, where
+ *  each step counts the remaining entries with hipsparseXpruneCsr2csrNnz(). Thus, no
+ *  sorted copy of the values is required and the temporary storage buffer only needs to
+ *  be of the size returned by hipsparseXpruneCsr2csr_bufferSizeExt(). The computed
+ *  threshold can then be passed to hipsparseXpruneCsr2csrNnz() and
+ *  hipsparseXpruneCsr2csr() to complete the conversion.
+ *
+ *  \p csrRowPtrC must hold \p m+1 elements and is used as workspace. On exit, its
+ *  contents are undefined.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  \note
+ *  \p threshold is written to host or device memory, depending on the pointer mode.
+ */
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpruneCsr2csrThresholdByPercentage(hipsparseHandle_t         handle,
+                                                              int                       m,
+                                                              int                       n,
+                                                              int                       nnzA,
+                                                              const hipsparseMatDescr_t descrA,
+                                                              const float*              csrValA,
+                                                              const int*                csrRowPtrA,
+                                                              const int*                csrColIndA,
+                                                              float                     percentage,
+                                                              const hipsparseMatDescr_t descrC,
+                                                              int*                      csrRowPtrC,
+                                                              float*                    threshold,
+                                                              void*                     buffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDpruneCsr2csrThresholdByPercentage(hipsparseHandle_t         handle,
+                                                              int                       m,
+                                                              int                       n,
+                                                              int                       nnzA,
+                                                              const hipsparseMatDescr_t descrA,
+                                                              const double*             csrValA,
+                                                              const int*                csrRowPtrA,
+                                                              const int*                csrColIndA,
+                                                              double                    percentage,
+                                                              const hipsparseMatDescr_t descrC,
+                                                              int*                      csrRowPtrC,
+                                                              double*                   threshold,
+                                                              void*                     buffer);
+/**@}*/
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
 /*! \ingroup conv_module
 *  \brief Convert a sparse HYB matrix into a sparse CSR matrix
@@ -8046,6 +9369,29 @@ hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer);
 
+/*! \ingroup conv_module
+*  \brief Determine the structural properties of a CSR matrix
+*
+*  \details
+*  \p hipsparseXcsrCheckProperties determines which of the \ref hipsparseMatProperty_t
+*  flags hold for a CSR matrix and returns them in \p properties. The result can be
+*  passed to hipsparseSetMatProperties(), such that the check is only done once for a
+*  recurring sparsity pattern. A pattern is symmetric and has a full diagonal only if
+*  the matrix is square.
+*
+*  \note
+*  This function blocks the host until the check has been completed.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsrCheckProperties(hipsparseHandle_t         handle,
+                                               int                       m,
+                                               int                       n,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descrA,
+                                               const int*                csrRowPtr,
+                                               const int*                csrColInd,
+                                               int*                      properties);
+
 /*! \ingroup conv_module
 *  \brief Sort a sparse CSC matrix
 *
@@ -8472,6 +9818,51 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
                                      void*                     pBuffer);
 /**@}*/
 
+#if(!defined(CUDART_VERSION))
+/*! \ingroup conv_module
+*  \brief
+*  This function sorts the values of an unsorted CSR matrix, re-using the permutation of
+*  a previous csru2csr call.
+*
+*  \details
+*  \p hipsparseXcsru2csrValues applies the permutation, that has been stored in \p info
+*  by a previous call to hipsparseXcsru2csr, to the values of a matrix with identical
+*  unsorted sparsity pattern, e.g. when a finite element assembly is repeated with new
+*  coefficients. The already sorted column indices are kept, and the column sort of
+*  hipsparseXcsru2csr is skipped. \p pBuffer has to be at least of the size returned by
+*  hipsparseXcsru2csr_bufferSizeExt.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsru2csrValues(hipsparseHandle_t handle,
+                                           int               nnz,
+                                           float*            csrVal,
+                                           csru2csrInfo_t    info,
+                                           void*             pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsru2csrValues(hipsparseHandle_t handle,
+                                           int               nnz,
+                                           double*           csrVal,
+                                           csru2csrInfo_t    info,
+                                           void*             pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsru2csrValues(hipsparseHandle_t handle,
+                                           int               nnz,
+                                           hipComplex*       csrVal,
+                                           csru2csrInfo_t    info,
+                                           void*             pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsru2csrValues(hipsparseHandle_t handle,
+                                           int               nnz,
+                                           hipDoubleComplex* csrVal,
+                                           csru2csrInfo_t    info,
+                                           void*             pBuffer);
+/**@}*/
+#endif
+
 /*! \ingroup conv_module
 *  \brief
 *  This function converts sorted CSR format to unsorted CSR format. The required
@@ -8626,6 +10017,21 @@ struct hipsparseSpSMDescr;
 typedef struct hipsparseSpSMDescr* hipsparseSpSMDescr_t;
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+struct hipsparseSpRAPDescr;
+typedef struct hipsparseSpRAPDescr* hipsparseSpRAPDescr_t;
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+struct hipsparseSpGSDescr;
+typedef struct hipsparseSpGSDescr* hipsparseSpGSDescr_t;
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+struct hipsparseSpAssembleDescr;
+typedef struct hipsparseSpAssembleDescr* hipsparseSpAssembleDescr_t;
+#endif
+
 /* Generic API types */
 #if(!defined(CUDART_VERSION))
 typedef enum
@@ -8809,7 +10215,8 @@ typedef enum
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11030)
 typedef enum
 {
-    HIPSPARSE_SPSV_ALG_DEFAULT = 0
+    HIPSPARSE_SPSV_ALG_DEFAULT = 0,
+    HIPSPARSE_SPSV_ALG_JACOBI  = 1
 } hipsparseSpSVAlg_t;
 #endif
 
@@ -8823,8 +10230,10 @@ typedef enum
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
 typedef enum
 {
-    HIPSPARSE_SPMAT_FILL_MODE = 0,
-    HIPSPARSE_SPMAT_DIAG_TYPE = 1
+    HIPSPARSE_SPMAT_FILL_MODE       = 0,
+    HIPSPARSE_SPMAT_DIAG_TYPE       = 1,
+    HIPSPARSE_SPMAT_MATRIX_TYPE     = 2, // symmetric / Hermitian half storage, ROCm backend only
+    HIPSPARSE_SPMAT_TRANSPOSE_CACHE = 3 // memory budget (size_t) of a cached transpose
 } hipsparseSpMatAttribute_t;
 #endif
 
@@ -8841,6 +10250,15 @@ typedef enum
     HIPSPARSE_SPGEMM_DEFAULT = 0
 } hipsparseSpGEMMAlg_t;
 #endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+typedef enum
+{
+    HIPSPARSE_SPGS_SWEEP_FORWARD   = 0,
+    HIPSPARSE_SPGS_SWEEP_BACKWARD  = 1,
+    HIPSPARSE_SPGS_SWEEP_SYMMETRIC = 2
+} hipsparseSpGSSweep_t;
+#endif
 /* Sparse vector API */
 
 /* Description: Create a sparse vector */
@@ -9139,7 +10557,17 @@ hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseSpMatDescr_t     spMatDesc
                                              size_t                    dataSize);
 #endif
 
-/* Description: Set attribute in sparse matrix descriptor */
+/* Description: Set attribute in sparse matrix descriptor. Setting HIPSPARSE_SPMAT_MATRIX_TYPE
+   to HIPSPARSE_MATRIX_TYPE_SYMMETRIC or HIPSPARSE_MATRIX_TYPE_HERMITIAN lets hipsparseSpMV
+   compute the full product from the triangle selected by HIPSPARSE_SPMAT_FILL_MODE.
+   Setting HIPSPARSE_SPMAT_TRANSPOSE_CACHE to a non zero memory budget in bytes lets the
+   buffer size and preprocess stages of transposed hipsparseSpMV and hipsparseSpMM calls
+   build a transposed copy of a CSR matrix with 32 bit indices, if it fits into the budget.
+   All subsequent transposed products then multiply with the non transposed copy, which
+   keeps the matrix type of A and stores the opposite triangle. The copy is refreshed after
+   hipsparseSpMatSetValues or hipsparseSpAssemble_compute, values modified in place otherwise
+   require setting the attribute again. hipsparseCsrSetPointers releases the copy, which is
+   rebuilt by the next buffer size or preprocess stage. A zero budget releases the copy. */
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDescr,
@@ -9385,7 +10813,10 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
 #endif
 
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 10010)
-/* Description: Compute the sparse matrix multiplication with a dense matrix */
+/* Description: Compute the sparse matrix multiplication with a dense vector.
+   Matrix and vector values may be stored in a lower precision than the compute
+   type, e.g. HIP_R_8I values with HIP_R_32F compute and output. Half precision
+   storage (HIP_R_16F, HIP_R_16BF) is only available with the CUDA backend. */
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                                 hipsparseOperation_t        opA,
@@ -9448,6 +10879,44 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
                                 void*                       externalBuffer);
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Out-of-core sparse matrix multiplication with a dense vector. The arrays of
+   the CSR matrix A reside in (preferably pinned) host memory, while x and y reside in device
+   memory. A is streamed through the device in row chunks, using at most deviceMemoryLimit
+   bytes of device memory for staging and the work space of the multiplication. Uploading
+   the next chunk overlaps with computing the current one. Only non-transposed A is
+   supported. The routine blocks the host until the computation has finished. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMV_streamed(hipsparseHandle_t           handle,
+                                         hipsparseOperation_t        opA,
+                                         const void*                 alpha,
+                                         const hipsparseSpMatDescr_t matA,
+                                         const hipsparseDnVecDescr_t vecX,
+                                         const void*                 beta,
+                                         const hipsparseDnVecDescr_t vecY,
+                                         hipDataType                 computeType,
+                                         hipsparseSpMVAlg_t          alg,
+                                         size_t                      deviceMemoryLimit);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Out-of-core sparse matrix multiplication with a dense matrix. The arrays of
+   the CSR matrix A reside in (preferably pinned) host memory, while B and C reside in device
+   memory. See hipsparseSpMV_streamed for details. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMM_streamed(hipsparseHandle_t           handle,
+                                         hipsparseOperation_t        opA,
+                                         hipsparseOperation_t        opB,
+                                         const void*                 alpha,
+                                         const hipsparseSpMatDescr_t matA,
+                                         const hipsparseDnMatDescr_t matB,
+                                         const void*                 beta,
+                                         const hipsparseDnMatDescr_t matC,
+                                         hipDataType                 computeType,
+                                         hipsparseSpMMAlg_t          alg,
+                                         size_t                      deviceMemoryLimit);
+#endif
+
 /* Description: Compute the sparse matrix sparse matrix product */
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
 HIPSPARSE_EXPORT
@@ -9508,6 +10977,47 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t      handle,
                                        hipsparseSpGEMMDescr_t spgemmDescr);
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Memory bounded sparse matrix sparse matrix multiplication C = alpha * A * B,
+   first pass. A, B and C are CSR matrices with 32 bit indices. The rows of A are split into
+   panels, such that the temporary device memory of a single panel does not exceed
+   deviceMemoryLimit bytes. Panels are planned up front from the number of intermediate
+   products of each row, and are split further if the actual buffer size exceeds the limit.
+   Returns the number of non-zero entries of C in nnzC. Only non-transposed A and B are
+   supported. The routine blocks the host. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGEMM_chunkedNnz(hipsparseHandle_t     handle,
+                                             hipsparseOperation_t  opA,
+                                             hipsparseOperation_t  opB,
+                                             const void*           alpha,
+                                             hipsparseSpMatDescr_t matA,
+                                             hipsparseSpMatDescr_t matB,
+                                             hipsparseSpMatDescr_t matC,
+                                             hipDataType           computeType,
+                                             hipsparseSpGEMMAlg_t  alg,
+                                             size_t                deviceMemoryLimit,
+                                             int64_t*              nnzC);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Memory bounded sparse matrix sparse matrix multiplication C = alpha * A * B,
+   second pass. The arrays of C must have been set with hipsparseCsrSetPointers, using the
+   number of non-zero entries obtained from hipsparseSpGEMM_chunkedNnz. Computes the row
+   pointer, column indices and values of C panel wise. See hipsparseSpGEMM_chunkedNnz for
+   details. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGEMM_chunkedCompute(hipsparseHandle_t     handle,
+                                                 hipsparseOperation_t  opA,
+                                                 hipsparseOperation_t  opB,
+                                                 const void*           alpha,
+                                                 hipsparseSpMatDescr_t matA,
+                                                 hipsparseSpMatDescr_t matB,
+                                                 hipsparseSpMatDescr_t matC,
+                                                 hipDataType           computeType,
+                                                 hipsparseSpGEMMAlg_t  alg,
+                                                 size_t                deviceMemoryLimit);
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t      handle,
@@ -9570,6 +11080,207 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t      handle,
                                             void*                  externalBuffer5);
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+/* Description: Create a descriptor for the Galerkin triple product C = alpha * R * A * P +
+   beta * C, which holds the intermediate product A * P and the analysis data of both
+   products. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpRAP_createDescr(hipsparseSpRAPDescr_t* descr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+/* Description: Destroy a Galerkin triple product descriptor and release its device
+   memory */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpRAP_destroyDescr(hipsparseSpRAPDescr_t descr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+/* Description: First symbolic stage of the Galerkin triple product. R, A, P and C are
+   non-transposed CSR matrices. Computes the full sparsity pattern of A * P, which is stored
+   in rapDescr, and the row pointer of C, which has to be set in matC beforehand. The number
+   of non-zero entries of C can be obtained with hipsparseSpMatGetSize afterwards. Device
+   memory is allocated by the routine, therefore it blocks the host. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpRAP_nnz(hipsparseHandle_t     handle,
+                                     hipsparseSpMatDescr_t matR,
+                                     hipsparseSpMatDescr_t matA,
+                                     hipsparseSpMatDescr_t matP,
+                                     hipsparseSpMatDescr_t matC,
+                                     hipsparseSpGEMMAlg_t  alg,
+                                     hipsparseSpRAPDescr_t rapDescr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+/* Description: Second symbolic stage of the Galerkin triple product. Computes the column
+   indices of C, whose arrays have to be set with hipsparseCsrSetPointers beforehand. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpRAP_copy(hipsparseHandle_t     handle,
+                                      hipsparseSpMatDescr_t matR,
+                                      hipsparseSpMatDescr_t matA,
+                                      hipsparseSpMatDescr_t matP,
+                                      hipsparseSpMatDescr_t matC,
+                                      hipsparseSpGEMMAlg_t  alg,
+                                      hipsparseSpRAPDescr_t rapDescr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+/* Description: Numerical stage of the Galerkin triple product C = alpha * R * A * P + beta * C.
+   Can be called repeatedly, when the values but not the sparsity patterns of R, A and P
+   change, without repeating the symbolic stages. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpRAP_compute(hipsparseHandle_t     handle,
+                                         const void*           alpha,
+                                         hipsparseSpMatDescr_t matR,
+                                         hipsparseSpMatDescr_t matA,
+                                         hipsparseSpMatDescr_t matP,
+                                         const void*           beta,
+                                         hipsparseSpMatDescr_t matC,
+                                         hipDataType           computeType,
+                                         hipsparseSpGEMMAlg_t  alg,
+                                         hipsparseSpRAPDescr_t rapDescr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Permute a square CSR matrix with 32 bit indices into color blocked form,
+   B = P * A * P^T, using the coloring computed by hipsparseXcsrcolor. Rows are grouped by
+   color, preserving their order within each color, and the column indices of each row
+   are sorted. The arrays of B have to be allocated with the size of A. On return, the
+   host array colorPtr of size ncolors + 1 holds the first row of each color in B, and the
+   optional device array perm holds the row of A that became row i of B. The permutation
+   is computed on the host, therefore the routine blocks the host. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsrColorPermute(hipsparseHandle_t     handle,
+                                           hipsparseSpMatDescr_t matA,
+                                           int                   ncolors,
+                                           const int*            coloring,
+                                           int*                  perm,
+                                           int*                  colorPtr,
+                                           hipsparseSpMatDescr_t matB);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Reverse Cuthill-McKee ordering of a square CSR matrix with 32 bit indices,
+   computed on the pattern of A + A^T. Each connected component is started from a
+   pseudo-peripheral node, and the neighbors of a node are numbered in order of increasing
+   degree. On return, the device array perm of size m holds the row of A that becomes row i
+   of the reordered matrix, which concentrates the non-zero entries near the diagonal and
+   improves the locality of SpMV and the fill of incomplete factorizations. Use
+   hipsparseCsrPermute to apply it to A, and hipsparseGather / hipsparseScatter with perm
+   as indices to permute vectors into and out of the new ordering. The ordering is
+   computed on the host, therefore the routine blocks the host. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsrRcm(hipsparseHandle_t handle, hipsparseSpMatDescr_t matA, int* perm);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Symmetric permutation B = P * A * P^T of a square CSR matrix with 32 bit
+   indices, where row perm[i] of A becomes row i of B, e.g. with the ordering computed by
+   hipsparseCsrRcm. The column indices of each row of B are sorted. The arrays of B have to
+   be allocated with the size of A. The permutation is applied on the host, therefore the
+   routine blocks the host. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsrPermute(hipsparseHandle_t     handle,
+                                      hipsparseSpMatDescr_t matA,
+                                      const int*            perm,
+                                      hipsparseSpMatDescr_t matB);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Create a descriptor for the multicolor Gauss-Seidel / SOR smoother */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGS_createDescr(hipsparseSpGSDescr_t* descr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Destroy a multicolor Gauss-Seidel descriptor and release its device memory */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGS_destroyDescr(hipsparseSpGSDescr_t descr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Analysis step of the multicolor Gauss-Seidel smoother on a color blocked
+   CSR matrix, e.g. obtained with hipsparseCsrColorPermute. colorPtr is a host array of
+   size ncolors + 1 holding the first row of each color. Rows of the same color must not
+   be coupled and every row needs a non-zero diagonal entry, otherwise
+   HIPSPARSE_STATUS_INVALID_VALUE or HIPSPARSE_STATUS_ZERO_PIVOT is returned. The inverse
+   diagonal is extracted on the host, therefore the routine blocks the host. The analysis
+   has to be repeated when the values or the arrays of A change. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGS_analysis(hipsparseHandle_t     handle,
+                                         hipsparseSpMatDescr_t matA,
+                                         int                   ncolors,
+                                         const int*            colorPtr,
+                                         hipDataType           computeType,
+                                         hipsparseSpGSDescr_t  gsDescr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Multicolor Gauss-Seidel / SOR sweep, which updates
+   x_c = x_c + omega * D_c^-1 * (b_c - A_c * x) for each color c in turn. All rows of a
+   color are updated in parallel. A forward sweep visits the colors in increasing order, a
+   backward sweep in decreasing order, and a symmetric sweep performs both, visiting the
+   last color only once. omega = 1 gives Gauss-Seidel, other values successive
+   over-relaxation. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGS_sweep(hipsparseHandle_t     handle,
+                                      hipsparseSpGSSweep_t  sweep,
+                                      const void*           omega,
+                                      hipsparseSpMatDescr_t matA,
+                                      hipsparseDnVecDescr_t vecB,
+                                      hipsparseDnVecDescr_t vecX,
+                                      hipDataType           computeType,
+                                      hipsparseSpGSDescr_t  gsDescr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Create a descriptor for the assembly of COO entries into a CSR matrix with
+   a fixed sparsity pattern */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpAssemble_createDescr(hipsparseSpAssembleDescr_t* descr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Destroy an assembly descriptor and release its device memory */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpAssemble_destroyDescr(hipsparseSpAssembleDescr_t descr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Analysis step of the assembly of the COO matrix matCoo, e.g. the element
+   contributions of a finite element discretization, into the CSR matrix matA of the same
+   size. Both use 32 bit indices. The COO entries may be unsorted and contain duplicates,
+   but every entry has to hit a non-zero of the pattern of A, otherwise
+   HIPSPARSE_STATUS_INVALID_VALUE is returned. The map from the entries into the non-zeros
+   of A is computed on the host and stored in asmDescr, therefore the routine blocks the
+   host. The analysis only has to be repeated when the indices of either matrix change. A
+   COO matrix without entries is valid for a non-empty pattern. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpAssemble_analysis(hipsparseHandle_t          handle,
+                                               hipsparseSpMatDescr_t      matCoo,
+                                               hipsparseSpMatDescr_t      matA,
+                                               hipDataType                computeType,
+                                               hipsparseSpAssembleDescr_t asmDescr);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+/* Description: Assembly of the values of the COO matrix into the values of the CSR matrix,
+   csrVal = alpha * sum(cooVal) + beta * csrVal, where the sum runs over all entries of each
+   non-zero in a fixed order. beta = 0 overwrites the values of A, beta = 1 accumulates
+   into them. Runs as a single sparse matrix vector product with the map of the analysis
+   and can be called repeatedly when only the values change. Without entries, only the
+   values of A are scaled by beta. A transposed copy of A that is cached by
+   HIPSPARSE_SPMAT_TRANSPOSE_CACHE is rebuilt by the next transposed product. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpAssemble_compute(hipsparseHandle_t          handle,
+                                              const void*                alpha,
+                                              hipsparseSpMatDescr_t      matCoo,
+                                              const void*                beta,
+                                              hipsparseSpMatDescr_t      matA,
+                                              hipDataType                computeType,
+                                              hipsparseSpAssembleDescr_t asmDescr);
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11022)
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t           handle,
@@ -9622,6 +11333,28 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr);
 #endif
 
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+/* Description: Sets the number of sweeps of HIPSPARSE_SPSV_ALG_JACOBI, 5 by default.
+With A = D + N, each sweep computes y = D^-1 * (alpha * X - N * y), starting from
+y = D^-1 * alpha * X, which is one SpMV. The result is exact once the number of sweeps reaches
+the length of the longest dependency chain of A, and an approximation otherwise. Only
+non-transposed CSR matrices with 32 bit indices are supported. The analysis copies A to the
+host and blocks the host; it has to be repeated when the values of A change. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpSV_setJacobiSweeps(hipsparseSpSVDescr_t descr, int sweeps);
+#endif
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11031)
+/* Description: Returns the bytes of device memory held by the SpSV descriptor, e.g. to
+decide which cached analyses to keep in long running applications. The analysis of
+HIPSPARSE_SPSV_ALG_JACOBI is stored in the descriptor and released by
+hipsparseSpSV_destroyDescr. The level scheduled algorithm keeps its analysis in backend
+memory of unknown size, therefore HIPSPARSE_STATUS_NOT_SUPPORTED is returned unless the
+descriptor holds a Jacobi analysis. */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpSV_getMemoryUsage(hipsparseSpSVDescr_t descr, size_t* bytes);
+#endif
+
 /* Description: Buffer size step of solution of triangular linear system op(A) * Y = alpha * X,
 where A is a sparse matrix in CSR storage format, x and Y are dense vectors. */
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11030)
@@ -27,6 +27,14 @@
 #include <cusparse_v2.h>
 #include <hip/hip_runtime_api.h>
 #include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <vector>
 
 #define TO_STR2(x) #x
 #define TO_STR(x) TO_STR2(x)
@@ -44,6 +52,44 @@ extern "C" {
         }                                                               \
     }
 
+#define RETURN_IF_CUDA_ERROR(INPUT_STATUS_FOR_CHECK)                    \
+    {                                                                   \
+        cudaError_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;      \
+        if(TMP_STATUS_FOR_CHECK != cudaSuccess)                         \
+        {                                                               \
+            return hipCUDAErrorToHIPSPARSEStatus(TMP_STATUS_FOR_CHECK); \
+        }                                                               \
+    }
+
+#define RETURN_IF_HIPSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                \
+    {                                                                    \
+        hipsparseStatus_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
+        if(TMP_STATUS_FOR_CHECK != HIPSPARSE_STATUS_SUCCESS)             \
+        {                                                                \
+            return TMP_STATUS_FOR_CHECK;                                 \
+        }                                                                \
+    }
+
+hipsparseStatus_t hipCUDAErrorToHIPSPARSEStatus(cudaError_t cuError)
+{
+    switch(cuError)
+    {
+    case cudaSuccess:
+        return HIPSPARSE_STATUS_SUCCESS;
+    case cudaErrorMemoryAllocation:
+    case cudaErrorLaunchOutOfResources:
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    case cudaErrorInvalidDevicePointer:
+    case cudaErrorInvalidValue:
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    case cudaErrorInvalidDevice:
+    case cudaErrorInvalidResourceHandle:
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    default:
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+}
+
 hipsparseStatus_t hipCUSPARSEStatusToHIPStatus(cusparseStatus_t cuStatus)
 {
 
@@ -399,6 +445,20 @@ cudaDataType hipDataTypeToCudaDataType(hipDataType datatype)
         return CUDA_C_32F;
     case HIP_C_64F:
         return CUDA_C_64F;
+    case HIP_R_16F:
+        return CUDA_R_16F;
+#if CUDART_VERSION >= 11000
+    case HIP_R_16BF:
+        return CUDA_R_16BF;
+#endif
+    case HIP_R_8I:
+        return CUDA_R_8I;
+    case HIP_R_8U:
+        return CUDA_R_8U;
+    case HIP_R_32I:
+        return CUDA_R_32I;
+    case HIP_R_32U:
+        return CUDA_R_32U;
     default:
         throw "Non existent hipDataType";
     }
@@ -416,6 +476,20 @@ hipDataType CudaDataTypeToHIPDataType(cudaDataType datatype)
         return HIP_C_32F;
     case CUDA_C_64F:
         return HIP_C_64F;
+    case CUDA_R_16F:
+        return HIP_R_16F;
+#if CUDART_VERSION >= 11000
+    case CUDA_R_16BF:
+        return HIP_R_16BF;
+#endif
+    case CUDA_R_8I:
+        return HIP_R_8I;
+    case CUDA_R_8U:
+        return HIP_R_8U;
+    case CUDA_R_32I:
+        return HIP_R_32I;
+    case CUDA_R_32U:
+        return HIP_R_32U;
     default:
         throw "Non existent cudaDataType";
     }
@@ -501,6 +575,219 @@ hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePoi
     return hipCUSPARSEStatusToHIPStatus(status);
 }
 
+// csrPrecond struct - to hold the triangular descriptors and the csrsv2 info of both solves
+// of the preconditioner apply
+struct csrPrecondInfo
+{
+    hipsparseMatDescr_t descr_L = nullptr;
+    hipsparseMatDescr_t descr_U = nullptr;
+    csrsv2Info_t        info_L  = nullptr;
+    csrsv2Info_t        info_U  = nullptr;
+};
+
+#if CUDART_VERSION < 11000
+struct csrmvInfo
+{
+    bool analysed = false;
+};
+#endif
+
+// Handle pool - handles are created on demand and recycled on release, such that the
+// library context setup is paid once per concurrently used handle only
+struct hipsparseHandlePool
+{
+    int                            device;
+    std::mutex                     mutex;
+    std::vector<hipsparseHandle_t> idle;
+    std::vector<hipsparseHandle_t> busy;
+};
+
+hipsparseStatus_t hipsparseCreateHandlePool(hipsparseHandlePool_t* pool)
+{
+    if(pool == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Handles of the pool are bound to the current device
+    int device;
+    RETURN_IF_CUDA_ERROR(cudaGetDevice(&device));
+
+    *pool           = new hipsparseHandlePool;
+    (*pool)->device = device;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyHandlePool(hipsparseHandlePool_t pool)
+{
+    // Check if pool has been created
+    if(pool == nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+
+        // All handles have to be released first
+        if(!pool->busy.empty())
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+    }
+
+    hipsparseStatus_t status = HIPSPARSE_STATUS_SUCCESS;
+
+    for(size_t i = 0; i < pool->idle.size(); ++i)
+    {
+        hipsparseStatus_t destroy_status = hipsparseDestroy(pool->idle[i]);
+
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            status = destroy_status;
+        }
+    }
+
+    delete pool;
+
+    return status;
+}
+
+hipsparseStatus_t hipsparseHandlePoolAcquire(hipsparseHandlePool_t pool,
+                                             hipStream_t           streamId,
+                                             hipsparseHandle_t*    handle)
+{
+    if(pool == nullptr || handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Pooled handles can only be used on the device the pool has been created on
+    int device;
+    RETURN_IF_CUDA_ERROR(cudaGetDevice(&device));
+
+    if(device != pool->device)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseHandle_t h = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+
+        if(!pool->idle.empty())
+        {
+            h = pool->idle.back();
+            pool->idle.pop_back();
+        }
+    }
+
+    // Create a new handle outside of the lock, if no idle handle is available
+    if(h == nullptr)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreate(&h));
+    }
+
+    // Bind the stream and reset the pointer mode, such that no state of a previous
+    // user leaks into the acquiring thread
+    hipsparseStatus_t status = hipsparseSetStream(h, streamId);
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseSetPointerMode(h, HIPSPARSE_POINTER_MODE_HOST);
+    }
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        hipsparseDestroy(h);
+        return status;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->busy.push_back(h);
+    }
+
+    *handle = h;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseHandlePoolRelease(hipsparseHandlePool_t pool, hipsparseHandle_t handle)
+{
+    if(pool == nullptr || handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    std::lock_guard<std::mutex> lock(pool->mutex);
+
+    // The handle must have been acquired from this pool
+    std::vector<hipsparseHandle_t>::iterator it
+        = std::find(pool->busy.begin(), pool->busy.end(), handle);
+
+    if(it == pool->busy.end())
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *it = pool->busy.back();
+    pool->busy.pop_back();
+
+    pool->idle.push_back(handle);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Structural properties of a matrix descriptor. The descriptor is the backend descriptor
+// itself, thus they are kept in a registry keyed by the descriptor.
+struct hipsparseMatDescrProperties
+{
+    int      properties = 0;
+    uint64_t pattern_id = 0;
+};
+
+struct hipsparseMatDescrPropertiesRegistry
+{
+    std::mutex                                                 mutex;
+    std::map<hipsparseMatDescr_t, hipsparseMatDescrProperties> entries;
+};
+
+static hipsparseMatDescrPropertiesRegistry& hipsparseGetMatPropertiesRegistry()
+{
+    static hipsparseMatDescrPropertiesRegistry registry;
+    return registry;
+}
+
+static hipsparseMatDescrProperties hipsparseMatPropertiesGet(const hipsparseMatDescr_t descrA)
+{
+    hipsparseMatDescrPropertiesRegistry& registry = hipsparseGetMatPropertiesRegistry();
+    std::lock_guard<std::mutex>          lock(registry.mutex);
+
+    auto it = registry.entries.find(descrA);
+
+    return (it == registry.entries.end()) ? hipsparseMatDescrProperties() : it->second;
+}
+
+static void hipsparseMatPropertiesSet(hipsparseMatDescr_t                descrA,
+                                      const hipsparseMatDescrProperties& props)
+{
+    hipsparseMatDescrPropertiesRegistry& registry = hipsparseGetMatPropertiesRegistry();
+    std::lock_guard<std::mutex>          lock(registry.mutex);
+
+    // Descriptors without any properties are not kept
+    if(props.properties == 0 && props.pattern_id == 0)
+    {
+        registry.entries.erase(descrA);
+    }
+    else
+    {
+        registry.entries[descrA] = props;
+    }
+}
+
 hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
 {
     return hipCUSPARSEStatusToHIPStatus(cusparseCreateMatDescr((cusparseMatDescr_t*)descrA));
@@ -508,6 +795,8 @@ hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
 
 hipsparseStatus_t hipsparseDestroyMatDescr(hipsparseMatDescr_t descrA)
 {
+    hipsparseMatPropertiesSet(descrA, hipsparseMatDescrProperties());
+
     return hipCUSPARSEStatusToHIPStatus(cusparseDestroyMatDescr((cusparseMatDescr_t)descrA));
 }
 
@@ -560,6 +849,50 @@ hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA)
     return CudaIndexBaseToHIPIndexBase(cusparseGetMatIndexBase((const cusparseMatDescr_t)descrA));
 }
 
+hipsparseStatus_t hipsparseSetMatProperties(hipsparseMatDescr_t descrA, int properties)
+{
+    const int valid = HIPSPARSE_MAT_PROPERTY_SORTED | HIPSPARSE_MAT_PROPERTY_UNIQUE
+                      | HIPSPARSE_MAT_PROPERTY_SYMMETRIC_PATTERN
+                      | HIPSPARSE_MAT_PROPERTY_FULL_DIAGONAL;
+
+    if(descrA == nullptr || (properties & ~valid) != 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseMatDescrProperties props = hipsparseMatPropertiesGet(descrA);
+
+    props.properties = properties;
+    hipsparseMatPropertiesSet(descrA, props);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+int hipsparseGetMatProperties(const hipsparseMatDescr_t descrA)
+{
+    return hipsparseMatPropertiesGet(descrA).properties;
+}
+
+hipsparseStatus_t hipsparseSetMatPatternId(hipsparseMatDescr_t descrA, uint64_t patternId)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseMatDescrProperties props = hipsparseMatPropertiesGet(descrA);
+
+    props.pattern_id = patternId;
+    hipsparseMatPropertiesSet(descrA, props);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+uint64_t hipsparseGetMatPatternId(const hipsparseMatDescr_t descrA)
+{
+    return hipsparseMatPropertiesGet(descrA).pattern_id;
+}
+
 #if CUDART_VERSION < 11000
 hipsparseStatus_t hipsparseCreateHybMat(hipsparseHybMat_t* hybA)
 {
@@ -694,6 +1027,93 @@ hipsparseStatus_t hipsparseDestroyCsru2csrInfo(csru2csrInfo_t info)
     return hipCUSPARSEStatusToHIPStatus(cusparseDestroyCsru2csrInfo(info));
 }
 
+hipsparseStatus_t hipsparseCreateCsrPrecondInfo(csrPrecondInfo_t* info)
+{
+    if(info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *info = new csrPrecondInfo;
+
+    hipsparseStatus_t status = hipsparseCreateMatDescr(&(*info)->descr_L);
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseCreateMatDescr(&(*info)->descr_U);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseCreateCsrsv2Info(&(*info)->info_L);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseCreateCsrsv2Info(&(*info)->info_U);
+    }
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        hipsparseDestroyCsrPrecondInfo(*info);
+        *info = nullptr;
+    }
+
+    return status;
+}
+
+hipsparseStatus_t hipsparseDestroyCsrPrecondInfo(csrPrecondInfo_t info)
+{
+    // Check if info structure has been created
+    if(info != nullptr)
+    {
+        if(info->descr_L != nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyMatDescr(info->descr_L));
+        }
+
+        if(info->descr_U != nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyMatDescr(info->descr_U));
+        }
+
+        if(info->info_L != nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyCsrsv2Info(info->info_L));
+        }
+
+        if(info->info_U != nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyCsrsv2Info(info->info_U));
+        }
+
+        delete info;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#if CUDART_VERSION < 11000
+hipsparseStatus_t hipsparseCreateCsrmvInfo(csrmvInfo_t* info)
+{
+    if(info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *info = new csrmvInfo;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyCsrmvInfo(csrmvInfo_t info)
+{
+    delete info;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
 #if CUDART_VERSION < 12000
 hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
                                   int                  nnz,
@@ -1166,53 +1586,333 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                                                        (const cuDoubleComplex*)beta,
                                                        (cuDoubleComplex*)y));
 }
-#endif
 
-hipsparseStatus_t
-    hipsparseXcsrsv2_zeroPivot(hipsparseHandle_t handle, csrsv2Info_t info, int* position)
+// The merge path kernel of cusparseXcsrmv_mp balances the work on the fly and requires no
+// meta data, thus the analysis only records that the load balanced path has been requested
+static hipsparseStatus_t hipsparseCsrmvAnalysis(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       n,
+                                                int                       nnz,
+                                                const hipsparseMatDescr_t descrA,
+                                                csrmvInfo_t               info)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseXcsrsv2_zeroPivot((cusparseHandle_t)handle, (csrsv2Info_t)info, position));
+    if(handle == nullptr || descrA == nullptr || info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    info->analysed = true;
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
-                                              hipsparseOperation_t      transA,
-                                              int                       m,
-                                              int                       nnz,
-                                              const hipsparseMatDescr_t descrA,
-                                              float*                    csrSortedValA,
-                                              const int*                csrSortedRowPtrA,
-                                              const int*                csrSortedColIndA,
-                                              csrsv2Info_t              info,
-                                              int*                      pBufferSizeInBytes)
+hipsparseStatus_t hipsparseScsrmv_analysis(hipsparseHandle_t         handle,
+                                           hipsparseOperation_t      transA,
+                                           int                       m,
+                                           int                       n,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const float*              csrSortedValA,
+                                           const int*                csrSortedRowPtrA,
+                                           const int*                csrSortedColIndA,
+                                           csrmvInfo_t               info)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseScsrsv2_bufferSize((cusparseHandle_t)handle,
-                                   hipOperationToCudaOperation(transA),
-                                   m,
-                                   nnz,
-                                   (cusparseMatDescr_t)descrA,
-                                   csrSortedValA,
-                                   csrSortedRowPtrA,
-                                   csrSortedColIndA,
-                                   (csrsv2Info_t)info,
-                                   pBufferSizeInBytes));
+    return hipsparseCsrmvAnalysis(handle, m, n, nnz, descrA, info);
 }
 
-hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
-                                              hipsparseOperation_t      transA,
-                                              int                       m,
-                                              int                       nnz,
-                                              const hipsparseMatDescr_t descrA,
-                                              double*                   csrSortedValA,
-                                              const int*                csrSortedRowPtrA,
-                                              const int*                csrSortedColIndA,
-                                              csrsv2Info_t              info,
-                                              int*                      pBufferSizeInBytes)
+hipsparseStatus_t hipsparseDcsrmv_analysis(hipsparseHandle_t         handle,
+                                           hipsparseOperation_t      transA,
+                                           int                       m,
+                                           int                       n,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const double*             csrSortedValA,
+                                           const int*                csrSortedRowPtrA,
+                                           const int*                csrSortedColIndA,
+                                           csrmvInfo_t               info)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDcsrsv2_bufferSize((cusparseHandle_t)handle,
-                                   hipOperationToCudaOperation(transA),
+    return hipsparseCsrmvAnalysis(handle, m, n, nnz, descrA, info);
+}
+
+hipsparseStatus_t hipsparseCcsrmv_analysis(hipsparseHandle_t         handle,
+                                           hipsparseOperation_t      transA,
+                                           int                       m,
+                                           int                       n,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const hipComplex*         csrSortedValA,
+                                           const int*                csrSortedRowPtrA,
+                                           const int*                csrSortedColIndA,
+                                           csrmvInfo_t               info)
+{
+    return hipsparseCsrmvAnalysis(handle, m, n, nnz, descrA, info);
+}
+
+hipsparseStatus_t hipsparseZcsrmv_analysis(hipsparseHandle_t         handle,
+                                           hipsparseOperation_t      transA,
+                                           int                       m,
+                                           int                       n,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const hipDoubleComplex*   csrSortedValA,
+                                           const int*                csrSortedRowPtrA,
+                                           const int*                csrSortedColIndA,
+                                           csrmvInfo_t               info)
+{
+    return hipsparseCsrmvAnalysis(handle, m, n, nnz, descrA, info);
+}
+
+hipsparseStatus_t hipsparseScsrmvWithInfo(hipsparseHandle_t         handle,
+                                          hipsparseOperation_t      transA,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnz,
+                                          const float*              alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const float*              csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrmvInfo_t               info,
+                                          const float*              x,
+                                          const float*              beta,
+                                          float*                    y)
+{
+    // Use the load balanced merge path kernel, if the matrix has been analysed. It supports
+    // general matrices only, symmetric and Hermitian matrices are left to cusparseXcsrmv
+    if(info != nullptr && info->analysed && transA == HIPSPARSE_OPERATION_NON_TRANSPOSE
+       && hipsparseGetMatType(descrA) == HIPSPARSE_MATRIX_TYPE_GENERAL)
+    {
+        return hipCUSPARSEStatusToHIPStatus(cusparseScsrmv_mp((cusparseHandle_t)handle,
+                                                              hipOperationToCudaOperation(transA),
+                                                              m,
+                                                              n,
+                                                              nnz,
+                                                              alpha,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              csrSortedValA,
+                                                              csrSortedRowPtrA,
+                                                              csrSortedColIndA,
+                                                              x,
+                                                              beta,
+                                                              y));
+    }
+
+    return hipsparseScsrmv(handle,
+                           transA,
+                           m,
+                           n,
+                           nnz,
+                           alpha,
+                           descrA,
+                           csrSortedValA,
+                           csrSortedRowPtrA,
+                           csrSortedColIndA,
+                           x,
+                           beta,
+                           y);
+}
+
+hipsparseStatus_t hipsparseDcsrmvWithInfo(hipsparseHandle_t         handle,
+                                          hipsparseOperation_t      transA,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnz,
+                                          const double*             alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const double*             csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrmvInfo_t               info,
+                                          const double*             x,
+                                          const double*             beta,
+                                          double*                   y)
+{
+    // Use the load balanced merge path kernel, if the matrix has been analysed. It supports
+    // general matrices only, symmetric and Hermitian matrices are left to cusparseXcsrmv
+    if(info != nullptr && info->analysed && transA == HIPSPARSE_OPERATION_NON_TRANSPOSE
+       && hipsparseGetMatType(descrA) == HIPSPARSE_MATRIX_TYPE_GENERAL)
+    {
+        return hipCUSPARSEStatusToHIPStatus(cusparseDcsrmv_mp((cusparseHandle_t)handle,
+                                                              hipOperationToCudaOperation(transA),
+                                                              m,
+                                                              n,
+                                                              nnz,
+                                                              alpha,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              csrSortedValA,
+                                                              csrSortedRowPtrA,
+                                                              csrSortedColIndA,
+                                                              x,
+                                                              beta,
+                                                              y));
+    }
+
+    return hipsparseDcsrmv(handle,
+                           transA,
+                           m,
+                           n,
+                           nnz,
+                           alpha,
+                           descrA,
+                           csrSortedValA,
+                           csrSortedRowPtrA,
+                           csrSortedColIndA,
+                           x,
+                           beta,
+                           y);
+}
+
+hipsparseStatus_t hipsparseCcsrmvWithInfo(hipsparseHandle_t         handle,
+                                          hipsparseOperation_t      transA,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnz,
+                                          const hipComplex*         alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipComplex*         csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrmvInfo_t               info,
+                                          const hipComplex*         x,
+                                          const hipComplex*         beta,
+                                          hipComplex*               y)
+{
+    // Use the load balanced merge path kernel, if the matrix has been analysed. It supports
+    // general matrices only, symmetric and Hermitian matrices are left to cusparseXcsrmv
+    if(info != nullptr && info->analysed && transA == HIPSPARSE_OPERATION_NON_TRANSPOSE
+       && hipsparseGetMatType(descrA) == HIPSPARSE_MATRIX_TYPE_GENERAL)
+    {
+        return hipCUSPARSEStatusToHIPStatus(cusparseCcsrmv_mp((cusparseHandle_t)handle,
+                                                              hipOperationToCudaOperation(transA),
+                                                              m,
+                                                              n,
+                                                              nnz,
+                                                              (const cuComplex*)alpha,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              (const cuComplex*)csrSortedValA,
+                                                              csrSortedRowPtrA,
+                                                              csrSortedColIndA,
+                                                              (const cuComplex*)x,
+                                                              (const cuComplex*)beta,
+                                                              (cuComplex*)y));
+    }
+
+    return hipsparseCcsrmv(handle,
+                           transA,
+                           m,
+                           n,
+                           nnz,
+                           alpha,
+                           descrA,
+                           csrSortedValA,
+                           csrSortedRowPtrA,
+                           csrSortedColIndA,
+                           x,
+                           beta,
+                           y);
+}
+
+hipsparseStatus_t hipsparseZcsrmvWithInfo(hipsparseHandle_t         handle,
+                                          hipsparseOperation_t      transA,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnz,
+                                          const hipDoubleComplex*   alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipDoubleComplex*   csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrmvInfo_t               info,
+                                          const hipDoubleComplex*   x,
+                                          const hipDoubleComplex*   beta,
+                                          hipDoubleComplex*         y)
+{
+    // Use the load balanced merge path kernel, if the matrix has been analysed. It supports
+    // general matrices only, symmetric and Hermitian matrices are left to cusparseXcsrmv
+    if(info != nullptr && info->analysed && transA == HIPSPARSE_OPERATION_NON_TRANSPOSE
+       && hipsparseGetMatType(descrA) == HIPSPARSE_MATRIX_TYPE_GENERAL)
+    {
+        return hipCUSPARSEStatusToHIPStatus(cusparseZcsrmv_mp((cusparseHandle_t)handle,
+                                                              hipOperationToCudaOperation(transA),
+                                                              m,
+                                                              n,
+                                                              nnz,
+                                                              (const cuDoubleComplex*)alpha,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              (const cuDoubleComplex*)csrSortedValA,
+                                                              csrSortedRowPtrA,
+                                                              csrSortedColIndA,
+                                                              (const cuDoubleComplex*)x,
+                                                              (const cuDoubleComplex*)beta,
+                                                              (cuDoubleComplex*)y));
+    }
+
+    return hipsparseZcsrmv(handle,
+                           transA,
+                           m,
+                           n,
+                           nnz,
+                           alpha,
+                           descrA,
+                           csrSortedValA,
+                           csrSortedRowPtrA,
+                           csrSortedColIndA,
+                           x,
+                           beta,
+                           y);
+}
+#endif
+
+hipsparseStatus_t
+    hipsparseXcsrsv2_zeroPivot(hipsparseHandle_t handle, csrsv2Info_t info, int* position)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseXcsrsv2_zeroPivot((cusparseHandle_t)handle, (csrsv2Info_t)info, position));
+}
+
+hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      transA,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              float*                    csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseScsrsv2_bufferSize((cusparseHandle_t)handle,
+                                   hipOperationToCudaOperation(transA),
+                                   m,
+                                   nnz,
+                                   (cusparseMatDescr_t)descrA,
+                                   csrSortedValA,
+                                   csrSortedRowPtrA,
+                                   csrSortedColIndA,
+                                   (csrsv2Info_t)info,
+                                   pBufferSizeInBytes));
+}
+
+hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      transA,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              double*                   csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDcsrsv2_bufferSize((cusparseHandle_t)handle,
+                                   hipOperationToCudaOperation(transA),
                                    m,
                                    nnz,
                                    (cusparseMatDescr_t)descrA,
@@ -4197,6 +4897,160 @@ hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
 }
 #endif
 
+// Returns true, if A and B carry the same sparsity pattern id and all matrices share the
+// index base. Then, C = alpha * A + beta * B has the pattern of A and its values are a
+// plain vector sum.
+static bool hipsparseCsrgeam2SamePattern(const hipsparseMatDescr_t descrA,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrB,
+                                         int                       nnzB,
+                                         const hipsparseMatDescr_t descrC)
+{
+    if(descrA == nullptr || descrB == nullptr || descrC == nullptr || nnzA < 0 || nnzA != nnzB)
+    {
+        return false;
+    }
+
+    uint64_t id = hipsparseGetMatPatternId(descrA);
+
+    return id != 0 && id == hipsparseGetMatPatternId(descrB)
+           && hipsparseGetMatIndexBase(descrA) == hipsparseGetMatIndexBase(descrB)
+           && hipsparseGetMatIndexBase(descrA) == hipsparseGetMatIndexBase(descrC);
+}
+
+// Row offsets and number of non-zero entries of C = alpha * A + beta * B for matrices of
+// the same pattern, which are those of A
+static hipsparseStatus_t hipsparseXcsrgeam2NnzSamePattern(hipsparseHandle_t handle,
+                                                          int               m,
+                                                          int               nnz,
+                                                          const int*        csrRowPtrA,
+                                                          int*              csrRowPtrC,
+                                                          int*              nnzTotalDevHostPtr)
+{
+    if(handle == nullptr || m < 0 || csrRowPtrA == nullptr || csrRowPtrC == nullptr
+       || nnzTotalDevHostPtr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    if(csrRowPtrC != csrRowPtrA)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            csrRowPtrC, csrRowPtrA, sizeof(int) * (m + 1), cudaMemcpyDeviceToDevice, stream));
+    }
+
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+
+    if(mode == HIPSPARSE_POINTER_MODE_DEVICE)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            nnzTotalDevHostPtr, &nnz, sizeof(int), cudaMemcpyHostToDevice, stream));
+        RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+    }
+    else
+    {
+        *nnzTotalDevHostPtr = nnz;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#if(CUDART_VERSION >= 11000)
+// C = alpha * A + beta * B for matrices of the same pattern. C takes the column indices of
+// A and its values are computed as valC = valB, followed by an axpby with valA. If valC
+// aliases valA, the roles of A and B are swapped, such that valA is only read in place.
+// valC must not alias both. The buffer holds the identity indices of the sparse vector.
+static hipsparseStatus_t hipsparseCsrgeam2Values(hipsparseHandle_t handle,
+                                                 int               nnz,
+                                                 const void*       alpha,
+                                                 const void*       csrValA,
+                                                 const int*        csrColIndA,
+                                                 const void*       beta,
+                                                 const void*       csrValB,
+                                                 void*             csrValC,
+                                                 int*              csrColIndC,
+                                                 hipDataType       valueType,
+                                                 size_t            valueSize,
+                                                 void*             pBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || beta == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Quick return
+    if(nnz == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(csrValA == nullptr || csrColIndA == nullptr || csrValB == nullptr || csrValC == nullptr
+       || csrColIndC == nullptr || pBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The sparse vector is read while valC is written, it must not alias valC
+    if(csrValC == csrValA && csrValC == csrValB)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // valC = beta * valB + alpha * valA, where valC already holds valA
+    if(csrValC == csrValA)
+    {
+        std::swap(alpha, beta);
+        std::swap(csrValA, csrValB);
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    if(csrColIndC != csrColIndA)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            csrColIndC, csrColIndA, sizeof(int) * nnz, cudaMemcpyDeviceToDevice, stream));
+    }
+
+    if(csrValC != csrValB)
+    {
+        RETURN_IF_CUDA_ERROR(
+            cudaMemcpyAsync(csrValC, csrValB, valueSize * nnz, cudaMemcpyDeviceToDevice, stream));
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, (int*)pBuffer));
+
+    hipsparseSpVecDescr_t vec_x;
+    hipsparseDnVecDescr_t vec_y;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateSpVec(&vec_x,
+                                                   nnz,
+                                                   nnz,
+                                                   pBuffer,
+                                                   (void*)csrValA,
+                                                   HIPSPARSE_INDEX_32I,
+                                                   HIPSPARSE_INDEX_BASE_ZERO,
+                                                   valueType));
+
+    hipsparseStatus_t status = hipsparseCreateDnVec(&vec_y, nnz, csrValC, valueType);
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseAxpby(handle, alpha, vec_x, beta, vec_y);
+        hipsparseDestroyDnVec(vec_y);
+    }
+
+    hipsparseDestroySpVec(vec_x);
+
+    return status;
+}
+#endif
+
 hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
                                                    int                       m,
                                                    int                       n,
@@ -4218,27 +5072,34 @@ hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseScsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
-                                        m,
-                                        n,
-                                        alpha,
-                                        (const cusparseMatDescr_t)descrA,
-                                        nnzA,
-                                        csrSortedValA,
-                                        csrSortedRowPtrA,
-                                        csrSortedColIndA,
-                                        beta,
-                                        (const cusparseMatDescr_t)descrB,
-                                        nnzB,
-                                        csrSortedValB,
-                                        csrSortedRowPtrB,
-                                        csrSortedColIndB,
-                                        (const cusparseMatDescr_t)descrC,
-                                        csrSortedValC,
-                                        csrSortedRowPtrC,
-                                        csrSortedColIndC,
-                                        pBufferSizeInBytes));
+    RETURN_IF_CUSPARSE_ERROR(cusparseScsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
+                                                             m,
+                                                             n,
+                                                             alpha,
+                                                             (const cusparseMatDescr_t)descrA,
+                                                             nnzA,
+                                                             csrSortedValA,
+                                                             csrSortedRowPtrA,
+                                                             csrSortedColIndA,
+                                                             beta,
+                                                             (const cusparseMatDescr_t)descrB,
+                                                             nnzB,
+                                                             csrSortedValB,
+                                                             csrSortedRowPtrB,
+                                                             csrSortedColIndB,
+                                                             (const cusparseMatDescr_t)descrC,
+                                                             csrSortedValC,
+                                                             csrSortedRowPtrC,
+                                                             csrSortedColIndC,
+                                                             pBufferSizeInBytes));
+
+    // The same pattern path needs the identity indices of the values of A
+    if(hipsparseCsrgeam2SamePattern(descrA, nnzA, descrB, nnzB, descrC))
+    {
+        *pBufferSizeInBytes = std::max(*pBufferSizeInBytes, sizeof(int) * nnzA);
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4262,27 +5123,34 @@ hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDcsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
-                                        m,
-                                        n,
-                                        alpha,
-                                        (const cusparseMatDescr_t)descrA,
-                                        nnzA,
-                                        csrSortedValA,
-                                        csrSortedRowPtrA,
-                                        csrSortedColIndA,
-                                        beta,
-                                        (const cusparseMatDescr_t)descrB,
-                                        nnzB,
-                                        csrSortedValB,
-                                        csrSortedRowPtrB,
-                                        csrSortedColIndB,
-                                        (const cusparseMatDescr_t)descrC,
-                                        csrSortedValC,
-                                        csrSortedRowPtrC,
-                                        csrSortedColIndC,
-                                        pBufferSizeInBytes));
+    RETURN_IF_CUSPARSE_ERROR(cusparseDcsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
+                                                             m,
+                                                             n,
+                                                             alpha,
+                                                             (const cusparseMatDescr_t)descrA,
+                                                             nnzA,
+                                                             csrSortedValA,
+                                                             csrSortedRowPtrA,
+                                                             csrSortedColIndA,
+                                                             beta,
+                                                             (const cusparseMatDescr_t)descrB,
+                                                             nnzB,
+                                                             csrSortedValB,
+                                                             csrSortedRowPtrB,
+                                                             csrSortedColIndB,
+                                                             (const cusparseMatDescr_t)descrC,
+                                                             csrSortedValC,
+                                                             csrSortedRowPtrC,
+                                                             csrSortedColIndC,
+                                                             pBufferSizeInBytes));
+
+    // The same pattern path needs the identity indices of the values of A
+    if(hipsparseCsrgeam2SamePattern(descrA, nnzA, descrB, nnzB, descrC))
+    {
+        *pBufferSizeInBytes = std::max(*pBufferSizeInBytes, sizeof(int) * nnzA);
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4306,27 +5174,34 @@ hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseCcsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
-                                        m,
-                                        n,
-                                        (const cuComplex*)alpha,
-                                        (const cusparseMatDescr_t)descrA,
-                                        nnzA,
-                                        (const cuComplex*)csrSortedValA,
-                                        csrSortedRowPtrA,
-                                        csrSortedColIndA,
-                                        (const cuComplex*)beta,
-                                        (const cusparseMatDescr_t)descrB,
-                                        nnzB,
-                                        (const cuComplex*)csrSortedValB,
-                                        csrSortedRowPtrB,
-                                        csrSortedColIndB,
-                                        (const cusparseMatDescr_t)descrC,
-                                        (cuComplex*)csrSortedValC,
-                                        csrSortedRowPtrC,
-                                        csrSortedColIndC,
-                                        pBufferSizeInBytes));
+    RETURN_IF_CUSPARSE_ERROR(cusparseCcsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
+                                                             m,
+                                                             n,
+                                                             (const cuComplex*)alpha,
+                                                             (const cusparseMatDescr_t)descrA,
+                                                             nnzA,
+                                                             (const cuComplex*)csrSortedValA,
+                                                             csrSortedRowPtrA,
+                                                             csrSortedColIndA,
+                                                             (const cuComplex*)beta,
+                                                             (const cusparseMatDescr_t)descrB,
+                                                             nnzB,
+                                                             (const cuComplex*)csrSortedValB,
+                                                             csrSortedRowPtrB,
+                                                             csrSortedColIndB,
+                                                             (const cusparseMatDescr_t)descrC,
+                                                             (cuComplex*)csrSortedValC,
+                                                             csrSortedRowPtrC,
+                                                             csrSortedColIndC,
+                                                             pBufferSizeInBytes));
+
+    // The same pattern path needs the identity indices of the values of A
+    if(hipsparseCsrgeam2SamePattern(descrA, nnzA, descrB, nnzB, descrC))
+    {
+        *pBufferSizeInBytes = std::max(*pBufferSizeInBytes, sizeof(int) * nnzA);
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4350,27 +5225,34 @@ hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseZcsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
-                                        m,
-                                        n,
-                                        (const cuDoubleComplex*)alpha,
-                                        (const cusparseMatDescr_t)descrA,
-                                        nnzA,
-                                        (const cuDoubleComplex*)csrSortedValA,
-                                        csrSortedRowPtrA,
-                                        csrSortedColIndA,
-                                        (const cuDoubleComplex*)beta,
-                                        (const cusparseMatDescr_t)descrB,
-                                        nnzB,
-                                        (const cuDoubleComplex*)csrSortedValB,
-                                        csrSortedRowPtrB,
-                                        csrSortedColIndB,
-                                        (const cusparseMatDescr_t)descrC,
-                                        (cuDoubleComplex*)csrSortedValC,
-                                        csrSortedRowPtrC,
-                                        csrSortedColIndC,
-                                        pBufferSizeInBytes));
+    RETURN_IF_CUSPARSE_ERROR(cusparseZcsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
+                                                             m,
+                                                             n,
+                                                             (const cuDoubleComplex*)alpha,
+                                                             (const cusparseMatDescr_t)descrA,
+                                                             nnzA,
+                                                             (const cuDoubleComplex*)csrSortedValA,
+                                                             csrSortedRowPtrA,
+                                                             csrSortedColIndA,
+                                                             (const cuDoubleComplex*)beta,
+                                                             (const cusparseMatDescr_t)descrB,
+                                                             nnzB,
+                                                             (const cuDoubleComplex*)csrSortedValB,
+                                                             csrSortedRowPtrB,
+                                                             csrSortedColIndB,
+                                                             (const cusparseMatDescr_t)descrC,
+                                                             (cuDoubleComplex*)csrSortedValC,
+                                                             csrSortedRowPtrC,
+                                                             csrSortedColIndC,
+                                                             pBufferSizeInBytes));
+
+    // The same pattern path needs the identity indices of the values of A
+    if(hipsparseCsrgeam2SamePattern(descrA, nnzA, descrB, nnzB, descrC))
+    {
+        *pBufferSizeInBytes = std::max(*pBufferSizeInBytes, sizeof(int) * nnzA);
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
@@ -4389,6 +5271,13 @@ hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
                                         int*                      nnzTotalDevHostPtr,
                                         void*                     workspace)
 {
+    // Matrices of the same pattern give C the row offsets of A
+    if(hipsparseCsrgeam2SamePattern(descrA, nnzA, descrB, nnzB, descrC))
+    {
+        return hipsparseXcsrgeam2NnzSamePattern(
+            handle, m, nnzA, csrSortedRowPtrA, csrSortedRowPtrC, nnzTotalDevHostPtr);
+    }
+
     return hipCUSPARSEStatusToHIPStatus(cusparseXcsrgeam2Nnz((cusparseHandle_t)handle,
                                                              m,
                                                              n,
@@ -4427,6 +5316,25 @@ hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+#if(CUDART_VERSION >= 11000)
+    // Matrices of the same pattern are added as vectors
+    if(hipsparseCsrgeam2SamePattern(descrA, nnzA, descrB, nnzB, descrC))
+    {
+        return hipsparseCsrgeam2Values(handle,
+                                       nnzA,
+                                       alpha,
+                                       csrSortedValA,
+                                       csrSortedColIndA,
+                                       beta,
+                                       csrSortedValB,
+                                       csrSortedValC,
+                                       csrSortedColIndC,
+                                       HIP_R_32F,
+                                       sizeof(float),
+                                       pBuffer);
+    }
+#endif
+
     return hipCUSPARSEStatusToHIPStatus(cusparseScsrgeam2((cusparseHandle_t)handle,
                                                           m,
                                                           n,
@@ -4470,6 +5378,25 @@ hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+#if(CUDART_VERSION >= 11000)
+    // Matrices of the same pattern are added as vectors
+    if(hipsparseCsrgeam2SamePattern(descrA, nnzA, descrB, nnzB, descrC))
+    {
+        return hipsparseCsrgeam2Values(handle,
+                                       nnzA,
+                                       alpha,
+                                       csrSortedValA,
+                                       csrSortedColIndA,
+                                       beta,
+                                       csrSortedValB,
+                                       csrSortedValC,
+                                       csrSortedColIndC,
+                                       HIP_R_64F,
+                                       sizeof(double),
+                                       pBuffer);
+    }
+#endif
+
     return hipCUSPARSEStatusToHIPStatus(cusparseDcsrgeam2((cusparseHandle_t)handle,
                                                           m,
                                                           n,
@@ -4513,6 +5440,25 @@ hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+#if(CUDART_VERSION >= 11000)
+    // Matrices of the same pattern are added as vectors
+    if(hipsparseCsrgeam2SamePattern(descrA, nnzA, descrB, nnzB, descrC))
+    {
+        return hipsparseCsrgeam2Values(handle,
+                                       nnzA,
+                                       alpha,
+                                       csrSortedValA,
+                                       csrSortedColIndA,
+                                       beta,
+                                       csrSortedValB,
+                                       csrSortedValC,
+                                       csrSortedColIndC,
+                                       HIP_C_32F,
+                                       sizeof(hipComplex),
+                                       pBuffer);
+    }
+#endif
+
     return hipCUSPARSEStatusToHIPStatus(cusparseCcsrgeam2((cusparseHandle_t)handle,
                                                           m,
                                                           n,
@@ -4556,6 +5502,25 @@ hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+#if(CUDART_VERSION >= 11000)
+    // Matrices of the same pattern are added as vectors
+    if(hipsparseCsrgeam2SamePattern(descrA, nnzA, descrB, nnzB, descrC))
+    {
+        return hipsparseCsrgeam2Values(handle,
+                                       nnzA,
+                                       alpha,
+                                       csrSortedValA,
+                                       csrSortedColIndA,
+                                       beta,
+                                       csrSortedValB,
+                                       csrSortedValC,
+                                       csrSortedColIndC,
+                                       HIP_C_64F,
+                                       sizeof(hipDoubleComplex),
+                                       pBuffer);
+    }
+#endif
+
     return hipCUSPARSEStatusToHIPStatus(cusparseZcsrgeam2((cusparseHandle_t)handle,
                                                           m,
                                                           n,
@@ -5247,6 +6212,17 @@ hipsparseStatus_t
         cusparseXbsrilu02_zeroPivot((cusparseHandle_t)handle, (bsrilu02Info_t)info, position));
 }
 
+hipsparseStatus_t hipsparseXbsrilu02_trim(hipsparseHandle_t handle, bsrilu02Info_t info)
+{
+    if(handle == nullptr || info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // cuSPARSE keeps the analysis data until the info is destroyed
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
 hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
@@ -5624,6 +6600,17 @@ hipsparseStatus_t
         cusparseXcsrilu02_zeroPivot((cusparseHandle_t)handle, (csrilu02Info_t)info, position));
 }
 
+hipsparseStatus_t hipsparseXcsrilu02_trim(hipsparseHandle_t handle, csrilu02Info_t info)
+{
+    if(handle == nullptr || info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // cuSPARSE keeps the analysis data until the info is destroyed
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
 hipsparseStatus_t hipsparseScsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
@@ -5999,6 +6986,17 @@ hipsparseStatus_t
         cusparseXbsric02_zeroPivot((cusparseHandle_t)handle, (bsric02Info_t)info, position));
 }
 
+hipsparseStatus_t hipsparseXbsric02_trim(hipsparseHandle_t handle, bsric02Info_t info)
+{
+    if(handle == nullptr || info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // cuSPARSE keeps the analysis data until the info is destroyed
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
 hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
                                                hipsparseDirection_t      dirA,
                                                int                       mb,
@@ -6326,6 +7324,17 @@ hipsparseStatus_t
         cusparseXcsric02_zeroPivot((cusparseHandle_t)handle, (csric02Info_t)info, position));
 }
 
+hipsparseStatus_t hipsparseXcsric02_trim(hipsparseHandle_t handle, csric02Info_t info)
+{
+    if(handle == nullptr || info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // cuSPARSE keeps the analysis data until the info is destroyed
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
 hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
                                                int                       m,
                                                int                       nnz,
@@ -6655,5036 +7664,10741 @@ hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
                                                          pBuffer));
 }
 
-hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
-                                hipsparseDirection_t      dirA,
-                                int                       m,
-                                int                       n,
-                                const hipsparseMatDescr_t descrA,
-                                const float*              A,
-                                int                       lda,
-                                int*                      nnzPerRowColumn,
-                                int*                      nnzTotalDevHostPtr)
+// Value size and unit scalar of the data type, where complex scalars store the real part first
+static hipsparseStatus_t hipsparseTypeScalars(hipDataType type, size_t* val_size, char* one)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSnnz((cusparseHandle_t)handle,
-                                                     hipDirectionToCudaDirection(dirA),
-                                                     m,
-                                                     n,
-                                                     (const cusparseMatDescr_t)descrA,
-                                                     A,
-                                                     lda,
-                                                     nnzPerRowColumn,
-                                                     nnzTotalDevHostPtr));
+    switch(type)
+    {
+    case HIP_R_32F:
+    case HIP_C_32F:
+        *val_size    = (type == HIP_R_32F) ? sizeof(float) : 2 * sizeof(float);
+        *(float*)one = 1.0f;
+        return HIPSPARSE_STATUS_SUCCESS;
+    case HIP_R_64F:
+    case HIP_C_64F:
+        *val_size     = (type == HIP_R_64F) ? sizeof(double) : 2 * sizeof(double);
+        *(double*)one = 1.0;
+        return HIPSPARSE_STATUS_SUCCESS;
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
 }
 
-hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
-                                hipsparseDirection_t      dirA,
-                                int                       m,
-                                int                       n,
-                                const hipsparseMatDescr_t descrA,
-                                const double*             A,
-                                int                       lda,
-                                int*                      nnzPerRowColumn,
-                                int*                      nnzTotalDevHostPtr)
+// cuSPARSE keeps the analysis of each triangular solve in a separate csrsv2 info
+static csrsv2Info_t hipsparseCsrPrecondSvInfo(csrPrecondInfo_t info, void* factor, bool second)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDnnz((cusparseHandle_t)handle,
-                                                     hipDirectionToCudaDirection(dirA),
-                                                     m,
-                                                     n,
-                                                     (const cusparseMatDescr_t)descrA,
-                                                     A,
-                                                     lda,
-                                                     nnzPerRowColumn,
-                                                     nnzTotalDevHostPtr));
+    return second ? info->info_U : info->info_L;
 }
 
-hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
-                                hipsparseDirection_t      dirA,
-                                int                       m,
-                                int                       n,
-                                const hipsparseMatDescr_t descrA,
-                                const hipComplex*         A,
-                                int                       lda,
-                                int*                      nnzPerRowColumn,
-                                int*                      nnzTotalDevHostPtr)
+// Type dispatch of the triangular solves used by the csrilu02 / csric02 preconditioner apply
+static hipsparseStatus_t hipsparseCsrPrecondSvBufferSize(hipsparseHandle_t         handle,
+                                                         hipDataType               type,
+                                                         hipsparseOperation_t      trans,
+                                                         int                       m,
+                                                         int                       nnz,
+                                                         const hipsparseMatDescr_t descr,
+                                                         void*                     val,
+                                                         const int*                row_ptr,
+                                                         const int*                col_ind,
+                                                         csrsv2Info_t              info,
+                                                         int*                      size)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCnnz((cusparseHandle_t)handle,
-                                                     hipDirectionToCudaDirection(dirA),
-                                                     m,
-                                                     n,
-                                                     (const cusparseMatDescr_t)descrA,
-                                                     (const cuComplex*)A,
-                                                     lda,
-                                                     nnzPerRowColumn,
-                                                     nnzTotalDevHostPtr));
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipsparseScsrsv2_bufferSize(
+            handle, trans, m, nnz, descr, (float*)val, row_ptr, col_ind, info, size);
+    case HIP_R_64F:
+        return hipsparseDcsrsv2_bufferSize(
+            handle, trans, m, nnz, descr, (double*)val, row_ptr, col_ind, info, size);
+    case HIP_C_32F:
+        return hipsparseCcsrsv2_bufferSize(
+            handle, trans, m, nnz, descr, (hipComplex*)val, row_ptr, col_ind, info, size);
+    case HIP_C_64F:
+        return hipsparseZcsrsv2_bufferSize(
+            handle, trans, m, nnz, descr, (hipDoubleComplex*)val, row_ptr, col_ind, info, size);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
 }
 
-hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
-                                hipsparseDirection_t      dirA,
-                                int                       m,
-                                int                       n,
-                                const hipsparseMatDescr_t descrA,
-                                const hipDoubleComplex*   A,
-                                int                       lda,
-                                int*                      nnzPerRowColumn,
-                                int*                      nnzTotalDevHostPtr)
+static hipsparseStatus_t hipsparseCsrPrecondSvAnalysis(hipsparseHandle_t         handle,
+                                                       hipDataType               type,
+                                                       hipsparseOperation_t      trans,
+                                                       int                       m,
+                                                       int                       nnz,
+                                                       const hipsparseMatDescr_t descr,
+                                                       const void*               val,
+                                                       const int*                row_ptr,
+                                                       const int*                col_ind,
+                                                       csrsv2Info_t              info,
+                                                       hipsparseSolvePolicy_t    policy,
+                                                       void*                     buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZnnz((cusparseHandle_t)handle,
-                                                     hipDirectionToCudaDirection(dirA),
-                                                     m,
-                                                     n,
-                                                     (const cusparseMatDescr_t)descrA,
-                                                     (const cuDoubleComplex*)A,
-                                                     lda,
-                                                     nnzPerRowColumn,
-                                                     nnzTotalDevHostPtr));
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipsparseScsrsv2_analysis(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         (const float*)val,
+                                         row_ptr,
+                                         col_ind,
+                                         info,
+                                         policy,
+                                         buffer);
+    case HIP_R_64F:
+        return hipsparseDcsrsv2_analysis(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         (const double*)val,
+                                         row_ptr,
+                                         col_ind,
+                                         info,
+                                         policy,
+                                         buffer);
+    case HIP_C_32F:
+        return hipsparseCcsrsv2_analysis(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         (const hipComplex*)val,
+                                         row_ptr,
+                                         col_ind,
+                                         info,
+                                         policy,
+                                         buffer);
+    case HIP_C_64F:
+        return hipsparseZcsrsv2_analysis(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         (const hipDoubleComplex*)val,
+                                         row_ptr,
+                                         col_ind,
+                                         info,
+                                         policy,
+                                         buffer);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
 }
 
-hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const float*              A,
-                                      int                       ld,
-                                      const int*                nnzPerRow,
-                                      float*                    csrVal,
-                                      int*                      csrRowPtr,
-                                      int*                      csrColInd)
+static hipsparseStatus_t hipsparseCsrPrecondSvSolve(hipsparseHandle_t         handle,
+                                                    hipDataType               type,
+                                                    hipsparseOperation_t      trans,
+                                                    int                       m,
+                                                    int                       nnz,
+                                                    const void*               alpha,
+                                                    const hipsparseMatDescr_t descr,
+                                                    const void*               val,
+                                                    const int*                row_ptr,
+                                                    const int*                col_ind,
+                                                    csrsv2Info_t              info,
+                                                    const void*               f,
+                                                    void*                     x,
+                                                    hipsparseSolvePolicy_t    policy,
+                                                    void*                     buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSdense2csr((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           A,
-                                                           ld,
-                                                           nnzPerRow,
-                                                           csrVal,
-                                                           csrRowPtr,
-                                                           csrColInd));
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipsparseScsrsv2_solve(handle,
+                                      trans,
+                                      m,
+                                      nnz,
+                                      (const float*)alpha,
+                                      descr,
+                                      (const float*)val,
+                                      row_ptr,
+                                      col_ind,
+                                      info,
+                                      (const float*)f,
+                                      (float*)x,
+                                      policy,
+                                      buffer);
+    case HIP_R_64F:
+        return hipsparseDcsrsv2_solve(handle,
+                                      trans,
+                                      m,
+                                      nnz,
+                                      (const double*)alpha,
+                                      descr,
+                                      (const double*)val,
+                                      row_ptr,
+                                      col_ind,
+                                      info,
+                                      (const double*)f,
+                                      (double*)x,
+                                      policy,
+                                      buffer);
+    case HIP_C_32F:
+        return hipsparseCcsrsv2_solve(handle,
+                                      trans,
+                                      m,
+                                      nnz,
+                                      (const hipComplex*)alpha,
+                                      descr,
+                                      (const hipComplex*)val,
+                                      row_ptr,
+                                      col_ind,
+                                      info,
+                                      (const hipComplex*)f,
+                                      (hipComplex*)x,
+                                      policy,
+                                      buffer);
+    case HIP_C_64F:
+        return hipsparseZcsrsv2_solve(handle,
+                                      trans,
+                                      m,
+                                      nnz,
+                                      (const hipDoubleComplex*)alpha,
+                                      descr,
+                                      (const hipDoubleComplex*)val,
+                                      row_ptr,
+                                      col_ind,
+                                      info,
+                                      (const hipDoubleComplex*)f,
+                                      (hipDoubleComplex*)x,
+                                      policy,
+                                      buffer);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
 }
 
-hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const double*             A,
-                                      int                       ld,
-                                      const int*                nnzPerRow,
-                                      double*                   csrVal,
-                                      int*                      csrRowPtr,
-                                      int*                      csrColInd)
+// Sets up the triangular descriptors of the preconditioner apply and returns the descriptor
+// and operation of both solves. ILU0 solves with L (unit diagonal) and U, IC0 with L and L^H.
+static hipsparseStatus_t hipsparseCsrPrecondSetup(csrPrecondInfo_t          info,
+                                                  hipDataType               type,
+                                                  bool                      ic,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  hipsparseMatDescr_t*      descr,
+                                                  hipsparseOperation_t*     trans)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDdense2csr((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           A,
-                                                           ld,
-                                                           nnzPerRow,
-                                                           csrVal,
-                                                           csrRowPtr,
-                                                           csrColInd));
+    hipsparseIndexBase_t base = hipsparseGetMatIndexBase(descrA);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(info->descr_L, base));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatFillMode(info->descr_L, HIPSPARSE_FILL_MODE_LOWER));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatDiagType(
+        info->descr_L, ic ? HIPSPARSE_DIAG_TYPE_NON_UNIT : HIPSPARSE_DIAG_TYPE_UNIT));
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(info->descr_U, base));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatFillMode(info->descr_U, HIPSPARSE_FILL_MODE_UPPER));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatDiagType(info->descr_U, HIPSPARSE_DIAG_TYPE_NON_UNIT));
+
+    descr[0] = info->descr_L;
+    descr[1] = ic ? info->descr_L : info->descr_U;
+    trans[0] = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    trans[1] = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+    if(ic)
+    {
+        bool is_complex = (type == HIP_C_32F || type == HIP_C_64F);
+
+        trans[1] = is_complex ? HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
+                              : HIPSPARSE_OPERATION_TRANSPOSE;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+static hipsparseStatus_t hipsparseCsrPrecondBufferSize(hipsparseHandle_t         handle,
+                                                       hipDataType               type,
+                                                       bool                      ic,
+                                                       int                       m,
+                                                       int                       nnz,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       void*                     val,
+                                                       const int*                row_ptr,
+                                                       const int*                col_ind,
+                                                       void*                     factor,
+                                                       csrPrecondInfo_t          info,
+                                                       int*                      size)
+{
+    if(handle == nullptr || descrA == nullptr || factor == nullptr || info == nullptr
+       || size == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    size_t val_size;
+    char   one[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTypeScalars(type, &val_size, one));
+
+    hipsparseMatDescr_t  descr[2];
+    hipsparseOperation_t trans[2];
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrPrecondSetup(info, type, ic, descrA, descr, trans));
+
+    int sv_size[2];
+    for(int i = 0; i < 2; ++i)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparseCsrPrecondSvBufferSize(handle,
+                                            type,
+                                            trans[i],
+                                            m,
+                                            nnz,
+                                            descr[i],
+                                            val,
+                                            row_ptr,
+                                            col_ind,
+                                            hipsparseCsrPrecondSvInfo(info, factor, i == 1),
+                                            &sv_size[i]));
+    }
+
+    // Intermediate vector of the two solves, followed by the buffer that both solves share
+    int64_t bytes = (val_size * m + 255) / 256 * 256 + std::max(sv_size[0], sv_size[1]);
+
+    if(bytes > std::numeric_limits<int>::max())
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *size = (int)bytes;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+static hipsparseStatus_t hipsparseCsrPrecondAnalysis(hipsparseHandle_t         handle,
+                                                     hipDataType               type,
+                                                     bool                      ic,
+                                                     int                       m,
+                                                     int                       nnz,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     const void*               val,
+                                                     const int*                row_ptr,
+                                                     const int*                col_ind,
+                                                     void*                     factor,
+                                                     csrPrecondInfo_t          info,
+                                                     hipsparseSolvePolicy_t    policy,
+                                                     void*                     pBuffer)
+{
+    if(handle == nullptr || descrA == nullptr || factor == nullptr || info == nullptr
+       || pBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    size_t val_size;
+    char   one[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTypeScalars(type, &val_size, one));
+
+    hipsparseMatDescr_t  descr[2];
+    hipsparseOperation_t trans[2];
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrPrecondSetup(info, type, ic, descrA, descr, trans));
+
+    void* work = (char*)pBuffer + (val_size * m + 255) / 256 * 256;
+
+    for(int i = 0; i < 2; ++i)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparseCsrPrecondSvAnalysis(handle,
+                                          type,
+                                          trans[i],
+                                          m,
+                                          nnz,
+                                          descr[i],
+                                          val,
+                                          row_ptr,
+                                          col_ind,
+                                          hipsparseCsrPrecondSvInfo(info, factor, i == 1),
+                                          policy,
+                                          work));
+    }
+
+    // Synchronize stream, as csrsv2_analysis
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+static hipsparseStatus_t hipsparseCsrPrecondApply(hipsparseHandle_t         handle,
+                                                  hipDataType               type,
+                                                  bool                      ic,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const void*               alpha,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const void*               val,
+                                                  const int*                row_ptr,
+                                                  const int*                col_ind,
+                                                  void*                     factor,
+                                                  csrPrecondInfo_t          info,
+                                                  const void*               f,
+                                                  void*                     x,
+                                                  hipsparseSolvePolicy_t    policy,
+                                                  void*                     pBuffer)
+{
+    if(handle == nullptr || alpha == nullptr || descrA == nullptr || factor == nullptr
+       || info == nullptr || f == nullptr || x == nullptr || pBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    size_t val_size;
+    char   one[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTypeScalars(type, &val_size, one));
+
+    hipsparseMatDescr_t  descr[2];
+    hipsparseOperation_t trans[2];
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrPrecondSetup(info, type, ic, descrA, descr, trans));
+
+    void* z    = pBuffer;
+    void* work = (char*)pBuffer + (val_size * m + 255) / 256 * 256;
+
+    // z = alpha * L^-1 * f, with alpha in the pointer mode of the handle
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseCsrPrecondSvSolve(handle,
+                                   type,
+                                   trans[0],
+                                   m,
+                                   nnz,
+                                   alpha,
+                                   descr[0],
+                                   val,
+                                   row_ptr,
+                                   col_ind,
+                                   hipsparseCsrPrecondSvInfo(info, factor, false),
+                                   f,
+                                   z,
+                                   policy,
+                                   work));
+
+    // x = U^-1 * z (or L^-H * z), the unit scalar lives on the host
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    hipsparseStatus_t status
+        = hipsparseCsrPrecondSvSolve(handle,
+                                     type,
+                                     trans[1],
+                                     m,
+                                     nnz,
+                                     one,
+                                     descr[1],
+                                     val,
+                                     row_ptr,
+                                     col_ind,
+                                     hipsparseCsrPrecondSvInfo(info, factor, true),
+                                     z,
+                                     x,
+                                     policy,
+                                     work);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+
+    return status;
+}
+
+hipsparseStatus_t hipsparseScsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       nnz,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     float*                    csrSortedValA,
+                                                     const int*                csrSortedRowPtrA,
+                                                     const int*                csrSortedColIndA,
+                                                     csrilu02Info_t            factorInfo,
+                                                     csrPrecondInfo_t          info,
+                                                     int*                      pBufferSizeInBytes)
+{
+    return hipsparseCsrPrecondBufferSize(handle,
+                                         HIP_R_32F,
+                                         false,
+                                         m,
+                                         nnz,
+                                         descrA,
+                                         csrSortedValA,
+                                         csrSortedRowPtrA,
+                                         csrSortedColIndA,
+                                         factorInfo,
+                                         info,
+                                         pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseDcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       nnz,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     double*                   csrSortedValA,
+                                                     const int*                csrSortedRowPtrA,
+                                                     const int*                csrSortedColIndA,
+                                                     csrilu02Info_t            factorInfo,
+                                                     csrPrecondInfo_t          info,
+                                                     int*                      pBufferSizeInBytes)
+{
+    return hipsparseCsrPrecondBufferSize(handle,
+                                         HIP_R_64F,
+                                         false,
+                                         m,
+                                         nnz,
+                                         descrA,
+                                         csrSortedValA,
+                                         csrSortedRowPtrA,
+                                         csrSortedColIndA,
+                                         factorInfo,
+                                         info,
+                                         pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseCcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       nnz,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     hipComplex*               csrSortedValA,
+                                                     const int*                csrSortedRowPtrA,
+                                                     const int*                csrSortedColIndA,
+                                                     csrilu02Info_t            factorInfo,
+                                                     csrPrecondInfo_t          info,
+                                                     int*                      pBufferSizeInBytes)
+{
+    return hipsparseCsrPrecondBufferSize(handle,
+                                         HIP_C_32F,
+                                         false,
+                                         m,
+                                         nnz,
+                                         descrA,
+                                         csrSortedValA,
+                                         csrSortedRowPtrA,
+                                         csrSortedColIndA,
+                                         factorInfo,
+                                         info,
+                                         pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseZcsrilu02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       nnz,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     hipDoubleComplex*         csrSortedValA,
+                                                     const int*                csrSortedRowPtrA,
+                                                     const int*                csrSortedColIndA,
+                                                     csrilu02Info_t            factorInfo,
+                                                     csrPrecondInfo_t          info,
+                                                     int*                      pBufferSizeInBytes)
+{
+    return hipsparseCsrPrecondBufferSize(handle,
+                                         HIP_C_64F,
+                                         false,
+                                         m,
+                                         nnz,
+                                         descrA,
+                                         csrSortedValA,
+                                         csrSortedRowPtrA,
+                                         csrSortedColIndA,
+                                         factorInfo,
+                                         info,
+                                         pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseScsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const float*              csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            factorInfo,
+                                                   csrPrecondInfo_t          info,
+                                                   hipsparseSolvePolicy_t    policy,
+                                                   void*                     pBuffer)
+{
+    return hipsparseCsrPrecondAnalysis(handle,
+                                       HIP_R_32F,
+                                       false,
+                                       m,
+                                       nnz,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       policy,
+                                       pBuffer);
+}
+
+hipsparseStatus_t hipsparseDcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const double*             csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            factorInfo,
+                                                   csrPrecondInfo_t          info,
+                                                   hipsparseSolvePolicy_t    policy,
+                                                   void*                     pBuffer)
+{
+    return hipsparseCsrPrecondAnalysis(handle,
+                                       HIP_R_64F,
+                                       false,
+                                       m,
+                                       nnz,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       policy,
+                                       pBuffer);
+}
+
+hipsparseStatus_t hipsparseCcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const hipComplex*         csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            factorInfo,
+                                                   csrPrecondInfo_t          info,
+                                                   hipsparseSolvePolicy_t    policy,
+                                                   void*                     pBuffer)
+{
+    return hipsparseCsrPrecondAnalysis(handle,
+                                       HIP_C_32F,
+                                       false,
+                                       m,
+                                       nnz,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       policy,
+                                       pBuffer);
+}
+
+hipsparseStatus_t hipsparseZcsrilu02Apply_analysis(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const hipDoubleComplex*   csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            factorInfo,
+                                                   csrPrecondInfo_t          info,
+                                                   hipsparseSolvePolicy_t    policy,
+                                                   void*                     pBuffer)
+{
+    return hipsparseCsrPrecondAnalysis(handle,
+                                       HIP_C_64F,
+                                       false,
+                                       m,
+                                       nnz,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       policy,
+                                       pBuffer);
+}
+
+hipsparseStatus_t hipsparseScsrilu02Apply(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       nnz,
+                                          const float*              alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const float*              csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrilu02Info_t            factorInfo,
+                                          csrPrecondInfo_t          info,
+                                          const float*              f,
+                                          float*                    x,
+                                          hipsparseSolvePolicy_t    policy,
+                                          void*                     pBuffer)
+{
+    return hipsparseCsrPrecondApply(handle,
+                                    HIP_R_32F,
+                                    false,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descrA,
+                                    csrSortedValA,
+                                    csrSortedRowPtrA,
+                                    csrSortedColIndA,
+                                    factorInfo,
+                                    info,
+                                    f,
+                                    x,
+                                    policy,
+                                    pBuffer);
+}
+
+hipsparseStatus_t hipsparseDcsrilu02Apply(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       nnz,
+                                          const double*             alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const double*             csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrilu02Info_t            factorInfo,
+                                          csrPrecondInfo_t          info,
+                                          const double*             f,
+                                          double*                   x,
+                                          hipsparseSolvePolicy_t    policy,
+                                          void*                     pBuffer)
+{
+    return hipsparseCsrPrecondApply(handle,
+                                    HIP_R_64F,
+                                    false,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descrA,
+                                    csrSortedValA,
+                                    csrSortedRowPtrA,
+                                    csrSortedColIndA,
+                                    factorInfo,
+                                    info,
+                                    f,
+                                    x,
+                                    policy,
+                                    pBuffer);
+}
+
+hipsparseStatus_t hipsparseCcsrilu02Apply(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipComplex*         alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipComplex*         csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrilu02Info_t            factorInfo,
+                                          csrPrecondInfo_t          info,
+                                          const hipComplex*         f,
+                                          hipComplex*               x,
+                                          hipsparseSolvePolicy_t    policy,
+                                          void*                     pBuffer)
+{
+    return hipsparseCsrPrecondApply(handle,
+                                    HIP_C_32F,
+                                    false,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descrA,
+                                    csrSortedValA,
+                                    csrSortedRowPtrA,
+                                    csrSortedColIndA,
+                                    factorInfo,
+                                    info,
+                                    f,
+                                    x,
+                                    policy,
+                                    pBuffer);
+}
+
+hipsparseStatus_t hipsparseZcsrilu02Apply(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipDoubleComplex*   alpha,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipDoubleComplex*   csrSortedValA,
+                                          const int*                csrSortedRowPtrA,
+                                          const int*                csrSortedColIndA,
+                                          csrilu02Info_t            factorInfo,
+                                          csrPrecondInfo_t          info,
+                                          const hipDoubleComplex*   f,
+                                          hipDoubleComplex*         x,
+                                          hipsparseSolvePolicy_t    policy,
+                                          void*                     pBuffer)
+{
+    return hipsparseCsrPrecondApply(handle,
+                                    HIP_C_64F,
+                                    false,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descrA,
+                                    csrSortedValA,
+                                    csrSortedRowPtrA,
+                                    csrSortedColIndA,
+                                    factorInfo,
+                                    info,
+                                    f,
+                                    x,
+                                    policy,
+                                    pBuffer);
+}
+
+hipsparseStatus_t hipsparseScsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       nnz,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    float*                    csrSortedValA,
+                                                    const int*                csrSortedRowPtrA,
+                                                    const int*                csrSortedColIndA,
+                                                    csric02Info_t             factorInfo,
+                                                    csrPrecondInfo_t          info,
+                                                    int*                      pBufferSizeInBytes)
+{
+    return hipsparseCsrPrecondBufferSize(handle,
+                                         HIP_R_32F,
+                                         true,
+                                         m,
+                                         nnz,
+                                         descrA,
+                                         csrSortedValA,
+                                         csrSortedRowPtrA,
+                                         csrSortedColIndA,
+                                         factorInfo,
+                                         info,
+                                         pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseDcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       nnz,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    double*                   csrSortedValA,
+                                                    const int*                csrSortedRowPtrA,
+                                                    const int*                csrSortedColIndA,
+                                                    csric02Info_t             factorInfo,
+                                                    csrPrecondInfo_t          info,
+                                                    int*                      pBufferSizeInBytes)
+{
+    return hipsparseCsrPrecondBufferSize(handle,
+                                         HIP_R_64F,
+                                         true,
+                                         m,
+                                         nnz,
+                                         descrA,
+                                         csrSortedValA,
+                                         csrSortedRowPtrA,
+                                         csrSortedColIndA,
+                                         factorInfo,
+                                         info,
+                                         pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseCcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       nnz,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    hipComplex*               csrSortedValA,
+                                                    const int*                csrSortedRowPtrA,
+                                                    const int*                csrSortedColIndA,
+                                                    csric02Info_t             factorInfo,
+                                                    csrPrecondInfo_t          info,
+                                                    int*                      pBufferSizeInBytes)
+{
+    return hipsparseCsrPrecondBufferSize(handle,
+                                         HIP_C_32F,
+                                         true,
+                                         m,
+                                         nnz,
+                                         descrA,
+                                         csrSortedValA,
+                                         csrSortedRowPtrA,
+                                         csrSortedColIndA,
+                                         factorInfo,
+                                         info,
+                                         pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseZcsric02Apply_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       nnz,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    hipDoubleComplex*         csrSortedValA,
+                                                    const int*                csrSortedRowPtrA,
+                                                    const int*                csrSortedColIndA,
+                                                    csric02Info_t             factorInfo,
+                                                    csrPrecondInfo_t          info,
+                                                    int*                      pBufferSizeInBytes)
+{
+    return hipsparseCsrPrecondBufferSize(handle,
+                                         HIP_C_64F,
+                                         true,
+                                         m,
+                                         nnz,
+                                         descrA,
+                                         csrSortedValA,
+                                         csrSortedRowPtrA,
+                                         csrSortedColIndA,
+                                         factorInfo,
+                                         info,
+                                         pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseScsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const float*              csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             factorInfo,
+                                                  csrPrecondInfo_t          info,
+                                                  hipsparseSolvePolicy_t    policy,
+                                                  void*                     pBuffer)
+{
+    return hipsparseCsrPrecondAnalysis(handle,
+                                       HIP_R_32F,
+                                       true,
+                                       m,
+                                       nnz,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       policy,
+                                       pBuffer);
+}
+
+hipsparseStatus_t hipsparseDcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const double*             csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             factorInfo,
+                                                  csrPrecondInfo_t          info,
+                                                  hipsparseSolvePolicy_t    policy,
+                                                  void*                     pBuffer)
+{
+    return hipsparseCsrPrecondAnalysis(handle,
+                                       HIP_R_64F,
+                                       true,
+                                       m,
+                                       nnz,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       policy,
+                                       pBuffer);
+}
+
+hipsparseStatus_t hipsparseCcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const hipComplex*         csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             factorInfo,
+                                                  csrPrecondInfo_t          info,
+                                                  hipsparseSolvePolicy_t    policy,
+                                                  void*                     pBuffer)
+{
+    return hipsparseCsrPrecondAnalysis(handle,
+                                       HIP_C_32F,
+                                       true,
+                                       m,
+                                       nnz,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       policy,
+                                       pBuffer);
+}
+
+hipsparseStatus_t hipsparseZcsric02Apply_analysis(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const hipDoubleComplex*   csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             factorInfo,
+                                                  csrPrecondInfo_t          info,
+                                                  hipsparseSolvePolicy_t    policy,
+                                                  void*                     pBuffer)
+{
+    return hipsparseCsrPrecondAnalysis(handle,
+                                       HIP_C_64F,
+                                       true,
+                                       m,
+                                       nnz,
+                                       descrA,
+                                       csrSortedValA,
+                                       csrSortedRowPtrA,
+                                       csrSortedColIndA,
+                                       factorInfo,
+                                       info,
+                                       policy,
+                                       pBuffer);
+}
+
+hipsparseStatus_t hipsparseScsric02Apply(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       nnz,
+                                         const float*              alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csric02Info_t             factorInfo,
+                                         csrPrecondInfo_t          info,
+                                         const float*              f,
+                                         float*                    x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return hipsparseCsrPrecondApply(handle,
+                                    HIP_R_32F,
+                                    true,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descrA,
+                                    csrSortedValA,
+                                    csrSortedRowPtrA,
+                                    csrSortedColIndA,
+                                    factorInfo,
+                                    info,
+                                    f,
+                                    x,
+                                    policy,
+                                    pBuffer);
+}
+
+hipsparseStatus_t hipsparseDcsric02Apply(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       nnz,
+                                         const double*             alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csric02Info_t             factorInfo,
+                                         csrPrecondInfo_t          info,
+                                         const double*             f,
+                                         double*                   x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return hipsparseCsrPrecondApply(handle,
+                                    HIP_R_64F,
+                                    true,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descrA,
+                                    csrSortedValA,
+                                    csrSortedRowPtrA,
+                                    csrSortedColIndA,
+                                    factorInfo,
+                                    info,
+                                    f,
+                                    x,
+                                    policy,
+                                    pBuffer);
+}
+
+hipsparseStatus_t hipsparseCcsric02Apply(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipComplex*         alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csric02Info_t             factorInfo,
+                                         csrPrecondInfo_t          info,
+                                         const hipComplex*         f,
+                                         hipComplex*               x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return hipsparseCsrPrecondApply(handle,
+                                    HIP_C_32F,
+                                    true,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descrA,
+                                    csrSortedValA,
+                                    csrSortedRowPtrA,
+                                    csrSortedColIndA,
+                                    factorInfo,
+                                    info,
+                                    f,
+                                    x,
+                                    policy,
+                                    pBuffer);
+}
+
+hipsparseStatus_t hipsparseZcsric02Apply(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipDoubleComplex*   alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csric02Info_t             factorInfo,
+                                         csrPrecondInfo_t          info,
+                                         const hipDoubleComplex*   f,
+                                         hipDoubleComplex*         x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return hipsparseCsrPrecondApply(handle,
+                                    HIP_C_64F,
+                                    true,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descrA,
+                                    csrSortedValA,
+                                    csrSortedRowPtrA,
+                                    csrSortedColIndA,
+                                    factorInfo,
+                                    info,
+                                    f,
+                                    x,
+                                    policy,
+                                    pBuffer);
+}
+
+hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
+                                hipsparseDirection_t      dirA,
+                                int                       m,
+                                int                       n,
+                                const hipsparseMatDescr_t descrA,
+                                const float*              A,
+                                int                       lda,
+                                int*                      nnzPerRowColumn,
+                                int*                      nnzTotalDevHostPtr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSnnz((cusparseHandle_t)handle,
+                                                     hipDirectionToCudaDirection(dirA),
+                                                     m,
+                                                     n,
+                                                     (const cusparseMatDescr_t)descrA,
+                                                     A,
+                                                     lda,
+                                                     nnzPerRowColumn,
+                                                     nnzTotalDevHostPtr));
+}
+
+hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
+                                hipsparseDirection_t      dirA,
+                                int                       m,
+                                int                       n,
+                                const hipsparseMatDescr_t descrA,
+                                const double*             A,
+                                int                       lda,
+                                int*                      nnzPerRowColumn,
+                                int*                      nnzTotalDevHostPtr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDnnz((cusparseHandle_t)handle,
+                                                     hipDirectionToCudaDirection(dirA),
+                                                     m,
+                                                     n,
+                                                     (const cusparseMatDescr_t)descrA,
+                                                     A,
+                                                     lda,
+                                                     nnzPerRowColumn,
+                                                     nnzTotalDevHostPtr));
+}
+
+hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
+                                hipsparseDirection_t      dirA,
+                                int                       m,
+                                int                       n,
+                                const hipsparseMatDescr_t descrA,
+                                const hipComplex*         A,
+                                int                       lda,
+                                int*                      nnzPerRowColumn,
+                                int*                      nnzTotalDevHostPtr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCnnz((cusparseHandle_t)handle,
+                                                     hipDirectionToCudaDirection(dirA),
+                                                     m,
+                                                     n,
+                                                     (const cusparseMatDescr_t)descrA,
+                                                     (const cuComplex*)A,
+                                                     lda,
+                                                     nnzPerRowColumn,
+                                                     nnzTotalDevHostPtr));
+}
+
+hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
+                                hipsparseDirection_t      dirA,
+                                int                       m,
+                                int                       n,
+                                const hipsparseMatDescr_t descrA,
+                                const hipDoubleComplex*   A,
+                                int                       lda,
+                                int*                      nnzPerRowColumn,
+                                int*                      nnzTotalDevHostPtr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZnnz((cusparseHandle_t)handle,
+                                                     hipDirectionToCudaDirection(dirA),
+                                                     m,
+                                                     n,
+                                                     (const cusparseMatDescr_t)descrA,
+                                                     (const cuDoubleComplex*)A,
+                                                     lda,
+                                                     nnzPerRowColumn,
+                                                     nnzTotalDevHostPtr));
+}
+
+hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const float*              A,
+                                      int                       ld,
+                                      const int*                nnzPerRow,
+                                      float*                    csrVal,
+                                      int*                      csrRowPtr,
+                                      int*                      csrColInd)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSdense2csr((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           A,
+                                                           ld,
+                                                           nnzPerRow,
+                                                           csrVal,
+                                                           csrRowPtr,
+                                                           csrColInd));
+}
+
+hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const double*             A,
+                                      int                       ld,
+                                      const int*                nnzPerRow,
+                                      double*                   csrVal,
+                                      int*                      csrRowPtr,
+                                      int*                      csrColInd)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDdense2csr((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           A,
+                                                           ld,
+                                                           nnzPerRow,
+                                                           csrVal,
+                                                           csrRowPtr,
+                                                           csrColInd));
 }
 
 hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
                                       int                       m,
                                       int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const hipComplex*         A,
-                                      int                       ld,
-                                      const int*                nnzPerRow,
-                                      hipComplex*               csrVal,
-                                      int*                      csrRowPtr,
-                                      int*                      csrColInd)
+                                      const hipsparseMatDescr_t descr,
+                                      const hipComplex*         A,
+                                      int                       ld,
+                                      const int*                nnzPerRow,
+                                      hipComplex*               csrVal,
+                                      int*                      csrRowPtr,
+                                      int*                      csrColInd)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCdense2csr((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           (const cuComplex*)A,
+                                                           ld,
+                                                           nnzPerRow,
+                                                           (cuComplex*)csrVal,
+                                                           csrRowPtr,
+                                                           csrColInd));
+}
+
+hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipDoubleComplex*   A,
+                                      int                       ld,
+                                      const int*                nnzPerRow,
+                                      hipDoubleComplex*         csrVal,
+                                      int*                      csrRowPtr,
+                                      int*                      csrColInd)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZdense2csr((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           (const cuDoubleComplex*)A,
+                                                           ld,
+                                                           nnzPerRow,
+                                                           (cuDoubleComplex*)csrVal,
+                                                           csrRowPtr,
+                                                           csrColInd));
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       n,
+                                                      const float*              A,
+                                                      int                       lda,
+                                                      const float*              threshold,
+                                                      const hipsparseMatDescr_t descr,
+                                                      const float*              csrVal,
+                                                      const int*                csrRowPtr,
+                                                      const int*                csrColInd,
+                                                      size_t*                   bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                              m,
+                                              n,
+                                              A,
+                                              lda,
+                                              threshold,
+                                              (const cusparseMatDescr_t)descr,
+                                              csrVal,
+                                              csrRowPtr,
+                                              csrColInd,
+                                              bufferSize));
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       n,
+                                                      const double*             A,
+                                                      int                       lda,
+                                                      const double*             threshold,
+                                                      const hipsparseMatDescr_t descr,
+                                                      const double*             csrVal,
+                                                      const int*                csrRowPtr,
+                                                      const int*                csrColInd,
+                                                      size_t*                   bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                              m,
+                                              n,
+                                              A,
+                                              lda,
+                                              threshold,
+                                              (const cusparseMatDescr_t)descr,
+                                              csrVal,
+                                              csrRowPtr,
+                                              csrColInd,
+                                              bufferSize));
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
+                                                         int                       m,
+                                                         int                       n,
+                                                         const float*              A,
+                                                         int                       lda,
+                                                         const float*              threshold,
+                                                         const hipsparseMatDescr_t descr,
+                                                         const float*              csrVal,
+                                                         const int*                csrRowPtr,
+                                                         const int*                csrColInd,
+                                                         size_t*                   bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                              m,
+                                              n,
+                                              A,
+                                              lda,
+                                              threshold,
+                                              (const cusparseMatDescr_t)descr,
+                                              csrVal,
+                                              csrRowPtr,
+                                              csrColInd,
+                                              bufferSize));
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
+                                                         int                       m,
+                                                         int                       n,
+                                                         const double*             A,
+                                                         int                       lda,
+                                                         const double*             threshold,
+                                                         const hipsparseMatDescr_t descr,
+                                                         const double*             csrVal,
+                                                         const int*                csrRowPtr,
+                                                         const int*                csrColInd,
+                                                         size_t*                   bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                              m,
+                                              n,
+                                              A,
+                                              lda,
+                                              threshold,
+                                              (const cusparseMatDescr_t)descr,
+                                              csrVal,
+                                              csrRowPtr,
+                                              csrColInd,
+                                              bufferSize));
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       n,
+                                              const float*              A,
+                                              int                       lda,
+                                              const float*              threshold,
+                                              const hipsparseMatDescr_t descr,
+                                              int*                      csrRowPtr,
+                                              int*                      nnzTotalDevHostPtr,
+                                              void*                     buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpruneDense2csrNnz((cusparseHandle_t)handle,
+                                                                   m,
+                                                                   n,
+                                                                   A,
+                                                                   lda,
+                                                                   threshold,
+                                                                   (const cusparseMatDescr_t)descr,
+                                                                   csrRowPtr,
+                                                                   nnzTotalDevHostPtr,
+                                                                   buffer));
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       n,
+                                              const double*             A,
+                                              int                       lda,
+                                              const double*             threshold,
+                                              const hipsparseMatDescr_t descr,
+                                              int*                      csrRowPtr,
+                                              int*                      nnzTotalDevHostPtr,
+                                              void*                     buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDpruneDense2csrNnz((cusparseHandle_t)handle,
+                                                                   m,
+                                                                   n,
+                                                                   A,
+                                                                   lda,
+                                                                   threshold,
+                                                                   (const cusparseMatDescr_t)descr,
+                                                                   csrRowPtr,
+                                                                   nnzTotalDevHostPtr,
+                                                                   buffer));
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       n,
+                                           const float*              A,
+                                           int                       lda,
+                                           const float*              threshold,
+                                           const hipsparseMatDescr_t descr,
+                                           float*                    csrVal,
+                                           const int*                csrRowPtr,
+                                           int*                      csrColInd,
+                                           void*                     buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpruneDense2csr((cusparseHandle_t)handle,
+                                                                m,
+                                                                n,
+                                                                A,
+                                                                lda,
+                                                                threshold,
+                                                                (const cusparseMatDescr_t)descr,
+                                                                csrVal,
+                                                                csrRowPtr,
+                                                                csrColInd,
+                                                                buffer));
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       n,
+                                           const double*             A,
+                                           int                       lda,
+                                           const double*             threshold,
+                                           const hipsparseMatDescr_t descr,
+                                           double*                   csrVal,
+                                           const int*                csrRowPtr,
+                                           int*                      csrColInd,
+                                           void*                     buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDpruneDense2csr((cusparseHandle_t)handle,
+                                                                m,
+                                                                n,
+                                                                A,
+                                                                lda,
+                                                                threshold,
+                                                                (const cusparseMatDescr_t)descr,
+                                                                csrVal,
+                                                                csrRowPtr,
+                                                                csrColInd,
+                                                                buffer));
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const float*      A,
+                                                                  int               lda,
+                                                                  float             percentage,
+                                                                  const hipsparseMatDescr_t descr,
+                                                                  const float*              csrVal,
+                                                                  const int*  csrRowPtr,
+                                                                  const int*  csrColInd,
+                                                                  pruneInfo_t info,
+                                                                  size_t*     bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          A,
+                                                          lda,
+                                                          percentage,
+                                                          (const cusparseMatDescr_t)descr,
+                                                          csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          (pruneInfo_t)info,
+                                                          bufferSize));
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const double*     A,
+                                                                  int               lda,
+                                                                  double            percentage,
+                                                                  const hipsparseMatDescr_t descr,
+                                                                  const double*             csrVal,
+                                                                  const int*  csrRowPtr,
+                                                                  const int*  csrColInd,
+                                                                  pruneInfo_t info,
+                                                                  size_t*     bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          A,
+                                                          lda,
+                                                          percentage,
+                                                          (const cusparseMatDescr_t)descr,
+                                                          csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          (pruneInfo_t)info,
+                                                          bufferSize));
+}
+
+hipsparseStatus_t
+    hipsparseSpruneDense2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       const float*              A,
+                                                       int                       lda,
+                                                       float                     percentage,
+                                                       const hipsparseMatDescr_t descr,
+                                                       const float*              csrVal,
+                                                       const int*                csrRowPtr,
+                                                       const int*                csrColInd,
+                                                       pruneInfo_t               info,
+                                                       size_t*                   bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          A,
+                                                          lda,
+                                                          percentage,
+                                                          (const cusparseMatDescr_t)descr,
+                                                          csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          (pruneInfo_t)info,
+                                                          bufferSize));
+}
+
+hipsparseStatus_t
+    hipsparseDpruneDense2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       const double*             A,
+                                                       int                       lda,
+                                                       double                    percentage,
+                                                       const hipsparseMatDescr_t descr,
+                                                       const double*             csrVal,
+                                                       const int*                csrRowPtr,
+                                                       const int*                csrColInd,
+                                                       pruneInfo_t               info,
+                                                       size_t*                   bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          A,
+                                                          lda,
+                                                          percentage,
+                                                          (const cusparseMatDescr_t)descr,
+                                                          csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          (pruneInfo_t)info,
+                                                          bufferSize));
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t         handle,
+                                                          int                       m,
+                                                          int                       n,
+                                                          const float*              A,
+                                                          int                       lda,
+                                                          float                     percentage,
+                                                          const hipsparseMatDescr_t descr,
+                                                          int*                      csrRowPtr,
+                                                          int*        nnzTotalDevHostPtr,
+                                                          pruneInfo_t info,
+                                                          void*       buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneDense2csrNnzByPercentage((cusparseHandle_t)handle,
+                                               m,
+                                               n,
+                                               A,
+                                               lda,
+                                               percentage,
+                                               (const cusparseMatDescr_t)descr,
+                                               csrRowPtr,
+                                               nnzTotalDevHostPtr,
+                                               (pruneInfo_t)info,
+                                               buffer));
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t         handle,
+                                                          int                       m,
+                                                          int                       n,
+                                                          const double*             A,
+                                                          int                       lda,
+                                                          double                    percentage,
+                                                          const hipsparseMatDescr_t descr,
+                                                          int*                      csrRowPtr,
+                                                          int*        nnzTotalDevHostPtr,
+                                                          pruneInfo_t info,
+                                                          void*       buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDpruneDense2csrNnzByPercentage((cusparseHandle_t)handle,
+                                               m,
+                                               n,
+                                               A,
+                                               lda,
+                                               percentage,
+                                               (const cusparseMatDescr_t)descr,
+                                               csrRowPtr,
+                                               nnzTotalDevHostPtr,
+                                               (pruneInfo_t)info,
+                                               buffer));
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       const float*              A,
+                                                       int                       lda,
+                                                       float                     percentage,
+                                                       const hipsparseMatDescr_t descr,
+                                                       float*                    csrVal,
+                                                       const int*                csrRowPtr,
+                                                       int*                      csrColInd,
+                                                       pruneInfo_t               info,
+                                                       void*                     buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneDense2csrByPercentage((cusparseHandle_t)handle,
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            percentage,
+                                            (const cusparseMatDescr_t)descr,
+                                            csrVal,
+                                            csrRowPtr,
+                                            csrColInd,
+                                            (pruneInfo_t)info,
+                                            buffer));
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       const double*             A,
+                                                       int                       lda,
+                                                       double                    percentage,
+                                                       const hipsparseMatDescr_t descr,
+                                                       double*                   csrVal,
+                                                       const int*                csrRowPtr,
+                                                       int*                      csrColInd,
+                                                       pruneInfo_t               info,
+                                                       void*                     buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDpruneDense2csrByPercentage((cusparseHandle_t)handle,
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            percentage,
+                                            (const cusparseMatDescr_t)descr,
+                                            csrVal,
+                                            csrRowPtr,
+                                            csrColInd,
+                                            (pruneInfo_t)info,
+                                            buffer));
+}
+
+hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const float*              A,
+                                      int                       ld,
+                                      const int*                nnzPerColumn,
+                                      float*                    cscVal,
+                                      int*                      cscRowInd,
+                                      int*                      cscColPtr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSdense2csc((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           A,
+                                                           ld,
+                                                           nnzPerColumn,
+                                                           cscVal,
+                                                           cscRowInd,
+                                                           cscColPtr));
+}
+
+hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const double*             A,
+                                      int                       ld,
+                                      const int*                nnzPerColumn,
+                                      double*                   cscVal,
+                                      int*                      cscRowInd,
+                                      int*                      cscColPtr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDdense2csc((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           A,
+                                                           ld,
+                                                           nnzPerColumn,
+                                                           cscVal,
+                                                           cscRowInd,
+                                                           cscColPtr));
+}
+
+hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipComplex*         A,
+                                      int                       ld,
+                                      const int*                nnzPerColumn,
+                                      hipComplex*               cscVal,
+                                      int*                      cscRowInd,
+                                      int*                      cscColPtr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCdense2csc((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           (const cuComplex*)A,
+                                                           ld,
+                                                           nnzPerColumn,
+                                                           (cuComplex*)cscVal,
+                                                           cscRowInd,
+                                                           cscColPtr));
+}
+
+hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipDoubleComplex*   A,
+                                      int                       ld,
+                                      const int*                nnzPerColumn,
+                                      hipDoubleComplex*         cscVal,
+                                      int*                      cscRowInd,
+                                      int*                      cscColPtr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZdense2csc((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           (const cuDoubleComplex*)A,
+                                                           ld,
+                                                           nnzPerColumn,
+                                                           (cuDoubleComplex*)cscVal,
+                                                           cscRowInd,
+                                                           cscColPtr));
+}
+
+hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const float*              csrVal,
+                                      const int*                csrRowPtr,
+                                      const int*                csrColInd,
+                                      float*                    A,
+                                      int                       ld)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2dense((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           csrVal,
+                                                           csrRowPtr,
+                                                           csrColInd,
+                                                           A,
+                                                           ld));
+}
+
+hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const double*             csrVal,
+                                      const int*                csrRowPtr,
+                                      const int*                csrColInd,
+                                      double*                   A,
+                                      int                       ld)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2dense((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           csrVal,
+                                                           csrRowPtr,
+                                                           csrColInd,
+                                                           A,
+                                                           ld));
+}
+
+hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipComplex*         csrVal,
+                                      const int*                csrRowPtr,
+                                      const int*                csrColInd,
+                                      hipComplex*               A,
+                                      int                       ld)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2dense((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           (const hipComplex*)csrVal,
+                                                           csrRowPtr,
+                                                           csrColInd,
+                                                           (hipComplex*)A,
+                                                           ld));
+}
+
+hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipDoubleComplex*   csrVal,
+                                      const int*                csrRowPtr,
+                                      const int*                csrColInd,
+                                      hipDoubleComplex*         A,
+                                      int                       ld)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2dense((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           (const cuDoubleComplex*)csrVal,
+                                                           csrRowPtr,
+                                                           csrColInd,
+                                                           (cuDoubleComplex*)A,
+                                                           ld));
+}
+
+hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const float*              cscVal,
+                                      const int*                cscRowInd,
+                                      const int*                cscColPtr,
+                                      float*                    A,
+                                      int                       ld)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseScsc2dense((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           cscVal,
+                                                           cscRowInd,
+                                                           cscColPtr,
+                                                           A,
+                                                           ld));
+}
+
+hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const double*             cscVal,
+                                      const int*                cscRowInd,
+                                      const int*                cscColPtr,
+                                      double*                   A,
+                                      int                       ld)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDcsc2dense((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           cscVal,
+                                                           cscRowInd,
+                                                           cscColPtr,
+                                                           A,
+                                                           ld));
+}
+
+hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipComplex*         cscVal,
+                                      const int*                cscRowInd,
+                                      const int*                cscColPtr,
+                                      hipComplex*               A,
+                                      int                       ld)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCcsc2dense((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           (const cuComplex*)cscVal,
+                                                           cscRowInd,
+                                                           cscColPtr,
+                                                           (cuComplex*)A,
+                                                           ld));
+}
+
+hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipDoubleComplex*   cscVal,
+                                      const int*                cscRowInd,
+                                      const int*                cscColPtr,
+                                      hipDoubleComplex*         A,
+                                      int                       ld)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZcsc2dense((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)descr,
+                                                           (const cuDoubleComplex*)cscVal,
+                                                           cscRowInd,
+                                                           cscColPtr,
+                                                           (cuDoubleComplex*)A,
+                                                           ld));
+}
+
+hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
+                                                   int               mb,
+                                                   int               nb,
+                                                   int               nnzb,
+                                                   const float*      bsr_val,
+                                                   const int*        bsr_row_ptr,
+                                                   const int*        bsr_col_ind,
+                                                   int               row_block_dim,
+                                                   int               col_block_dim,
+                                                   size_t*           p_buffer_size)
+{
+    int               cu_buffer_size;
+    hipsparseStatus_t status
+        = hipCUSPARSEStatusToHIPStatus(cusparseSgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
+                                                                       mb,
+                                                                       nb,
+                                                                       nnzb,
+                                                                       bsr_val,
+                                                                       bsr_row_ptr,
+                                                                       bsr_col_ind,
+                                                                       row_block_dim,
+                                                                       col_block_dim,
+                                                                       &cu_buffer_size));
+    p_buffer_size[0] = cu_buffer_size;
+    return status;
+}
+
+hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
+                                                   int               mb,
+                                                   int               nb,
+                                                   int               nnzb,
+                                                   const double*     bsr_val,
+                                                   const int*        bsr_row_ptr,
+                                                   const int*        bsr_col_ind,
+                                                   int               row_block_dim,
+                                                   int               col_block_dim,
+                                                   size_t*           p_buffer_size)
+{
+    int               cu_buffer_size;
+    hipsparseStatus_t status
+        = hipCUSPARSEStatusToHIPStatus(cusparseDgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
+                                                                       mb,
+                                                                       nb,
+                                                                       nnzb,
+                                                                       bsr_val,
+                                                                       bsr_row_ptr,
+                                                                       bsr_col_ind,
+                                                                       row_block_dim,
+                                                                       col_block_dim,
+                                                                       &cu_buffer_size));
+    p_buffer_size[0] = cu_buffer_size;
+    return status;
+}
+
+hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
+                                                   int               mb,
+                                                   int               nb,
+                                                   int               nnzb,
+                                                   const hipComplex* bsr_val,
+                                                   const int*        bsr_row_ptr,
+                                                   const int*        bsr_col_ind,
+                                                   int               row_block_dim,
+                                                   int               col_block_dim,
+                                                   size_t*           p_buffer_size)
+{
+    int               cu_buffer_size;
+    hipsparseStatus_t status
+        = hipCUSPARSEStatusToHIPStatus(cusparseCgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
+                                                                       mb,
+                                                                       nb,
+                                                                       nnzb,
+                                                                       (const cuComplex*)bsr_val,
+                                                                       bsr_row_ptr,
+                                                                       bsr_col_ind,
+                                                                       row_block_dim,
+                                                                       col_block_dim,
+                                                                       &cu_buffer_size));
+    p_buffer_size[0] = cu_buffer_size;
+    return status;
+}
+
+hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handle,
+                                                   int                     mb,
+                                                   int                     nb,
+                                                   int                     nnzb,
+                                                   const hipDoubleComplex* bsr_val,
+                                                   const int*              bsr_row_ptr,
+                                                   const int*              bsr_col_ind,
+                                                   int                     row_block_dim,
+                                                   int                     col_block_dim,
+                                                   size_t*                 p_buffer_size)
+{
+    int               cu_buffer_size;
+    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
+        cusparseZgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
+                                        mb,
+                                        nb,
+                                        nnzb,
+                                        (const cuDoubleComplex*)bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        row_block_dim,
+                                        col_block_dim,
+                                        &cu_buffer_size));
+    p_buffer_size[0] = cu_buffer_size;
+    return status;
+}
+
+hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
+                                        int                  mb,
+                                        int                  nb,
+                                        int                  nnzb,
+                                        const float*         bsr_val,
+                                        const int*           bsr_row_ptr,
+                                        const int*           bsr_col_ind,
+                                        int                  row_block_dim,
+                                        int                  col_block_dim,
+                                        float*               bsc_val,
+                                        int*                 bsc_row_ind,
+                                        int*                 bsc_col_ptr,
+                                        hipsparseAction_t    copy_values,
+                                        hipsparseIndexBase_t idx_base,
+                                        void*                temp_buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSgebsr2gebsc((cusparseHandle_t)handle,
+                                                             mb,
+                                                             nb,
+                                                             nnzb,
+                                                             bsr_val,
+                                                             bsr_row_ptr,
+                                                             bsr_col_ind,
+                                                             row_block_dim,
+                                                             col_block_dim,
+                                                             bsc_val,
+                                                             bsc_row_ind,
+                                                             bsc_col_ptr,
+                                                             hipActionToCudaAction(copy_values),
+                                                             hipIndexBaseToCudaIndexBase(idx_base),
+                                                             temp_buffer));
+}
+
+hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
+                                        int                  mb,
+                                        int                  nb,
+                                        int                  nnzb,
+                                        const double*        bsr_val,
+                                        const int*           bsr_row_ptr,
+                                        const int*           bsr_col_ind,
+                                        int                  row_block_dim,
+                                        int                  col_block_dim,
+                                        double*              bsc_val,
+                                        int*                 bsc_row_ind,
+                                        int*                 bsc_col_ptr,
+                                        hipsparseAction_t    copy_values,
+                                        hipsparseIndexBase_t idx_base,
+                                        void*                temp_buffer)
+{
+
+    return hipCUSPARSEStatusToHIPStatus(cusparseDgebsr2gebsc((cusparseHandle_t)handle,
+                                                             mb,
+                                                             nb,
+                                                             nnzb,
+                                                             bsr_val,
+                                                             bsr_row_ptr,
+                                                             bsr_col_ind,
+                                                             row_block_dim,
+                                                             col_block_dim,
+                                                             bsc_val,
+                                                             bsc_row_ind,
+                                                             bsc_col_ptr,
+                                                             hipActionToCudaAction(copy_values),
+                                                             hipIndexBaseToCudaIndexBase(idx_base),
+                                                             temp_buffer));
+}
+
+hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
+                                        int                  mb,
+                                        int                  nb,
+                                        int                  nnzb,
+                                        const hipComplex*    bsr_val,
+                                        const int*           bsr_row_ptr,
+                                        const int*           bsr_col_ind,
+                                        int                  row_block_dim,
+                                        int                  col_block_dim,
+                                        hipComplex*          bsc_val,
+                                        int*                 bsc_row_ind,
+                                        int*                 bsc_col_ptr,
+                                        hipsparseAction_t    copy_values,
+                                        hipsparseIndexBase_t idx_base,
+                                        void*                temp_buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCgebsr2gebsc((cusparseHandle_t)handle,
+                                                             mb,
+                                                             nb,
+                                                             nnzb,
+                                                             (const cuComplex*)bsr_val,
+                                                             bsr_row_ptr,
+                                                             bsr_col_ind,
+                                                             row_block_dim,
+                                                             col_block_dim,
+                                                             (cuComplex*)bsc_val,
+                                                             bsc_row_ind,
+                                                             bsc_col_ptr,
+                                                             hipActionToCudaAction(copy_values),
+                                                             hipIndexBaseToCudaIndexBase(idx_base),
+                                                             temp_buffer));
+}
+
+hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
+                                        int                     mb,
+                                        int                     nb,
+                                        int                     nnzb,
+                                        const hipDoubleComplex* bsr_val,
+                                        const int*              bsr_row_ptr,
+                                        const int*              bsr_col_ind,
+                                        int                     row_block_dim,
+                                        int                     col_block_dim,
+                                        hipDoubleComplex*       bsc_val,
+                                        int*                    bsc_row_ind,
+                                        int*                    bsc_col_ptr,
+                                        hipsparseAction_t       copy_values,
+                                        hipsparseIndexBase_t    idx_base,
+                                        void*                   temp_buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZgebsr2gebsc((cusparseHandle_t)handle,
+                                                             mb,
+                                                             nb,
+                                                             nnzb,
+                                                             (const cuDoubleComplex*)bsr_val,
+                                                             bsr_row_ptr,
+                                                             bsr_col_ind,
+                                                             row_block_dim,
+                                                             col_block_dim,
+                                                             (cuDoubleComplex*)bsc_val,
+                                                             bsc_row_ind,
+                                                             bsc_col_ptr,
+                                                             hipActionToCudaAction(copy_values),
+                                                             hipIndexBaseToCudaIndexBase(idx_base),
+                                                             temp_buffer));
+}
+
+hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dir,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t csr_descr,
+                                                 const float*              csr_val,
+                                                 const int*                csr_row_ptr,
+                                                 const int*                csr_col_ind,
+                                                 int                       row_block_dim,
+                                                 int                       col_block_dim,
+                                                 size_t*                   p_buffer_size)
+{
+    int               cu_buffer_size;
+    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
+        cusparseScsr2gebsr_bufferSize((cusparseHandle_t)handle,
+                                      hipDirectionToCudaDirection(dir),
+                                      m,
+                                      n,
+                                      (const cusparseMatDescr_t)csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      row_block_dim,
+                                      col_block_dim,
+                                      &cu_buffer_size));
+    p_buffer_size[0] = cu_buffer_size;
+    return status;
+}
+
+hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dir,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t csr_descr,
+                                                 const double*             csr_val,
+                                                 const int*                csr_row_ptr,
+                                                 const int*                csr_col_ind,
+                                                 int                       row_block_dim,
+                                                 int                       col_block_dim,
+                                                 size_t*                   p_buffer_size)
+{
+    int               cu_buffer_size;
+    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
+        cusparseDcsr2gebsr_bufferSize((cusparseHandle_t)handle,
+                                      hipDirectionToCudaDirection(dir),
+                                      m,
+                                      n,
+                                      (const cusparseMatDescr_t)csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      row_block_dim,
+                                      col_block_dim,
+                                      &cu_buffer_size));
+    p_buffer_size[0] = cu_buffer_size;
+    return status;
+}
+
+hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dir,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t csr_descr,
+                                                 const hipComplex*         csr_val,
+                                                 const int*                csr_row_ptr,
+                                                 const int*                csr_col_ind,
+                                                 int                       row_block_dim,
+                                                 int                       col_block_dim,
+                                                 size_t*                   p_buffer_size)
+{
+
+    int               cu_buffer_size;
+    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
+        cusparseCcsr2gebsr_bufferSize((cusparseHandle_t)handle,
+                                      hipDirectionToCudaDirection(dir),
+                                      m,
+                                      n,
+                                      (const cusparseMatDescr_t)csr_descr,
+                                      (const cuComplex*)csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      row_block_dim,
+                                      col_block_dim,
+                                      &cu_buffer_size));
+    p_buffer_size[0] = cu_buffer_size;
+    return status;
+}
+
+hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dir,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t csr_descr,
+                                                 const hipDoubleComplex*   csr_val,
+                                                 const int*                csr_row_ptr,
+                                                 const int*                csr_col_ind,
+                                                 int                       row_block_dim,
+                                                 int                       col_block_dim,
+                                                 size_t*                   p_buffer_size)
+{
+    int               cu_buffer_size;
+    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
+        cusparseZcsr2gebsr_bufferSize((cusparseHandle_t)handle,
+                                      hipDirectionToCudaDirection(dir),
+                                      m,
+                                      n,
+                                      (const cusparseMatDescr_t)csr_descr,
+                                      (const cuDoubleComplex*)csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      row_block_dim,
+                                      col_block_dim,
+                                      &cu_buffer_size));
+    p_buffer_size[0] = cu_buffer_size;
+    return status;
+}
+
+hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dir,
+                                         int                       m,
+                                         int                       n,
+                                         const hipsparseMatDescr_t csr_descr,
+                                         const int*                csr_row_ptr,
+                                         const int*                csr_col_ind,
+                                         const hipsparseMatDescr_t bsr_descr,
+                                         int*                      bsr_row_ptr,
+                                         int                       row_block_dim,
+                                         int                       col_block_dim,
+                                         int*                      bsr_nnz_devhost,
+                                         void*                     p_buffer)
+{
+
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcsr2gebsrNnz((cusparseHandle_t)handle,
+                                                              hipDirectionToCudaDirection(dir),
+                                                              m,
+                                                              n,
+                                                              (const cusparseMatDescr_t)csr_descr,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              (const cusparseMatDescr_t)bsr_descr,
+                                                              bsr_row_ptr,
+                                                              row_block_dim,
+                                                              col_block_dim,
+                                                              bsr_nnz_devhost,
+                                                              p_buffer));
+}
+
+hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dir,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t csr_descr,
+                                      const float*              csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      const hipsparseMatDescr_t bsr_descr,
+                                      float*                    bsr_val,
+                                      int*                      bsr_row_ptr,
+                                      int*                      bsr_col_ind,
+                                      int                       row_block_dim,
+                                      int                       col_block_dim,
+                                      void*                     p_buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2gebsr((cusparseHandle_t)handle,
+                                                           hipDirectionToCudaDirection(dir),
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)csr_descr,
+                                                           csr_val,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           (const cusparseMatDescr_t)bsr_descr,
+                                                           bsr_val,
+                                                           bsr_row_ptr,
+                                                           bsr_col_ind,
+                                                           row_block_dim,
+                                                           col_block_dim,
+                                                           p_buffer));
+}
+
+hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dir,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t csr_descr,
+                                      const double*             csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      const hipsparseMatDescr_t bsr_descr,
+                                      double*                   bsr_val,
+                                      int*                      bsr_row_ptr,
+                                      int*                      bsr_col_ind,
+                                      int                       row_block_dim,
+                                      int                       col_block_dim,
+                                      void*                     p_buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2gebsr((cusparseHandle_t)handle,
+                                                           hipDirectionToCudaDirection(dir),
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)csr_descr,
+                                                           csr_val,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           (const cusparseMatDescr_t)bsr_descr,
+                                                           bsr_val,
+                                                           bsr_row_ptr,
+                                                           bsr_col_ind,
+                                                           row_block_dim,
+                                                           col_block_dim,
+                                                           p_buffer));
+}
+
+hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dir,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t csr_descr,
+                                      const hipComplex*         csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      const hipsparseMatDescr_t bsr_descr,
+                                      hipComplex*               bsr_val,
+                                      int*                      bsr_row_ptr,
+                                      int*                      bsr_col_ind,
+                                      int                       row_block_dim,
+                                      int                       col_block_dim,
+                                      void*                     p_buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2gebsr((cusparseHandle_t)handle,
+                                                           hipDirectionToCudaDirection(dir),
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)csr_descr,
+                                                           (const cuComplex*)csr_val,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           (const cusparseMatDescr_t)bsr_descr,
+                                                           (cuComplex*)bsr_val,
+                                                           bsr_row_ptr,
+                                                           bsr_col_ind,
+                                                           row_block_dim,
+                                                           col_block_dim,
+                                                           p_buffer));
+}
+
+hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dir,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t csr_descr,
+                                      const hipDoubleComplex*   csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      const hipsparseMatDescr_t bsr_descr,
+                                      hipDoubleComplex*         bsr_val,
+                                      int*                      bsr_row_ptr,
+                                      int*                      bsr_col_ind,
+                                      int                       row_block_dim,
+                                      int                       col_block_dim,
+                                      void*                     p_buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2gebsr((cusparseHandle_t)handle,
+                                                           hipDirectionToCudaDirection(dir),
+                                                           m,
+                                                           n,
+                                                           (const cusparseMatDescr_t)csr_descr,
+                                                           (const cuDoubleComplex*)csr_val,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           (const cusparseMatDescr_t)bsr_descr,
+                                                           (cuDoubleComplex*)bsr_val,
+                                                           bsr_row_ptr,
+                                                           bsr_col_ind,
+                                                           row_block_dim,
+                                                           col_block_dim,
+                                                           p_buffer));
+}
+
+hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
+                                       hipsparseDirection_t      dirA,
+                                       int                       m,
+                                       int                       n,
+                                       const hipsparseMatDescr_t descrA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       int                       blockDim,
+                                       const hipsparseMatDescr_t descrC,
+                                       int*                      bsrRowPtrC,
+                                       int*                      bsrNnzb)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcsr2bsrNnz((cusparseHandle_t)handle,
+                                                            hipDirectionToCudaDirection(dirA),
+                                                            m,
+                                                            n,
+                                                            (const cusparseMatDescr_t)descrA,
+                                                            csrRowPtrA,
+                                                            csrColIndA,
+                                                            blockDim,
+                                                            (const cusparseMatDescr_t)descrC,
+                                                            bsrRowPtrC,
+                                                            bsrNnzb));
+}
+
+hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrValA,
+                                         const int*                csrRowPtrA,
+                                         int*                      nnzPerRow,
+                                         int*                      nnzC,
+                                         float                     tol)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSnnz_compress((cusparseHandle_t)handle,
+                                                              m,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              csrValA,
+                                                              csrRowPtrA,
+                                                              nnzPerRow,
+                                                              nnzC,
+                                                              tol));
+}
+
+hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrValA,
+                                         const int*                csrRowPtrA,
+                                         int*                      nnzPerRow,
+                                         int*                      nnzC,
+                                         double                    tol)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDnnz_compress((cusparseHandle_t)handle,
+                                                              m,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              csrValA,
+                                                              csrRowPtrA,
+                                                              nnzPerRow,
+                                                              nnzC,
+                                                              tol));
+}
+
+hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         csrValA,
+                                         const int*                csrRowPtrA,
+                                         int*                      nnzPerRow,
+                                         int*                      nnzC,
+                                         hipComplex                tol)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCnnz_compress((cusparseHandle_t)handle,
+                                                              m,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              (const cuComplex*)csrValA,
+                                                              csrRowPtrA,
+                                                              nnzPerRow,
+                                                              nnzC,
+                                                              {cuCrealf(tol), cuCimagf(tol)}));
+}
+
+hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   csrValA,
+                                         const int*                csrRowPtrA,
+                                         int*                      nnzPerRow,
+                                         int*                      nnzC,
+                                         hipDoubleComplex          tol)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZnnz_compress((cusparseHandle_t)handle,
+                                                              m,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              (const cuDoubleComplex*)csrValA,
+                                                              csrRowPtrA,
+                                                              nnzPerRow,
+                                                              nnzC,
+                                                              {cuCreal(tol), cuCimag(tol)}));
+}
+
+hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
+                                    const int*           csrRowPtr,
+                                    int                  nnz,
+                                    int                  m,
+                                    int*                 cooRowInd,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcsr2coo((cusparseHandle_t)handle,
+                                                         csrRowPtr,
+                                                         nnz,
+                                                         m,
+                                                         cooRowInd,
+                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+}
+
+hipsparseStatus_t hipsparseXcsrbatch2csr(hipsparseHandle_t    handle,
+                                         int                  batchCount,
+                                         const int*           m,
+                                         const int*           n,
+                                         const int*           nnz,
+                                         hipsparseIndexBase_t idxBase,
+                                         const int*           csrRowPtrA,
+                                         const int*           csrColIndA,
+                                         int*                 csrRowPtrC,
+                                         int*                 csrColIndC)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Check sizes
+    if(batchCount < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Quick return
+    if(batchCount == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Check pointer arguments
+    if(m == nullptr || n == nullptr || nnz == nullptr || csrRowPtrA == nullptr
+       || csrRowPtrC == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(idxBase != HIPSPARSE_INDEX_BASE_ZERO && idxBase != HIPSPARSE_INDEX_BASE_ONE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Total sizes of the batch
+    int64_t size_row_ptr = 0;
+    int64_t total_m      = 0;
+    int64_t total_n      = 0;
+    int64_t total_nnz    = 0;
+
+    for(int i = 0; i < batchCount; ++i)
+    {
+        if(m[i] < 0 || n[i] < 0 || nnz[i] < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        size_row_ptr += m[i] + 1;
+        total_m += m[i];
+        total_n += n[i];
+        total_nnz += nnz[i];
+    }
+
+    // The block diagonal matrix has to be addressable with 32 bit indices
+    if(total_m + 1 > std::numeric_limits<int>::max()
+       || total_n + idxBase > std::numeric_limits<int>::max()
+       || total_nnz + idxBase > std::numeric_limits<int>::max())
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(total_nnz > 0 && (csrColIndA == nullptr || csrColIndC == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    // The index transformation is a one-time setup step for a fixed batch
+    // pattern, thus it is carried out on the host
+    std::vector<int> row_ptr(size_row_ptr);
+    std::vector<int> col_ind(total_nnz);
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(row_ptr.data(),
+                                         csrRowPtrA,
+                                         sizeof(int) * size_row_ptr,
+                                         cudaMemcpyDeviceToHost,
+                                         stream));
+
+    if(total_nnz > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(col_ind.data(),
+                                             csrColIndA,
+                                             sizeof(int) * total_nnz,
+                                             cudaMemcpyDeviceToHost,
+                                             stream));
+    }
+
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    std::vector<int> block_row_ptr(total_m + 1);
+
+    int64_t row_offset = 0;
+    int     out_offset = 0;
+    int64_t col_offset = 0;
+    int     nnz_offset = 0;
+
+    for(int i = 0; i < batchCount; ++i)
+    {
+        const int* local_row_ptr = row_ptr.data() + row_offset;
+
+        // Each matrix has to be a valid CSR matrix of nnz[i] entries
+        if(local_row_ptr[0] != idxBase || local_row_ptr[m[i]] - idxBase != nnz[i])
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // Shift row offsets by the number of preceding non-zero entries
+        for(int j = 0; j < m[i]; ++j)
+        {
+            block_row_ptr[out_offset + j] = local_row_ptr[j] + nnz_offset;
+        }
+
+        // Shift column indices by the number of preceding columns. Each local column
+        // index has to lie within the n[i] columns of its matrix, otherwise the entry
+        // would end up in the diagonal block of another matrix of the batch
+        for(int j = 0; j < nnz[i]; ++j)
+        {
+            int col = col_ind[nnz_offset + j] - idxBase;
+
+            if(col < 0 || col >= n[i])
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            col_ind[nnz_offset + j] += static_cast<int>(col_offset);
+        }
+
+        row_offset += m[i] + 1;
+        out_offset += m[i];
+        col_offset += n[i];
+        nnz_offset += nnz[i];
+    }
+
+    block_row_ptr[total_m] = nnz_offset + idxBase;
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(csrRowPtrC,
+                                         block_row_ptr.data(),
+                                         sizeof(int) * (total_m + 1),
+                                         cudaMemcpyHostToDevice,
+                                         stream));
+
+    if(total_nnz > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(csrColIndC,
+                                             col_ind.data(),
+                                             sizeof(int) * total_nnz,
+                                             cudaMemcpyHostToDevice,
+                                             stream));
+    }
+
+    // Wait for the transfers to complete before releasing host memory
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#if(CUDART_VERSION >= 11021)
+
+// Copies the sparsity pattern of a CSR matrix to the host and collects the sorted,
+// unique block columns of each block row of size ellBlockSize
+static hipsparseStatus_t hipsparseBlockedEllPattern(hipsparseHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               ellBlockSize,
+                                                    int               idxBase,
+                                                    const int*        csrRowPtrA,
+                                                    const int*        csrColIndA,
+                                                    std::vector<int>& row_ptr,
+                                                    std::vector<int>& col_ind,
+                                                    std::vector<int>& block_ptr,
+                                                    std::vector<int>& block_col,
+                                                    int*              ellWidth)
+{
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    row_ptr.resize(m + 1);
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        row_ptr.data(), csrRowPtrA, sizeof(int) * (m + 1), cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    int nnz = row_ptr[m] - row_ptr[0];
+
+    if(nnz < 0 || (nnz > 0 && csrColIndA == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    col_ind.resize(nnz);
+
+    if(nnz > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            col_ind.data(), csrColIndA, sizeof(int) * nnz, cudaMemcpyDeviceToHost, stream));
+        RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+    }
+
+    int mb = (m + ellBlockSize - 1) / ellBlockSize;
+
+    block_ptr.assign(mb + 1, 0);
+    block_col.clear();
+
+    int width = 0;
+
+    for(int i = 0; i < mb; ++i)
+    {
+        int row_begin = i * ellBlockSize;
+        int row_end   = std::min(row_begin + ellBlockSize, m);
+
+        for(int j = row_ptr[row_begin] - row_ptr[0]; j < row_ptr[row_end] - row_ptr[0]; ++j)
+        {
+            int col = col_ind[j] - idxBase;
+
+            if(col < 0 || col >= n)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            block_col.push_back(col / ellBlockSize);
+        }
+
+        std::vector<int>::iterator first = block_col.begin() + block_ptr[i];
+
+        std::sort(first, block_col.end());
+        block_col.erase(std::unique(first, block_col.end()), block_col.end());
+
+        block_ptr[i + 1] = (int)block_col.size();
+        width            = std::max(width, block_ptr[i + 1] - block_ptr[i]);
+    }
+
+    *ellWidth = width;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseXcsr2blockedEll_bufferSize(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       n,
+                                                      const hipsparseMatDescr_t descrA,
+                                                      const int*                csrRowPtrA,
+                                                      const int*                csrColIndA,
+                                                      int                       ellBlockSize,
+                                                      int*                      ellCols,
+                                                      size_t*                   pBufferSizeInBytes)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || ellBlockSize <= 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Check pointer arguments
+    if(descrA == nullptr || csrRowPtrA == nullptr || ellCols == nullptr
+       || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<int> row_ptr;
+    std::vector<int> col_ind;
+    std::vector<int> block_ptr;
+    std::vector<int> block_col;
+
+    int width;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseBlockedEllPattern(handle,
+                                                         m,
+                                                         n,
+                                                         ellBlockSize,
+                                                         hipsparseGetMatIndexBase(descrA),
+                                                         csrRowPtrA,
+                                                         csrColIndA,
+                                                         row_ptr,
+                                                         col_ind,
+                                                         block_ptr,
+                                                         block_col,
+                                                         &width));
+
+    // The buffer holds the position of each CSR entry in the Blocked-ELL values
+    *ellCols            = width * ellBlockSize;
+    *pBufferSizeInBytes = sizeof(int) * std::max(col_ind.size(), (size_t)1);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseXcsr2blockedEllColInd(hipsparseHandle_t         handle,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const int*                csrRowPtrA,
+                                                 const int*                csrColIndA,
+                                                 int                       ellBlockSize,
+                                                 int                       ellCols,
+                                                 int*                      ellColInd,
+                                                 void*                     pBuffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || ellBlockSize <= 0 || ellCols < 0 || ellCols % ellBlockSize != 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Check pointer arguments
+    if(descrA == nullptr || csrRowPtrA == nullptr || pBuffer == nullptr
+       || (m > 0 && ellCols > 0 && ellColInd == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int idxBase = hipsparseGetMatIndexBase(descrA);
+
+    std::vector<int> row_ptr;
+    std::vector<int> col_ind;
+    std::vector<int> block_ptr;
+    std::vector<int> block_col;
+
+    int width;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseBlockedEllPattern(handle,
+                                                         m,
+                                                         n,
+                                                         ellBlockSize,
+                                                         idxBase,
+                                                         csrRowPtrA,
+                                                         csrColIndA,
+                                                         row_ptr,
+                                                         col_ind,
+                                                         block_ptr,
+                                                         block_col,
+                                                         &width));
+
+    int mb         = (m + ellBlockSize - 1) / ellBlockSize;
+    int ell_blocks = ellCols / ellBlockSize;
+
+    if(width > ell_blocks)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Positions are stored as 32 bit indices
+    if((int64_t)mb * ellBlockSize * ellCols > std::numeric_limits<int>::max())
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // cuSPARSE stores the block column indices row by row, i.e. the block column index
+    // of ELL slot j in block row i is found at i * ell_blocks + j. Unused slots are
+    // marked by -1. The values form a dense row major matrix with ellCols columns.
+    std::vector<int> ell_col_ind((size_t)mb * ell_blocks, -1);
+    std::vector<int> perm(col_ind.size());
+
+    for(int i = 0; i < mb; ++i)
+    {
+        for(int j = block_ptr[i]; j < block_ptr[i + 1]; ++j)
+        {
+            ell_col_ind[(size_t)i * ell_blocks + j - block_ptr[i]] = block_col[j] + idxBase;
+        }
+
+        int row_begin = i * ellBlockSize;
+        int row_end   = std::min(row_begin + ellBlockSize, m);
+
+        for(int row = row_begin; row < row_end; ++row)
+        {
+            for(int j = row_ptr[row] - row_ptr[0]; j < row_ptr[row + 1] - row_ptr[0]; ++j)
+            {
+                int col = col_ind[j] - idxBase;
+
+                // ELL slot of the block the entry belongs to
+                int slot = (int)(std::lower_bound(block_col.begin() + block_ptr[i],
+                                                  block_col.begin() + block_ptr[i + 1],
+                                                  col / ellBlockSize)
+                                 - (block_col.begin() + block_ptr[i]));
+
+                perm[j] = row * ellCols + slot * ellBlockSize + col % ellBlockSize;
+            }
+        }
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    if(ell_col_ind.size() > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(ellColInd,
+                                             ell_col_ind.data(),
+                                             sizeof(int) * ell_col_ind.size(),
+                                             cudaMemcpyHostToDevice,
+                                             stream));
+    }
+
+    if(perm.size() > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            pBuffer, perm.data(), sizeof(int) * perm.size(), cudaMemcpyHostToDevice, stream));
+    }
+
+    // Wait for the transfers, as the host arrays go out of scope
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Scatters the CSR values into the zero initialized Blocked-ELL values, using the
+// positions computed by hipsparseXcsr2blockedEllColInd()
+static hipsparseStatus_t hipsparseCsr2blockedEllValues(hipsparseHandle_t handle,
+                                                       int               m,
+                                                       int               nnz,
+                                                       const void*       csrValA,
+                                                       int               ellBlockSize,
+                                                       int               ellCols,
+                                                       void*             ellValue,
+                                                       const void*       pBuffer,
+                                                       hipDataType       valueType,
+                                                       size_t            valueSize)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || ellBlockSize <= 0 || ellCols < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t ell_size = (int64_t)((m + ellBlockSize - 1) / ellBlockSize) * ellBlockSize * ellCols;
+
+    // Quick return
+    if(ell_size == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Check pointer arguments
+    if(ellValue == nullptr || pBuffer == nullptr || (nnz > 0 && csrValA == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    // Padded entries are explicit zeros
+    RETURN_IF_CUDA_ERROR(cudaMemsetAsync(ellValue, 0, valueSize * ell_size, stream));
+
+    if(nnz == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseSpVecDescr_t vecX;
+    hipsparseDnVecDescr_t vecY;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateSpVec(&vecX,
+                                                   ell_size,
+                                                   nnz,
+                                                   (void*)pBuffer,
+                                                   (void*)csrValA,
+                                                   HIPSPARSE_INDEX_32I,
+                                                   HIPSPARSE_INDEX_BASE_ZERO,
+                                                   valueType));
+
+    hipsparseStatus_t status = hipsparseCreateDnVec(&vecY, ell_size, ellValue, valueType);
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        hipsparseDestroySpVec(vecX);
+        return status;
+    }
+
+    status = hipsparseScatter(handle, vecX, vecY);
+
+    hipsparseDestroySpVec(vecX);
+    hipsparseDestroyDnVec(vecY);
+
+    return status;
+}
+
+hipsparseStatus_t hipsparseScsr2blockedEll(hipsparseHandle_t handle,
+                                           int               m,
+                                           int               nnz,
+                                           const float*      csrValA,
+                                           int               ellBlockSize,
+                                           int               ellCols,
+                                           float*            ellValue,
+                                           const void*       pBuffer)
+{
+    return hipsparseCsr2blockedEllValues(handle,
+                                         m,
+                                         nnz,
+                                         csrValA,
+                                         ellBlockSize,
+                                         ellCols,
+                                         ellValue,
+                                         pBuffer,
+                                         HIP_R_32F,
+                                         sizeof(float));
+}
+
+hipsparseStatus_t hipsparseDcsr2blockedEll(hipsparseHandle_t handle,
+                                           int               m,
+                                           int               nnz,
+                                           const double*     csrValA,
+                                           int               ellBlockSize,
+                                           int               ellCols,
+                                           double*           ellValue,
+                                           const void*       pBuffer)
+{
+    return hipsparseCsr2blockedEllValues(handle,
+                                         m,
+                                         nnz,
+                                         csrValA,
+                                         ellBlockSize,
+                                         ellCols,
+                                         ellValue,
+                                         pBuffer,
+                                         HIP_R_64F,
+                                         sizeof(double));
+}
+
+hipsparseStatus_t hipsparseCcsr2blockedEll(hipsparseHandle_t handle,
+                                           int               m,
+                                           int               nnz,
+                                           const hipComplex* csrValA,
+                                           int               ellBlockSize,
+                                           int               ellCols,
+                                           hipComplex*       ellValue,
+                                           const void*       pBuffer)
+{
+    return hipsparseCsr2blockedEllValues(handle,
+                                         m,
+                                         nnz,
+                                         csrValA,
+                                         ellBlockSize,
+                                         ellCols,
+                                         ellValue,
+                                         pBuffer,
+                                         HIP_C_32F,
+                                         sizeof(hipComplex));
+}
+
+hipsparseStatus_t hipsparseZcsr2blockedEll(hipsparseHandle_t       handle,
+                                           int                     m,
+                                           int                     nnz,
+                                           const hipDoubleComplex* csrValA,
+                                           int                     ellBlockSize,
+                                           int                     ellCols,
+                                           hipDoubleComplex*       ellValue,
+                                           const void*             pBuffer)
+{
+    return hipsparseCsr2blockedEllValues(handle,
+                                         m,
+                                         nnz,
+                                         csrValA,
+                                         ellBlockSize,
+                                         ellCols,
+                                         ellValue,
+                                         pBuffer,
+                                         HIP_C_64F,
+                                         sizeof(hipDoubleComplex));
+}
+#endif
+
+#if CUDART_VERSION < 11000
+hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
+                                    int                  m,
+                                    int                  n,
+                                    int                  nnz,
+                                    const float*         csrSortedVal,
+                                    const int*           csrSortedRowPtr,
+                                    const int*           csrSortedColInd,
+                                    float*               cscSortedVal,
+                                    int*                 cscSortedRowInd,
+                                    int*                 cscSortedColPtr,
+                                    hipsparseAction_t    copyValues,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2csc((cusparseHandle_t)handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         csrSortedVal,
+                                                         csrSortedRowPtr,
+                                                         csrSortedColInd,
+                                                         cscSortedVal,
+                                                         cscSortedRowInd,
+                                                         cscSortedColPtr,
+                                                         hipActionToCudaAction(copyValues),
+                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+}
+
+hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
+                                    int                  m,
+                                    int                  n,
+                                    int                  nnz,
+                                    const double*        csrSortedVal,
+                                    const int*           csrSortedRowPtr,
+                                    const int*           csrSortedColInd,
+                                    double*              cscSortedVal,
+                                    int*                 cscSortedRowInd,
+                                    int*                 cscSortedColPtr,
+                                    hipsparseAction_t    copyValues,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2csc((cusparseHandle_t)handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         csrSortedVal,
+                                                         csrSortedRowPtr,
+                                                         csrSortedColInd,
+                                                         cscSortedVal,
+                                                         cscSortedRowInd,
+                                                         cscSortedColPtr,
+                                                         hipActionToCudaAction(copyValues),
+                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+}
+
+hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
+                                    int                  m,
+                                    int                  n,
+                                    int                  nnz,
+                                    const hipComplex*    csrSortedVal,
+                                    const int*           csrSortedRowPtr,
+                                    const int*           csrSortedColInd,
+                                    hipComplex*          cscSortedVal,
+                                    int*                 cscSortedRowInd,
+                                    int*                 cscSortedColPtr,
+                                    hipsparseAction_t    copyValues,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2csc((cusparseHandle_t)handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         (const cuComplex*)csrSortedVal,
+                                                         csrSortedRowPtr,
+                                                         csrSortedColInd,
+                                                         (cuComplex*)cscSortedVal,
+                                                         cscSortedRowInd,
+                                                         cscSortedColPtr,
+                                                         hipActionToCudaAction(copyValues),
+                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+}
+
+hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
+                                    int                     m,
+                                    int                     n,
+                                    int                     nnz,
+                                    const hipDoubleComplex* csrSortedVal,
+                                    const int*              csrSortedRowPtr,
+                                    const int*              csrSortedColInd,
+                                    hipDoubleComplex*       cscSortedVal,
+                                    int*                    cscSortedRowInd,
+                                    int*                    cscSortedColPtr,
+                                    hipsparseAction_t       copyValues,
+                                    hipsparseIndexBase_t    idxBase)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2csc((cusparseHandle_t)handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         (const cuDoubleComplex*)csrSortedVal,
+                                                         csrSortedRowPtr,
+                                                         csrSortedColInd,
+                                                         (cuDoubleComplex*)cscSortedVal,
+                                                         cscSortedRowInd,
+                                                         cscSortedColPtr,
+                                                         hipActionToCudaAction(copyValues),
+                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+}
+#endif
+
+#if CUDART_VERSION < 11000
+hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const float*              csrSortedValA,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    hipsparseHybMat_t         hybA,
+                                    int                       userEllWidth,
+                                    hipsparseHybPartition_t   partitionType)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseScsr2hyb((cusparseHandle_t)handle,
+                         m,
+                         n,
+                         (const cusparseMatDescr_t)descrA,
+                         csrSortedValA,
+                         csrSortedRowPtrA,
+                         csrSortedColIndA,
+                         (const cusparseHybMat_t)hybA,
+                         userEllWidth,
+                         hipHybPartitionToCudaHybPartition(partitionType)));
+}
+
+hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const double*             csrSortedValA,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    hipsparseHybMat_t         hybA,
+                                    int                       userEllWidth,
+                                    hipsparseHybPartition_t   partitionType)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDcsr2hyb((cusparseHandle_t)handle,
+                         m,
+                         n,
+                         (const cusparseMatDescr_t)descrA,
+                         csrSortedValA,
+                         csrSortedRowPtrA,
+                         csrSortedColIndA,
+                         (const cusparseHybMat_t)hybA,
+                         userEllWidth,
+                         hipHybPartitionToCudaHybPartition(partitionType)));
+}
+
+hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipComplex*         csrSortedValA,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    hipsparseHybMat_t         hybA,
+                                    int                       userEllWidth,
+                                    hipsparseHybPartition_t   partitionType)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseCcsr2hyb((cusparseHandle_t)handle,
+                         m,
+                         n,
+                         (const cusparseMatDescr_t)descrA,
+                         (const cuComplex*)csrSortedValA,
+                         csrSortedRowPtrA,
+                         csrSortedColIndA,
+                         (const cusparseHybMat_t)hybA,
+                         userEllWidth,
+                         hipHybPartitionToCudaHybPartition(partitionType)));
+}
+
+hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipDoubleComplex*   csrSortedValA,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    hipsparseHybMat_t         hybA,
+                                    int                       userEllWidth,
+                                    hipsparseHybPartition_t   partitionType)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseZcsr2hyb((cusparseHandle_t)handle,
+                         m,
+                         n,
+                         (const cusparseMatDescr_t)descrA,
+                         (const cuDoubleComplex*)csrSortedValA,
+                         csrSortedRowPtrA,
+                         csrSortedColIndA,
+                         (const cusparseHybMat_t)hybA,
+                         userEllWidth,
+                         hipHybPartitionToCudaHybPartition(partitionType)));
+}
+#endif
+
+hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const float*              csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    float*                    bsrValC,
+                                    int*                      bsrRowPtrC,
+                                    int*                      bsrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2bsr((cusparseHandle_t)handle,
+                                                         hipDirectionToCudaDirection(dirA),
+                                                         m,
+                                                         n,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         csrValA,
+                                                         csrRowPtrA,
+                                                         csrColIndA,
+                                                         blockDim,
+                                                         (const cusparseMatDescr_t)descrC,
+                                                         bsrValC,
+                                                         bsrRowPtrC,
+                                                         bsrColIndC));
+}
+
+hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const double*             csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    double*                   bsrValC,
+                                    int*                      bsrRowPtrC,
+                                    int*                      bsrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2bsr((cusparseHandle_t)handle,
+                                                         hipDirectionToCudaDirection(dirA),
+                                                         m,
+                                                         n,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         csrValA,
+                                                         csrRowPtrA,
+                                                         csrColIndA,
+                                                         blockDim,
+                                                         (const cusparseMatDescr_t)descrC,
+                                                         bsrValC,
+                                                         bsrRowPtrC,
+                                                         bsrColIndC));
+}
+
+hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipComplex*         csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipComplex*               bsrValC,
+                                    int*                      bsrRowPtrC,
+                                    int*                      bsrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2bsr((cusparseHandle_t)handle,
+                                                         hipDirectionToCudaDirection(dirA),
+                                                         m,
+                                                         n,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         (const cuComplex*)csrValA,
+                                                         csrRowPtrA,
+                                                         csrColIndA,
+                                                         blockDim,
+                                                         (const cusparseMatDescr_t)descrC,
+                                                         (cuComplex*)bsrValC,
+                                                         bsrRowPtrC,
+                                                         bsrColIndC));
+}
+
+hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipDoubleComplex*   csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipDoubleComplex*         bsrValC,
+                                    int*                      bsrRowPtrC,
+                                    int*                      bsrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2bsr((cusparseHandle_t)handle,
+                                                         hipDirectionToCudaDirection(dirA),
+                                                         m,
+                                                         n,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         (const cuDoubleComplex*)csrValA,
+                                                         csrRowPtrA,
+                                                         csrColIndA,
+                                                         blockDim,
+                                                         (const cusparseMatDescr_t)descrC,
+                                                         (cuDoubleComplex*)bsrValC,
+                                                         bsrRowPtrC,
+                                                         bsrColIndC));
+}
+
+hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const float*              bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    float*                    csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSbsr2csr((cusparseHandle_t)handle,
+                                                         hipDirectionToCudaDirection(dirA),
+                                                         mb,
+                                                         nb,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         bsrValA,
+                                                         bsrRowPtrA,
+                                                         bsrColIndA,
+                                                         blockDim,
+                                                         (const cusparseMatDescr_t)descrC,
+                                                         csrValC,
+                                                         csrRowPtrC,
+                                                         csrColIndC));
+}
+
+hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const double*             bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    double*                   csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDbsr2csr((cusparseHandle_t)handle,
+                                                         hipDirectionToCudaDirection(dirA),
+                                                         mb,
+                                                         nb,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         bsrValA,
+                                                         bsrRowPtrA,
+                                                         bsrColIndA,
+                                                         blockDim,
+                                                         (const cusparseMatDescr_t)descrC,
+                                                         csrValC,
+                                                         csrRowPtrC,
+                                                         csrColIndC));
+}
+
+hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipComplex*         bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipComplex*               csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCbsr2csr((cusparseHandle_t)handle,
+                                                         hipDirectionToCudaDirection(dirA),
+                                                         mb,
+                                                         nb,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         (const cuComplex*)bsrValA,
+                                                         bsrRowPtrA,
+                                                         bsrColIndA,
+                                                         blockDim,
+                                                         (const cusparseMatDescr_t)descrC,
+                                                         (cuComplex*)csrValC,
+                                                         csrRowPtrC,
+                                                         csrColIndC));
+}
+
+hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipDoubleComplex*   bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipDoubleComplex*         csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZbsr2csr((cusparseHandle_t)handle,
+                                                         hipDirectionToCudaDirection(dirA),
+                                                         mb,
+                                                         nb,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         (const cuDoubleComplex*)bsrValA,
+                                                         bsrRowPtrA,
+                                                         bsrColIndA,
+                                                         blockDim,
+                                                         (const cusparseMatDescr_t)descrC,
+                                                         (cuDoubleComplex*)csrValC,
+                                                         csrRowPtrC,
+                                                         csrColIndC));
+}
+
+hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dirA,
+                                      int                       mb,
+                                      int                       nb,
+                                      const hipsparseMatDescr_t descrA,
+                                      const float*              bsrValA,
+                                      const int*                bsrRowPtrA,
+                                      const int*                bsrColIndA,
+                                      int                       rowBlockDim,
+                                      int                       colBlockDim,
+                                      const hipsparseMatDescr_t descrC,
+                                      float*                    csrValC,
+                                      int*                      csrRowPtrC,
+                                      int*                      csrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSgebsr2csr((cusparseHandle_t)handle,
+                                                           hipDirectionToCudaDirection(dirA),
+                                                           mb,
+                                                           nb,
+                                                           (const cusparseMatDescr_t)descrA,
+                                                           bsrValA,
+                                                           bsrRowPtrA,
+                                                           bsrColIndA,
+                                                           rowBlockDim,
+                                                           colBlockDim,
+                                                           (const cusparseMatDescr_t)descrC,
+                                                           csrValC,
+                                                           csrRowPtrC,
+                                                           csrColIndC));
+}
+
+hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dirA,
+                                      int                       mb,
+                                      int                       nb,
+                                      const hipsparseMatDescr_t descrA,
+                                      const double*             bsrValA,
+                                      const int*                bsrRowPtrA,
+                                      const int*                bsrColIndA,
+                                      int                       rowBlockDim,
+                                      int                       colBlockDim,
+                                      const hipsparseMatDescr_t descrC,
+                                      double*                   csrValC,
+                                      int*                      csrRowPtrC,
+                                      int*                      csrColIndC)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCdense2csr((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           (const cuComplex*)A,
-                                                           ld,
-                                                           nnzPerRow,
-                                                           (cuComplex*)csrVal,
-                                                           csrRowPtr,
-                                                           csrColInd));
+    return hipCUSPARSEStatusToHIPStatus(cusparseDgebsr2csr((cusparseHandle_t)handle,
+                                                           hipDirectionToCudaDirection(dirA),
+                                                           mb,
+                                                           nb,
+                                                           (const cusparseMatDescr_t)descrA,
+                                                           bsrValA,
+                                                           bsrRowPtrA,
+                                                           bsrColIndA,
+                                                           rowBlockDim,
+                                                           colBlockDim,
+                                                           (const cusparseMatDescr_t)descrC,
+                                                           csrValC,
+                                                           csrRowPtrC,
+                                                           csrColIndC));
+}
+
+hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dirA,
+                                      int                       mb,
+                                      int                       nb,
+                                      const hipsparseMatDescr_t descrA,
+                                      const hipComplex*         bsrValA,
+                                      const int*                bsrRowPtrA,
+                                      const int*                bsrColIndA,
+                                      int                       rowBlockDim,
+                                      int                       colBlockDim,
+                                      const hipsparseMatDescr_t descrC,
+                                      hipComplex*               csrValC,
+                                      int*                      csrRowPtrC,
+                                      int*                      csrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCgebsr2csr((cusparseHandle_t)handle,
+                                                           hipDirectionToCudaDirection(dirA),
+                                                           mb,
+                                                           nb,
+                                                           (const cusparseMatDescr_t)descrA,
+                                                           (const cuComplex*)bsrValA,
+                                                           bsrRowPtrA,
+                                                           bsrColIndA,
+                                                           rowBlockDim,
+                                                           colBlockDim,
+                                                           (const cusparseMatDescr_t)descrC,
+                                                           (cuComplex*)csrValC,
+                                                           csrRowPtrC,
+                                                           csrColIndC));
+}
+
+hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dirA,
+                                      int                       mb,
+                                      int                       nb,
+                                      const hipsparseMatDescr_t descrA,
+                                      const hipDoubleComplex*   bsrValA,
+                                      const int*                bsrRowPtrA,
+                                      const int*                bsrColIndA,
+                                      int                       rowBlockDim,
+                                      int                       colBlockDim,
+                                      const hipsparseMatDescr_t descrC,
+                                      hipDoubleComplex*         csrValC,
+                                      int*                      csrRowPtrC,
+                                      int*                      csrColIndC)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZgebsr2csr((cusparseHandle_t)handle,
+                                                           hipDirectionToCudaDirection(dirA),
+                                                           mb,
+                                                           nb,
+                                                           (const cusparseMatDescr_t)descrA,
+                                                           (const cuDoubleComplex*)bsrValA,
+                                                           bsrRowPtrA,
+                                                           bsrColIndA,
+                                                           rowBlockDim,
+                                                           colBlockDim,
+                                                           (const cusparseMatDescr_t)descrC,
+                                                           (cuDoubleComplex*)csrValC,
+                                                           csrRowPtrC,
+                                                           csrColIndC));
+}
+
+hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             const hipsparseMatDescr_t descrA,
+                                             const float*              csrValA,
+                                             const int*                csrColIndA,
+                                             const int*                csrRowPtrA,
+                                             int                       nnzA,
+                                             const int*                nnzPerRow,
+                                             float*                    csrValC,
+                                             int*                      csrColIndC,
+                                             int*                      csrRowPtrC,
+                                             float                     tol)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2csr_compress((cusparseHandle_t)handle,
+                                                                  m,
+                                                                  n,
+                                                                  (const cusparseMatDescr_t)descrA,
+                                                                  csrValA,
+                                                                  csrColIndA,
+                                                                  csrRowPtrA,
+                                                                  nnzA,
+                                                                  nnzPerRow,
+                                                                  csrValC,
+                                                                  csrColIndC,
+                                                                  csrRowPtrC,
+                                                                  tol));
+}
+
+hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             const hipsparseMatDescr_t descrA,
+                                             const double*             csrValA,
+                                             const int*                csrColIndA,
+                                             const int*                csrRowPtrA,
+                                             int                       nnzA,
+                                             const int*                nnzPerRow,
+                                             double*                   csrValC,
+                                             int*                      csrColIndC,
+                                             int*                      csrRowPtrC,
+                                             double                    tol)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2csr_compress((cusparseHandle_t)handle,
+                                                                  m,
+                                                                  n,
+                                                                  (const cusparseMatDescr_t)descrA,
+                                                                  csrValA,
+                                                                  csrColIndA,
+                                                                  csrRowPtrA,
+                                                                  nnzA,
+                                                                  nnzPerRow,
+                                                                  csrValC,
+                                                                  csrColIndC,
+                                                                  csrRowPtrC,
+                                                                  tol));
+}
+
+hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipComplex*         csrValA,
+                                             const int*                csrColIndA,
+                                             const int*                csrRowPtrA,
+                                             int                       nnzA,
+                                             const int*                nnzPerRow,
+                                             hipComplex*               csrValC,
+                                             int*                      csrColIndC,
+                                             int*                      csrRowPtrC,
+                                             hipComplex                tol)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2csr_compress((cusparseHandle_t)handle,
+                                                                  m,
+                                                                  n,
+                                                                  (const cusparseMatDescr_t)descrA,
+                                                                  (const cuComplex*)csrValA,
+                                                                  csrColIndA,
+                                                                  csrRowPtrA,
+                                                                  nnzA,
+                                                                  nnzPerRow,
+                                                                  (cuComplex*)csrValC,
+                                                                  csrColIndC,
+                                                                  csrRowPtrC,
+                                                                  {cuCrealf(tol), cuCimagf(tol)}));
+}
+
+hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipDoubleComplex*   csrValA,
+                                             const int*                csrColIndA,
+                                             const int*                csrRowPtrA,
+                                             int                       nnzA,
+                                             const int*                nnzPerRow,
+                                             hipDoubleComplex*         csrValC,
+                                             int*                      csrColIndC,
+                                             int*                      csrRowPtrC,
+                                             hipDoubleComplex          tol)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2csr_compress((cusparseHandle_t)handle,
+                                                                  m,
+                                                                  n,
+                                                                  (const cusparseMatDescr_t)descrA,
+                                                                  (const cuDoubleComplex*)csrValA,
+                                                                  csrColIndA,
+                                                                  csrRowPtrA,
+                                                                  nnzA,
+                                                                  nnzPerRow,
+                                                                  (cuDoubleComplex*)csrValC,
+                                                                  csrColIndC,
+                                                                  csrRowPtrC,
+                                                                  {cuCreal(tol), cuCimag(tol)}));
+}
+
+hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       n,
+                                                    int                       nnzA,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    const float*              csrValA,
+                                                    const int*                csrRowPtrA,
+                                                    const int*                csrColIndA,
+                                                    const float*              threshold,
+                                                    const hipsparseMatDescr_t descrC,
+                                                    const float*              csrValC,
+                                                    const int*                csrRowPtrC,
+                                                    const int*                csrColIndC,
+                                                    size_t*                   bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                            m,
+                                            n,
+                                            nnzA,
+                                            (const cusparseMatDescr_t)descrA,
+                                            csrValA,
+                                            csrRowPtrA,
+                                            csrColIndA,
+                                            threshold,
+                                            (const cusparseMatDescr_t)descrC,
+                                            csrValC,
+                                            csrRowPtrC,
+                                            csrColIndC,
+                                            bufferSize));
+}
+
+hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       n,
+                                                    int                       nnzA,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    const double*             csrValA,
+                                                    const int*                csrRowPtrA,
+                                                    const int*                csrColIndA,
+                                                    const double*             threshold,
+                                                    const hipsparseMatDescr_t descrC,
+                                                    const double*             csrValC,
+                                                    const int*                csrRowPtrC,
+                                                    const int*                csrColIndC,
+                                                    size_t*                   bufferSize)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                            m,
+                                            n,
+                                            nnzA,
+                                            (const cusparseMatDescr_t)descrA,
+                                            csrValA,
+                                            csrRowPtrA,
+                                            csrColIndA,
+                                            threshold,
+                                            (const cusparseMatDescr_t)descrC,
+                                            csrValC,
+                                            csrRowPtrC,
+                                            csrColIndC,
+                                            bufferSize));
 }
 
-hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const hipDoubleComplex*   A,
-                                      int                       ld,
-                                      const int*                nnzPerRow,
-                                      hipDoubleComplex*         csrVal,
-                                      int*                      csrRowPtr,
-                                      int*                      csrColInd)
+hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       int                       nnzA,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       const float*              csrValA,
+                                                       const int*                csrRowPtrA,
+                                                       const int*                csrColIndA,
+                                                       const float*              threshold,
+                                                       const hipsparseMatDescr_t descrC,
+                                                       const float*              csrValC,
+                                                       const int*                csrRowPtrC,
+                                                       const int*                csrColIndC,
+                                                       size_t*                   bufferSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZdense2csr((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           (const cuDoubleComplex*)A,
-                                                           ld,
-                                                           nnzPerRow,
-                                                           (cuDoubleComplex*)csrVal,
-                                                           csrRowPtr,
-                                                           csrColInd));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                            m,
+                                            n,
+                                            nnzA,
+                                            (const cusparseMatDescr_t)descrA,
+                                            csrValA,
+                                            csrRowPtrA,
+                                            csrColIndA,
+                                            threshold,
+                                            (const cusparseMatDescr_t)descrC,
+                                            csrValC,
+                                            csrRowPtrC,
+                                            csrColIndC,
+                                            bufferSize));
 }
 
-hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t         handle,
-                                                      int                       m,
-                                                      int                       n,
-                                                      const float*              A,
-                                                      int                       lda,
-                                                      const float*              threshold,
-                                                      const hipsparseMatDescr_t descr,
-                                                      const float*              csrVal,
-                                                      const int*                csrRowPtr,
-                                                      const int*                csrColInd,
-                                                      size_t*                   bufferSize)
+hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       int                       nnzA,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       const double*             csrValA,
+                                                       const int*                csrRowPtrA,
+                                                       const int*                csrColIndA,
+                                                       const double*             threshold,
+                                                       const hipsparseMatDescr_t descrC,
+                                                       const double*             csrValC,
+                                                       const int*                csrRowPtrC,
+                                                       const int*                csrColIndC,
+                                                       size_t*                   bufferSize)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                              m,
-                                              n,
-                                              A,
-                                              lda,
-                                              threshold,
-                                              (const cusparseMatDescr_t)descr,
-                                              csrVal,
-                                              csrRowPtr,
-                                              csrColInd,
-                                              bufferSize));
+        cusparseDpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                            m,
+                                            n,
+                                            nnzA,
+                                            (const cusparseMatDescr_t)descrA,
+                                            csrValA,
+                                            csrRowPtrA,
+                                            csrColIndA,
+                                            threshold,
+                                            (const cusparseMatDescr_t)descrC,
+                                            csrValC,
+                                            csrRowPtrC,
+                                            csrColIndC,
+                                            bufferSize));
 }
 
-hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t         handle,
-                                                      int                       m,
-                                                      int                       n,
-                                                      const double*             A,
-                                                      int                       lda,
-                                                      const double*             threshold,
-                                                      const hipsparseMatDescr_t descr,
-                                                      const double*             csrVal,
-                                                      const int*                csrRowPtr,
-                                                      const int*                csrColInd,
-                                                      size_t*                   bufferSize)
+hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       nnzA,
+                                            const hipsparseMatDescr_t descrA,
+                                            const float*              csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const float*              threshold,
+                                            const hipsparseMatDescr_t descrC,
+                                            int*                      csrRowPtrC,
+                                            int*                      nnzTotalDevHostPtr,
+                                            void*                     buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                              m,
-                                              n,
-                                              A,
-                                              lda,
-                                              threshold,
-                                              (const cusparseMatDescr_t)descr,
-                                              csrVal,
-                                              csrRowPtr,
-                                              csrColInd,
-                                              bufferSize));
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpruneCsr2csrNnz((cusparseHandle_t)handle,
+                                                                 m,
+                                                                 n,
+                                                                 nnzA,
+                                                                 (const cusparseMatDescr_t)descrA,
+                                                                 csrValA,
+                                                                 csrRowPtrA,
+                                                                 csrColIndA,
+                                                                 threshold,
+                                                                 (const cusparseMatDescr_t)descrC,
+                                                                 csrRowPtrC,
+                                                                 nnzTotalDevHostPtr,
+                                                                 buffer));
 }
 
-hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
-                                                         int                       m,
-                                                         int                       n,
-                                                         const float*              A,
-                                                         int                       lda,
-                                                         const float*              threshold,
-                                                         const hipsparseMatDescr_t descr,
-                                                         const float*              csrVal,
-                                                         const int*                csrRowPtr,
-                                                         const int*                csrColInd,
-                                                         size_t*                   bufferSize)
+hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       nnzA,
+                                            const hipsparseMatDescr_t descrA,
+                                            const double*             csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const double*             threshold,
+                                            const hipsparseMatDescr_t descrC,
+                                            int*                      csrRowPtrC,
+                                            int*                      nnzTotalDevHostPtr,
+                                            void*                     buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                              m,
-                                              n,
-                                              A,
-                                              lda,
-                                              threshold,
-                                              (const cusparseMatDescr_t)descr,
-                                              csrVal,
-                                              csrRowPtr,
-                                              csrColInd,
-                                              bufferSize));
+    return hipCUSPARSEStatusToHIPStatus(cusparseDpruneCsr2csrNnz((cusparseHandle_t)handle,
+                                                                 m,
+                                                                 n,
+                                                                 nnzA,
+                                                                 (const cusparseMatDescr_t)descrA,
+                                                                 csrValA,
+                                                                 csrRowPtrA,
+                                                                 csrColIndA,
+                                                                 threshold,
+                                                                 (const cusparseMatDescr_t)descrC,
+                                                                 csrRowPtrC,
+                                                                 nnzTotalDevHostPtr,
+                                                                 buffer));
 }
 
-hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
-                                                         int                       m,
-                                                         int                       n,
-                                                         const double*             A,
-                                                         int                       lda,
-                                                         const double*             threshold,
-                                                         const hipsparseMatDescr_t descr,
-                                                         const double*             csrVal,
-                                                         const int*                csrRowPtr,
-                                                         const int*                csrColInd,
-                                                         size_t*                   bufferSize)
+hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         const float*              threshold,
+                                         const hipsparseMatDescr_t descrC,
+                                         float*                    csrValC,
+                                         const int*                csrRowPtrC,
+                                         int*                      csrColIndC,
+                                         void*                     buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                              m,
-                                              n,
-                                              A,
-                                              lda,
-                                              threshold,
-                                              (const cusparseMatDescr_t)descr,
-                                              csrVal,
-                                              csrRowPtr,
-                                              csrColInd,
-                                              bufferSize));
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpruneCsr2csr((cusparseHandle_t)handle,
+                                                              m,
+                                                              n,
+                                                              nnzA,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              csrValA,
+                                                              csrRowPtrA,
+                                                              csrColIndA,
+                                                              threshold,
+                                                              (const cusparseMatDescr_t)descrC,
+                                                              csrValC,
+                                                              csrRowPtrC,
+                                                              csrColIndC,
+                                                              buffer));
 }
 
-hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
-                                              int                       m,
-                                              int                       n,
-                                              const float*              A,
-                                              int                       lda,
-                                              const float*              threshold,
-                                              const hipsparseMatDescr_t descr,
-                                              int*                      csrRowPtr,
-                                              int*                      nnzTotalDevHostPtr,
-                                              void*                     buffer)
+hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         const double*             threshold,
+                                         const hipsparseMatDescr_t descrC,
+                                         double*                   csrValC,
+                                         const int*                csrRowPtrC,
+                                         int*                      csrColIndC,
+                                         void*                     buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpruneDense2csrNnz((cusparseHandle_t)handle,
-                                                                   m,
-                                                                   n,
-                                                                   A,
-                                                                   lda,
-                                                                   threshold,
-                                                                   (const cusparseMatDescr_t)descr,
-                                                                   csrRowPtr,
-                                                                   nnzTotalDevHostPtr,
-                                                                   buffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseDpruneCsr2csr((cusparseHandle_t)handle,
+                                                              m,
+                                                              n,
+                                                              nnzA,
+                                                              (const cusparseMatDescr_t)descrA,
+                                                              csrValA,
+                                                              csrRowPtrA,
+                                                              csrColIndA,
+                                                              threshold,
+                                                              (const cusparseMatDescr_t)descrC,
+                                                              csrValC,
+                                                              csrRowPtrC,
+                                                              csrColIndC,
+                                                              buffer));
 }
 
-hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
-                                              int                       m,
-                                              int                       n,
-                                              const double*             A,
-                                              int                       lda,
-                                              const double*             threshold,
-                                              const hipsparseMatDescr_t descr,
-                                              int*                      csrRowPtr,
-                                              int*                      nnzTotalDevHostPtr,
-                                              void*                     buffer)
+hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
+                                                                int                       m,
+                                                                int                       n,
+                                                                int                       nnzA,
+                                                                const hipsparseMatDescr_t descrA,
+                                                                const float*              csrValA,
+                                                                const int* csrRowPtrA,
+                                                                const int* csrColIndA,
+                                                                float      percentage,
+                                                                const hipsparseMatDescr_t descrC,
+                                                                const float*              csrValC,
+                                                                const int*  csrRowPtrC,
+                                                                const int*  csrColIndC,
+                                                                pruneInfo_t info,
+                                                                size_t*     bufferSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDpruneDense2csrNnz((cusparseHandle_t)handle,
-                                                                   m,
-                                                                   n,
-                                                                   A,
-                                                                   lda,
-                                                                   threshold,
-                                                                   (const cusparseMatDescr_t)descr,
-                                                                   csrRowPtr,
-                                                                   nnzTotalDevHostPtr,
-                                                                   buffer));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
+                                                        m,
+                                                        n,
+                                                        nnzA,
+                                                        (const cusparseMatDescr_t)descrA,
+                                                        csrValA,
+                                                        csrRowPtrA,
+                                                        csrColIndA,
+                                                        percentage,
+                                                        (const cusparseMatDescr_t)descrC,
+                                                        csrValC,
+                                                        csrRowPtrC,
+                                                        csrColIndC,
+                                                        (pruneInfo_t)info,
+                                                        bufferSize));
 }
 
-hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
-                                           int                       m,
-                                           int                       n,
-                                           const float*              A,
-                                           int                       lda,
-                                           const float*              threshold,
-                                           const hipsparseMatDescr_t descr,
-                                           float*                    csrVal,
-                                           const int*                csrRowPtr,
-                                           int*                      csrColInd,
-                                           void*                     buffer)
+hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
+                                                                int                       m,
+                                                                int                       n,
+                                                                int                       nnzA,
+                                                                const hipsparseMatDescr_t descrA,
+                                                                const double*             csrValA,
+                                                                const int* csrRowPtrA,
+                                                                const int* csrColIndA,
+                                                                double     percentage,
+                                                                const hipsparseMatDescr_t descrC,
+                                                                const double*             csrValC,
+                                                                const int*  csrRowPtrC,
+                                                                const int*  csrColIndC,
+                                                                pruneInfo_t info,
+                                                                size_t*     bufferSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpruneDense2csr((cusparseHandle_t)handle,
-                                                                m,
-                                                                n,
-                                                                A,
-                                                                lda,
-                                                                threshold,
-                                                                (const cusparseMatDescr_t)descr,
-                                                                csrVal,
-                                                                csrRowPtr,
-                                                                csrColInd,
-                                                                buffer));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
+                                                        m,
+                                                        n,
+                                                        nnzA,
+                                                        (const cusparseMatDescr_t)descrA,
+                                                        csrValA,
+                                                        csrRowPtrA,
+                                                        csrColIndA,
+                                                        percentage,
+                                                        (const cusparseMatDescr_t)descrC,
+                                                        csrValC,
+                                                        csrRowPtrC,
+                                                        csrColIndC,
+                                                        (pruneInfo_t)info,
+                                                        bufferSize));
 }
 
-hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
-                                           int                       m,
-                                           int                       n,
-                                           const double*             A,
-                                           int                       lda,
-                                           const double*             threshold,
-                                           const hipsparseMatDescr_t descr,
-                                           double*                   csrVal,
-                                           const int*                csrRowPtr,
-                                           int*                      csrColInd,
-                                           void*                     buffer)
+hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
+                                                                   int                       m,
+                                                                   int                       n,
+                                                                   int                       nnzA,
+                                                                   const hipsparseMatDescr_t descrA,
+                                                                   const float* csrValA,
+                                                                   const int*   csrRowPtrA,
+                                                                   const int*   csrColIndA,
+                                                                   float        percentage,
+                                                                   const hipsparseMatDescr_t descrC,
+                                                                   const float* csrValC,
+                                                                   const int*   csrRowPtrC,
+                                                                   const int*   csrColIndC,
+                                                                   pruneInfo_t  info,
+                                                                   size_t*      bufferSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDpruneDense2csr((cusparseHandle_t)handle,
-                                                                m,
-                                                                n,
-                                                                A,
-                                                                lda,
-                                                                threshold,
-                                                                (const cusparseMatDescr_t)descr,
-                                                                csrVal,
-                                                                csrRowPtr,
-                                                                csrColInd,
-                                                                buffer));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
+                                                        m,
+                                                        n,
+                                                        nnzA,
+                                                        (const cusparseMatDescr_t)descrA,
+                                                        csrValA,
+                                                        csrRowPtrA,
+                                                        csrColIndA,
+                                                        percentage,
+                                                        (const cusparseMatDescr_t)descrC,
+                                                        csrValC,
+                                                        csrRowPtrC,
+                                                        csrColIndC,
+                                                        (pruneInfo_t)info,
+                                                        bufferSize));
 }
 
-hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandle_t handle,
-                                                                  int               m,
-                                                                  int               n,
-                                                                  const float*      A,
-                                                                  int               lda,
-                                                                  float             percentage,
-                                                                  const hipsparseMatDescr_t descr,
-                                                                  const float*              csrVal,
-                                                                  const int*  csrRowPtr,
-                                                                  const int*  csrColInd,
-                                                                  pruneInfo_t info,
-                                                                  size_t*     bufferSize)
+hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
+                                                                   int                       m,
+                                                                   int                       n,
+                                                                   int                       nnzA,
+                                                                   const hipsparseMatDescr_t descrA,
+                                                                   const double* csrValA,
+                                                                   const int*    csrRowPtrA,
+                                                                   const int*    csrColIndA,
+                                                                   double        percentage,
+                                                                   const hipsparseMatDescr_t descrC,
+                                                                   const double* csrValC,
+                                                                   const int*    csrRowPtrC,
+                                                                   const int*    csrColIndC,
+                                                                   pruneInfo_t   info,
+                                                                   size_t*       bufferSize)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          A,
-                                                          lda,
-                                                          percentage,
-                                                          (const cusparseMatDescr_t)descr,
-                                                          csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          (pruneInfo_t)info,
-                                                          bufferSize));
+        cusparseDpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
+                                                        m,
+                                                        n,
+                                                        nnzA,
+                                                        (const cusparseMatDescr_t)descrA,
+                                                        csrValA,
+                                                        csrRowPtrA,
+                                                        csrColIndA,
+                                                        percentage,
+                                                        (const cusparseMatDescr_t)descrC,
+                                                        csrValC,
+                                                        csrRowPtrC,
+                                                        csrColIndC,
+                                                        (pruneInfo_t)info,
+                                                        bufferSize));
 }
 
-hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandle_t handle,
-                                                                  int               m,
-                                                                  int               n,
-                                                                  const double*     A,
-                                                                  int               lda,
-                                                                  double            percentage,
-                                                                  const hipsparseMatDescr_t descr,
-                                                                  const double*             csrVal,
-                                                                  const int*  csrRowPtr,
-                                                                  const int*  csrColInd,
-                                                                  pruneInfo_t info,
-                                                                  size_t*     bufferSize)
+hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t         handle,
+                                                        int                       m,
+                                                        int                       n,
+                                                        int                       nnzA,
+                                                        const hipsparseMatDescr_t descrA,
+                                                        const float*              csrValA,
+                                                        const int*                csrRowPtrA,
+                                                        const int*                csrColIndA,
+                                                        float                     percentage,
+                                                        const hipsparseMatDescr_t descrC,
+                                                        int*                      csrRowPtrC,
+                                                        int*        nnzTotalDevHostPtr,
+                                                        pruneInfo_t info,
+                                                        void*       buffer)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          A,
-                                                          lda,
-                                                          percentage,
-                                                          (const cusparseMatDescr_t)descr,
-                                                          csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          (pruneInfo_t)info,
-                                                          bufferSize));
+        cusparseSpruneCsr2csrNnzByPercentage((cusparseHandle_t)handle,
+                                             m,
+                                             n,
+                                             nnzA,
+                                             (const cusparseMatDescr_t)descrA,
+                                             csrValA,
+                                             csrRowPtrA,
+                                             csrColIndA,
+                                             percentage,
+                                             (const cusparseMatDescr_t)descrC,
+                                             csrRowPtrC,
+                                             nnzTotalDevHostPtr,
+                                             (pruneInfo_t)info,
+                                             buffer));
 }
 
-hipsparseStatus_t
-    hipsparseSpruneDense2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
-                                                       int                       m,
-                                                       int                       n,
-                                                       const float*              A,
-                                                       int                       lda,
-                                                       float                     percentage,
-                                                       const hipsparseMatDescr_t descr,
-                                                       const float*              csrVal,
-                                                       const int*                csrRowPtr,
-                                                       const int*                csrColInd,
-                                                       pruneInfo_t               info,
-                                                       size_t*                   bufferSize)
+hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t         handle,
+                                                        int                       m,
+                                                        int                       n,
+                                                        int                       nnzA,
+                                                        const hipsparseMatDescr_t descrA,
+                                                        const double*             csrValA,
+                                                        const int*                csrRowPtrA,
+                                                        const int*                csrColIndA,
+                                                        double                    percentage,
+                                                        const hipsparseMatDescr_t descrC,
+                                                        int*                      csrRowPtrC,
+                                                        int*        nnzTotalDevHostPtr,
+                                                        pruneInfo_t info,
+                                                        void*       buffer)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          A,
-                                                          lda,
-                                                          percentage,
-                                                          (const cusparseMatDescr_t)descr,
-                                                          csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          (pruneInfo_t)info,
-                                                          bufferSize));
+        cusparseDpruneCsr2csrNnzByPercentage((cusparseHandle_t)handle,
+                                             m,
+                                             n,
+                                             nnzA,
+                                             (const cusparseMatDescr_t)descrA,
+                                             csrValA,
+                                             csrRowPtrA,
+                                             csrColIndA,
+                                             percentage,
+                                             (const cusparseMatDescr_t)descrC,
+                                             csrRowPtrC,
+                                             nnzTotalDevHostPtr,
+                                             (pruneInfo_t)info,
+                                             buffer));
 }
 
-hipsparseStatus_t
-    hipsparseDpruneDense2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
-                                                       int                       m,
-                                                       int                       n,
-                                                       const double*             A,
-                                                       int                       lda,
-                                                       double                    percentage,
-                                                       const hipsparseMatDescr_t descr,
-                                                       const double*             csrVal,
-                                                       const int*                csrRowPtr,
-                                                       const int*                csrColInd,
-                                                       pruneInfo_t               info,
-                                                       size_t*                   bufferSize)
+hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       n,
+                                                     int                       nnzA,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     const float*              csrValA,
+                                                     const int*                csrRowPtrA,
+                                                     const int*                csrColIndA,
+                                                     float                     percentage,
+                                                     const hipsparseMatDescr_t descrC,
+                                                     float*                    csrValC,
+                                                     const int*                csrRowPtrC,
+                                                     int*                      csrColIndC,
+                                                     pruneInfo_t               info,
+                                                     void*                     buffer)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          A,
-                                                          lda,
-                                                          percentage,
-                                                          (const cusparseMatDescr_t)descr,
-                                                          csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          (pruneInfo_t)info,
-                                                          bufferSize));
+        cusparseSpruneCsr2csrByPercentage((cusparseHandle_t)handle,
+                                          m,
+                                          n,
+                                          nnzA,
+                                          (const cusparseMatDescr_t)descrA,
+                                          csrValA,
+                                          csrRowPtrA,
+                                          csrColIndA,
+                                          percentage,
+                                          (const cusparseMatDescr_t)descrC,
+                                          csrValC,
+                                          csrRowPtrC,
+                                          csrColIndC,
+                                          (pruneInfo_t)info,
+                                          buffer));
 }
 
-hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t         handle,
-                                                          int                       m,
-                                                          int                       n,
-                                                          const float*              A,
-                                                          int                       lda,
-                                                          float                     percentage,
-                                                          const hipsparseMatDescr_t descr,
-                                                          int*                      csrRowPtr,
-                                                          int*        nnzTotalDevHostPtr,
-                                                          pruneInfo_t info,
-                                                          void*       buffer)
+hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       n,
+                                                     int                       nnzA,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     const double*             csrValA,
+                                                     const int*                csrRowPtrA,
+                                                     const int*                csrColIndA,
+                                                     double                    percentage,
+                                                     const hipsparseMatDescr_t descrC,
+                                                     double*                   csrValC,
+                                                     const int*                csrRowPtrC,
+                                                     int*                      csrColIndC,
+                                                     pruneInfo_t               info,
+                                                     void*                     buffer)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneDense2csrNnzByPercentage((cusparseHandle_t)handle,
-                                               m,
-                                               n,
-                                               A,
-                                               lda,
-                                               percentage,
-                                               (const cusparseMatDescr_t)descr,
-                                               csrRowPtr,
-                                               nnzTotalDevHostPtr,
-                                               (pruneInfo_t)info,
-                                               buffer));
+        cusparseDpruneCsr2csrByPercentage((cusparseHandle_t)handle,
+                                          m,
+                                          n,
+                                          nnzA,
+                                          (const cusparseMatDescr_t)descrA,
+                                          csrValA,
+                                          csrRowPtrA,
+                                          csrColIndA,
+                                          percentage,
+                                          (const cusparseMatDescr_t)descrC,
+                                          csrValC,
+                                          csrRowPtrC,
+                                          csrColIndC,
+                                          (pruneInfo_t)info,
+                                          buffer));
 }
 
-hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t         handle,
-                                                          int                       m,
-                                                          int                       n,
-                                                          const double*             A,
-                                                          int                       lda,
-                                                          double                    percentage,
-                                                          const hipsparseMatDescr_t descr,
-                                                          int*                      csrRowPtr,
-                                                          int*        nnzTotalDevHostPtr,
-                                                          pruneInfo_t info,
-                                                          void*       buffer)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneDense2csrNnzByPercentage((cusparseHandle_t)handle,
-                                               m,
-                                               n,
-                                               A,
-                                               lda,
-                                               percentage,
-                                               (const cusparseMatDescr_t)descr,
-                                               csrRowPtr,
-                                               nnzTotalDevHostPtr,
-                                               (pruneInfo_t)info,
-                                               buffer));
+hipsparseStatus_t hipsparseSpruneCsr2csrThresholdByPercentage(hipsparseHandle_t         handle,
+                                                              int                       m,
+                                                              int                       n,
+                                                              int                       nnzA,
+                                                              const hipsparseMatDescr_t descrA,
+                                                              const float*              csrValA,
+                                                              const int*                csrRowPtrA,
+                                                              const int*                csrColIndA,
+                                                              float                     percentage,
+                                                              const hipsparseMatDescr_t descrC,
+                                                              int*                      csrRowPtrC,
+                                                              float*                    threshold,
+                                                              void*                     buffer)
+{
+    // Test for bad args
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Invalid sizes
+    if(m < 0 || n < 0 || nnzA < 0 || percentage < 0.0f || percentage > 100.0f)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Invalid pointers
+    if(descrA == nullptr || descrC == nullptr || csrRowPtrC == nullptr || threshold == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get pointer mode
+    cusparsePointerMode_t pointer_mode;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetPointerMode((cusparseHandle_t)handle, &pointer_mode));
+
+    // Position of the threshold within the sorted absolute values
+    int pos = std::ceil(nnzA * (percentage / 100.0f)) - 1;
+    pos     = std::min(pos, nnzA - 1);
+    pos     = std::max(pos, 0);
+
+    // Bisection over the bit pattern of non-negative floats, which is monotone in
+    // the value. Search for the smallest t with #{|a| <= t} > pos.
+    uint32_t lo = 0;
+    uint32_t hi = (nnzA == 0) ? 0 : 0x7F800000;
+
+    // Counting requires host pointer mode
+    RETURN_IF_CUSPARSE_ERROR(
+        cusparseSetPointerMode((cusparseHandle_t)handle, CUSPARSE_POINTER_MODE_HOST));
+
+    cusparseStatus_t status = CUSPARSE_STATUS_SUCCESS;
+
+    while(lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+
+        float t;
+        memcpy(&t, &mid, sizeof(float));
+
+        int nnz_gt;
+        status = cusparseSpruneCsr2csrNnz((cusparseHandle_t)handle,
+                                          m,
+                                          n,
+                                          nnzA,
+                                          (const cusparseMatDescr_t)descrA,
+                                          csrValA,
+                                          csrRowPtrA,
+                                          csrColIndA,
+                                          &t,
+                                          (const cusparseMatDescr_t)descrC,
+                                          csrRowPtrC,
+                                          &nnz_gt,
+                                          buffer);
+
+        if(status != CUSPARSE_STATUS_SUCCESS)
+        {
+            break;
+        }
+
+        if(nnzA - nnz_gt > pos)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+
+    // Restore pointer mode
+    RETURN_IF_CUSPARSE_ERROR(cusparseSetPointerMode((cusparseHandle_t)handle, pointer_mode));
+    RETURN_IF_CUSPARSE_ERROR(status);
+
+    float t;
+    memcpy(&t, &lo, sizeof(float));
+
+    if(pointer_mode == CUSPARSE_POINTER_MODE_HOST)
+    {
+        *threshold = t;
+    }
+    else
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpy(threshold, &t, sizeof(float), cudaMemcpyHostToDevice));
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t         handle,
-                                                       int                       m,
-                                                       int                       n,
-                                                       const float*              A,
-                                                       int                       lda,
-                                                       float                     percentage,
-                                                       const hipsparseMatDescr_t descr,
-                                                       float*                    csrVal,
-                                                       const int*                csrRowPtr,
-                                                       int*                      csrColInd,
-                                                       pruneInfo_t               info,
-                                                       void*                     buffer)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneDense2csrByPercentage((cusparseHandle_t)handle,
-                                            m,
-                                            n,
-                                            A,
-                                            lda,
-                                            percentage,
-                                            (const cusparseMatDescr_t)descr,
-                                            csrVal,
-                                            csrRowPtr,
-                                            csrColInd,
-                                            (pruneInfo_t)info,
-                                            buffer));
+hipsparseStatus_t hipsparseDpruneCsr2csrThresholdByPercentage(hipsparseHandle_t         handle,
+                                                              int                       m,
+                                                              int                       n,
+                                                              int                       nnzA,
+                                                              const hipsparseMatDescr_t descrA,
+                                                              const double*             csrValA,
+                                                              const int*                csrRowPtrA,
+                                                              const int*                csrColIndA,
+                                                              double                    percentage,
+                                                              const hipsparseMatDescr_t descrC,
+                                                              int*                      csrRowPtrC,
+                                                              double*                   threshold,
+                                                              void*                     buffer)
+{
+    // Test for bad args
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Invalid sizes
+    if(m < 0 || n < 0 || nnzA < 0 || percentage < 0.0 || percentage > 100.0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Invalid pointers
+    if(descrA == nullptr || descrC == nullptr || csrRowPtrC == nullptr || threshold == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get pointer mode
+    cusparsePointerMode_t pointer_mode;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetPointerMode((cusparseHandle_t)handle, &pointer_mode));
+
+    // Position of the threshold within the sorted absolute values
+    int pos = std::ceil(nnzA * (percentage / 100.0)) - 1;
+    pos     = std::min(pos, nnzA - 1);
+    pos     = std::max(pos, 0);
+
+    // Bisection over the bit pattern of non-negative doubles, which is monotone in
+    // the value. Search for the smallest t with #{|a| <= t} > pos.
+    uint64_t lo = 0;
+    uint64_t hi = (nnzA == 0) ? 0 : 0x7FF0000000000000ULL;
+
+    // Counting requires host pointer mode
+    RETURN_IF_CUSPARSE_ERROR(
+        cusparseSetPointerMode((cusparseHandle_t)handle, CUSPARSE_POINTER_MODE_HOST));
+
+    cusparseStatus_t status = CUSPARSE_STATUS_SUCCESS;
+
+    while(lo < hi)
+    {
+        uint64_t mid = lo + (hi - lo) / 2;
+
+        double t;
+        memcpy(&t, &mid, sizeof(double));
+
+        int nnz_gt;
+        status = cusparseDpruneCsr2csrNnz((cusparseHandle_t)handle,
+                                          m,
+                                          n,
+                                          nnzA,
+                                          (const cusparseMatDescr_t)descrA,
+                                          csrValA,
+                                          csrRowPtrA,
+                                          csrColIndA,
+                                          &t,
+                                          (const cusparseMatDescr_t)descrC,
+                                          csrRowPtrC,
+                                          &nnz_gt,
+                                          buffer);
+
+        if(status != CUSPARSE_STATUS_SUCCESS)
+        {
+            break;
+        }
+
+        if(nnzA - nnz_gt > pos)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+
+    // Restore pointer mode
+    RETURN_IF_CUSPARSE_ERROR(cusparseSetPointerMode((cusparseHandle_t)handle, pointer_mode));
+    RETURN_IF_CUSPARSE_ERROR(status);
+
+    double t;
+    memcpy(&t, &lo, sizeof(double));
+
+    if(pointer_mode == CUSPARSE_POINTER_MODE_HOST)
+    {
+        *threshold = t;
+    }
+    else
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpy(threshold, &t, sizeof(double), cudaMemcpyHostToDevice));
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t         handle,
-                                                       int                       m,
-                                                       int                       n,
-                                                       const double*             A,
-                                                       int                       lda,
-                                                       double                    percentage,
-                                                       const hipsparseMatDescr_t descr,
-                                                       double*                   csrVal,
-                                                       const int*                csrRowPtr,
-                                                       int*                      csrColInd,
-                                                       pruneInfo_t               info,
-                                                       void*                     buffer)
+#if CUDART_VERSION < 11000
+hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipsparseHybMat_t   hybA,
+                                    float*                    csrSortedValA,
+                                    int*                      csrSortedRowPtrA,
+                                    int*                      csrSortedColIndA)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneDense2csrByPercentage((cusparseHandle_t)handle,
-                                            m,
-                                            n,
-                                            A,
-                                            lda,
-                                            percentage,
-                                            (const cusparseMatDescr_t)descr,
-                                            csrVal,
-                                            csrRowPtr,
-                                            csrColInd,
-                                            (pruneInfo_t)info,
-                                            buffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseShyb2csr((cusparseHandle_t)handle,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         (const cusparseHybMat_t)hybA,
+                                                         csrSortedValA,
+                                                         csrSortedRowPtrA,
+                                                         csrSortedColIndA));
 }
 
-hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const float*              A,
-                                      int                       ld,
-                                      const int*                nnzPerColumn,
-                                      float*                    cscVal,
-                                      int*                      cscRowInd,
-                                      int*                      cscColPtr)
+hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipsparseHybMat_t   hybA,
+                                    double*                   csrSortedValA,
+                                    int*                      csrSortedRowPtrA,
+                                    int*                      csrSortedColIndA)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSdense2csc((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           A,
-                                                           ld,
-                                                           nnzPerColumn,
-                                                           cscVal,
-                                                           cscRowInd,
-                                                           cscColPtr));
+    return hipCUSPARSEStatusToHIPStatus(cusparseDhyb2csr((cusparseHandle_t)handle,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         (const cusparseHybMat_t)hybA,
+                                                         csrSortedValA,
+                                                         csrSortedRowPtrA,
+                                                         csrSortedColIndA));
 }
 
-hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const double*             A,
-                                      int                       ld,
-                                      const int*                nnzPerColumn,
-                                      double*                   cscVal,
-                                      int*                      cscRowInd,
-                                      int*                      cscColPtr)
+hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipsparseHybMat_t   hybA,
+                                    hipComplex*               csrSortedValA,
+                                    int*                      csrSortedRowPtrA,
+                                    int*                      csrSortedColIndA)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDdense2csc((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           A,
-                                                           ld,
-                                                           nnzPerColumn,
-                                                           cscVal,
-                                                           cscRowInd,
-                                                           cscColPtr));
+    return hipCUSPARSEStatusToHIPStatus(cusparseChyb2csr((cusparseHandle_t)handle,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         (const cusparseHybMat_t)hybA,
+                                                         csrSortedValA,
+                                                         csrSortedRowPtrA,
+                                                         csrSortedColIndA));
 }
 
-hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const hipComplex*         A,
-                                      int                       ld,
-                                      const int*                nnzPerColumn,
-                                      hipComplex*               cscVal,
-                                      int*                      cscRowInd,
-                                      int*                      cscColPtr)
+hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipsparseHybMat_t   hybA,
+                                    hipDoubleComplex*         csrSortedValA,
+                                    int*                      csrSortedRowPtrA,
+                                    int*                      csrSortedColIndA)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCdense2csc((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           (const cuComplex*)A,
-                                                           ld,
-                                                           nnzPerColumn,
-                                                           (cuComplex*)cscVal,
-                                                           cscRowInd,
-                                                           cscColPtr));
+    return hipCUSPARSEStatusToHIPStatus(cusparseZhyb2csr((cusparseHandle_t)handle,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         (const cusparseHybMat_t)hybA,
+                                                         csrSortedValA,
+                                                         csrSortedRowPtrA,
+                                                         csrSortedColIndA));
 }
+#endif
 
-hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const hipDoubleComplex*   A,
-                                      int                       ld,
-                                      const int*                nnzPerColumn,
-                                      hipDoubleComplex*         cscVal,
-                                      int*                      cscRowInd,
-                                      int*                      cscColPtr)
+hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
+                                    const int*           cooRowInd,
+                                    int                  nnz,
+                                    int                  m,
+                                    int*                 csrRowPtr,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcoo2csr((cusparseHandle_t)handle,
+                                                         cooRowInd,
+                                                         nnz,
+                                                         m,
+                                                         csrRowPtr,
+                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+}
+
+hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZdense2csc((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           (const cuDoubleComplex*)A,
-                                                           ld,
-                                                           nnzPerColumn,
-                                                           (cuDoubleComplex*)cscVal,
-                                                           cscRowInd,
-                                                           cscColPtr));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateIdentityPermutation((cusparseHandle_t)handle, n, p));
 }
 
-hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const float*              csrVal,
-                                      const int*                csrRowPtr,
-                                      const int*                csrColInd,
-                                      float*                    A,
-                                      int                       ld)
+hipsparseStatus_t hipsparseXcsrsort_bufferSizeExt(hipsparseHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  int               nnz,
+                                                  const int*        csrRowPtr,
+                                                  const int*        csrColInd,
+                                                  size_t*           pBufferSizeInBytes)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2dense((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           csrVal,
-                                                           csrRowPtr,
-                                                           csrColInd,
-                                                           A,
-                                                           ld));
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcsrsort_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes));
 }
 
-hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const double*             csrVal,
-                                      const int*                csrRowPtr,
-                                      const int*                csrColInd,
-                                      double*                   A,
-                                      int                       ld)
+hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descrA,
+                                    const int*                csrRowPtr,
+                                    int*                      csrColInd,
+                                    int*                      P,
+                                    void*                     pBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2dense((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           csrVal,
-                                                           csrRowPtr,
-                                                           csrColInd,
-                                                           A,
-                                                           ld));
+    // Column indices that are known to be sorted keep their order, thus P stays unchanged
+    if(handle != nullptr && descrA != nullptr
+       && (hipsparseGetMatProperties(descrA) & HIPSPARSE_MAT_PROPERTY_SORTED))
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcsrsort((cusparseHandle_t)handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         csrRowPtr,
+                                                         csrColInd,
+                                                         P,
+                                                         pBuffer));
 }
 
-hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const hipComplex*         csrVal,
-                                      const int*                csrRowPtr,
-                                      const int*                csrColInd,
-                                      hipComplex*               A,
-                                      int                       ld)
+hipsparseStatus_t hipsparseXcsrCheckProperties(hipsparseHandle_t         handle,
+                                               int                       m,
+                                               int                       n,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descrA,
+                                               const int*                csrRowPtr,
+                                               const int*                csrColInd,
+                                               int*                      properties)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2dense((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           (const hipComplex*)csrVal,
-                                                           csrRowPtr,
-                                                           csrColInd,
-                                                           (hipComplex*)A,
-                                                           ld));
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Check pointer arguments
+    if(descrA == nullptr || csrRowPtr == nullptr || properties == nullptr
+       || (nnz > 0 && csrColInd == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    std::vector<int> row_ptr(m + 1);
+    std::vector<int> col_ind(nnz);
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        row_ptr.data(), csrRowPtr, sizeof(int) * (m + 1), cudaMemcpyDeviceToHost, stream));
+
+    if(nnz > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            col_ind.data(), csrColInd, sizeof(int) * nnz, cudaMemcpyDeviceToHost, stream));
+    }
+
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    int base = hipsparseGetMatIndexBase(descrA);
+
+    if(row_ptr[0] != base || row_ptr[m] - base != nnz)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    bool sorted    = true;
+    bool unique    = true;
+    bool symmetric = (m == n);
+    bool diagonal  = (m == n);
+
+    // Sorted copy of each row, to look up the transposed entries
+    std::vector<int> sorted_col_ind(nnz);
+
+    for(int i = 0; i < m; ++i)
+    {
+        int row_begin = row_ptr[i] - base;
+        int row_end   = row_ptr[i + 1] - base;
+
+        if(row_end < row_begin || row_end > nnz)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        for(int j = row_begin; j < row_end; ++j)
+        {
+            int col = col_ind[j] - base;
+
+            if(col < 0 || col >= n)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            if(j > row_begin && col_ind[j] < col_ind[j - 1])
+            {
+                sorted = false;
+            }
+
+            sorted_col_ind[j] = col;
+        }
+
+        std::sort(sorted_col_ind.begin() + row_begin, sorted_col_ind.begin() + row_end);
+
+        for(int j = row_begin + 1; j < row_end; ++j)
+        {
+            if(sorted_col_ind[j] == sorted_col_ind[j - 1])
+            {
+                unique = false;
+            }
+        }
+
+        if(diagonal
+           && !std::binary_search(
+               sorted_col_ind.begin() + row_begin, sorted_col_ind.begin() + row_end, i))
+        {
+            diagonal = false;
+        }
+    }
+
+    // Each entry (i, j) needs a transposed entry (j, i)
+    for(int i = 0; i < m && symmetric; ++i)
+    {
+        for(int j = row_ptr[i] - base; j < row_ptr[i + 1] - base; ++j)
+        {
+            int col = sorted_col_ind[j];
+
+            if(!std::binary_search(sorted_col_ind.begin() + (row_ptr[col] - base),
+                                   sorted_col_ind.begin() + (row_ptr[col + 1] - base),
+                                   i))
+            {
+                symmetric = false;
+                break;
+            }
+        }
+    }
+
+    *properties = (sorted ? HIPSPARSE_MAT_PROPERTY_SORTED : 0)
+                  | (unique ? HIPSPARSE_MAT_PROPERTY_UNIQUE : 0)
+                  | (symmetric ? HIPSPARSE_MAT_PROPERTY_SYMMETRIC_PATTERN : 0)
+                  | (diagonal ? HIPSPARSE_MAT_PROPERTY_FULL_DIAGONAL : 0);
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const hipDoubleComplex*   csrVal,
-                                      const int*                csrRowPtr,
-                                      const int*                csrColInd,
-                                      hipDoubleComplex*         A,
-                                      int                       ld)
+hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  int               nnz,
+                                                  const int*        cscColPtr,
+                                                  const int*        cscRowInd,
+                                                  size_t*           pBufferSizeInBytes)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2dense((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           (const cuDoubleComplex*)csrVal,
-                                                           csrRowPtr,
-                                                           csrColInd,
-                                                           (cuDoubleComplex*)A,
-                                                           ld));
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcscsort_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes));
 }
 
-hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const float*              cscVal,
-                                      const int*                cscRowInd,
-                                      const int*                cscColPtr,
-                                      float*                    A,
-                                      int                       ld)
+hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descrA,
+                                    const int*                cscColPtr,
+                                    int*                      cscRowInd,
+                                    int*                      P,
+                                    void*                     pBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseScsc2dense((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           cscVal,
-                                                           cscRowInd,
-                                                           cscColPtr,
-                                                           A,
-                                                           ld));
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcscsort((cusparseHandle_t)handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         (const cusparseMatDescr_t)descrA,
+                                                         cscColPtr,
+                                                         cscRowInd,
+                                                         P,
+                                                         pBuffer));
 }
 
-hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const double*             cscVal,
-                                      const int*                cscRowInd,
-                                      const int*                cscColPtr,
-                                      double*                   A,
-                                      int                       ld)
+hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  int               nnz,
+                                                  const int*        cooRows,
+                                                  const int*        cooCols,
+                                                  size_t*           pBufferSizeInBytes)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDcsc2dense((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           cscVal,
-                                                           cscRowInd,
-                                                           cscColPtr,
-                                                           A,
-                                                           ld));
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcoosort_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes));
 }
 
-hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const hipComplex*         cscVal,
-                                      const int*                cscRowInd,
-                                      const int*                cscColPtr,
-                                      hipComplex*               A,
-                                      int                       ld)
+hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nnz,
+                                         int*              cooRows,
+                                         int*              cooCols,
+                                         int*              P,
+                                         void*             pBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCcsc2dense((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           (const cuComplex*)cscVal,
-                                                           cscRowInd,
-                                                           cscColPtr,
-                                                           (cuComplex*)A,
-                                                           ld));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseXcoosortByRow((cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
 }
 
-hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t descr,
-                                      const hipDoubleComplex*   cscVal,
-                                      const int*                cscRowInd,
-                                      const int*                cscColPtr,
-                                      hipDoubleComplex*         A,
-                                      int                       ld)
+hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
+                                            int               m,
+                                            int               n,
+                                            int               nnz,
+                                            int*              cooRows,
+                                            int*              cooCols,
+                                            int*              P,
+                                            void*             pBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZcsc2dense((cusparseHandle_t)handle,
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)descr,
-                                                           (const cuDoubleComplex*)cscVal,
-                                                           cscRowInd,
-                                                           cscColPtr,
-                                                           (cuDoubleComplex*)A,
-                                                           ld));
+    return hipCUSPARSEStatusToHIPStatus(cusparseXcoosortByColumn(
+        (cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
 }
 
-hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
-                                                   int               mb,
-                                                   int               nb,
-                                                   int               nnzb,
-                                                   const float*      bsr_val,
-                                                   const int*        bsr_row_ptr,
-                                                   const int*        bsr_col_ind,
-                                                   int               row_block_dim,
-                                                   int               col_block_dim,
-                                                   size_t*           p_buffer_size)
+hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                   hipsparseDirection_t      dirA,
+                                                   int                       mb,
+                                                   int                       nb,
+                                                   int                       nnzb,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const float*              bsrValA,
+                                                   const int*                bsrRowPtrA,
+                                                   const int*                bsrColIndA,
+                                                   int                       rowBlockDimA,
+                                                   int                       colBlockDimA,
+                                                   int                       rowBlockDimC,
+                                                   int                       colBlockDimC,
+                                                   int*                      bufferSize)
 {
-    int               cu_buffer_size;
-    hipsparseStatus_t status
-        = hipCUSPARSEStatusToHIPStatus(cusparseSgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
-                                                                       mb,
-                                                                       nb,
-                                                                       nnzb,
-                                                                       bsr_val,
-                                                                       bsr_row_ptr,
-                                                                       bsr_col_ind,
-                                                                       row_block_dim,
-                                                                       col_block_dim,
-                                                                       &cu_buffer_size));
-    p_buffer_size[0] = cu_buffer_size;
-    return status;
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
+                                        hipDirectionToCudaDirection(dirA),
+                                        mb,
+                                        nb,
+                                        nnzb,
+                                        (const cusparseMatDescr_t)descrA,
+                                        bsrValA,
+                                        bsrRowPtrA,
+                                        bsrColIndA,
+                                        rowBlockDimA,
+                                        colBlockDimA,
+                                        rowBlockDimC,
+                                        colBlockDimC,
+                                        bufferSize));
 }
 
-hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
-                                                   int               mb,
-                                                   int               nb,
-                                                   int               nnzb,
-                                                   const double*     bsr_val,
-                                                   const int*        bsr_row_ptr,
-                                                   const int*        bsr_col_ind,
-                                                   int               row_block_dim,
-                                                   int               col_block_dim,
-                                                   size_t*           p_buffer_size)
+hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                   hipsparseDirection_t      dirA,
+                                                   int                       mb,
+                                                   int                       nb,
+                                                   int                       nnzb,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const double*             bsrValA,
+                                                   const int*                bsrRowPtrA,
+                                                   const int*                bsrColIndA,
+                                                   int                       rowBlockDimA,
+                                                   int                       colBlockDimA,
+                                                   int                       rowBlockDimC,
+                                                   int                       colBlockDimC,
+                                                   int*                      bufferSize)
 {
-    int               cu_buffer_size;
-    hipsparseStatus_t status
-        = hipCUSPARSEStatusToHIPStatus(cusparseDgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
-                                                                       mb,
-                                                                       nb,
-                                                                       nnzb,
-                                                                       bsr_val,
-                                                                       bsr_row_ptr,
-                                                                       bsr_col_ind,
-                                                                       row_block_dim,
-                                                                       col_block_dim,
-                                                                       &cu_buffer_size));
-    p_buffer_size[0] = cu_buffer_size;
-    return status;
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
+                                        hipDirectionToCudaDirection(dirA),
+                                        mb,
+                                        nb,
+                                        nnzb,
+                                        (const cusparseMatDescr_t)descrA,
+                                        bsrValA,
+                                        bsrRowPtrA,
+                                        bsrColIndA,
+                                        rowBlockDimA,
+                                        colBlockDimA,
+                                        rowBlockDimC,
+                                        colBlockDimC,
+                                        bufferSize));
 }
 
-hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
-                                                   int               mb,
-                                                   int               nb,
-                                                   int               nnzb,
-                                                   const hipComplex* bsr_val,
-                                                   const int*        bsr_row_ptr,
-                                                   const int*        bsr_col_ind,
-                                                   int               row_block_dim,
-                                                   int               col_block_dim,
-                                                   size_t*           p_buffer_size)
+hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                   hipsparseDirection_t      dirA,
+                                                   int                       mb,
+                                                   int                       nb,
+                                                   int                       nnzb,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const hipComplex*         bsrValA,
+                                                   const int*                bsrRowPtrA,
+                                                   const int*                bsrColIndA,
+                                                   int                       rowBlockDimA,
+                                                   int                       colBlockDimA,
+                                                   int                       rowBlockDimC,
+                                                   int                       colBlockDimC,
+                                                   int*                      bufferSize)
 {
-    int               cu_buffer_size;
-    hipsparseStatus_t status
-        = hipCUSPARSEStatusToHIPStatus(cusparseCgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
-                                                                       mb,
-                                                                       nb,
-                                                                       nnzb,
-                                                                       (const cuComplex*)bsr_val,
-                                                                       bsr_row_ptr,
-                                                                       bsr_col_ind,
-                                                                       row_block_dim,
-                                                                       col_block_dim,
-                                                                       &cu_buffer_size));
-    p_buffer_size[0] = cu_buffer_size;
-    return status;
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseCgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
+                                        hipDirectionToCudaDirection(dirA),
+                                        mb,
+                                        nb,
+                                        nnzb,
+                                        (const cusparseMatDescr_t)descrA,
+                                        (const cuComplex*)bsrValA,
+                                        bsrRowPtrA,
+                                        bsrColIndA,
+                                        rowBlockDimA,
+                                        colBlockDimA,
+                                        rowBlockDimC,
+                                        colBlockDimC,
+                                        bufferSize));
 }
 
-hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handle,
-                                                   int                     mb,
-                                                   int                     nb,
-                                                   int                     nnzb,
-                                                   const hipDoubleComplex* bsr_val,
-                                                   const int*              bsr_row_ptr,
-                                                   const int*              bsr_col_ind,
-                                                   int                     row_block_dim,
-                                                   int                     col_block_dim,
-                                                   size_t*                 p_buffer_size)
+hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                   hipsparseDirection_t      dirA,
+                                                   int                       mb,
+                                                   int                       nb,
+                                                   int                       nnzb,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const hipDoubleComplex*   bsrValA,
+                                                   const int*                bsrRowPtrA,
+                                                   const int*                bsrColIndA,
+                                                   int                       rowBlockDimA,
+                                                   int                       colBlockDimA,
+                                                   int                       rowBlockDimC,
+                                                   int                       colBlockDimC,
+                                                   int*                      bufferSize)
 {
-    int               cu_buffer_size;
-    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
-        cusparseZgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseZgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
+                                        hipDirectionToCudaDirection(dirA),
                                         mb,
                                         nb,
                                         nnzb,
-                                        (const cuDoubleComplex*)bsr_val,
-                                        bsr_row_ptr,
-                                        bsr_col_ind,
-                                        row_block_dim,
-                                        col_block_dim,
-                                        &cu_buffer_size));
-    p_buffer_size[0] = cu_buffer_size;
-    return status;
+                                        (const cusparseMatDescr_t)descrA,
+                                        (const cuDoubleComplex*)bsrValA,
+                                        bsrRowPtrA,
+                                        bsrColIndA,
+                                        rowBlockDimA,
+                                        colBlockDimA,
+                                        rowBlockDimC,
+                                        colBlockDimC,
+                                        bufferSize));
+}
+
+hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
+                                           hipsparseDirection_t      dirA,
+                                           int                       mb,
+                                           int                       nb,
+                                           int                       nnzb,
+                                           const hipsparseMatDescr_t descrA,
+                                           const int*                bsrRowPtrA,
+                                           const int*                bsrColIndA,
+                                           int                       rowBlockDimA,
+                                           int                       colBlockDimA,
+                                           const hipsparseMatDescr_t descrC,
+                                           int*                      bsrRowPtrC,
+                                           int                       rowBlockDimC,
+                                           int                       colBlockDimC,
+                                           int*                      nnzTotalDevHostPtr,
+                                           void*                     buffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseXgebsr2gebsrNnz((cusparseHandle_t)handle,
+                                                                hipDirectionToCudaDirection(dirA),
+                                                                mb,
+                                                                nb,
+                                                                nnzb,
+                                                                (const cusparseMatDescr_t)descrA,
+                                                                bsrRowPtrA,
+                                                                bsrColIndA,
+                                                                rowBlockDimA,
+                                                                colBlockDimA,
+                                                                (cusparseMatDescr_t)descrC,
+                                                                bsrRowPtrC,
+                                                                rowBlockDimC,
+                                                                colBlockDimC,
+                                                                nnzTotalDevHostPtr,
+                                                                buffer));
 }
 
-hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
-                                        int                  mb,
-                                        int                  nb,
-                                        int                  nnzb,
-                                        const float*         bsr_val,
-                                        const int*           bsr_row_ptr,
-                                        const int*           bsr_col_ind,
-                                        int                  row_block_dim,
-                                        int                  col_block_dim,
-                                        float*               bsc_val,
-                                        int*                 bsc_row_ind,
-                                        int*                 bsc_col_ptr,
-                                        hipsparseAction_t    copy_values,
-                                        hipsparseIndexBase_t idx_base,
-                                        void*                temp_buffer)
+hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const float*              bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       rowBlockDimA,
+                                        int                       colBlockDimA,
+                                        const hipsparseMatDescr_t descrC,
+                                        float*                    bsrValC,
+                                        int*                      bsrRowPtrC,
+                                        int*                      bsrColIndC,
+                                        int                       rowBlockDimC,
+                                        int                       colBlockDimC,
+                                        void*                     buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSgebsr2gebsc((cusparseHandle_t)handle,
+    return hipCUSPARSEStatusToHIPStatus(cusparseSgebsr2gebsr((cusparseHandle_t)handle,
+                                                             hipDirectionToCudaDirection(dirA),
                                                              mb,
                                                              nb,
                                                              nnzb,
-                                                             bsr_val,
-                                                             bsr_row_ptr,
-                                                             bsr_col_ind,
-                                                             row_block_dim,
-                                                             col_block_dim,
-                                                             bsc_val,
-                                                             bsc_row_ind,
-                                                             bsc_col_ptr,
-                                                             hipActionToCudaAction(copy_values),
-                                                             hipIndexBaseToCudaIndexBase(idx_base),
-                                                             temp_buffer));
+                                                             (const cusparseMatDescr_t)descrA,
+                                                             bsrValA,
+                                                             bsrRowPtrA,
+                                                             bsrColIndA,
+                                                             rowBlockDimA,
+                                                             colBlockDimA,
+                                                             (const cusparseMatDescr_t)descrC,
+                                                             bsrValC,
+                                                             bsrRowPtrC,
+                                                             bsrColIndC,
+                                                             rowBlockDimC,
+                                                             colBlockDimC,
+                                                             buffer));
 }
 
-hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
-                                        int                  mb,
-                                        int                  nb,
-                                        int                  nnzb,
-                                        const double*        bsr_val,
-                                        const int*           bsr_row_ptr,
-                                        const int*           bsr_col_ind,
-                                        int                  row_block_dim,
-                                        int                  col_block_dim,
-                                        double*              bsc_val,
-                                        int*                 bsc_row_ind,
-                                        int*                 bsc_col_ptr,
-                                        hipsparseAction_t    copy_values,
-                                        hipsparseIndexBase_t idx_base,
-                                        void*                temp_buffer)
+hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const double*             bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       rowBlockDimA,
+                                        int                       colBlockDimA,
+                                        const hipsparseMatDescr_t descrC,
+                                        double*                   bsrValC,
+                                        int*                      bsrRowPtrC,
+                                        int*                      bsrColIndC,
+                                        int                       rowBlockDimC,
+                                        int                       colBlockDimC,
+                                        void*                     buffer)
 {
-
-    return hipCUSPARSEStatusToHIPStatus(cusparseDgebsr2gebsc((cusparseHandle_t)handle,
+    return hipCUSPARSEStatusToHIPStatus(cusparseDgebsr2gebsr((cusparseHandle_t)handle,
+                                                             hipDirectionToCudaDirection(dirA),
                                                              mb,
                                                              nb,
                                                              nnzb,
-                                                             bsr_val,
-                                                             bsr_row_ptr,
-                                                             bsr_col_ind,
-                                                             row_block_dim,
-                                                             col_block_dim,
-                                                             bsc_val,
-                                                             bsc_row_ind,
-                                                             bsc_col_ptr,
-                                                             hipActionToCudaAction(copy_values),
-                                                             hipIndexBaseToCudaIndexBase(idx_base),
-                                                             temp_buffer));
+                                                             (const cusparseMatDescr_t)descrA,
+                                                             bsrValA,
+                                                             bsrRowPtrA,
+                                                             bsrColIndA,
+                                                             rowBlockDimA,
+                                                             colBlockDimA,
+                                                             (const cusparseMatDescr_t)descrC,
+                                                             bsrValC,
+                                                             bsrRowPtrC,
+                                                             bsrColIndC,
+                                                             rowBlockDimC,
+                                                             colBlockDimC,
+                                                             buffer));
 }
 
-hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
-                                        int                  mb,
-                                        int                  nb,
-                                        int                  nnzb,
-                                        const hipComplex*    bsr_val,
-                                        const int*           bsr_row_ptr,
-                                        const int*           bsr_col_ind,
-                                        int                  row_block_dim,
-                                        int                  col_block_dim,
-                                        hipComplex*          bsc_val,
-                                        int*                 bsc_row_ind,
-                                        int*                 bsc_col_ptr,
-                                        hipsparseAction_t    copy_values,
-                                        hipsparseIndexBase_t idx_base,
-                                        void*                temp_buffer)
+hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const hipComplex*         bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       rowBlockDimA,
+                                        int                       colBlockDimA,
+                                        const hipsparseMatDescr_t descrC,
+                                        hipComplex*               bsrValC,
+                                        int*                      bsrRowPtrC,
+                                        int*                      bsrColIndC,
+                                        int                       rowBlockDimC,
+                                        int                       colBlockDimC,
+                                        void*                     buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCgebsr2gebsc((cusparseHandle_t)handle,
+    return hipCUSPARSEStatusToHIPStatus(cusparseCgebsr2gebsr((cusparseHandle_t)handle,
+                                                             hipDirectionToCudaDirection(dirA),
                                                              mb,
                                                              nb,
                                                              nnzb,
-                                                             (const cuComplex*)bsr_val,
-                                                             bsr_row_ptr,
-                                                             bsr_col_ind,
-                                                             row_block_dim,
-                                                             col_block_dim,
-                                                             (cuComplex*)bsc_val,
-                                                             bsc_row_ind,
-                                                             bsc_col_ptr,
-                                                             hipActionToCudaAction(copy_values),
-                                                             hipIndexBaseToCudaIndexBase(idx_base),
-                                                             temp_buffer));
+                                                             (const cusparseMatDescr_t)descrA,
+                                                             (const cuComplex*)bsrValA,
+                                                             bsrRowPtrA,
+                                                             bsrColIndA,
+                                                             rowBlockDimA,
+                                                             colBlockDimA,
+                                                             (const cusparseMatDescr_t)descrC,
+                                                             (cuComplex*)bsrValC,
+                                                             bsrRowPtrC,
+                                                             bsrColIndC,
+                                                             rowBlockDimC,
+                                                             colBlockDimC,
+                                                             buffer));
 }
 
-hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
-                                        int                     mb,
-                                        int                     nb,
-                                        int                     nnzb,
-                                        const hipDoubleComplex* bsr_val,
-                                        const int*              bsr_row_ptr,
-                                        const int*              bsr_col_ind,
-                                        int                     row_block_dim,
-                                        int                     col_block_dim,
-                                        hipDoubleComplex*       bsc_val,
-                                        int*                    bsc_row_ind,
-                                        int*                    bsc_col_ptr,
-                                        hipsparseAction_t       copy_values,
-                                        hipsparseIndexBase_t    idx_base,
-                                        void*                   temp_buffer)
+hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const hipDoubleComplex*   bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       rowBlockDimA,
+                                        int                       colBlockDimA,
+                                        const hipsparseMatDescr_t descrC,
+                                        hipDoubleComplex*         bsrValC,
+                                        int*                      bsrRowPtrC,
+                                        int*                      bsrColIndC,
+                                        int                       rowBlockDimC,
+                                        int                       colBlockDimC,
+                                        void*                     buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZgebsr2gebsc((cusparseHandle_t)handle,
+    return hipCUSPARSEStatusToHIPStatus(cusparseZgebsr2gebsr((cusparseHandle_t)handle,
+                                                             hipDirectionToCudaDirection(dirA),
                                                              mb,
                                                              nb,
                                                              nnzb,
-                                                             (const cuDoubleComplex*)bsr_val,
-                                                             bsr_row_ptr,
-                                                             bsr_col_ind,
-                                                             row_block_dim,
-                                                             col_block_dim,
-                                                             (cuDoubleComplex*)bsc_val,
-                                                             bsc_row_ind,
-                                                             bsc_col_ptr,
-                                                             hipActionToCudaAction(copy_values),
-                                                             hipIndexBaseToCudaIndexBase(idx_base),
-                                                             temp_buffer));
+                                                             (const cusparseMatDescr_t)descrA,
+                                                             (const cuDoubleComplex*)bsrValA,
+                                                             bsrRowPtrA,
+                                                             bsrColIndA,
+                                                             rowBlockDimA,
+                                                             colBlockDimA,
+                                                             (const cusparseMatDescr_t)descrC,
+                                                             (cuDoubleComplex*)bsrValC,
+                                                             bsrRowPtrC,
+                                                             bsrColIndC,
+                                                             rowBlockDimC,
+                                                             colBlockDimC,
+                                                             buffer));
 }
 
-hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handle,
-                                                 hipsparseDirection_t      dir,
-                                                 int                       m,
-                                                 int                       n,
-                                                 const hipsparseMatDescr_t csr_descr,
-                                                 const float*              csr_val,
-                                                 const int*                csr_row_ptr,
-                                                 const int*                csr_col_ind,
-                                                 int                       row_block_dim,
-                                                 int                       col_block_dim,
-                                                 size_t*                   p_buffer_size)
+hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nnz,
+                                                   float*            csrVal,
+                                                   const int*        csrRowPtr,
+                                                   int*              csrColInd,
+                                                   csru2csrInfo_t    info,
+                                                   size_t*           pBufferSizeInBytes)
 {
-    int               cu_buffer_size;
-    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
-        cusparseScsr2gebsr_bufferSize((cusparseHandle_t)handle,
-                                      hipDirectionToCudaDirection(dir),
-                                      m,
-                                      n,
-                                      (const cusparseMatDescr_t)csr_descr,
-                                      csr_val,
-                                      csr_row_ptr,
-                                      csr_col_ind,
-                                      row_block_dim,
-                                      col_block_dim,
-                                      &cu_buffer_size));
-    p_buffer_size[0] = cu_buffer_size;
-    return status;
+    return hipCUSPARSEStatusToHIPStatus(cusparseScsru2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                                                        m,
+                                                                        n,
+                                                                        nnz,
+                                                                        csrVal,
+                                                                        csrRowPtr,
+                                                                        csrColInd,
+                                                                        info,
+                                                                        pBufferSizeInBytes));
 }
 
-hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
-                                                 hipsparseDirection_t      dir,
-                                                 int                       m,
-                                                 int                       n,
-                                                 const hipsparseMatDescr_t csr_descr,
-                                                 const double*             csr_val,
-                                                 const int*                csr_row_ptr,
-                                                 const int*                csr_col_ind,
-                                                 int                       row_block_dim,
-                                                 int                       col_block_dim,
-                                                 size_t*                   p_buffer_size)
+hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nnz,
+                                                   double*           csrVal,
+                                                   const int*        csrRowPtr,
+                                                   int*              csrColInd,
+                                                   csru2csrInfo_t    info,
+                                                   size_t*           pBufferSizeInBytes)
 {
-    int               cu_buffer_size;
-    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
-        cusparseDcsr2gebsr_bufferSize((cusparseHandle_t)handle,
-                                      hipDirectionToCudaDirection(dir),
-                                      m,
-                                      n,
-                                      (const cusparseMatDescr_t)csr_descr,
-                                      csr_val,
-                                      csr_row_ptr,
-                                      csr_col_ind,
-                                      row_block_dim,
-                                      col_block_dim,
-                                      &cu_buffer_size));
-    p_buffer_size[0] = cu_buffer_size;
-    return status;
+    return hipCUSPARSEStatusToHIPStatus(cusparseDcsru2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                                                        m,
+                                                                        n,
+                                                                        nnz,
+                                                                        csrVal,
+                                                                        csrRowPtr,
+                                                                        csrColInd,
+                                                                        info,
+                                                                        pBufferSizeInBytes));
 }
 
-hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
-                                                 hipsparseDirection_t      dir,
-                                                 int                       m,
-                                                 int                       n,
-                                                 const hipsparseMatDescr_t csr_descr,
-                                                 const hipComplex*         csr_val,
-                                                 const int*                csr_row_ptr,
-                                                 const int*                csr_col_ind,
-                                                 int                       row_block_dim,
-                                                 int                       col_block_dim,
-                                                 size_t*                   p_buffer_size)
+hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nnz,
+                                                   hipComplex*       csrVal,
+                                                   const int*        csrRowPtr,
+                                                   int*              csrColInd,
+                                                   csru2csrInfo_t    info,
+                                                   size_t*           pBufferSizeInBytes)
 {
+    return hipCUSPARSEStatusToHIPStatus(cusparseCcsru2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                                                        m,
+                                                                        n,
+                                                                        nnz,
+                                                                        (cuComplex*)csrVal,
+                                                                        csrRowPtr,
+                                                                        csrColInd,
+                                                                        info,
+                                                                        pBufferSizeInBytes));
+}
 
-    int               cu_buffer_size;
-    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
-        cusparseCcsr2gebsr_bufferSize((cusparseHandle_t)handle,
-                                      hipDirectionToCudaDirection(dir),
-                                      m,
-                                      n,
-                                      (const cusparseMatDescr_t)csr_descr,
-                                      (const cuComplex*)csr_val,
-                                      csr_row_ptr,
-                                      csr_col_ind,
-                                      row_block_dim,
-                                      col_block_dim,
-                                      &cu_buffer_size));
-    p_buffer_size[0] = cu_buffer_size;
-    return status;
+hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nnz,
+                                                   hipDoubleComplex* csrVal,
+                                                   const int*        csrRowPtr,
+                                                   int*              csrColInd,
+                                                   csru2csrInfo_t    info,
+                                                   size_t*           pBufferSizeInBytes)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseZcsru2csr_bufferSizeExt((cusparseHandle_t)handle,
+                                                                        m,
+                                                                        n,
+                                                                        nnz,
+                                                                        (cuDoubleComplex*)csrVal,
+                                                                        csrRowPtr,
+                                                                        csrColInd,
+                                                                        info,
+                                                                        pBufferSizeInBytes));
 }
 
-hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
-                                                 hipsparseDirection_t      dir,
-                                                 int                       m,
-                                                 int                       n,
-                                                 const hipsparseMatDescr_t csr_descr,
-                                                 const hipDoubleComplex*   csr_val,
-                                                 const int*                csr_row_ptr,
-                                                 const int*                csr_col_ind,
-                                                 int                       row_block_dim,
-                                                 int                       col_block_dim,
-                                                 size_t*                   p_buffer_size)
+hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     float*                    csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
 {
-    int               cu_buffer_size;
-    hipsparseStatus_t status = hipCUSPARSEStatusToHIPStatus(
-        cusparseZcsr2gebsr_bufferSize((cusparseHandle_t)handle,
-                                      hipDirectionToCudaDirection(dir),
-                                      m,
-                                      n,
-                                      (const cusparseMatDescr_t)csr_descr,
-                                      (const cuDoubleComplex*)csr_val,
-                                      csr_row_ptr,
-                                      csr_col_ind,
-                                      row_block_dim,
-                                      col_block_dim,
-                                      &cu_buffer_size));
-    p_buffer_size[0] = cu_buffer_size;
-    return status;
+    return hipCUSPARSEStatusToHIPStatus(cusparseScsru2csr((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          (const cusparseMatDescr_t)descrA,
+                                                          csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          info,
+                                                          pBuffer));
 }
 
-hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
-                                         hipsparseDirection_t      dir,
-                                         int                       m,
-                                         int                       n,
-                                         const hipsparseMatDescr_t csr_descr,
-                                         const int*                csr_row_ptr,
-                                         const int*                csr_col_ind,
-                                         const hipsparseMatDescr_t bsr_descr,
-                                         int*                      bsr_row_ptr,
-                                         int                       row_block_dim,
-                                         int                       col_block_dim,
-                                         int*                      bsr_nnz_devhost,
-                                         void*                     p_buffer)
+hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     double*                   csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
 {
+    return hipCUSPARSEStatusToHIPStatus(cusparseDcsru2csr((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          (const cusparseMatDescr_t)descrA,
+                                                          csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          info,
+                                                          pBuffer));
+}
 
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcsr2gebsrNnz((cusparseHandle_t)handle,
-                                                              hipDirectionToCudaDirection(dir),
-                                                              m,
-                                                              n,
-                                                              (const cusparseMatDescr_t)csr_descr,
-                                                              csr_row_ptr,
-                                                              csr_col_ind,
-                                                              (const cusparseMatDescr_t)bsr_descr,
-                                                              bsr_row_ptr,
-                                                              row_block_dim,
-                                                              col_block_dim,
-                                                              bsr_nnz_devhost,
-                                                              p_buffer));
+hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipComplex*               csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCcsru2csr((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          (const cusparseMatDescr_t)descrA,
+                                                          (cuComplex*)csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          info,
+                                                          pBuffer));
 }
 
-hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
-                                      hipsparseDirection_t      dir,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t csr_descr,
-                                      const float*              csr_val,
-                                      const int*                csr_row_ptr,
-                                      const int*                csr_col_ind,
-                                      const hipsparseMatDescr_t bsr_descr,
-                                      float*                    bsr_val,
-                                      int*                      bsr_row_ptr,
-                                      int*                      bsr_col_ind,
-                                      int                       row_block_dim,
-                                      int                       col_block_dim,
-                                      void*                     p_buffer)
+hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipDoubleComplex*         csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2gebsr((cusparseHandle_t)handle,
-                                                           hipDirectionToCudaDirection(dir),
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)csr_descr,
-                                                           csr_val,
-                                                           csr_row_ptr,
-                                                           csr_col_ind,
-                                                           (const cusparseMatDescr_t)bsr_descr,
-                                                           bsr_val,
-                                                           bsr_row_ptr,
-                                                           bsr_col_ind,
-                                                           row_block_dim,
-                                                           col_block_dim,
-                                                           p_buffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseZcsru2csr((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          (const cusparseMatDescr_t)descrA,
+                                                          (cuDoubleComplex*)csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          info,
+                                                          pBuffer));
 }
 
-hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
-                                      hipsparseDirection_t      dir,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t csr_descr,
-                                      const double*             csr_val,
-                                      const int*                csr_row_ptr,
-                                      const int*                csr_col_ind,
-                                      const hipsparseMatDescr_t bsr_descr,
-                                      double*                   bsr_val,
-                                      int*                      bsr_row_ptr,
-                                      int*                      bsr_col_ind,
-                                      int                       row_block_dim,
-                                      int                       col_block_dim,
-                                      void*                     p_buffer)
+hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     float*                    csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2gebsr((cusparseHandle_t)handle,
-                                                           hipDirectionToCudaDirection(dir),
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)csr_descr,
-                                                           csr_val,
-                                                           csr_row_ptr,
-                                                           csr_col_ind,
-                                                           (const cusparseMatDescr_t)bsr_descr,
-                                                           bsr_val,
-                                                           bsr_row_ptr,
-                                                           bsr_col_ind,
-                                                           row_block_dim,
-                                                           col_block_dim,
-                                                           p_buffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2csru((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          (const cusparseMatDescr_t)descrA,
+                                                          csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          info,
+                                                          pBuffer));
 }
 
-hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
-                                      hipsparseDirection_t      dir,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t csr_descr,
-                                      const hipComplex*         csr_val,
-                                      const int*                csr_row_ptr,
-                                      const int*                csr_col_ind,
-                                      const hipsparseMatDescr_t bsr_descr,
-                                      hipComplex*               bsr_val,
-                                      int*                      bsr_row_ptr,
-                                      int*                      bsr_col_ind,
-                                      int                       row_block_dim,
-                                      int                       col_block_dim,
-                                      void*                     p_buffer)
+hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     double*                   csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2gebsr((cusparseHandle_t)handle,
-                                                           hipDirectionToCudaDirection(dir),
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)csr_descr,
-                                                           (const cuComplex*)csr_val,
-                                                           csr_row_ptr,
-                                                           csr_col_ind,
-                                                           (const cusparseMatDescr_t)bsr_descr,
-                                                           (cuComplex*)bsr_val,
-                                                           bsr_row_ptr,
-                                                           bsr_col_ind,
-                                                           row_block_dim,
-                                                           col_block_dim,
-                                                           p_buffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2csru((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          (const cusparseMatDescr_t)descrA,
+                                                          csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          info,
+                                                          pBuffer));
 }
 
-hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
-                                      hipsparseDirection_t      dir,
-                                      int                       m,
-                                      int                       n,
-                                      const hipsparseMatDescr_t csr_descr,
-                                      const hipDoubleComplex*   csr_val,
-                                      const int*                csr_row_ptr,
-                                      const int*                csr_col_ind,
-                                      const hipsparseMatDescr_t bsr_descr,
-                                      hipDoubleComplex*         bsr_val,
-                                      int*                      bsr_row_ptr,
-                                      int*                      bsr_col_ind,
-                                      int                       row_block_dim,
-                                      int                       col_block_dim,
-                                      void*                     p_buffer)
+hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipComplex*               csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2gebsr((cusparseHandle_t)handle,
-                                                           hipDirectionToCudaDirection(dir),
-                                                           m,
-                                                           n,
-                                                           (const cusparseMatDescr_t)csr_descr,
-                                                           (const cuDoubleComplex*)csr_val,
-                                                           csr_row_ptr,
-                                                           csr_col_ind,
-                                                           (const cusparseMatDescr_t)bsr_descr,
-                                                           (cuDoubleComplex*)bsr_val,
-                                                           bsr_row_ptr,
-                                                           bsr_col_ind,
-                                                           row_block_dim,
-                                                           col_block_dim,
-                                                           p_buffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2csru((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          (const cusparseMatDescr_t)descrA,
+                                                          (cuComplex*)csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          info,
+                                                          pBuffer));
 }
 
-hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
-                                       hipsparseDirection_t      dirA,
-                                       int                       m,
-                                       int                       n,
-                                       const hipsparseMatDescr_t descrA,
-                                       const int*                csrRowPtrA,
-                                       const int*                csrColIndA,
-                                       int                       blockDim,
-                                       const hipsparseMatDescr_t descrC,
-                                       int*                      bsrRowPtrC,
-                                       int*                      bsrNnzb)
+hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipDoubleComplex*         csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcsr2bsrNnz((cusparseHandle_t)handle,
-                                                            hipDirectionToCudaDirection(dirA),
-                                                            m,
-                                                            n,
-                                                            (const cusparseMatDescr_t)descrA,
-                                                            csrRowPtrA,
-                                                            csrColIndA,
-                                                            blockDim,
-                                                            (const cusparseMatDescr_t)descrC,
-                                                            bsrRowPtrC,
-                                                            bsrNnzb));
+    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2csru((cusparseHandle_t)handle,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          (const cusparseMatDescr_t)descrA,
+                                                          (cuDoubleComplex*)csrVal,
+                                                          csrRowPtr,
+                                                          csrColInd,
+                                                          info,
+                                                          pBuffer));
+}
+
+/* Generic API */
+#if(CUDART_VERSION >= 10010)
+cusparseFormat_t hipFormatToCudaFormat(hipsparseFormat_t format)
+{
+    switch(format)
+    {
+    case HIPSPARSE_FORMAT_COO:
+        return CUSPARSE_FORMAT_COO;
+    case HIPSPARSE_FORMAT_COO_AOS:
+        return CUSPARSE_FORMAT_COO_AOS;
+    case HIPSPARSE_FORMAT_CSR:
+        return CUSPARSE_FORMAT_CSR;
+#if(CUDART_VERSION >= 11021)
+    case HIPSPARSE_FORMAT_BLOCKED_ELL:
+        return CUSPARSE_FORMAT_BLOCKED_ELL;
+#endif
+    default:
+        throw "Non existent hipsparseFormat_t";
+    }
 }
 
-hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
-                                         int                       m,
-                                         const hipsparseMatDescr_t descrA,
-                                         const float*              csrValA,
-                                         const int*                csrRowPtrA,
-                                         int*                      nnzPerRow,
-                                         int*                      nnzC,
-                                         float                     tol)
+hipsparseFormat_t CudaFormatToHIPFormat(cusparseFormat_t format)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSnnz_compress((cusparseHandle_t)handle,
-                                                              m,
-                                                              (const cusparseMatDescr_t)descrA,
-                                                              csrValA,
-                                                              csrRowPtrA,
-                                                              nnzPerRow,
-                                                              nnzC,
-                                                              tol));
+    switch(format)
+    {
+    case CUSPARSE_FORMAT_COO:
+        return HIPSPARSE_FORMAT_COO;
+    case CUSPARSE_FORMAT_COO_AOS:
+        return HIPSPARSE_FORMAT_COO_AOS;
+    case CUSPARSE_FORMAT_CSR:
+        return HIPSPARSE_FORMAT_CSR;
+
+#if(CUDART_VERSION >= 11021)
+    case CUSPARSE_FORMAT_BLOCKED_ELL:
+        return HIPSPARSE_FORMAT_BLOCKED_ELL;
+#endif
+    default:
+        throw "Non existent cusparseFormat_t";
+    }
 }
+#endif
 
-hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
-                                         int                       m,
-                                         const hipsparseMatDescr_t descrA,
-                                         const double*             csrValA,
-                                         const int*                csrRowPtrA,
-                                         int*                      nnzPerRow,
-                                         int*                      nnzC,
-                                         double                    tol)
+#if(CUDART_VERSION >= 11000)
+cusparseOrder_t hipOrderToCudaOrder(hipsparseOrder_t op)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDnnz_compress((cusparseHandle_t)handle,
-                                                              m,
-                                                              (const cusparseMatDescr_t)descrA,
-                                                              csrValA,
-                                                              csrRowPtrA,
-                                                              nnzPerRow,
-                                                              nnzC,
-                                                              tol));
+    switch(op)
+    {
+    case HIPSPARSE_ORDER_ROW:
+        return CUSPARSE_ORDER_ROW;
+    case HIPSPARSE_ORDER_COLUMN:
+        return CUSPARSE_ORDER_COL;
+    default:
+        throw "Non existent hipsparseOrder_t";
+    }
 }
 
-hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
-                                         int                       m,
-                                         const hipsparseMatDescr_t descrA,
-                                         const hipComplex*         csrValA,
-                                         const int*                csrRowPtrA,
-                                         int*                      nnzPerRow,
-                                         int*                      nnzC,
-                                         hipComplex                tol)
+hipsparseOrder_t CudaOrderToHIPOrder(cusparseOrder_t op)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCnnz_compress((cusparseHandle_t)handle,
-                                                              m,
-                                                              (const cusparseMatDescr_t)descrA,
-                                                              (const cuComplex*)csrValA,
-                                                              csrRowPtrA,
-                                                              nnzPerRow,
-                                                              nnzC,
-                                                              {cuCrealf(tol), cuCimagf(tol)}));
+    switch(op)
+    {
+    case CUSPARSE_ORDER_ROW:
+        return HIPSPARSE_ORDER_ROW;
+    case CUSPARSE_ORDER_COL:
+        return HIPSPARSE_ORDER_COLUMN;
+    default:
+        throw "Non existent cusparseOrder_t";
+    }
 }
-
-hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
-                                         int                       m,
-                                         const hipsparseMatDescr_t descrA,
-                                         const hipDoubleComplex*   csrValA,
-                                         const int*                csrRowPtrA,
-                                         int*                      nnzPerRow,
-                                         int*                      nnzC,
-                                         hipDoubleComplex          tol)
+#elif(CUDART_VERSION >= 10010)
+cusparseOrder_t hipOrderToCudaOrder(hipsparseOrder_t op)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZnnz_compress((cusparseHandle_t)handle,
-                                                              m,
-                                                              (const cusparseMatDescr_t)descrA,
-                                                              (const cuDoubleComplex*)csrValA,
-                                                              csrRowPtrA,
-                                                              nnzPerRow,
-                                                              nnzC,
-                                                              {cuCreal(tol), cuCimag(tol)}));
+    switch(op)
+    {
+    case HIPSPARSE_ORDER_COLUMN:
+        return CUSPARSE_ORDER_COL;
+    default:
+        throw "Non existent hipsparseOrder_t";
+    }
 }
 
-hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
-                                    const int*           csrRowPtr,
-                                    int                  nnz,
-                                    int                  m,
-                                    int*                 cooRowInd,
-                                    hipsparseIndexBase_t idxBase)
+hipsparseOrder_t CudaOrderToHIPOrder(cusparseOrder_t op)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcsr2coo((cusparseHandle_t)handle,
-                                                         csrRowPtr,
-                                                         nnz,
-                                                         m,
-                                                         cooRowInd,
-                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+    switch(op)
+    {
+    case CUSPARSE_ORDER_COL:
+        return HIPSPARSE_ORDER_COLUMN;
+    default:
+        throw "Non existent cusparseOrder_t";
+    }
 }
+#endif
 
-#if CUDART_VERSION < 11000
-hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
-                                    int                  m,
-                                    int                  n,
-                                    int                  nnz,
-                                    const float*         csrSortedVal,
-                                    const int*           csrSortedRowPtr,
-                                    const int*           csrSortedColInd,
-                                    float*               cscSortedVal,
-                                    int*                 cscSortedRowInd,
-                                    int*                 cscSortedColPtr,
-                                    hipsparseAction_t    copyValues,
-                                    hipsparseIndexBase_t idxBase)
+#if(CUDART_VERSION >= 10010)
+cusparseIndexType_t hipIndexTypeToCudaIndexType(hipsparseIndexType_t type)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2csc((cusparseHandle_t)handle,
-                                                         m,
-                                                         n,
-                                                         nnz,
-                                                         csrSortedVal,
-                                                         csrSortedRowPtr,
-                                                         csrSortedColInd,
-                                                         cscSortedVal,
-                                                         cscSortedRowInd,
-                                                         cscSortedColPtr,
-                                                         hipActionToCudaAction(copyValues),
-                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+    switch(type)
+    {
+    case HIPSPARSE_INDEX_16U:
+        return CUSPARSE_INDEX_16U;
+    case HIPSPARSE_INDEX_32I:
+        return CUSPARSE_INDEX_32I;
+    case HIPSPARSE_INDEX_64I:
+        return CUSPARSE_INDEX_64I;
+    default:
+        throw "Non existant hipsparseIndexType_t";
+    }
 }
 
-hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
-                                    int                  m,
-                                    int                  n,
-                                    int                  nnz,
-                                    const double*        csrSortedVal,
-                                    const int*           csrSortedRowPtr,
-                                    const int*           csrSortedColInd,
-                                    double*              cscSortedVal,
-                                    int*                 cscSortedRowInd,
-                                    int*                 cscSortedColPtr,
-                                    hipsparseAction_t    copyValues,
-                                    hipsparseIndexBase_t idxBase)
+hipsparseIndexType_t CudaIndexTypeToHIPIndexType(cusparseIndexType_t type)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2csc((cusparseHandle_t)handle,
-                                                         m,
-                                                         n,
-                                                         nnz,
-                                                         csrSortedVal,
-                                                         csrSortedRowPtr,
-                                                         csrSortedColInd,
-                                                         cscSortedVal,
-                                                         cscSortedRowInd,
-                                                         cscSortedColPtr,
-                                                         hipActionToCudaAction(copyValues),
-                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+    switch(type)
+    {
+    case CUSPARSE_INDEX_16U:
+        return HIPSPARSE_INDEX_16U;
+    case CUSPARSE_INDEX_32I:
+        return HIPSPARSE_INDEX_32I;
+    case CUSPARSE_INDEX_64I:
+        return HIPSPARSE_INDEX_64I;
+    default:
+        throw "Non existant cusparseIndexType_t";
+    }
 }
+#endif
 
-hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
-                                    int                  m,
-                                    int                  n,
-                                    int                  nnz,
-                                    const hipComplex*    csrSortedVal,
-                                    const int*           csrSortedRowPtr,
-                                    const int*           csrSortedColInd,
-                                    hipComplex*          cscSortedVal,
-                                    int*                 cscSortedRowInd,
-                                    int*                 cscSortedColPtr,
-                                    hipsparseAction_t    copyValues,
-                                    hipsparseIndexBase_t idxBase)
+#if(CUDART_VERSION >= 11021)
+cusparseSpMVAlg_t hipSpMVAlgToCudaSpMVAlg(hipsparseSpMVAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2csc((cusparseHandle_t)handle,
-                                                         m,
-                                                         n,
-                                                         nnz,
-                                                         (const cuComplex*)csrSortedVal,
-                                                         csrSortedRowPtr,
-                                                         csrSortedColInd,
-                                                         (cuComplex*)cscSortedVal,
-                                                         cscSortedRowInd,
-                                                         cscSortedColPtr,
-                                                         hipActionToCudaAction(copyValues),
-                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+    switch(alg)
+    {
+    case HIPSPARSE_MV_ALG_DEFAULT:
+        return CUSPARSE_MV_ALG_DEFAULT;
+    case HIPSPARSE_SPMV_ALG_DEFAULT:
+        return CUSPARSE_SPMV_ALG_DEFAULT;
+    case HIPSPARSE_COOMV_ALG:
+        return CUSPARSE_COOMV_ALG;
+    case HIPSPARSE_SPMV_COO_ALG1:
+        return CUSPARSE_SPMV_COO_ALG1;
+    case HIPSPARSE_SPMV_COO_ALG2:
+        return CUSPARSE_SPMV_COO_ALG2;
+    case HIPSPARSE_CSRMV_ALG1:
+        return CUSPARSE_CSRMV_ALG1;
+    case HIPSPARSE_SPMV_CSR_ALG1:
+        return CUSPARSE_SPMV_CSR_ALG1;
+    case HIPSPARSE_CSRMV_ALG2:
+        return CUSPARSE_CSRMV_ALG2;
+    case HIPSPARSE_SPMV_CSR_ALG2:
+        return CUSPARSE_SPMV_CSR_ALG2;
+    default:
+        throw "Non existant hipsparseSpMVAlg_t";
+    }
 }
-
-hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
-                                    int                     m,
-                                    int                     n,
-                                    int                     nnz,
-                                    const hipDoubleComplex* csrSortedVal,
-                                    const int*              csrSortedRowPtr,
-                                    const int*              csrSortedColInd,
-                                    hipDoubleComplex*       cscSortedVal,
-                                    int*                    cscSortedRowInd,
-                                    int*                    cscSortedColPtr,
-                                    hipsparseAction_t       copyValues,
-                                    hipsparseIndexBase_t    idxBase)
+#elif(CUDART_VERSION >= 10010)
+cusparseSpMVAlg_t hipSpMVAlgToCudaSpMVAlg(hipsparseSpMVAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2csc((cusparseHandle_t)handle,
-                                                         m,
-                                                         n,
-                                                         nnz,
-                                                         (const cuDoubleComplex*)csrSortedVal,
-                                                         csrSortedRowPtr,
-                                                         csrSortedColInd,
-                                                         (cuDoubleComplex*)cscSortedVal,
-                                                         cscSortedRowInd,
-                                                         cscSortedColPtr,
-                                                         hipActionToCudaAction(copyValues),
-                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+    switch(alg)
+    {
+    case HIPSPARSE_MV_ALG_DEFAULT:
+        return CUSPARSE_MV_ALG_DEFAULT;
+    case HIPSPARSE_COOMV_ALG:
+        return CUSPARSE_COOMV_ALG;
+    case HIPSPARSE_CSRMV_ALG1:
+        return CUSPARSE_CSRMV_ALG1;
+    case HIPSPARSE_CSRMV_ALG2:
+        return CUSPARSE_CSRMV_ALG2;
+    default:
+        throw "Non existant hipsparseSpMVAlg_t";
+    }
 }
 #endif
 
-#if CUDART_VERSION < 11000
-hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
-                                    int                       m,
-                                    int                       n,
-                                    const hipsparseMatDescr_t descrA,
-                                    const float*              csrSortedValA,
-                                    const int*                csrSortedRowPtrA,
-                                    const int*                csrSortedColIndA,
-                                    hipsparseHybMat_t         hybA,
-                                    int                       userEllWidth,
-                                    hipsparseHybPartition_t   partitionType)
+#if(CUDART_VERSION >= 11021)
+cusparseSpMMAlg_t hipSpMMAlgToCudaSpMMAlg(hipsparseSpMMAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseScsr2hyb((cusparseHandle_t)handle,
-                         m,
-                         n,
-                         (const cusparseMatDescr_t)descrA,
-                         csrSortedValA,
-                         csrSortedRowPtrA,
-                         csrSortedColIndA,
-                         (const cusparseHybMat_t)hybA,
-                         userEllWidth,
-                         hipHybPartitionToCudaHybPartition(partitionType)));
+    switch(alg)
+    {
+    case HIPSPARSE_MM_ALG_DEFAULT:
+        return CUSPARSE_MM_ALG_DEFAULT;
+    case HIPSPARSE_COOMM_ALG1:
+        return CUSPARSE_COOMM_ALG1;
+    case HIPSPARSE_COOMM_ALG2:
+        return CUSPARSE_COOMM_ALG2;
+    case HIPSPARSE_COOMM_ALG3:
+        return CUSPARSE_COOMM_ALG3;
+    case HIPSPARSE_CSRMM_ALG1:
+        return CUSPARSE_CSRMM_ALG1;
+    case HIPSPARSE_SPMM_ALG_DEFAULT:
+        return CUSPARSE_SPMM_ALG_DEFAULT;
+    case HIPSPARSE_SPMM_COO_ALG1:
+        return CUSPARSE_SPMM_COO_ALG1;
+    case HIPSPARSE_SPMM_COO_ALG2:
+        return CUSPARSE_SPMM_COO_ALG2;
+    case HIPSPARSE_SPMM_COO_ALG3:
+        return CUSPARSE_SPMM_COO_ALG3;
+    case HIPSPARSE_SPMM_COO_ALG4:
+        return CUSPARSE_SPMM_COO_ALG4;
+    case HIPSPARSE_SPMM_CSR_ALG1:
+        return CUSPARSE_SPMM_CSR_ALG1;
+    case HIPSPARSE_SPMM_CSR_ALG2:
+        return CUSPARSE_SPMM_CSR_ALG2;
+    case HIPSPARSE_SPMM_CSR_ALG3:
+        return CUSPARSE_SPMM_CSR_ALG3;
+    case HIPSPARSE_SPMM_BLOCKED_ELL_ALG1:
+        return CUSPARSE_SPMM_BLOCKED_ELL_ALG1;
+    default:
+        throw "Non existant hipsparseSpMMAlg_t";
+    }
 }
-
-hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
-                                    int                       m,
-                                    int                       n,
-                                    const hipsparseMatDescr_t descrA,
-                                    const double*             csrSortedValA,
-                                    const int*                csrSortedRowPtrA,
-                                    const int*                csrSortedColIndA,
-                                    hipsparseHybMat_t         hybA,
-                                    int                       userEllWidth,
-                                    hipsparseHybPartition_t   partitionType)
+#elif(CUDART_VERSION >= 11003)
+cusparseSpMMAlg_t hipSpMMAlgToCudaSpMMAlg(hipsparseSpMMAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDcsr2hyb((cusparseHandle_t)handle,
-                         m,
-                         n,
-                         (const cusparseMatDescr_t)descrA,
-                         csrSortedValA,
-                         csrSortedRowPtrA,
-                         csrSortedColIndA,
-                         (const cusparseHybMat_t)hybA,
-                         userEllWidth,
-                         hipHybPartitionToCudaHybPartition(partitionType)));
+    switch(alg)
+    {
+    case HIPSPARSE_MM_ALG_DEFAULT:
+        return CUSPARSE_MM_ALG_DEFAULT;
+    case HIPSPARSE_COOMM_ALG1:
+        return CUSPARSE_COOMM_ALG1;
+    case HIPSPARSE_COOMM_ALG2:
+        return CUSPARSE_COOMM_ALG2;
+    case HIPSPARSE_COOMM_ALG3:
+        return CUSPARSE_COOMM_ALG3;
+    case HIPSPARSE_CSRMM_ALG1:
+        return CUSPARSE_CSRMM_ALG1;
+    case HIPSPARSE_SPMM_ALG_DEFAULT:
+        return CUSPARSE_SPMM_ALG_DEFAULT;
+    case HIPSPARSE_SPMM_COO_ALG1:
+        return CUSPARSE_SPMM_COO_ALG1;
+    case HIPSPARSE_SPMM_COO_ALG2:
+        return CUSPARSE_SPMM_COO_ALG2;
+    case HIPSPARSE_SPMM_COO_ALG3:
+        return CUSPARSE_SPMM_COO_ALG3;
+    case HIPSPARSE_SPMM_COO_ALG4:
+        return CUSPARSE_SPMM_COO_ALG4;
+    case HIPSPARSE_SPMM_CSR_ALG1:
+        return CUSPARSE_SPMM_CSR_ALG1;
+    case HIPSPARSE_SPMM_CSR_ALG2:
+        return CUSPARSE_SPMM_CSR_ALG2;
+    case HIPSPARSE_SPMM_BLOCKED_ELL_ALG1:
+        return CUSPARSE_SPMM_BLOCKED_ELL_ALG1;
+    default:
+        throw "Non existant hipsparseSpMMAlg_t";
+    }
 }
-
-hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
-                                    int                       m,
-                                    int                       n,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipComplex*         csrSortedValA,
-                                    const int*                csrSortedRowPtrA,
-                                    const int*                csrSortedColIndA,
-                                    hipsparseHybMat_t         hybA,
-                                    int                       userEllWidth,
-                                    hipsparseHybPartition_t   partitionType)
+#elif(CUDART_VERSION >= 10010)
+cusparseSpMMAlg_t hipSpMMAlgToCudaSpMMAlg(hipsparseSpMMAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseCcsr2hyb((cusparseHandle_t)handle,
-                         m,
-                         n,
-                         (const cusparseMatDescr_t)descrA,
-                         (const cuComplex*)csrSortedValA,
-                         csrSortedRowPtrA,
-                         csrSortedColIndA,
-                         (const cusparseHybMat_t)hybA,
-                         userEllWidth,
-                         hipHybPartitionToCudaHybPartition(partitionType)));
+    switch(alg)
+    {
+    case HIPSPARSE_MM_ALG_DEFAULT:
+        return CUSPARSE_MM_ALG_DEFAULT;
+    case HIPSPARSE_COOMM_ALG1:
+        return CUSPARSE_COOMM_ALG1;
+    case HIPSPARSE_COOMM_ALG2:
+        return CUSPARSE_COOMM_ALG2;
+    case HIPSPARSE_COOMM_ALG3:
+        return CUSPARSE_COOMM_ALG3;
+    case HIPSPARSE_CSRMM_ALG1:
+        return CUSPARSE_CSRMM_ALG1;
+    default:
+        throw "Non existant hipsparseSpMMAlg_t";
+    }
 }
+#endif
 
-hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
-                                    int                       m,
-                                    int                       n,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipDoubleComplex*   csrSortedValA,
-                                    const int*                csrSortedRowPtrA,
-                                    const int*                csrSortedColIndA,
-                                    hipsparseHybMat_t         hybA,
-                                    int                       userEllWidth,
-                                    hipsparseHybPartition_t   partitionType)
+#if(CUDART_VERSION >= 11031)
+cusparseSpGEMMAlg_t hipSpGEMMAlgToCudaSpGEMMAlg(hipsparseSpGEMMAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseZcsr2hyb((cusparseHandle_t)handle,
-                         m,
-                         n,
-                         (const cusparseMatDescr_t)descrA,
-                         (const cuDoubleComplex*)csrSortedValA,
-                         csrSortedRowPtrA,
-                         csrSortedColIndA,
-                         (const cusparseHybMat_t)hybA,
-                         userEllWidth,
-                         hipHybPartitionToCudaHybPartition(partitionType)));
+    switch(alg)
+    {
+    case HIPSPARSE_SPGEMM_DEFAULT:
+        return CUSPARSE_SPGEMM_DEFAULT;
+    case HIPSPARSE_SPGEMM_CSR_ALG_NONDETERMINISTIC:
+        return CUSPARSE_SPGEMM_CSR_ALG_NONDETERMINITIC;
+    case HIPSPARSE_SPGEMM_CSR_ALG_DETERMINISTIC:
+        return CUSPARSE_SPGEMM_CSR_ALG_NONDETERMINITIC;
+    default:
+        throw "Non existant cusparseSpGEMMAlg_t";
+    }
+}
+#elif(CUDART_VERSION >= 11000)
+cusparseSpGEMMAlg_t hipSpGEMMAlgToCudaSpGEMMAlg(hipsparseSpGEMMAlg_t alg)
+{
+    switch(alg)
+    {
+    case HIPSPARSE_SPGEMM_DEFAULT:
+        return CUSPARSE_SPGEMM_DEFAULT;
+    default:
+        throw "Non existant cusparseSpGEMMAlg_t";
+    }
 }
 #endif
 
-hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
-                                    hipsparseDirection_t      dirA,
-                                    int                       m,
-                                    int                       n,
-                                    const hipsparseMatDescr_t descrA,
-                                    const float*              csrValA,
-                                    const int*                csrRowPtrA,
-                                    const int*                csrColIndA,
-                                    int                       blockDim,
-                                    const hipsparseMatDescr_t descrC,
-                                    float*                    bsrValC,
-                                    int*                      bsrRowPtrC,
-                                    int*                      bsrColIndC)
+#if(CUDART_VERSION >= 11020)
+cusparseSparseToDenseAlg_t hipSpToDnAlgToCudaSpToDnAlg(hipsparseSparseToDenseAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2bsr((cusparseHandle_t)handle,
-                                                         hipDirectionToCudaDirection(dirA),
-                                                         m,
-                                                         n,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         csrValA,
-                                                         csrRowPtrA,
-                                                         csrColIndA,
-                                                         blockDim,
-                                                         (const cusparseMatDescr_t)descrC,
-                                                         bsrValC,
-                                                         bsrRowPtrC,
-                                                         bsrColIndC));
+    switch(alg)
+    {
+    case HIPSPARSE_SPARSETODENSE_ALG_DEFAULT:
+        return CUSPARSE_SPARSETODENSE_ALG_DEFAULT;
+    default:
+        throw "Non existent hipsparseSparseToDenseAlg_t";
+    }
 }
 
-hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
-                                    hipsparseDirection_t      dirA,
-                                    int                       m,
-                                    int                       n,
-                                    const hipsparseMatDescr_t descrA,
-                                    const double*             csrValA,
-                                    const int*                csrRowPtrA,
-                                    const int*                csrColIndA,
-                                    int                       blockDim,
-                                    const hipsparseMatDescr_t descrC,
-                                    double*                   bsrValC,
-                                    int*                      bsrRowPtrC,
-                                    int*                      bsrColIndC)
+hipsparseSparseToDenseAlg_t CudaSpToDnAlgToHipSpToDnAlg(cusparseSparseToDenseAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2bsr((cusparseHandle_t)handle,
-                                                         hipDirectionToCudaDirection(dirA),
-                                                         m,
-                                                         n,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         csrValA,
-                                                         csrRowPtrA,
-                                                         csrColIndA,
-                                                         blockDim,
-                                                         (const cusparseMatDescr_t)descrC,
-                                                         bsrValC,
-                                                         bsrRowPtrC,
-                                                         bsrColIndC));
+    switch(alg)
+    {
+    case CUSPARSE_SPARSETODENSE_ALG_DEFAULT:
+        return HIPSPARSE_SPARSETODENSE_ALG_DEFAULT;
+    default:
+        throw "Non existent cusparseSparseToDenseAlg_t";
+    }
 }
+#endif
 
-hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
-                                    hipsparseDirection_t      dirA,
-                                    int                       m,
-                                    int                       n,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipComplex*         csrValA,
-                                    const int*                csrRowPtrA,
-                                    const int*                csrColIndA,
-                                    int                       blockDim,
-                                    const hipsparseMatDescr_t descrC,
-                                    hipComplex*               bsrValC,
-                                    int*                      bsrRowPtrC,
-                                    int*                      bsrColIndC)
+#if(CUDART_VERSION >= 11020)
+cusparseDenseToSparseAlg_t hipDnToSpAlgToCudaDnToSpAlg(hipsparseDenseToSparseAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2bsr((cusparseHandle_t)handle,
-                                                         hipDirectionToCudaDirection(dirA),
-                                                         m,
-                                                         n,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         (const cuComplex*)csrValA,
-                                                         csrRowPtrA,
-                                                         csrColIndA,
-                                                         blockDim,
-                                                         (const cusparseMatDescr_t)descrC,
-                                                         (cuComplex*)bsrValC,
-                                                         bsrRowPtrC,
-                                                         bsrColIndC));
+    switch(alg)
+    {
+    case HIPSPARSE_DENSETOSPARSE_ALG_DEFAULT:
+        return CUSPARSE_DENSETOSPARSE_ALG_DEFAULT;
+    default:
+        throw "Non existent hipsparseDenseToSparseAlg_t";
+    }
 }
 
-hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
-                                    hipsparseDirection_t      dirA,
-                                    int                       m,
-                                    int                       n,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipDoubleComplex*   csrValA,
-                                    const int*                csrRowPtrA,
-                                    const int*                csrColIndA,
-                                    int                       blockDim,
-                                    const hipsparseMatDescr_t descrC,
-                                    hipDoubleComplex*         bsrValC,
-                                    int*                      bsrRowPtrC,
-                                    int*                      bsrColIndC)
+hipsparseDenseToSparseAlg_t CudaDnToSpAlgToHipDnToSpAlg(cusparseDenseToSparseAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2bsr((cusparseHandle_t)handle,
-                                                         hipDirectionToCudaDirection(dirA),
-                                                         m,
-                                                         n,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         (const cuDoubleComplex*)csrValA,
-                                                         csrRowPtrA,
-                                                         csrColIndA,
-                                                         blockDim,
-                                                         (const cusparseMatDescr_t)descrC,
-                                                         (cuDoubleComplex*)bsrValC,
-                                                         bsrRowPtrC,
-                                                         bsrColIndC));
+    switch(alg)
+    {
+    case CUSPARSE_DENSETOSPARSE_ALG_DEFAULT:
+        return HIPSPARSE_DENSETOSPARSE_ALG_DEFAULT;
+    default:
+        throw "Non existent cusparseDenseToSparseAlg_t";
+    }
 }
+#endif
 
-hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
-                                    hipsparseDirection_t      dirA,
-                                    int                       mb,
-                                    int                       nb,
-                                    const hipsparseMatDescr_t descrA,
-                                    const float*              bsrValA,
-                                    const int*                bsrRowPtrA,
-                                    const int*                bsrColIndA,
-                                    int                       blockDim,
-                                    const hipsparseMatDescr_t descrC,
-                                    float*                    csrValC,
-                                    int*                      csrRowPtrC,
-                                    int*                      csrColIndC)
+#if(CUDART_VERSION >= 11022)
+cusparseSDDMMAlg_t hipSDDMMAlgToCudaSDDMMAlg(hipsparseSDDMMAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSbsr2csr((cusparseHandle_t)handle,
-                                                         hipDirectionToCudaDirection(dirA),
-                                                         mb,
-                                                         nb,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         bsrValA,
-                                                         bsrRowPtrA,
-                                                         bsrColIndA,
-                                                         blockDim,
-                                                         (const cusparseMatDescr_t)descrC,
-                                                         csrValC,
-                                                         csrRowPtrC,
-                                                         csrColIndC));
+    switch(alg)
+    {
+    case HIPSPARSE_SDDMM_ALG_DEFAULT:
+        return CUSPARSE_SDDMM_ALG_DEFAULT;
+    default:
+        throw "Non existant cusparseSDDMMAlg_t";
+    }
 }
+#endif
 
-hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
-                                    hipsparseDirection_t      dirA,
-                                    int                       mb,
-                                    int                       nb,
-                                    const hipsparseMatDescr_t descrA,
-                                    const double*             bsrValA,
-                                    const int*                bsrRowPtrA,
-                                    const int*                bsrColIndA,
-                                    int                       blockDim,
-                                    const hipsparseMatDescr_t descrC,
-                                    double*                   csrValC,
-                                    int*                      csrRowPtrC,
-                                    int*                      csrColIndC)
+#if(CUDART_VERSION >= 11030)
+cusparseSpSVAlg_t hipSpSVAlgToCudaSpSVAlg(hipsparseSpSVAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDbsr2csr((cusparseHandle_t)handle,
-                                                         hipDirectionToCudaDirection(dirA),
-                                                         mb,
-                                                         nb,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         bsrValA,
-                                                         bsrRowPtrA,
-                                                         bsrColIndA,
-                                                         blockDim,
-                                                         (const cusparseMatDescr_t)descrC,
-                                                         csrValC,
-                                                         csrRowPtrC,
-                                                         csrColIndC));
+    switch(alg)
+    {
+    case HIPSPARSE_SPSV_ALG_DEFAULT:
+        return CUSPARSE_SPSV_ALG_DEFAULT;
+    default:
+        throw "Non existant cusparseSpSVAlg_t";
+    }
 }
+#endif
 
-hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
-                                    hipsparseDirection_t      dirA,
-                                    int                       mb,
-                                    int                       nb,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipComplex*         bsrValA,
-                                    const int*                bsrRowPtrA,
-                                    const int*                bsrColIndA,
-                                    int                       blockDim,
-                                    const hipsparseMatDescr_t descrC,
-                                    hipComplex*               csrValC,
-                                    int*                      csrRowPtrC,
-                                    int*                      csrColIndC)
+#if(CUDART_VERSION >= 11031)
+cusparseSpSMAlg_t hipSpSMAlgToCudaSpSMAlg(hipsparseSpSMAlg_t alg)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCbsr2csr((cusparseHandle_t)handle,
-                                                         hipDirectionToCudaDirection(dirA),
-                                                         mb,
-                                                         nb,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         (const cuComplex*)bsrValA,
-                                                         bsrRowPtrA,
-                                                         bsrColIndA,
-                                                         blockDim,
-                                                         (const cusparseMatDescr_t)descrC,
-                                                         (cuComplex*)csrValC,
-                                                         csrRowPtrC,
-                                                         csrColIndC));
+    switch(alg)
+    {
+    case HIPSPARSE_SPSM_ALG_DEFAULT:
+        return CUSPARSE_SPSM_ALG_DEFAULT;
+    default:
+        throw "Non existant cusparseSpSMAlg_t";
+    }
+}
+#endif
+
+#if(CUDART_VERSION >= 11031)
+// Transposed copies of CSR matrices, enabled per matrix by HIPSPARSE_SPMAT_TRANSPOSE_CACHE.
+// Transposed SpMV / SpMM calls multiply with the non transposed copy instead, which replaces
+// the atomic scatter of the transposed kernels by a row wise gather.
+struct hipsparseSpMatTransposeCache
+{
+    size_t                budget      = 0;
+    size_t                size        = 0;
+    bool                  valid       = false;
+    void*                 buffer      = nullptr;
+    int*                  csc_col_ptr = nullptr;
+    int*                  csc_row_ind = nullptr;
+    void*                 csc_val     = nullptr;
+    hipsparseSpMatDescr_t matT        = nullptr;
+};
+
+struct hipsparseSpMatTransposeCacheRegistry
+{
+    std::mutex                                                    mutex;
+    std::map<hipsparseSpMatDescr_t, hipsparseSpMatTransposeCache> caches;
+};
+
+static hipsparseSpMatTransposeCacheRegistry& hipsparseGetTransposeCacheRegistry()
+{
+    static hipsparseSpMatTransposeCacheRegistry registry;
+    return registry;
 }
 
-hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
-                                    hipsparseDirection_t      dirA,
-                                    int                       mb,
-                                    int                       nb,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipDoubleComplex*   bsrValA,
-                                    const int*                bsrRowPtrA,
-                                    const int*                bsrColIndA,
-                                    int                       blockDim,
-                                    const hipsparseMatDescr_t descrC,
-                                    hipDoubleComplex*         csrValC,
-                                    int*                      csrRowPtrC,
-                                    int*                      csrColIndC)
+static size_t hipsparseDataTypeSize(hipDataType type);
+
+// Releases the transposed copy, the registry has to be locked by the caller
+static hipsparseStatus_t hipsparseTransposeCacheRelease(hipsparseSpMatTransposeCache& cache)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZbsr2csr((cusparseHandle_t)handle,
-                                                         hipDirectionToCudaDirection(dirA),
-                                                         mb,
-                                                         nb,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         (const cuDoubleComplex*)bsrValA,
-                                                         bsrRowPtrA,
-                                                         bsrColIndA,
-                                                         blockDim,
-                                                         (const cusparseMatDescr_t)descrC,
-                                                         (cuDoubleComplex*)csrValC,
-                                                         csrRowPtrC,
-                                                         csrColIndC));
+    if(cache.matT != nullptr)
+    {
+        RETURN_IF_CUSPARSE_ERROR(cusparseDestroySpMat((cusparseSpMatDescr_t)cache.matT));
+        cache.matT = nullptr;
+    }
+
+    if(cache.buffer != nullptr)
+    {
+        RETURN_IF_CUDA_ERROR(cudaFree(cache.buffer));
+        cache.buffer = nullptr;
+    }
+
+    cache.size  = 0;
+    cache.valid = false;
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
-                                      hipsparseDirection_t      dirA,
-                                      int                       mb,
-                                      int                       nb,
-                                      const hipsparseMatDescr_t descrA,
-                                      const float*              bsrValA,
-                                      const int*                bsrRowPtrA,
-                                      const int*                bsrColIndA,
-                                      int                       rowBlockDim,
-                                      int                       colBlockDim,
-                                      const hipsparseMatDescr_t descrC,
-                                      float*                    csrValC,
-                                      int*                      csrRowPtrC,
-                                      int*                      csrColIndC)
+static hipsparseStatus_t hipsparseTransposeCacheSetBudget(hipsparseSpMatDescr_t matA,
+                                                          size_t                budget)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSgebsr2csr((cusparseHandle_t)handle,
-                                                           hipDirectionToCudaDirection(dirA),
-                                                           mb,
-                                                           nb,
-                                                           (const cusparseMatDescr_t)descrA,
-                                                           bsrValA,
-                                                           bsrRowPtrA,
-                                                           bsrColIndA,
-                                                           rowBlockDim,
-                                                           colBlockDim,
-                                                           (const cusparseMatDescr_t)descrC,
-                                                           csrValC,
-                                                           csrRowPtrC,
-                                                           csrColIndC));
+    hipsparseSpMatTransposeCacheRegistry& registry = hipsparseGetTransposeCacheRegistry();
+    std::lock_guard<std::mutex>           lock(registry.mutex);
+
+    auto it = registry.caches.find(matA);
+
+    // A zero budget disables the cache
+    if(budget == 0)
+    {
+        if(it == registry.caches.end())
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        hipsparseStatus_t status = hipsparseTransposeCacheRelease(it->second);
+        registry.caches.erase(it);
+
+        return status;
+    }
+
+    hipsparseSpMatTransposeCache& cache = registry.caches[matA];
+
+    cache.budget = budget;
+    cache.valid  = false;
+
+    // Drop a transposed copy that exceeds the new budget
+    if(cache.size > budget)
+    {
+        return hipsparseTransposeCacheRelease(cache);
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
-                                      hipsparseDirection_t      dirA,
-                                      int                       mb,
-                                      int                       nb,
-                                      const hipsparseMatDescr_t descrA,
-                                      const double*             bsrValA,
-                                      const int*                bsrRowPtrA,
-                                      const int*                bsrColIndA,
-                                      int                       rowBlockDim,
-                                      int                       colBlockDim,
-                                      const hipsparseMatDescr_t descrC,
-                                      double*                   csrValC,
-                                      int*                      csrRowPtrC,
-                                      int*                      csrColIndC)
+static size_t hipsparseTransposeCacheGetBudget(hipsparseSpMatDescr_t matA)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDgebsr2csr((cusparseHandle_t)handle,
-                                                           hipDirectionToCudaDirection(dirA),
-                                                           mb,
-                                                           nb,
-                                                           (const cusparseMatDescr_t)descrA,
-                                                           bsrValA,
-                                                           bsrRowPtrA,
-                                                           bsrColIndA,
-                                                           rowBlockDim,
-                                                           colBlockDim,
-                                                           (const cusparseMatDescr_t)descrC,
-                                                           csrValC,
-                                                           csrRowPtrC,
-                                                           csrColIndC));
+    hipsparseSpMatTransposeCacheRegistry& registry = hipsparseGetTransposeCacheRegistry();
+    std::lock_guard<std::mutex>           lock(registry.mutex);
+
+    auto it = registry.caches.find(matA);
+
+    return (it != registry.caches.end()) ? it->second.budget : 0;
 }
 
-hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
-                                      hipsparseDirection_t      dirA,
-                                      int                       mb,
-                                      int                       nb,
-                                      const hipsparseMatDescr_t descrA,
-                                      const hipComplex*         bsrValA,
-                                      const int*                bsrRowPtrA,
-                                      const int*                bsrColIndA,
-                                      int                       rowBlockDim,
-                                      int                       colBlockDim,
-                                      const hipsparseMatDescr_t descrC,
-                                      hipComplex*               csrValC,
-                                      int*                      csrRowPtrC,
-                                      int*                      csrColIndC)
+// Marks the transposed copy as stale, such that it is refreshed by the next transposed product
+static void hipsparseTransposeCacheInvalidate(hipsparseSpMatDescr_t matA)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCgebsr2csr((cusparseHandle_t)handle,
-                                                           hipDirectionToCudaDirection(dirA),
-                                                           mb,
-                                                           nb,
-                                                           (const cusparseMatDescr_t)descrA,
-                                                           (const cuComplex*)bsrValA,
-                                                           bsrRowPtrA,
-                                                           bsrColIndA,
-                                                           rowBlockDim,
-                                                           colBlockDim,
-                                                           (const cusparseMatDescr_t)descrC,
-                                                           (cuComplex*)csrValC,
-                                                           csrRowPtrC,
-                                                           csrColIndC));
+    hipsparseSpMatTransposeCacheRegistry& registry = hipsparseGetTransposeCacheRegistry();
+    std::lock_guard<std::mutex>           lock(registry.mutex);
+
+    auto it = registry.caches.find(matA);
+
+    if(it != registry.caches.end())
+    {
+        it->second.valid = false;
+    }
 }
 
-hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
-                                      hipsparseDirection_t      dirA,
-                                      int                       mb,
-                                      int                       nb,
-                                      const hipsparseMatDescr_t descrA,
-                                      const hipDoubleComplex*   bsrValA,
-                                      const int*                bsrRowPtrA,
-                                      const int*                bsrColIndA,
-                                      int                       rowBlockDim,
-                                      int                       colBlockDim,
-                                      const hipsparseMatDescr_t descrC,
-                                      hipDoubleComplex*         csrValC,
-                                      int*                      csrRowPtrC,
-                                      int*                      csrColIndC)
+// Releases the transposed copy after a change of the sparsity pattern, such that the next
+// transposed product rebuilds it, together with the analysis of its products
+static hipsparseStatus_t hipsparseTransposeCacheReset(hipsparseSpMatDescr_t matA)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZgebsr2csr((cusparseHandle_t)handle,
-                                                           hipDirectionToCudaDirection(dirA),
-                                                           mb,
-                                                           nb,
-                                                           (const cusparseMatDescr_t)descrA,
-                                                           (const cuDoubleComplex*)bsrValA,
-                                                           bsrRowPtrA,
-                                                           bsrColIndA,
-                                                           rowBlockDim,
-                                                           colBlockDim,
-                                                           (const cusparseMatDescr_t)descrC,
-                                                           (cuDoubleComplex*)csrValC,
-                                                           csrRowPtrC,
-                                                           csrColIndC));
+    hipsparseSpMatTransposeCacheRegistry& registry = hipsparseGetTransposeCacheRegistry();
+    std::lock_guard<std::mutex>           lock(registry.mutex);
+
+    auto it = registry.caches.find(matA);
+
+    if(it == registry.caches.end())
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    return hipsparseTransposeCacheRelease(it->second);
 }
 
-hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
-                                             int                       m,
-                                             int                       n,
-                                             const hipsparseMatDescr_t descrA,
-                                             const float*              csrValA,
-                                             const int*                csrColIndA,
-                                             const int*                csrRowPtrA,
-                                             int                       nnzA,
-                                             const int*                nnzPerRow,
-                                             float*                    csrValC,
-                                             int*                      csrColIndC,
-                                             int*                      csrRowPtrC,
-                                             float                     tol)
+static hipsparseStatus_t hipsparseTransposeCacheDestroy(hipsparseSpMatDescr_t matA)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2csr_compress((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  (const cusparseMatDescr_t)descrA,
-                                                                  csrValA,
-                                                                  csrColIndA,
-                                                                  csrRowPtrA,
-                                                                  nnzA,
-                                                                  nnzPerRow,
-                                                                  csrValC,
-                                                                  csrColIndC,
-                                                                  csrRowPtrC,
-                                                                  tol));
+    hipsparseSpMatTransposeCacheRegistry& registry = hipsparseGetTransposeCacheRegistry();
+    std::lock_guard<std::mutex>           lock(registry.mutex);
+
+    auto it = registry.caches.find(matA);
+
+    if(it == registry.caches.end())
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseStatus_t status = hipsparseTransposeCacheRelease(it->second);
+    registry.caches.erase(it);
+
+    return status;
+}
+
+// Transposes the CSR matrix into the cached copy
+static hipsparseStatus_t hipsparseTransposeCacheFill(hipsparseHandle_t    handle,
+                                                     hipDataType          type,
+                                                     int                  m,
+                                                     int                  n,
+                                                     int                  nnz,
+                                                     const void*          csr_val,
+                                                     const int*           csr_row_ptr,
+                                                     const int*           csr_col_ind,
+                                                     void*                csc_val,
+                                                     int*                 csc_row_ind,
+                                                     int*                 csc_col_ptr,
+                                                     hipsparseIndexBase_t base)
+{
+    size_t buffer_size;
+    RETURN_IF_CUSPARSE_ERROR(cusparseCsr2cscEx2_bufferSize((cusparseHandle_t)handle,
+                                                           m,
+                                                           n,
+                                                           nnz,
+                                                           csr_val,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           csc_val,
+                                                           csc_col_ptr,
+                                                           csc_row_ind,
+                                                           hipDataTypeToCudaDataType(type),
+                                                           CUSPARSE_ACTION_NUMERIC,
+                                                           hipIndexBaseToCudaIndexBase(base),
+                                                           CUSPARSE_CSR2CSC_ALG1,
+                                                           &buffer_size));
+
+    void* buffer;
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&buffer, buffer_size));
+
+    cusparseStatus_t status = cusparseCsr2cscEx2((cusparseHandle_t)handle,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 csc_val,
+                                                 csc_col_ptr,
+                                                 csc_row_ind,
+                                                 hipDataTypeToCudaDataType(type),
+                                                 CUSPARSE_ACTION_NUMERIC,
+                                                 hipIndexBaseToCudaIndexBase(base),
+                                                 CUSPARSE_CSR2CSC_ALG1,
+                                                 buffer);
+
+    // cudaFree synchronizes with the conversion
+    RETURN_IF_CUDA_ERROR(cudaFree(buffer));
+
+    return hipCUSPARSEStatusToHIPStatus(status);
+}
+
+// Replaces a transposed product with matA by the non transposed product with the cached
+// transpose of matA. The transposed copy is built if build is set, i.e. by the buffer size and
+// preprocess stages, such that the external buffer is sized for the product actually computed.
+// Stale values are refreshed by every stage.
+static hipsparseStatus_t hipsparseTransposeCacheApply(hipsparseHandle_t      handle,
+                                                      bool                   build,
+                                                      hipsparseOperation_t*  op,
+                                                      hipsparseSpMatDescr_t* mat)
+{
+    if(*op == HIPSPARSE_OPERATION_NON_TRANSPOSE || *mat == nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseSpMatTransposeCacheRegistry& registry = hipsparseGetTransposeCacheRegistry();
+    std::lock_guard<std::mutex>           lock(registry.mutex);
+
+    auto it = registry.caches.find(*mat);
+
+    if(it == registry.caches.end() || (it->second.matT == nullptr && !build))
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseSpMatTransposeCache& cache = it->second;
+
+    // Only single CSR matrices with 32 bit indices are cached
+    hipsparseFormat_t format;
+    int               batch_count;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(*mat, &format));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetStridedBatch(*mat, &batch_count));
+
+    if(format != HIPSPARSE_FORMAT_CSR || batch_count > 1)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    void*                csr_row_ptr;
+    void*                csr_col_ind;
+    void*                csr_val;
+    hipsparseIndexType_t row_type;
+    hipsparseIndexType_t col_type;
+    hipsparseIndexBase_t base;
+    hipDataType          type;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(*mat,
+                                              &m,
+                                              &n,
+                                              &nnz,
+                                              &csr_row_ptr,
+                                              &csr_col_ind,
+                                              &csr_val,
+                                              &row_type,
+                                              &col_type,
+                                              &base,
+                                              &type));
+
+    bool is_complex = (type == HIP_C_32F || type == HIP_C_64F);
+
+    if(row_type != HIPSPARSE_INDEX_32I || col_type != HIPSPARSE_INDEX_32I
+       || (!is_complex && type != HIP_R_32F && type != HIP_R_64F))
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // The transposed copy does not hold conjugated values
+    if(*op == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE && is_complex)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(cache.matT == nullptr)
+    {
+        size_t ptr_size = ((sizeof(int) * (n + 1) + 255) / 256) * 256;
+        size_t ind_size = ((sizeof(int) * nnz + 255) / 256) * 256;
+        size_t val_size = hipsparseDataTypeSize(type) * nnz;
+
+        // Fall back to the transposed kernels if the copy exceeds the budget
+        if(ptr_size + ind_size + val_size > cache.budget)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        RETURN_IF_CUDA_ERROR(cudaMalloc(&cache.buffer, ptr_size + ind_size + val_size));
+
+        cache.size        = ptr_size + ind_size + val_size;
+        cache.csc_col_ptr = (int*)cache.buffer;
+        cache.csc_row_ind = (int*)((char*)cache.buffer + ptr_size);
+        cache.csc_val     = (char*)cache.buffer + ptr_size + ind_size;
+
+        hipsparseStatus_t status = hipsparseCreateCsr(&cache.matT,
+                                                      n,
+                                                      m,
+                                                      nnz,
+                                                      cache.csc_col_ptr,
+                                                      cache.csc_row_ind,
+                                                      cache.csc_val,
+                                                      HIPSPARSE_INDEX_32I,
+                                                      HIPSPARSE_INDEX_32I,
+                                                      base,
+                                                      type);
+
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            hipsparseTransposeCacheRelease(cache);
+            return status;
+        }
+    }
+
+    if(!cache.valid)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseTransposeCacheFill(handle,
+                                                              type,
+                                                              m,
+                                                              n,
+                                                              nnz,
+                                                              csr_val,
+                                                              (const int*)csr_row_ptr,
+                                                              (const int*)csr_col_ind,
+                                                              cache.csc_val,
+                                                              cache.csc_row_ind,
+                                                              cache.csc_col_ptr,
+                                                              base));
+        cache.valid = true;
+    }
+
+    *op  = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    *mat = cache.matT;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
+                                       int64_t                size,
+                                       int64_t                nnz,
+                                       void*                  indices,
+                                       void*                  values,
+                                       hipsparseIndexType_t   idxType,
+                                       hipsparseIndexBase_t   idxBase,
+                                       hipDataType            valueType)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCreateSpVec((cusparseSpVecDescr_t*)spVecDescr,
+                                                            size,
+                                                            nnz,
+                                                            indices,
+                                                            values,
+                                                            hipIndexTypeToCudaIndexType(idxType),
+                                                            hipIndexBaseToCudaIndexBase(idxBase),
+                                                            hipDataTypeToCudaDataType(valueType)));
 }
+#endif
 
-hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
-                                             int                       m,
-                                             int                       n,
-                                             const hipsparseMatDescr_t descrA,
-                                             const double*             csrValA,
-                                             const int*                csrColIndA,
-                                             const int*                csrRowPtrA,
-                                             int                       nnzA,
-                                             const int*                nnzPerRow,
-                                             double*                   csrValC,
-                                             int*                      csrColIndC,
-                                             int*                      csrRowPtrC,
-                                             double                    tol)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDestroySpVec(hipsparseSpVecDescr_t spVecDescr)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2csr_compress((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  (const cusparseMatDescr_t)descrA,
-                                                                  csrValA,
-                                                                  csrColIndA,
-                                                                  csrRowPtrA,
-                                                                  nnzA,
-                                                                  nnzPerRow,
-                                                                  csrValC,
-                                                                  csrColIndC,
-                                                                  csrRowPtrC,
-                                                                  tol));
+    return hipCUSPARSEStatusToHIPStatus(cusparseDestroySpVec((cusparseSpVecDescr_t)spVecDescr));
 }
+#endif
 
-hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
-                                             int                       m,
-                                             int                       n,
-                                             const hipsparseMatDescr_t descrA,
-                                             const hipComplex*         csrValA,
-                                             const int*                csrColIndA,
-                                             const int*                csrRowPtrA,
-                                             int                       nnzA,
-                                             const int*                nnzPerRow,
-                                             hipComplex*               csrValC,
-                                             int*                      csrColIndC,
-                                             int*                      csrRowPtrC,
-                                             hipComplex                tol)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
+                                    int64_t*                    size,
+                                    int64_t*                    nnz,
+                                    void**                      indices,
+                                    void**                      values,
+                                    hipsparseIndexType_t*       idxType,
+                                    hipsparseIndexBase_t*       idxBase,
+                                    hipDataType*                valueType)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2csr_compress((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  (const cusparseMatDescr_t)descrA,
-                                                                  (const cuComplex*)csrValA,
-                                                                  csrColIndA,
-                                                                  csrRowPtrA,
-                                                                  nnzA,
-                                                                  nnzPerRow,
-                                                                  (cuComplex*)csrValC,
-                                                                  csrColIndC,
-                                                                  csrRowPtrC,
-                                                                  {cuCrealf(tol), cuCimagf(tol)}));
+    cusparseIndexType_t cuda_index_type;
+    cusparseIndexBase_t cuda_index_base;
+    cudaDataType        cuda_data_type;
+
+    RETURN_IF_CUSPARSE_ERROR(cusparseSpVecGet((const cusparseSpVecDescr_t)spVecDescr,
+                                              size,
+                                              nnz,
+                                              indices,
+                                              values,
+                                              idxType != nullptr ? &cuda_index_type : nullptr,
+                                              idxBase != nullptr ? &cuda_index_base : nullptr,
+                                              valueType != nullptr ? &cuda_data_type : nullptr));
+
+    *idxType   = CudaIndexTypeToHIPIndexType(cuda_index_type);
+    *idxBase   = CudaIndexBaseToHIPIndexBase(cuda_index_base);
+    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
+#endif
 
-hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
-                                             int                       m,
-                                             int                       n,
-                                             const hipsparseMatDescr_t descrA,
-                                             const hipDoubleComplex*   csrValA,
-                                             const int*                csrColIndA,
-                                             const int*                csrRowPtrA,
-                                             int                       nnzA,
-                                             const int*                nnzPerRow,
-                                             hipDoubleComplex*         csrValC,
-                                             int*                      csrColIndC,
-                                             int*                      csrRowPtrC,
-                                             hipDoubleComplex          tol)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpVecGetIndexBase(const hipsparseSpVecDescr_t spVecDescr,
+                                             hipsparseIndexBase_t*       idxBase)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2csr_compress((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  (const cusparseMatDescr_t)descrA,
-                                                                  (const cuDoubleComplex*)csrValA,
-                                                                  csrColIndA,
-                                                                  csrRowPtrA,
-                                                                  nnzA,
-                                                                  nnzPerRow,
-                                                                  (cuDoubleComplex*)csrValC,
-                                                                  csrColIndC,
-                                                                  csrRowPtrC,
-                                                                  {cuCreal(tol), cuCimag(tol)}));
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpVecGetIndexBase(
+        (const cusparseSpVecDescr_t)spVecDescr, (cusparseIndexBase_t*)idxBase));
 }
+#endif
 
-hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
-                                                    int                       m,
-                                                    int                       n,
-                                                    int                       nnzA,
-                                                    const hipsparseMatDescr_t descrA,
-                                                    const float*              csrValA,
-                                                    const int*                csrRowPtrA,
-                                                    const int*                csrColIndA,
-                                                    const float*              threshold,
-                                                    const hipsparseMatDescr_t descrC,
-                                                    const float*              csrValC,
-                                                    const int*                csrRowPtrC,
-                                                    const int*                csrColIndC,
-                                                    size_t*                   bufferSize)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpVecGetValues(const hipsparseSpVecDescr_t spVecDescr, void** values)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                            m,
-                                            n,
-                                            nnzA,
-                                            (const cusparseMatDescr_t)descrA,
-                                            csrValA,
-                                            csrRowPtrA,
-                                            csrColIndA,
-                                            threshold,
-                                            (const cusparseMatDescr_t)descrC,
-                                            csrValC,
-                                            csrRowPtrC,
-                                            csrColIndC,
-                                            bufferSize));
+        cusparseSpVecGetValues((const cusparseSpVecDescr_t)spVecDescr, values));
 }
+#endif
 
-hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
-                                                    int                       m,
-                                                    int                       n,
-                                                    int                       nnzA,
-                                                    const hipsparseMatDescr_t descrA,
-                                                    const double*             csrValA,
-                                                    const int*                csrRowPtrA,
-                                                    const int*                csrColIndA,
-                                                    const double*             threshold,
-                                                    const hipsparseMatDescr_t descrC,
-                                                    const double*             csrValC,
-                                                    const int*                csrRowPtrC,
-                                                    const int*                csrColIndC,
-                                                    size_t*                   bufferSize)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpVecSetValues(hipsparseSpVecDescr_t spVecDescr, void* values)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                            m,
-                                            n,
-                                            nnzA,
-                                            (const cusparseMatDescr_t)descrA,
-                                            csrValA,
-                                            csrRowPtrA,
-                                            csrColIndA,
-                                            threshold,
-                                            (const cusparseMatDescr_t)descrC,
-                                            csrValC,
-                                            csrRowPtrC,
-                                            csrColIndC,
-                                            bufferSize));
+        cusparseSpVecSetValues((const cusparseSpVecDescr_t)spVecDescr, values));
 }
+#endif
 
-hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t         handle,
-                                                       int                       m,
-                                                       int                       n,
-                                                       int                       nnzA,
-                                                       const hipsparseMatDescr_t descrA,
-                                                       const float*              csrValA,
-                                                       const int*                csrRowPtrA,
-                                                       const int*                csrColIndA,
-                                                       const float*              threshold,
-                                                       const hipsparseMatDescr_t descrC,
-                                                       const float*              csrValC,
-                                                       const int*                csrRowPtrC,
-                                                       const int*                csrColIndC,
-                                                       size_t*                   bufferSize)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  cooRowInd,
+                                     void*                  cooColInd,
+                                     void*                  cooValues,
+                                     hipsparseIndexType_t   cooIdxType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseCreateCoo((cusparseSpMatDescr_t*)spMatDescr,
+                                                          rows,
+                                                          cols,
+                                                          nnz,
+                                                          cooRowInd,
+                                                          cooColInd,
+                                                          cooValues,
+                                                          hipIndexTypeToCudaIndexType(cooIdxType),
+                                                          hipIndexBaseToCudaIndexBase(idxBase),
+                                                          hipDataTypeToCudaDataType(valueType)));
+}
+#endif
+
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
+                                        int64_t                rows,
+                                        int64_t                cols,
+                                        int64_t                nnz,
+                                        void*                  cooInd,
+                                        void*                  cooValues,
+                                        hipsparseIndexType_t   cooIdxType,
+                                        hipsparseIndexBase_t   idxBase,
+                                        hipDataType            valueType)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateCooAoS((cusparseSpMatDescr_t*)spMatDescr,
+                             rows,
+                             cols,
+                             nnz,
+                             cooInd,
+                             cooValues,
+                             hipIndexTypeToCudaIndexType(cooIdxType),
+                             hipIndexBaseToCudaIndexBase(idxBase),
+                             hipDataTypeToCudaDataType(valueType)));
+}
+#endif
+
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  csrRowOffsets,
+                                     void*                  csrColInd,
+                                     void*                  csrValues,
+                                     hipsparseIndexType_t   csrRowOffsetsType,
+                                     hipsparseIndexType_t   csrColIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                            m,
-                                            n,
-                                            nnzA,
-                                            (const cusparseMatDescr_t)descrA,
-                                            csrValA,
-                                            csrRowPtrA,
-                                            csrColIndA,
-                                            threshold,
-                                            (const cusparseMatDescr_t)descrC,
-                                            csrValC,
-                                            csrRowPtrC,
-                                            csrColIndC,
-                                            bufferSize));
+        cusparseCreateCsr((cusparseSpMatDescr_t*)spMatDescr,
+                          rows,
+                          cols,
+                          nnz,
+                          csrRowOffsets,
+                          csrColInd,
+                          csrValues,
+                          hipIndexTypeToCudaIndexType(csrRowOffsetsType),
+                          hipIndexTypeToCudaIndexType(csrColIndType),
+                          hipIndexBaseToCudaIndexBase(idxBase),
+                          hipDataTypeToCudaDataType(valueType)));
 }
+#endif
 
-hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t         handle,
-                                                       int                       m,
-                                                       int                       n,
-                                                       int                       nnzA,
-                                                       const hipsparseMatDescr_t descrA,
-                                                       const double*             csrValA,
-                                                       const int*                csrRowPtrA,
-                                                       const int*                csrColIndA,
-                                                       const double*             threshold,
-                                                       const hipsparseMatDescr_t descrC,
-                                                       const double*             csrValC,
-                                                       const int*                csrRowPtrC,
-                                                       const int*                csrColIndC,
-                                                       size_t*                   bufferSize)
+#if(CUDART_VERSION >= 11020)
+hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  cscColOffsets,
+                                     void*                  cscRowInd,
+                                     void*                  cscValues,
+                                     hipsparseIndexType_t   cscColOffsetsType,
+                                     hipsparseIndexType_t   cscRowIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                            m,
-                                            n,
-                                            nnzA,
-                                            (const cusparseMatDescr_t)descrA,
-                                            csrValA,
-                                            csrRowPtrA,
-                                            csrColIndA,
-                                            threshold,
-                                            (const cusparseMatDescr_t)descrC,
-                                            csrValC,
-                                            csrRowPtrC,
-                                            csrColIndC,
-                                            bufferSize));
+        cusparseCreateCsc((cusparseSpMatDescr_t*)spMatDescr,
+                          rows,
+                          cols,
+                          nnz,
+                          cscColOffsets,
+                          cscRowInd,
+                          cscValues,
+                          hipIndexTypeToCudaIndexType(cscColOffsetsType),
+                          hipIndexTypeToCudaIndexType(cscRowIndType),
+                          hipIndexBaseToCudaIndexBase(idxBase),
+                          hipDataTypeToCudaDataType(valueType)));
 }
+#endif
 
-hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
-                                            int                       m,
-                                            int                       n,
-                                            int                       nnzA,
-                                            const hipsparseMatDescr_t descrA,
-                                            const float*              csrValA,
-                                            const int*                csrRowPtrA,
-                                            const int*                csrColIndA,
-                                            const float*              threshold,
-                                            const hipsparseMatDescr_t descrC,
-                                            int*                      csrRowPtrC,
-                                            int*                      nnzTotalDevHostPtr,
-                                            void*                     buffer)
+#if(CUDART_VERSION >= 11021)
+hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
+                                            int64_t                rows,
+                                            int64_t                cols,
+                                            int64_t                ellBlockSize,
+                                            int64_t                ellCols,
+                                            void*                  ellColInd,
+                                            void*                  ellValue,
+                                            hipsparseIndexType_t   ellIdxType,
+                                            hipsparseIndexBase_t   idxBase,
+                                            hipDataType            valueType)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpruneCsr2csrNnz((cusparseHandle_t)handle,
-                                                                 m,
-                                                                 n,
-                                                                 nnzA,
-                                                                 (const cusparseMatDescr_t)descrA,
-                                                                 csrValA,
-                                                                 csrRowPtrA,
-                                                                 csrColIndA,
-                                                                 threshold,
-                                                                 (const cusparseMatDescr_t)descrC,
-                                                                 csrRowPtrC,
-                                                                 nnzTotalDevHostPtr,
-                                                                 buffer));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateBlockedEll((cusparseSpMatDescr_t*)spMatDescr,
+                                 rows,
+                                 cols,
+                                 ellBlockSize,
+                                 ellCols,
+                                 ellColInd,
+                                 ellValue,
+                                 hipIndexTypeToCudaIndexType(ellIdxType),
+                                 hipIndexBaseToCudaIndexBase(idxBase),
+                                 hipDataTypeToCudaDataType(valueType)));
 }
+#endif
 
-hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
-                                            int                       m,
-                                            int                       n,
-                                            int                       nnzA,
-                                            const hipsparseMatDescr_t descrA,
-                                            const double*             csrValA,
-                                            const int*                csrRowPtrA,
-                                            const int*                csrColIndA,
-                                            const double*             threshold,
-                                            const hipsparseMatDescr_t descrC,
-                                            int*                      csrRowPtrC,
-                                            int*                      nnzTotalDevHostPtr,
-                                            void*                     buffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDestroySpMat(hipsparseSpMatDescr_t spMatDescr)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDpruneCsr2csrNnz((cusparseHandle_t)handle,
-                                                                 m,
-                                                                 n,
-                                                                 nnzA,
-                                                                 (const cusparseMatDescr_t)descrA,
-                                                                 csrValA,
-                                                                 csrRowPtrA,
-                                                                 csrColIndA,
-                                                                 threshold,
-                                                                 (const cusparseMatDescr_t)descrC,
-                                                                 csrRowPtrC,
-                                                                 nnzTotalDevHostPtr,
-                                                                 buffer));
+#if(CUDART_VERSION >= 11031)
+    // Release the cached transpose, if any
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTransposeCacheDestroy(spMatDescr));
+#endif
+
+    return hipCUSPARSEStatusToHIPStatus(cusparseDestroySpMat((cusparseSpMatDescr_t)spMatDescr));
 }
+#endif
 
-hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
-                                         int                       m,
-                                         int                       n,
-                                         int                       nnzA,
-                                         const hipsparseMatDescr_t descrA,
-                                         const float*              csrValA,
-                                         const int*                csrRowPtrA,
-                                         const int*                csrColIndA,
-                                         const float*              threshold,
-                                         const hipsparseMatDescr_t descrC,
-                                         float*                    csrValC,
-                                         const int*                csrRowPtrC,
-                                         int*                      csrColIndC,
-                                         void*                     buffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      cooRowInd,
+                                  void**                      cooColInd,
+                                  void**                      cooValues,
+                                  hipsparseIndexType_t*       idxType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpruneCsr2csr((cusparseHandle_t)handle,
-                                                              m,
-                                                              n,
-                                                              nnzA,
-                                                              (const cusparseMatDescr_t)descrA,
-                                                              csrValA,
-                                                              csrRowPtrA,
-                                                              csrColIndA,
-                                                              threshold,
-                                                              (const cusparseMatDescr_t)descrC,
-                                                              csrValC,
-                                                              csrRowPtrC,
-                                                              csrColIndC,
-                                                              buffer));
+    cusparseIndexType_t cuda_index_type;
+    cusparseIndexBase_t cuda_index_base;
+    cudaDataType        cuda_data_type;
+
+    RETURN_IF_CUSPARSE_ERROR(cusparseCooGet((const cusparseSpMatDescr_t)spMatDescr,
+                                            rows,
+                                            cols,
+                                            nnz,
+                                            cooRowInd,
+                                            cooColInd,
+                                            cooValues,
+                                            idxType != nullptr ? &cuda_index_type : nullptr,
+                                            idxBase != nullptr ? &cuda_index_base : nullptr,
+                                            valueType != nullptr ? &cuda_data_type : nullptr));
+
+    *idxType   = CudaIndexTypeToHIPIndexType(cuda_index_type);
+    *idxBase   = CudaIndexBaseToHIPIndexBase(cuda_index_base);
+    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
+#endif
 
-hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
-                                         int                       m,
-                                         int                       n,
-                                         int                       nnzA,
-                                         const hipsparseMatDescr_t descrA,
-                                         const double*             csrValA,
-                                         const int*                csrRowPtrA,
-                                         const int*                csrColIndA,
-                                         const double*             threshold,
-                                         const hipsparseMatDescr_t descrC,
-                                         double*                   csrValC,
-                                         const int*                csrRowPtrC,
-                                         int*                      csrColIndC,
-                                         void*                     buffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
+                                     int64_t*                    rows,
+                                     int64_t*                    cols,
+                                     int64_t*                    nnz,
+                                     void**                      cooInd,
+                                     void**                      cooValues,
+                                     hipsparseIndexType_t*       idxType,
+                                     hipsparseIndexBase_t*       idxBase,
+                                     hipDataType*                valueType)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDpruneCsr2csr((cusparseHandle_t)handle,
-                                                              m,
-                                                              n,
-                                                              nnzA,
-                                                              (const cusparseMatDescr_t)descrA,
-                                                              csrValA,
-                                                              csrRowPtrA,
-                                                              csrColIndA,
-                                                              threshold,
-                                                              (const cusparseMatDescr_t)descrC,
-                                                              csrValC,
-                                                              csrRowPtrC,
-                                                              csrColIndC,
-                                                              buffer));
+    cusparseIndexType_t cuda_index_type;
+    cusparseIndexBase_t cuda_index_base;
+    cudaDataType        cuda_data_type;
+
+    RETURN_IF_CUSPARSE_ERROR(cusparseCooAoSGet((const cusparseSpMatDescr_t)spMatDescr,
+                                               rows,
+                                               cols,
+                                               nnz,
+                                               cooInd,
+                                               cooValues,
+                                               idxType != nullptr ? &cuda_index_type : nullptr,
+                                               idxBase != nullptr ? &cuda_index_base : nullptr,
+                                               valueType != nullptr ? &cuda_data_type : nullptr));
+
+    *idxType   = CudaIndexTypeToHIPIndexType(cuda_index_type);
+    *idxBase   = CudaIndexBaseToHIPIndexBase(cuda_index_base);
+    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
+#endif
 
-hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
-                                                                int                       m,
-                                                                int                       n,
-                                                                int                       nnzA,
-                                                                const hipsparseMatDescr_t descrA,
-                                                                const float*              csrValA,
-                                                                const int* csrRowPtrA,
-                                                                const int* csrColIndA,
-                                                                float      percentage,
-                                                                const hipsparseMatDescr_t descrC,
-                                                                const float*              csrValC,
-                                                                const int*  csrRowPtrC,
-                                                                const int*  csrColIndC,
-                                                                pruneInfo_t info,
-                                                                size_t*     bufferSize)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      csrRowOffsets,
+                                  void**                      csrColInd,
+                                  void**                      csrValues,
+                                  hipsparseIndexType_t*       csrRowOffsetsType,
+                                  hipsparseIndexType_t*       csrColIndType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
-                                                        m,
-                                                        n,
-                                                        nnzA,
-                                                        (const cusparseMatDescr_t)descrA,
-                                                        csrValA,
-                                                        csrRowPtrA,
-                                                        csrColIndA,
-                                                        percentage,
-                                                        (const cusparseMatDescr_t)descrC,
-                                                        csrValC,
-                                                        csrRowPtrC,
-                                                        csrColIndC,
-                                                        (pruneInfo_t)info,
-                                                        bufferSize));
+    cusparseIndexType_t cuda_row_index_type;
+    cusparseIndexType_t cuda_col_index_type;
+    cusparseIndexBase_t cuda_index_base;
+    cudaDataType        cuda_data_type;
+
+    RETURN_IF_CUSPARSE_ERROR(
+        cusparseCsrGet((const cusparseSpMatDescr_t)spMatDescr,
+                       rows,
+                       cols,
+                       nnz,
+                       csrRowOffsets,
+                       csrColInd,
+                       csrValues,
+                       csrRowOffsetsType != nullptr ? &cuda_row_index_type : nullptr,
+                       csrColIndType != nullptr ? &cuda_col_index_type : nullptr,
+                       idxBase != nullptr ? &cuda_index_base : nullptr,
+                       valueType != nullptr ? &cuda_data_type : nullptr));
+
+    *csrRowOffsetsType = CudaIndexTypeToHIPIndexType(cuda_row_index_type);
+    *csrColIndType     = CudaIndexTypeToHIPIndexType(cuda_col_index_type);
+    *idxBase           = CudaIndexBaseToHIPIndexBase(cuda_index_base);
+    *valueType         = CudaDataTypeToHIPDataType(cuda_data_type);
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
+#endif
 
-hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
-                                                                int                       m,
-                                                                int                       n,
-                                                                int                       nnzA,
-                                                                const hipsparseMatDescr_t descrA,
-                                                                const double*             csrValA,
-                                                                const int* csrRowPtrA,
-                                                                const int* csrColIndA,
-                                                                double     percentage,
-                                                                const hipsparseMatDescr_t descrC,
-                                                                const double*             csrValC,
-                                                                const int*  csrRowPtrC,
-                                                                const int*  csrColIndC,
-                                                                pruneInfo_t info,
-                                                                size_t*     bufferSize)
+#if(CUDART_VERSION >= 11021)
+hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
+                                         int64_t*                    rows,
+                                         int64_t*                    cols,
+                                         int64_t*                    ellBlockSize,
+                                         int64_t*                    ellCols,
+                                         void**                      ellColInd,
+                                         void**                      ellValue,
+                                         hipsparseIndexType_t*       ellIdxType,
+                                         hipsparseIndexBase_t*       idxBase,
+                                         hipDataType*                valueType)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
-                                                        m,
-                                                        n,
-                                                        nnzA,
-                                                        (const cusparseMatDescr_t)descrA,
-                                                        csrValA,
-                                                        csrRowPtrA,
-                                                        csrColIndA,
-                                                        percentage,
-                                                        (const cusparseMatDescr_t)descrC,
-                                                        csrValC,
-                                                        csrRowPtrC,
-                                                        csrColIndC,
-                                                        (pruneInfo_t)info,
-                                                        bufferSize));
+    // As of cusparse 11.4.1, this routine does not actually exist as a symbol in the cusparse
+    // library (the documentation indicates that it should exist starting at cusparse 11.2.1).
+    // Uncomment once it has been added
+    // cusparseIndexType_t cuda_index_type;
+    // cusparseIndexBase_t cuda_index_base;
+    // cudaDataType        cuda_data_type;
+
+    // RETURN_IF_CUSPARSE_ERROR(
+    //     cusparseBlockedEllGet((cusparseSpMatDescr_t)spMatDescr,
+    //                           rows,
+    //                           cols,
+    //                           ellBlockSize,
+    //                           ellCols,
+    //                           ellColInd,
+    //                           ellValue,
+    //                           ellIdxType != nullptr ? &cuda_index_type : nullptr,
+    //                           idxBase != nullptr ? &cuda_index_base : nullptr,
+    //                           valueType != nullptr ? &cuda_data_type : nullptr));
+
+    // *ellIdxType = CudaIndexTypeToHIPIndexType(cuda_index_type);
+    // *idxBase    = CudaIndexBaseToHIPIndexBase(cuda_index_base);
+    // *valueType  = CudaDataTypeToHIPDataType(cuda_data_type);
+
+    // return HIPSPARSE_STATUS_SUCCESS;
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
 }
+#endif
 
-hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
-                                                                   int                       m,
-                                                                   int                       n,
-                                                                   int                       nnzA,
-                                                                   const hipsparseMatDescr_t descrA,
-                                                                   const float* csrValA,
-                                                                   const int*   csrRowPtrA,
-                                                                   const int*   csrColIndA,
-                                                                   float        percentage,
-                                                                   const hipsparseMatDescr_t descrC,
-                                                                   const float* csrValC,
-                                                                   const int*   csrRowPtrC,
-                                                                   const int*   csrColIndC,
-                                                                   pruneInfo_t  info,
-                                                                   size_t*      bufferSize)
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 csrRowOffsets,
+                                          void*                 csrColInd,
+                                          void*                 csrValues)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
-                                                        m,
-                                                        n,
-                                                        nnzA,
-                                                        (const cusparseMatDescr_t)descrA,
-                                                        csrValA,
-                                                        csrRowPtrA,
-                                                        csrColIndA,
-                                                        percentage,
-                                                        (const cusparseMatDescr_t)descrC,
-                                                        csrValC,
-                                                        csrRowPtrC,
-                                                        csrColIndC,
-                                                        (pruneInfo_t)info,
-                                                        bufferSize));
+#if(CUDART_VERSION >= 11031)
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTransposeCacheReset(spMatDescr));
+#endif
+
+    return hipCUSPARSEStatusToHIPStatus(cusparseCsrSetPointers(
+        (cusparseSpMatDescr_t)spMatDescr, csrRowOffsets, csrColInd, csrValues));
 }
+#endif
 
-hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
-                                                                   int                       m,
-                                                                   int                       n,
-                                                                   int                       nnzA,
-                                                                   const hipsparseMatDescr_t descrA,
-                                                                   const double* csrValA,
-                                                                   const int*    csrRowPtrA,
-                                                                   const int*    csrColIndA,
-                                                                   double        percentage,
-                                                                   const hipsparseMatDescr_t descrC,
-                                                                   const double* csrValC,
-                                                                   const int*    csrRowPtrC,
-                                                                   const int*    csrColIndC,
-                                                                   pruneInfo_t   info,
-                                                                   size_t*       bufferSize)
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseSpMatGetSize(hipsparseSpMatDescr_t spMatDescr,
+                                        int64_t*              rows,
+                                        int64_t*              cols,
+                                        int64_t*              nnz)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
-                                                        m,
-                                                        n,
-                                                        nnzA,
-                                                        (const cusparseMatDescr_t)descrA,
-                                                        csrValA,
-                                                        csrRowPtrA,
-                                                        csrColIndA,
-                                                        percentage,
-                                                        (const cusparseMatDescr_t)descrC,
-                                                        csrValC,
-                                                        csrRowPtrC,
-                                                        csrColIndC,
-                                                        (pruneInfo_t)info,
-                                                        bufferSize));
+        cusparseSpMatGetSize((cusparseSpMatDescr_t)spMatDescr, rows, cols, nnz));
 }
+#endif
 
-hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t         handle,
-                                                        int                       m,
-                                                        int                       n,
-                                                        int                       nnzA,
-                                                        const hipsparseMatDescr_t descrA,
-                                                        const float*              csrValA,
-                                                        const int*                csrRowPtrA,
-                                                        const int*                csrColIndA,
-                                                        float                     percentage,
-                                                        const hipsparseMatDescr_t descrC,
-                                                        int*                      csrRowPtrC,
-                                                        int*        nnzTotalDevHostPtr,
-                                                        pruneInfo_t info,
-                                                        void*       buffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMatGetFormat(const hipsparseSpMatDescr_t spMatDescr,
+                                          hipsparseFormat_t*          format)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneCsr2csrNnzByPercentage((cusparseHandle_t)handle,
-                                             m,
-                                             n,
-                                             nnzA,
-                                             (const cusparseMatDescr_t)descrA,
-                                             csrValA,
-                                             csrRowPtrA,
-                                             csrColIndA,
-                                             percentage,
-                                             (const cusparseMatDescr_t)descrC,
-                                             csrRowPtrC,
-                                             nnzTotalDevHostPtr,
-                                             (pruneInfo_t)info,
-                                             buffer));
+    cusparseFormat_t cuda_format;
+
+    RETURN_IF_CUSPARSE_ERROR(cusparseSpMatGetFormat((const cusparseSpMatDescr_t)spMatDescr,
+                                                    format != nullptr ? &cuda_format : nullptr));
+
+    *format = CudaFormatToHIPFormat(cuda_format);
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
+#endif
 
-hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t         handle,
-                                                        int                       m,
-                                                        int                       n,
-                                                        int                       nnzA,
-                                                        const hipsparseMatDescr_t descrA,
-                                                        const double*             csrValA,
-                                                        const int*                csrRowPtrA,
-                                                        const int*                csrColIndA,
-                                                        double                    percentage,
-                                                        const hipsparseMatDescr_t descrC,
-                                                        int*                      csrRowPtrC,
-                                                        int*        nnzTotalDevHostPtr,
-                                                        pruneInfo_t info,
-                                                        void*       buffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMatGetIndexBase(const hipsparseSpMatDescr_t spMatDescr,
+                                             hipsparseIndexBase_t*       idxBase)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneCsr2csrNnzByPercentage((cusparseHandle_t)handle,
-                                             m,
-                                             n,
-                                             nnzA,
-                                             (const cusparseMatDescr_t)descrA,
-                                             csrValA,
-                                             csrRowPtrA,
-                                             csrColIndA,
-                                             percentage,
-                                             (const cusparseMatDescr_t)descrC,
-                                             csrRowPtrC,
-                                             nnzTotalDevHostPtr,
-                                             (pruneInfo_t)info,
-                                             buffer));
+    cusparseIndexBase_t cuda_index_base;
+
+    RETURN_IF_CUSPARSE_ERROR(cusparseSpMatGetIndexBase(
+        (const cusparseSpMatDescr_t)spMatDescr, idxBase != nullptr ? &cuda_index_base : nullptr));
+
+    *idxBase = CudaIndexBaseToHIPIndexBase(cuda_index_base);
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
+#endif
 
-hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         handle,
-                                                     int                       m,
-                                                     int                       n,
-                                                     int                       nnzA,
-                                                     const hipsparseMatDescr_t descrA,
-                                                     const float*              csrValA,
-                                                     const int*                csrRowPtrA,
-                                                     const int*                csrColIndA,
-                                                     float                     percentage,
-                                                     const hipsparseMatDescr_t descrC,
-                                                     float*                    csrValC,
-                                                     const int*                csrRowPtrC,
-                                                     int*                      csrColIndC,
-                                                     pruneInfo_t               info,
-                                                     void*                     buffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void** values)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpruneCsr2csrByPercentage((cusparseHandle_t)handle,
-                                          m,
-                                          n,
-                                          nnzA,
-                                          (const cusparseMatDescr_t)descrA,
-                                          csrValA,
-                                          csrRowPtrA,
-                                          csrColIndA,
-                                          percentage,
-                                          (const cusparseMatDescr_t)descrC,
-                                          csrValC,
-                                          csrRowPtrC,
-                                          csrColIndC,
-                                          (pruneInfo_t)info,
-                                          buffer));
+        cusparseSpMatGetValues((cusparseSpMatDescr_t)spMatDescr, values));
 }
+#endif
 
-hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         handle,
-                                                     int                       m,
-                                                     int                       n,
-                                                     int                       nnzA,
-                                                     const hipsparseMatDescr_t descrA,
-                                                     const double*             csrValA,
-                                                     const int*                csrRowPtrA,
-                                                     const int*                csrColIndA,
-                                                     double                    percentage,
-                                                     const hipsparseMatDescr_t descrC,
-                                                     double*                   csrValC,
-                                                     const int*                csrRowPtrC,
-                                                     int*                      csrColIndC,
-                                                     pruneInfo_t               info,
-                                                     void*                     buffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void* values)
 {
+#if(CUDART_VERSION >= 11031)
+    hipsparseTransposeCacheInvalidate(spMatDescr);
+#endif
+
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseDpruneCsr2csrByPercentage((cusparseHandle_t)handle,
-                                          m,
-                                          n,
-                                          nnzA,
-                                          (const cusparseMatDescr_t)descrA,
-                                          csrValA,
-                                          csrRowPtrA,
-                                          csrColIndA,
-                                          percentage,
-                                          (const cusparseMatDescr_t)descrC,
-                                          csrValC,
-                                          csrRowPtrC,
-                                          csrColIndC,
-                                          (pruneInfo_t)info,
-                                          buffer));
+        cusparseSpMatSetValues((cusparseSpMatDescr_t)spMatDescr, values));
 }
+#endif
 
-#if CUDART_VERSION < 11000
-hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipsparseHybMat_t   hybA,
-                                    float*                    csrSortedValA,
-                                    int*                      csrSortedRowPtrA,
-                                    int*                      csrSortedColIndA)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMatGetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int* batchCount)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseShyb2csr((cusparseHandle_t)handle,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         (const cusparseHybMat_t)hybA,
-                                                         csrSortedValA,
-                                                         csrSortedRowPtrA,
-                                                         csrSortedColIndA));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatGetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount));
 }
+#endif
 
-hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipsparseHybMat_t   hybA,
-                                    double*                   csrSortedValA,
-                                    int*                      csrSortedRowPtrA,
-                                    int*                      csrSortedColIndA)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMatSetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int batchCount)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDhyb2csr((cusparseHandle_t)handle,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         (const cusparseHybMat_t)hybA,
-                                                         csrSortedValA,
-                                                         csrSortedRowPtrA,
-                                                         csrSortedColIndA));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatSetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount));
 }
+#endif
 
-hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipsparseHybMat_t   hybA,
-                                    hipComplex*               csrSortedValA,
-                                    int*                      csrSortedRowPtrA,
-                                    int*                      csrSortedColIndA)
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseCooSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
+                                              int                   batchCount,
+                                              int64_t               batchStride)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseChyb2csr((cusparseHandle_t)handle,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         (const cusparseHybMat_t)hybA,
-                                                         csrSortedValA,
-                                                         csrSortedRowPtrA,
-                                                         csrSortedColIndA));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseCooSetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount, batchStride));
 }
+#endif
 
-hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
-                                    const hipsparseMatDescr_t descrA,
-                                    const hipsparseHybMat_t   hybA,
-                                    hipDoubleComplex*         csrSortedValA,
-                                    int*                      csrSortedRowPtrA,
-                                    int*                      csrSortedColIndA)
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
+                                              int                   batchCount,
+                                              int64_t               offsetsBatchStride,
+                                              int64_t               columnsValuesBatchStride)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZhyb2csr((cusparseHandle_t)handle,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         (const cusparseHybMat_t)hybA,
-                                                         csrSortedValA,
-                                                         csrSortedRowPtrA,
-                                                         csrSortedColIndA));
+    return hipCUSPARSEStatusToHIPStatus(cusparseCsrSetStridedBatch((cusparseSpMatDescr_t)spMatDescr,
+                                                                   batchCount,
+                                                                   offsetsBatchStride,
+                                                                   columnsValuesBatchStride));
 }
 #endif
 
-hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
-                                    const int*           cooRowInd,
-                                    int                  nnz,
-                                    int                  m,
-                                    int*                 csrRowPtr,
-                                    hipsparseIndexBase_t idxBase)
+#if(CUDART_VERSION >= 11031)
+hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseSpMatDescr_t     spMatDescr,
+                                             hipsparseSpMatAttribute_t attribute,
+                                             void*                     data,
+                                             size_t                    dataSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcoo2csr((cusparseHandle_t)handle,
-                                                         cooRowInd,
-                                                         nnz,
-                                                         m,
-                                                         csrRowPtr,
-                                                         hipIndexBaseToCudaIndexBase(idxBase)));
+    if(attribute == HIPSPARSE_SPMAT_TRANSPOSE_CACHE)
+    {
+        if(spMatDescr == nullptr || data == nullptr || dataSize != sizeof(size_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *(size_t*)data = hipsparseTransposeCacheGetBudget(spMatDescr);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // cuSPARSE generic matrices are always general
+    if(attribute == HIPSPARSE_SPMAT_MATRIX_TYPE)
+    {
+        if(data == nullptr || dataSize != sizeof(hipsparseMatrixType_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *(hipsparseMatrixType_t*)data = HIPSPARSE_MATRIX_TYPE_GENERAL;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpMatGetAttribute(
+        (cusparseSpMatDescr_t)spMatDescr, (cusparseSpMatAttribute_t)attribute, data, dataSize));
 }
+#endif
 
-hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
+#if(CUDART_VERSION >= 11031)
+hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDescr,
+                                             hipsparseSpMatAttribute_t attribute,
+                                             const void*               data,
+                                             size_t                    dataSize)
 {
+    if(attribute == HIPSPARSE_SPMAT_TRANSPOSE_CACHE)
+    {
+        if(spMatDescr == nullptr || data == nullptr || dataSize != sizeof(size_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return hipsparseTransposeCacheSetBudget(spMatDescr, *(const size_t*)data);
+    }
+
+    // cuSPARSE generic matrices are always general, symmetric and Hermitian half storage is
+    // not supported
+    if(attribute == HIPSPARSE_SPMAT_MATRIX_TYPE)
+    {
+        if(data == nullptr || dataSize != sizeof(hipsparseMatrixType_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return (*(const hipsparseMatrixType_t*)data == HIPSPARSE_MATRIX_TYPE_GENERAL)
+                   ? HIPSPARSE_STATUS_SUCCESS
+                   : HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateIdentityPermutation((cusparseHandle_t)handle, n, p));
+        cusparseSpMatSetAttribute((cusparseSpMatDescr_t)spMatDescr,
+                                  (cusparseSpMatAttribute_t)attribute,
+                                  const_cast<void*>(data),
+                                  dataSize));
 }
+#endif
 
-hipsparseStatus_t hipsparseXcsrsort_bufferSizeExt(hipsparseHandle_t handle,
-                                                  int               m,
-                                                  int               n,
-                                                  int               nnz,
-                                                  const int*        csrRowPtr,
-                                                  const int*        csrColInd,
-                                                  size_t*           pBufferSizeInBytes)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
+                                       int64_t                size,
+                                       void*                  values,
+                                       hipDataType            valueType)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcsrsort_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes));
+    return hipCUSPARSEStatusToHIPStatus(cusparseCreateDnVec(
+        (cusparseDnVecDescr_t*)dnVecDescr, size, values, hipDataTypeToCudaDataType(valueType)));
 }
+#endif
 
-hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
-                                    int                       m,
-                                    int                       n,
-                                    int                       nnz,
-                                    const hipsparseMatDescr_t descrA,
-                                    const int*                csrRowPtr,
-                                    int*                      csrColInd,
-                                    int*                      P,
-                                    void*                     pBuffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDestroyDnVec(hipsparseDnVecDescr_t dnVecDescr)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcsrsort((cusparseHandle_t)handle,
-                                                         m,
-                                                         n,
-                                                         nnz,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         csrRowPtr,
-                                                         csrColInd,
-                                                         P,
-                                                         pBuffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseDestroyDnVec((cusparseDnVecDescr_t)dnVecDescr));
 }
+#endif
 
-hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
-                                                  int               m,
-                                                  int               n,
-                                                  int               nnz,
-                                                  const int*        cscColPtr,
-                                                  const int*        cscRowInd,
-                                                  size_t*           pBufferSizeInBytes)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
+                                    int64_t*                    size,
+                                    void**                      values,
+                                    hipDataType*                valueType)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcscsort_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes));
-}
+    cudaDataType cuda_data_type;
 
-hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
-                                    int                       m,
-                                    int                       n,
-                                    int                       nnz,
-                                    const hipsparseMatDescr_t descrA,
-                                    const int*                cscColPtr,
-                                    int*                      cscRowInd,
-                                    int*                      P,
-                                    void*                     pBuffer)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcscsort((cusparseHandle_t)handle,
-                                                         m,
-                                                         n,
-                                                         nnz,
-                                                         (const cusparseMatDescr_t)descrA,
-                                                         cscColPtr,
-                                                         cscRowInd,
-                                                         P,
-                                                         pBuffer));
+    RETURN_IF_CUSPARSE_ERROR(cusparseDnVecGet((const cusparseDnVecDescr_t)dnVecDescr,
+                                              size,
+                                              values,
+                                              valueType != nullptr ? &cuda_data_type : nullptr));
+
+    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
+#endif
 
-hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
-                                                  int               m,
-                                                  int               n,
-                                                  int               nnz,
-                                                  const int*        cooRows,
-                                                  const int*        cooCols,
-                                                  size_t*           pBufferSizeInBytes)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDnVecGetValues(const hipsparseDnVecDescr_t dnVecDescr, void** values)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcoosort_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDnVecGetValues((const cusparseDnVecDescr_t)dnVecDescr, values));
 }
+#endif
 
-hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         int               nnz,
-                                         int*              cooRows,
-                                         int*              cooCols,
-                                         int*              P,
-                                         void*             pBuffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDnVecSetValues(hipsparseDnVecDescr_t dnVecDescr, void* values)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseXcoosortByRow((cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
+        cusparseDnVecSetValues((cusparseDnVecDescr_t)dnVecDescr, values));
 }
+#endif
 
-hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
-                                            int               m,
-                                            int               n,
-                                            int               nnz,
-                                            int*              cooRows,
-                                            int*              cooCols,
-                                            int*              P,
-                                            void*             pBuffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseCreateDnMat(hipsparseDnMatDescr_t* dnMatDescr,
+                                       int64_t                rows,
+                                       int64_t                cols,
+                                       int64_t                ld,
+                                       void*                  values,
+                                       hipDataType            valueType,
+                                       hipsparseOrder_t       order)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseXcoosortByColumn(
-        (cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseCreateDnMat((cusparseDnMatDescr_t*)dnMatDescr,
+                                                            rows,
+                                                            cols,
+                                                            ld,
+                                                            values,
+                                                            hipDataTypeToCudaDataType(valueType),
+                                                            hipOrderToCudaOrder(order)));
 }
+#endif
 
-hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
-                                                   hipsparseDirection_t      dirA,
-                                                   int                       mb,
-                                                   int                       nb,
-                                                   int                       nnzb,
-                                                   const hipsparseMatDescr_t descrA,
-                                                   const float*              bsrValA,
-                                                   const int*                bsrRowPtrA,
-                                                   const int*                bsrColIndA,
-                                                   int                       rowBlockDimA,
-                                                   int                       colBlockDimA,
-                                                   int                       rowBlockDimC,
-                                                   int                       colBlockDimC,
-                                                   int*                      bufferSize)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDestroyDnMat(hipsparseDnMatDescr_t dnMatDescr)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
-                                        hipDirectionToCudaDirection(dirA),
-                                        mb,
-                                        nb,
-                                        nnzb,
-                                        (const cusparseMatDescr_t)descrA,
-                                        bsrValA,
-                                        bsrRowPtrA,
-                                        bsrColIndA,
-                                        rowBlockDimA,
-                                        colBlockDimA,
-                                        rowBlockDimC,
-                                        colBlockDimC,
-                                        bufferSize));
+    return hipCUSPARSEStatusToHIPStatus(cusparseDestroyDnMat((cusparseDnMatDescr_t)dnMatDescr));
 }
+#endif
 
-hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
-                                                   hipsparseDirection_t      dirA,
-                                                   int                       mb,
-                                                   int                       nb,
-                                                   int                       nnzb,
-                                                   const hipsparseMatDescr_t descrA,
-                                                   const double*             bsrValA,
-                                                   const int*                bsrRowPtrA,
-                                                   const int*                bsrColIndA,
-                                                   int                       rowBlockDimA,
-                                                   int                       colBlockDimA,
-                                                   int                       rowBlockDimC,
-                                                   int                       colBlockDimC,
-                                                   int*                      bufferSize)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
+                                    int64_t*                    rows,
+                                    int64_t*                    cols,
+                                    int64_t*                    ld,
+                                    void**                      values,
+                                    hipDataType*                valueType,
+                                    hipsparseOrder_t*           order)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
-                                        hipDirectionToCudaDirection(dirA),
-                                        mb,
-                                        nb,
-                                        nnzb,
-                                        (const cusparseMatDescr_t)descrA,
-                                        bsrValA,
-                                        bsrRowPtrA,
-                                        bsrColIndA,
-                                        rowBlockDimA,
-                                        colBlockDimA,
-                                        rowBlockDimC,
-                                        colBlockDimC,
-                                        bufferSize));
-}
+    cudaDataType    cuda_data_type;
+    cusparseOrder_t cusparse_order;
+    hipCUSPARSEStatusToHIPStatus(cusparseDnMatGet((const cusparseDnMatDescr_t)dnMatDescr,
+                                                  rows,
+                                                  cols,
+                                                  ld,
+                                                  values,
+                                                  valueType != nullptr ? &cuda_data_type : nullptr,
+                                                  order != nullptr ? &cusparse_order : nullptr));
 
-hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
-                                                   hipsparseDirection_t      dirA,
-                                                   int                       mb,
-                                                   int                       nb,
-                                                   int                       nnzb,
-                                                   const hipsparseMatDescr_t descrA,
-                                                   const hipComplex*         bsrValA,
-                                                   const int*                bsrRowPtrA,
-                                                   const int*                bsrColIndA,
-                                                   int                       rowBlockDimA,
-                                                   int                       colBlockDimA,
-                                                   int                       rowBlockDimC,
-                                                   int                       colBlockDimC,
-                                                   int*                      bufferSize)
+    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
+    *order     = CudaOrderToHIPOrder(cusparse_order);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDnMatGetValues(const hipsparseDnMatDescr_t dnMatDescr, void** values)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseCgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
-                                        hipDirectionToCudaDirection(dirA),
-                                        mb,
-                                        nb,
-                                        nnzb,
-                                        (const cusparseMatDescr_t)descrA,
-                                        (const cuComplex*)bsrValA,
-                                        bsrRowPtrA,
-                                        bsrColIndA,
-                                        rowBlockDimA,
-                                        colBlockDimA,
-                                        rowBlockDimC,
-                                        colBlockDimC,
-                                        bufferSize));
+        cusparseDnMatGetValues((const cusparseDnMatDescr_t)dnMatDescr, values));
 }
+#endif
 
-hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
-                                                   hipsparseDirection_t      dirA,
-                                                   int                       mb,
-                                                   int                       nb,
-                                                   int                       nnzb,
-                                                   const hipsparseMatDescr_t descrA,
-                                                   const hipDoubleComplex*   bsrValA,
-                                                   const int*                bsrRowPtrA,
-                                                   const int*                bsrColIndA,
-                                                   int                       rowBlockDimA,
-                                                   int                       colBlockDimA,
-                                                   int                       rowBlockDimC,
-                                                   int                       colBlockDimC,
-                                                   int*                      bufferSize)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDnMatSetValues(hipsparseDnMatDescr_t dnMatDescr, void* values)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseZgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
-                                        hipDirectionToCudaDirection(dirA),
-                                        mb,
-                                        nb,
-                                        nnzb,
-                                        (const cusparseMatDescr_t)descrA,
-                                        (const cuDoubleComplex*)bsrValA,
-                                        bsrRowPtrA,
-                                        bsrColIndA,
-                                        rowBlockDimA,
-                                        colBlockDimA,
-                                        rowBlockDimC,
-                                        colBlockDimC,
-                                        bufferSize));
+        cusparseDnMatSetValues((cusparseDnMatDescr_t)dnMatDescr, values));
 }
+#endif
 
-hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
-                                           hipsparseDirection_t      dirA,
-                                           int                       mb,
-                                           int                       nb,
-                                           int                       nnzb,
-                                           const hipsparseMatDescr_t descrA,
-                                           const int*                bsrRowPtrA,
-                                           const int*                bsrColIndA,
-                                           int                       rowBlockDimA,
-                                           int                       colBlockDimA,
-                                           const hipsparseMatDescr_t descrC,
-                                           int*                      bsrRowPtrC,
-                                           int                       rowBlockDimC,
-                                           int                       colBlockDimC,
-                                           int*                      nnzTotalDevHostPtr,
-                                           void*                     buffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDnMatGetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
+                                                int*                  batchCount,
+                                                int64_t*              batchStride)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseXgebsr2gebsrNnz((cusparseHandle_t)handle,
-                                                                hipDirectionToCudaDirection(dirA),
-                                                                mb,
-                                                                nb,
-                                                                nnzb,
-                                                                (const cusparseMatDescr_t)descrA,
-                                                                bsrRowPtrA,
-                                                                bsrColIndA,
-                                                                rowBlockDimA,
-                                                                colBlockDimA,
-                                                                (cusparseMatDescr_t)descrC,
-                                                                bsrRowPtrC,
-                                                                rowBlockDimC,
-                                                                colBlockDimC,
-                                                                nnzTotalDevHostPtr,
-                                                                buffer));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDnMatGetStridedBatch((cusparseDnMatDescr_t)dnMatDescr, batchCount, batchStride));
 }
+#endif
 
-hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
-                                        hipsparseDirection_t      dirA,
-                                        int                       mb,
-                                        int                       nb,
-                                        int                       nnzb,
-                                        const hipsparseMatDescr_t descrA,
-                                        const float*              bsrValA,
-                                        const int*                bsrRowPtrA,
-                                        const int*                bsrColIndA,
-                                        int                       rowBlockDimA,
-                                        int                       colBlockDimA,
-                                        const hipsparseMatDescr_t descrC,
-                                        float*                    bsrValC,
-                                        int*                      bsrRowPtrC,
-                                        int*                      bsrColIndC,
-                                        int                       rowBlockDimC,
-                                        int                       colBlockDimC,
-                                        void*                     buffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseDnMatSetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
+                                                int                   batchCount,
+                                                int64_t               batchStride)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSgebsr2gebsr((cusparseHandle_t)handle,
-                                                             hipDirectionToCudaDirection(dirA),
-                                                             mb,
-                                                             nb,
-                                                             nnzb,
-                                                             (const cusparseMatDescr_t)descrA,
-                                                             bsrValA,
-                                                             bsrRowPtrA,
-                                                             bsrColIndA,
-                                                             rowBlockDimA,
-                                                             colBlockDimA,
-                                                             (const cusparseMatDescr_t)descrC,
-                                                             bsrValC,
-                                                             bsrRowPtrC,
-                                                             bsrColIndC,
-                                                             rowBlockDimC,
-                                                             colBlockDimC,
-                                                             buffer));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDnMatSetStridedBatch((cusparseDnMatDescr_t)dnMatDescr, batchCount, batchStride));
 }
+#endif
 
-hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
-                                        hipsparseDirection_t      dirA,
-                                        int                       mb,
-                                        int                       nb,
-                                        int                       nnzb,
-                                        const hipsparseMatDescr_t descrA,
-                                        const double*             bsrValA,
-                                        const int*                bsrRowPtrA,
-                                        const int*                bsrColIndA,
-                                        int                       rowBlockDimA,
-                                        int                       colBlockDimA,
-                                        const hipsparseMatDescr_t descrC,
-                                        double*                   bsrValC,
-                                        int*                      bsrRowPtrC,
-                                        int*                      bsrColIndC,
-                                        int                       rowBlockDimC,
-                                        int                       colBlockDimC,
-                                        void*                     buffer)
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t     handle,
+                                 const void*           alpha,
+                                 hipsparseSpVecDescr_t vecX,
+                                 const void*           beta,
+                                 hipsparseDnVecDescr_t vecY)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDgebsr2gebsr((cusparseHandle_t)handle,
-                                                             hipDirectionToCudaDirection(dirA),
-                                                             mb,
-                                                             nb,
-                                                             nnzb,
-                                                             (const cusparseMatDescr_t)descrA,
-                                                             bsrValA,
-                                                             bsrRowPtrA,
-                                                             bsrColIndA,
-                                                             rowBlockDimA,
-                                                             colBlockDimA,
-                                                             (const cusparseMatDescr_t)descrC,
-                                                             bsrValC,
-                                                             bsrRowPtrC,
-                                                             bsrColIndC,
-                                                             rowBlockDimC,
-                                                             colBlockDimC,
-                                                             buffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseAxpby((cusparseHandle_t)handle,
+                                                      alpha,
+                                                      (cusparseSpVecDescr_t)vecX,
+                                                      beta,
+                                                      (cusparseDnVecDescr_t)vecY));
 }
+#endif
 
-hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
-                                        hipsparseDirection_t      dirA,
-                                        int                       mb,
-                                        int                       nb,
-                                        int                       nnzb,
-                                        const hipsparseMatDescr_t descrA,
-                                        const hipComplex*         bsrValA,
-                                        const int*                bsrRowPtrA,
-                                        const int*                bsrColIndA,
-                                        int                       rowBlockDimA,
-                                        int                       colBlockDimA,
-                                        const hipsparseMatDescr_t descrC,
-                                        hipComplex*               bsrValC,
-                                        int*                      bsrRowPtrC,
-                                        int*                      bsrColIndC,
-                                        int                       rowBlockDimC,
-                                        int                       colBlockDimC,
-                                        void*                     buffer)
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseGather(hipsparseHandle_t     handle,
+                                  hipsparseDnVecDescr_t vecY,
+                                  hipsparseSpVecDescr_t vecX)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCgebsr2gebsr((cusparseHandle_t)handle,
-                                                             hipDirectionToCudaDirection(dirA),
-                                                             mb,
-                                                             nb,
-                                                             nnzb,
-                                                             (const cusparseMatDescr_t)descrA,
-                                                             (const cuComplex*)bsrValA,
-                                                             bsrRowPtrA,
-                                                             bsrColIndA,
-                                                             rowBlockDimA,
-                                                             colBlockDimA,
-                                                             (const cusparseMatDescr_t)descrC,
-                                                             (cuComplex*)bsrValC,
-                                                             bsrRowPtrC,
-                                                             bsrColIndC,
-                                                             rowBlockDimC,
-                                                             colBlockDimC,
-                                                             buffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseGather(
+        (cusparseHandle_t)handle, (cusparseDnVecDescr_t)vecY, (cusparseSpVecDescr_t)vecX));
 }
+#endif
 
-hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
-                                        hipsparseDirection_t      dirA,
-                                        int                       mb,
-                                        int                       nb,
-                                        int                       nnzb,
-                                        const hipsparseMatDescr_t descrA,
-                                        const hipDoubleComplex*   bsrValA,
-                                        const int*                bsrRowPtrA,
-                                        const int*                bsrColIndA,
-                                        int                       rowBlockDimA,
-                                        int                       colBlockDimA,
-                                        const hipsparseMatDescr_t descrC,
-                                        hipDoubleComplex*         bsrValC,
-                                        int*                      bsrRowPtrC,
-                                        int*                      bsrColIndC,
-                                        int                       rowBlockDimC,
-                                        int                       colBlockDimC,
-                                        void*                     buffer)
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseScatter(hipsparseHandle_t     handle,
+                                   hipsparseSpVecDescr_t vecX,
+                                   hipsparseDnVecDescr_t vecY)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseScatter(
+        (cusparseHandle_t)handle, (cusparseSpVecDescr_t)vecX, (cusparseDnVecDescr_t)vecY));
+}
+#endif
+
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
+                               const void*           c_coeff,
+                               const void*           s_coeff,
+                               hipsparseSpVecDescr_t vecX,
+                               hipsparseDnVecDescr_t vecY)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZgebsr2gebsr((cusparseHandle_t)handle,
-                                                             hipDirectionToCudaDirection(dirA),
-                                                             mb,
-                                                             nb,
-                                                             nnzb,
-                                                             (const cusparseMatDescr_t)descrA,
-                                                             (const cuDoubleComplex*)bsrValA,
-                                                             bsrRowPtrA,
-                                                             bsrColIndA,
-                                                             rowBlockDimA,
-                                                             colBlockDimA,
-                                                             (const cusparseMatDescr_t)descrC,
-                                                             (cuDoubleComplex*)bsrValC,
-                                                             bsrRowPtrC,
-                                                             bsrColIndC,
-                                                             rowBlockDimC,
-                                                             colBlockDimC,
-                                                             buffer));
+    return hipCUSPARSEStatusToHIPStatus(cusparseRot((cusparseHandle_t)handle,
+                                                    c_coeff,
+                                                    s_coeff,
+                                                    (cusparseSpVecDescr_t)vecX,
+                                                    (cusparseDnVecDescr_t)vecY));
 }
+#endif
 
-hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
-                                                   int               m,
-                                                   int               n,
-                                                   int               nnz,
-                                                   float*            csrVal,
-                                                   const int*        csrRowPtr,
-                                                   int*              csrColInd,
-                                                   csru2csrInfo_t    info,
-                                                   size_t*           pBufferSizeInBytes)
+#if(CUDART_VERSION >= 11020)
+hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t           handle,
+                                                    hipsparseSpMatDescr_t       matA,
+                                                    hipsparseDnMatDescr_t       matB,
+                                                    hipsparseSparseToDenseAlg_t alg,
+                                                    size_t*                     bufferSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseScsru2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                                                        m,
-                                                                        n,
-                                                                        nnz,
-                                                                        csrVal,
-                                                                        csrRowPtr,
-                                                                        csrColInd,
-                                                                        info,
-                                                                        pBufferSizeInBytes));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSparseToDense_bufferSize((cusparseHandle_t)handle,
+                                         (cusparseSpMatDescr_t)matA,
+                                         (cusparseDnMatDescr_t)matB,
+                                         hipSpToDnAlgToCudaSpToDnAlg(alg),
+                                         bufferSize));
 }
+#endif
 
-hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
-                                                   int               m,
-                                                   int               n,
-                                                   int               nnz,
-                                                   double*           csrVal,
-                                                   const int*        csrRowPtr,
-                                                   int*              csrColInd,
-                                                   csru2csrInfo_t    info,
-                                                   size_t*           pBufferSizeInBytes)
+#if(CUDART_VERSION >= 11020)
+hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
+                                         hipsparseSpMatDescr_t       matA,
+                                         hipsparseDnMatDescr_t       matB,
+                                         hipsparseSparseToDenseAlg_t alg,
+                                         void*                       externalBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDcsru2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                                                        m,
-                                                                        n,
-                                                                        nnz,
-                                                                        csrVal,
-                                                                        csrRowPtr,
-                                                                        csrColInd,
-                                                                        info,
-                                                                        pBufferSizeInBytes));
+    return hipCUSPARSEStatusToHIPStatus(cusparseSparseToDense((cusparseHandle_t)handle,
+                                                              (cusparseSpMatDescr_t)matA,
+                                                              (cusparseDnMatDescr_t)matB,
+                                                              hipSpToDnAlgToCudaSpToDnAlg(alg),
+                                                              externalBuffer));
 }
+#endif
 
-hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
-                                                   int               m,
-                                                   int               n,
-                                                   int               nnz,
-                                                   hipComplex*       csrVal,
-                                                   const int*        csrRowPtr,
-                                                   int*              csrColInd,
-                                                   csru2csrInfo_t    info,
-                                                   size_t*           pBufferSizeInBytes)
+#if(CUDART_VERSION >= 11020)
+hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t           handle,
+                                                    hipsparseDnMatDescr_t       matA,
+                                                    hipsparseSpMatDescr_t       matB,
+                                                    hipsparseDenseToSparseAlg_t alg,
+                                                    size_t*                     bufferSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCcsru2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                                                        m,
-                                                                        n,
-                                                                        nnz,
-                                                                        (cuComplex*)csrVal,
-                                                                        csrRowPtr,
-                                                                        csrColInd,
-                                                                        info,
-                                                                        pBufferSizeInBytes));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDenseToSparse_bufferSize((cusparseHandle_t)handle,
+                                         (cusparseDnMatDescr_t)matA,
+                                         (cusparseSpMatDescr_t)matB,
+                                         hipDnToSpAlgToCudaDnToSpAlg(alg),
+                                         bufferSize));
 }
+#endif
 
-hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
-                                                   int               m,
-                                                   int               n,
-                                                   int               nnz,
-                                                   hipDoubleComplex* csrVal,
-                                                   const int*        csrRowPtr,
-                                                   int*              csrColInd,
-                                                   csru2csrInfo_t    info,
-                                                   size_t*           pBufferSizeInBytes)
+#if(CUDART_VERSION >= 11020)
+hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           handle,
+                                                  hipsparseDnMatDescr_t       matA,
+                                                  hipsparseSpMatDescr_t       matB,
+                                                  hipsparseDenseToSparseAlg_t alg,
+                                                  void*                       externalBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZcsru2csr_bufferSizeExt((cusparseHandle_t)handle,
-                                                                        m,
-                                                                        n,
-                                                                        nnz,
-                                                                        (cuDoubleComplex*)csrVal,
-                                                                        csrRowPtr,
-                                                                        csrColInd,
-                                                                        info,
-                                                                        pBufferSizeInBytes));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDenseToSparse_analysis((cusparseHandle_t)handle,
+                                       (cusparseDnMatDescr_t)matA,
+                                       (cusparseSpMatDescr_t)matB,
+                                       hipDnToSpAlgToCudaDnToSpAlg(alg),
+                                       externalBuffer));
 }
+#endif
 
-hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
-                                     int                       m,
-                                     int                       n,
-                                     int                       nnz,
-                                     const hipsparseMatDescr_t descrA,
-                                     float*                    csrVal,
-                                     const int*                csrRowPtr,
-                                     int*                      csrColInd,
-                                     csru2csrInfo_t            info,
-                                     void*                     pBuffer)
+#if(CUDART_VERSION >= 11020)
+hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           handle,
+                                                 hipsparseDnMatDescr_t       matA,
+                                                 hipsparseSpMatDescr_t       matB,
+                                                 hipsparseDenseToSparseAlg_t alg,
+                                                 void*                       externalBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseScsru2csr((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          nnz,
-                                                          (const cusparseMatDescr_t)descrA,
-                                                          csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          info,
-                                                          pBuffer));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseDenseToSparse_convert((cusparseHandle_t)handle,
+                                      (cusparseDnMatDescr_t)matA,
+                                      (cusparseSpMatDescr_t)matB,
+                                      hipDnToSpAlgToCudaDnToSpAlg(alg),
+                                      externalBuffer));
 }
+#endif
 
-hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
-                                     int                       m,
-                                     int                       n,
-                                     int                       nnz,
-                                     const hipsparseMatDescr_t descrA,
-                                     double*                   csrVal,
-                                     const int*                csrRowPtr,
-                                     int*                      csrColInd,
-                                     csru2csrInfo_t            info,
-                                     void*                     pBuffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t     handle,
+                                           hipsparseOperation_t  opX,
+                                           hipsparseSpVecDescr_t vecX,
+                                           hipsparseDnVecDescr_t vecY,
+                                           void*                 result,
+                                           hipDataType           computeType,
+                                           size_t*               bufferSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDcsru2csr((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          nnz,
-                                                          (const cusparseMatDescr_t)descrA,
-                                                          csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          info,
-                                                          pBuffer));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpVV_bufferSize((cusparseHandle_t)handle,
+                                hipOperationToCudaOperation(opX),
+                                (cusparseSpVecDescr_t)vecX,
+                                (cusparseDnVecDescr_t)vecY,
+                                result,
+                                hipDataTypeToCudaDataType(computeType),
+                                bufferSize));
 }
+#endif
 
-hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
-                                     int                       m,
-                                     int                       n,
-                                     int                       nnz,
-                                     const hipsparseMatDescr_t descrA,
-                                     hipComplex*               csrVal,
-                                     const int*                csrRowPtr,
-                                     int*                      csrColInd,
-                                     csru2csrInfo_t            info,
-                                     void*                     pBuffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t     handle,
+                                hipsparseOperation_t  opX,
+                                hipsparseSpVecDescr_t vecX,
+                                hipsparseDnVecDescr_t vecY,
+                                void*                 result,
+                                hipDataType           computeType,
+                                void*                 externalBuffer)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpVV((cusparseHandle_t)handle,
+                                                     hipOperationToCudaOperation(opX),
+                                                     (cusparseSpVecDescr_t)vecX,
+                                                     (cusparseDnVecDescr_t)vecY,
+                                                     result,
+                                                     hipDataTypeToCudaDataType(computeType),
+                                                     externalBuffer));
+}
+#endif
+
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnVecDescr_t vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           size_t*                     bufferSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCcsru2csr((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          nnz,
-                                                          (const cusparseMatDescr_t)descrA,
-                                                          (cuComplex*)csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          info,
-                                                          pBuffer));
+    // Multiply with the cached transpose, if enabled by HIPSPARSE_SPMAT_TRANSPOSE_CACHE
+    hipsparseOperation_t  op  = opA;
+    hipsparseSpMatDescr_t mat = matA;
+#if(CUDART_VERSION >= 11031)
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTransposeCacheApply(handle, true, &op, &mat));
+#endif
+
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMV_bufferSize((cusparseHandle_t)handle,
+                                hipOperationToCudaOperation(op),
+                                alpha,
+                                (const cusparseSpMatDescr_t)mat,
+                                (const cusparseDnVecDescr_t)vecX,
+                                beta,
+                                (const cusparseDnVecDescr_t)vecY,
+                                hipDataTypeToCudaDataType(computeType),
+                                hipSpMVAlgToCudaSpMVAlg(alg),
+                                bufferSize));
 }
+#endif
 
-hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
-                                     int                       m,
-                                     int                       n,
-                                     int                       nnz,
-                                     const hipsparseMatDescr_t descrA,
-                                     hipDoubleComplex*         csrVal,
-                                     const int*                csrRowPtr,
-                                     int*                      csrColInd,
-                                     csru2csrInfo_t            info,
-                                     void*                     pBuffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnVecDescr_t vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           void*                       externalBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZcsru2csr((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          nnz,
-                                                          (const cusparseMatDescr_t)descrA,
-                                                          (cuDoubleComplex*)csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          info,
-                                                          pBuffer));
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(matA == nullptr || vecX == nullptr || vecY == nullptr || alpha == nullptr || beta == nullptr
+       || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Multiply with the cached transpose, if enabled by HIPSPARSE_SPMAT_TRANSPOSE_CACHE
+    hipsparseOperation_t  op  = opA;
+    hipsparseSpMatDescr_t mat = matA;
+#if(CUDART_VERSION >= 11031)
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTransposeCacheApply(handle, true, &op, &mat));
+#endif
+
+#if(CUDART_VERSION >= 12040)
+    // Run the algorithm specific analysis ahead of the first SpMV call
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMV_preprocess((cusparseHandle_t)handle,
+                                hipOperationToCudaOperation(op),
+                                alpha,
+                                (const cusparseSpMatDescr_t)mat,
+                                (const cusparseDnVecDescr_t)vecX,
+                                beta,
+                                (const cusparseDnVecDescr_t)vecY,
+                                hipDataTypeToCudaDataType(computeType),
+                                hipSpMVAlgToCudaSpMVAlg(alg),
+                                externalBuffer));
+#else
+    return HIPSPARSE_STATUS_SUCCESS;
+#endif
 }
+#endif
 
-hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
-                                     int                       m,
-                                     int                       n,
-                                     int                       nnz,
-                                     const hipsparseMatDescr_t descrA,
-                                     float*                    csrVal,
-                                     const int*                csrRowPtr,
-                                     int*                      csrColInd,
-                                     csru2csrInfo_t            info,
-                                     void*                     pBuffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
+                                hipsparseOperation_t        opA,
+                                const void*                 alpha,
+                                const hipsparseSpMatDescr_t matA,
+                                const hipsparseDnVecDescr_t vecX,
+                                const void*                 beta,
+                                const hipsparseDnVecDescr_t vecY,
+                                hipDataType                 computeType,
+                                hipsparseSpMVAlg_t          alg,
+                                void*                       externalBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseScsr2csru((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          nnz,
-                                                          (const cusparseMatDescr_t)descrA,
-                                                          csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          info,
-                                                          pBuffer));
+    // Multiply with the cached transpose, if enabled by HIPSPARSE_SPMAT_TRANSPOSE_CACHE
+    hipsparseOperation_t  op  = opA;
+    hipsparseSpMatDescr_t mat = matA;
+#if(CUDART_VERSION >= 11031)
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTransposeCacheApply(handle, false, &op, &mat));
+#endif
+
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpMV((cusparseHandle_t)handle,
+                                                     hipOperationToCudaOperation(op),
+                                                     alpha,
+                                                     (const cusparseSpMatDescr_t)mat,
+                                                     (const cusparseDnVecDescr_t)vecX,
+                                                     beta,
+                                                     (const cusparseDnVecDescr_t)vecY,
+                                                     hipDataTypeToCudaDataType(computeType),
+                                                     hipSpMVAlgToCudaSpMVAlg(alg),
+                                                     externalBuffer));
 }
+#endif
 
-hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
-                                     int                       m,
-                                     int                       n,
-                                     int                       nnz,
-                                     const hipsparseMatDescr_t descrA,
-                                     double*                   csrVal,
-                                     const int*                csrRowPtr,
-                                     int*                      csrColInd,
-                                     csru2csrInfo_t            info,
-                                     void*                     pBuffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnMatDescr_t matB,
+                                           const void*                 beta,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMMAlg_t          alg,
+                                           size_t*                     bufferSize)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDcsr2csru((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          nnz,
-                                                          (const cusparseMatDescr_t)descrA,
-                                                          csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          info,
-                                                          pBuffer));
+    // Multiply with the cached transpose, if enabled by HIPSPARSE_SPMAT_TRANSPOSE_CACHE
+    hipsparseOperation_t  op  = opA;
+    hipsparseSpMatDescr_t mat = matA;
+#if(CUDART_VERSION >= 11031)
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTransposeCacheApply(handle, true, &op, &mat));
+#endif
+
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMM_bufferSize((cusparseHandle_t)handle,
+                                hipOperationToCudaOperation(op),
+                                hipOperationToCudaOperation(opB),
+                                alpha,
+                                (const cusparseSpMatDescr_t)mat,
+                                (const cusparseDnMatDescr_t)matB,
+                                beta,
+                                (const cusparseDnMatDescr_t)matC,
+                                hipDataTypeToCudaDataType(computeType),
+                                hipSpMMAlgToCudaSpMMAlg(alg),
+                                bufferSize));
 }
+#endif
 
-hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
-                                     int                       m,
-                                     int                       n,
-                                     int                       nnz,
-                                     const hipsparseMatDescr_t descrA,
-                                     hipComplex*               csrVal,
-                                     const int*                csrRowPtr,
-                                     int*                      csrColInd,
-                                     csru2csrInfo_t            info,
-                                     void*                     pBuffer)
+#if(CUDART_VERSION >= 11021)
+hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnMatDescr_t matB,
+                                           const void*                 beta,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMMAlg_t          alg,
+                                           void*                       externalBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseCcsr2csru((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          nnz,
-                                                          (const cusparseMatDescr_t)descrA,
-                                                          (cuComplex*)csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          info,
-                                                          pBuffer));
+    // Multiply with the cached transpose, if enabled by HIPSPARSE_SPMAT_TRANSPOSE_CACHE
+    hipsparseOperation_t  op  = opA;
+    hipsparseSpMatDescr_t mat = matA;
+#if(CUDART_VERSION >= 11031)
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTransposeCacheApply(handle, true, &op, &mat));
+#endif
+
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMM_preprocess((cusparseHandle_t)handle,
+                                hipOperationToCudaOperation(op),
+                                hipOperationToCudaOperation(opB),
+                                alpha,
+                                (const cusparseSpMatDescr_t)mat,
+                                (const cusparseDnMatDescr_t)matB,
+                                beta,
+                                (const cusparseDnMatDescr_t)matC,
+                                hipDataTypeToCudaDataType(computeType),
+                                hipSpMMAlgToCudaSpMMAlg(alg),
+                                externalBuffer));
 }
+#endif
 
-hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
-                                     int                       m,
-                                     int                       n,
-                                     int                       nnz,
-                                     const hipsparseMatDescr_t descrA,
-                                     hipDoubleComplex*         csrVal,
-                                     const int*                csrRowPtr,
-                                     int*                      csrColInd,
-                                     csru2csrInfo_t            info,
-                                     void*                     pBuffer)
+#if(CUDART_VERSION >= 10010)
+hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
+                                hipsparseOperation_t        opA,
+                                hipsparseOperation_t        opB,
+                                const void*                 alpha,
+                                const hipsparseSpMatDescr_t matA,
+                                const hipsparseDnMatDescr_t matB,
+                                const void*                 beta,
+                                const hipsparseDnMatDescr_t matC,
+                                hipDataType                 computeType,
+                                hipsparseSpMMAlg_t          alg,
+                                void*                       externalBuffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseZcsr2csru((cusparseHandle_t)handle,
-                                                          m,
-                                                          n,
-                                                          nnz,
-                                                          (const cusparseMatDescr_t)descrA,
-                                                          (cuDoubleComplex*)csrVal,
-                                                          csrRowPtr,
-                                                          csrColInd,
-                                                          info,
-                                                          pBuffer));
+    // Multiply with the cached transpose, if enabled by HIPSPARSE_SPMAT_TRANSPOSE_CACHE
+    hipsparseOperation_t  op  = opA;
+    hipsparseSpMatDescr_t mat = matA;
+#if(CUDART_VERSION >= 11031)
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTransposeCacheApply(handle, false, &op, &mat));
+#endif
+
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpMM((cusparseHandle_t)handle,
+                                                     hipOperationToCudaOperation(op),
+                                                     hipOperationToCudaOperation(opB),
+                                                     alpha,
+                                                     (const cusparseSpMatDescr_t)mat,
+                                                     (const cusparseDnMatDescr_t)matB,
+                                                     beta,
+                                                     (const cusparseDnMatDescr_t)matC,
+                                                     hipDataTypeToCudaDataType(computeType),
+                                                     hipSpMMAlgToCudaSpMMAlg(alg),
+                                                     externalBuffer));
 }
+#endif
 
-/* Generic API */
-#if(CUDART_VERSION >= 10010)
-cusparseFormat_t hipFormatToCudaFormat(hipsparseFormat_t format)
+#if(CUDART_VERSION >= 11000)
+// Size in bytes of a single element of the given data type
+static size_t hipsparseDataTypeSize(hipDataType type)
 {
-    switch(format)
+    switch(type)
     {
-    case HIPSPARSE_FORMAT_COO:
-        return CUSPARSE_FORMAT_COO;
-    case HIPSPARSE_FORMAT_COO_AOS:
-        return CUSPARSE_FORMAT_COO_AOS;
-    case HIPSPARSE_FORMAT_CSR:
-        return CUSPARSE_FORMAT_CSR;
-#if(CUDART_VERSION >= 11021)
-    case HIPSPARSE_FORMAT_BLOCKED_ELL:
-        return CUSPARSE_FORMAT_BLOCKED_ELL;
-#endif
+    case HIP_R_8I:
+    case HIP_R_8U:
+        return 1;
+    case HIP_R_16F:
+    case HIP_R_16BF:
+        return 2;
+    case HIP_R_32F:
+    case HIP_R_32I:
+    case HIP_R_32U:
+        return 4;
+    case HIP_R_64F:
+    case HIP_C_32F:
+        return 8;
+    case HIP_C_64F:
+        return 16;
     default:
-        throw "Non existent hipsparseFormat_t";
+        return 0;
     }
 }
 
-hipsparseFormat_t CudaFormatToHIPFormat(cusparseFormat_t format)
+// Device and host resources of the out-of-core streaming routines. Two staging slots
+// are used, such that uploading the next chunk overlaps with computing the current one.
+struct hipsparseStreamedCsr
 {
-    switch(format)
+    cudaStream_t copy_stream  = nullptr;
+    cudaEvent_t  uploaded[2]  = {nullptr, nullptr};
+    cudaEvent_t  consumed[2]  = {nullptr, nullptr};
+    void*        h_row_ptr[2] = {nullptr, nullptr};
+    void*        d_row_ptr[2] = {nullptr, nullptr};
+    void*        d_col_ind[2] = {nullptr, nullptr};
+    void*        d_val[2]     = {nullptr, nullptr};
+    void*        buffer       = nullptr;
+    size_t       buffer_size  = 0;
+
+    ~hipsparseStreamedCsr()
     {
-    case CUSPARSE_FORMAT_COO:
-        return HIPSPARSE_FORMAT_COO;
-    case CUSPARSE_FORMAT_COO_AOS:
-        return HIPSPARSE_FORMAT_COO_AOS;
-    case CUSPARSE_FORMAT_CSR:
-        return HIPSPARSE_FORMAT_CSR;
+        for(int i = 0; i < 2; ++i)
+        {
+            if(uploaded[i] != nullptr)
+                cudaEventDestroy(uploaded[i]);
+            if(consumed[i] != nullptr)
+                cudaEventDestroy(consumed[i]);
+            if(h_row_ptr[i] != nullptr)
+                cudaFreeHost(h_row_ptr[i]);
+            if(d_row_ptr[i] != nullptr)
+                cudaFree(d_row_ptr[i]);
+            if(d_col_ind[i] != nullptr)
+                cudaFree(d_col_ind[i]);
+            if(d_val[i] != nullptr)
+                cudaFree(d_val[i]);
+        }
+
+        if(buffer != nullptr)
+            cudaFree(buffer);
+        if(copy_stream != nullptr)
+            cudaStreamDestroy(copy_stream);
+    }
+};
+
+// Computes the product of a single row chunk, stored in device memory. If bufferSize is
+// not nullptr, only the size of the work space required by the chunk is queried.
+typedef hipsparseStatus_t (*hipsparseStreamedChunkFunc)(hipsparseHandle_t     handle,
+                                                        hipsparseSpMatDescr_t chunk,
+                                                        int64_t               row_begin,
+                                                        hipsparseStreamedCsr* res,
+                                                        void*                 data,
+                                                        size_t*               bufferSize);
+
+// Streams a host resident CSR matrix row chunk wise through the device, such that the
+// work space and both staging slots together do not exceed the device memory limit
+static hipsparseStatus_t hipsparseStreamCsrRows(hipsparseHandle_t           handle,
+                                                const hipsparseSpMatDescr_t matA,
+                                                size_t                      deviceMemoryLimit,
+                                                hipsparseStreamedChunkFunc  func,
+                                                void*                       data)
+{
+    hipsparseFormat_t format;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matA, &format));
+
+    if(format != HIPSPARSE_FORMAT_CSR)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
 
-#if(CUDART_VERSION >= 11021)
-    case CUSPARSE_FORMAT_BLOCKED_ELL:
-        return HIPSPARSE_FORMAT_BLOCKED_ELL;
-#endif
-    default:
-        throw "Non existent cusparseFormat_t";
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    void*                csr_row_ptr;
+    void*                csr_col_ind;
+    void*                csr_val;
+    hipsparseIndexType_t row_type;
+    hipsparseIndexType_t col_type;
+    hipsparseIndexBase_t base;
+    hipDataType          val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matA,
+                                              &m,
+                                              &n,
+                                              &nnz,
+                                              &csr_row_ptr,
+                                              &csr_col_ind,
+                                              &csr_val,
+                                              &row_type,
+                                              &col_type,
+                                              &base,
+                                              &val_type));
+
+    if(row_type == HIPSPARSE_INDEX_16U || col_type == HIPSPARSE_INDEX_16U)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
     }
-}
-#endif
 
-#if(CUDART_VERSION >= 11000)
-cusparseOrder_t hipOrderToCudaOrder(hipsparseOrder_t op)
-{
-    switch(op)
+    // Quick return
+    if(m == 0)
     {
-    case HIPSPARSE_ORDER_ROW:
-        return CUSPARSE_ORDER_ROW;
-    case HIPSPARSE_ORDER_COLUMN:
-        return CUSPARSE_ORDER_COL;
-    default:
-        throw "Non existent hipsparseOrder_t";
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    size_t row_size = (row_type == HIPSPARSE_INDEX_32I) ? sizeof(int32_t) : sizeof(int64_t);
+    size_t col_size = (col_type == HIPSPARSE_INDEX_32I) ? sizeof(int32_t) : sizeof(int64_t);
+    size_t val_size = hipsparseDataTypeSize(val_type);
+
+    if(val_size == 0)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // Capacity of a single chunk, in non-zero entries and rows, for two staging slots
+    size_t  slot_size = 2 * (row_size + col_size + val_size);
+    int64_t capacity  = (int64_t)(deviceMemoryLimit / slot_size) - 1;
+
+    if(capacity < 1)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The work space counts against the limit. It is queried for the largest chunk the
+    // staging slots could hold without it, which bounds the work space of every chunk,
+    // since reserving the work space only shrinks the chunks. The size query does not
+    // access the arrays, thus the host arrays of A serve as placeholders.
+    hipsparseSpMatDescr_t largest;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&largest,
+                                                 std::min(m, capacity),
+                                                 n,
+                                                 std::min(nnz, capacity),
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 csr_val,
+                                                 row_type,
+                                                 col_type,
+                                                 base,
+                                                 val_type));
+
+    size_t            buffer_size;
+    hipsparseStatus_t status = func(handle, largest, 0, nullptr, data, &buffer_size);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroySpMat(largest));
+    RETURN_IF_HIPSPARSE_ERROR(status);
+
+    if(buffer_size >= deviceMemoryLimit)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    capacity = (int64_t)((deviceMemoryLimit - buffer_size) / slot_size) - 1;
+
+    if(capacity < 1)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseStreamedCsr res;
+
+    if(buffer_size > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMalloc(&res.buffer, buffer_size));
+        res.buffer_size = buffer_size;
+    }
+
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    RETURN_IF_CUDA_ERROR(cudaStreamCreateWithFlags(&res.copy_stream, cudaStreamNonBlocking));
+
+    for(int i = 0; i < 2; ++i)
+    {
+        RETURN_IF_CUDA_ERROR(cudaEventCreateWithFlags(&res.uploaded[i], cudaEventDisableTiming));
+        RETURN_IF_CUDA_ERROR(cudaEventCreateWithFlags(&res.consumed[i], cudaEventDisableTiming));
+        RETURN_IF_CUDA_ERROR(cudaMallocHost(&res.h_row_ptr[i], row_size * (capacity + 1)));
+        RETURN_IF_CUDA_ERROR(cudaMalloc(&res.d_row_ptr[i], row_size * (capacity + 1)));
+        RETURN_IF_CUDA_ERROR(cudaMalloc(&res.d_col_ind[i], col_size * capacity));
+        RETURN_IF_CUDA_ERROR(cudaMalloc(&res.d_val[i], val_size * capacity));
+    }
+
+    const int32_t* row_ptr32 = (const int32_t*)csr_row_ptr;
+    const int64_t* row_ptr64 = (const int64_t*)csr_row_ptr;
+
+    int64_t row_begin = 0;
+    int     slot      = 0;
+
+    while(row_begin < m)
+    {
+        int64_t offset = (row_type == HIPSPARSE_INDEX_32I) ? row_ptr32[row_begin] - base
+                                                           : row_ptr64[row_begin] - base;
+
+        // Extend the chunk as long as it fits into a staging slot
+        int64_t row_end = row_begin;
+        while(row_end < m && row_end - row_begin < capacity)
+        {
+            int64_t next = (row_type == HIPSPARSE_INDEX_32I) ? row_ptr32[row_end + 1] - base
+                                                             : row_ptr64[row_end + 1] - base;
+
+            if(next - offset > capacity)
+            {
+                break;
+            }
+
+            ++row_end;
+        }
+
+        // A single row exceeds the device memory limit
+        if(row_end == row_begin)
+        {
+            RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+            return HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES;
+        }
+
+        int64_t rows      = row_end - row_begin;
+        int64_t chunk_nnz = ((row_type == HIPSPARSE_INDEX_32I) ? row_ptr32[row_end] - base
+                                                               : row_ptr64[row_end] - base)
+                            - offset;
+
+        // Wait until the slot is not in use by the computation anymore
+        RETURN_IF_CUDA_ERROR(cudaEventSynchronize(res.consumed[slot]));
+
+        // Rebase the row offsets of the chunk
+        if(row_type == HIPSPARSE_INDEX_32I)
+        {
+            int32_t* ptr = (int32_t*)res.h_row_ptr[slot];
+            for(int64_t i = 0; i <= rows; ++i)
+            {
+                ptr[i] = row_ptr32[row_begin + i] - offset;
+            }
+        }
+        else
+        {
+            int64_t* ptr = (int64_t*)res.h_row_ptr[slot];
+            for(int64_t i = 0; i <= rows; ++i)
+            {
+                ptr[i] = row_ptr64[row_begin + i] - offset;
+            }
+        }
+
+        // Upload the chunk
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(res.d_row_ptr[slot],
+                                             res.h_row_ptr[slot],
+                                             row_size * (rows + 1),
+                                             cudaMemcpyHostToDevice,
+                                             res.copy_stream));
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(res.d_col_ind[slot],
+                                             (const char*)csr_col_ind + col_size * offset,
+                                             col_size * chunk_nnz,
+                                             cudaMemcpyHostToDevice,
+                                             res.copy_stream));
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(res.d_val[slot],
+                                             (const char*)csr_val + val_size * offset,
+                                             val_size * chunk_nnz,
+                                             cudaMemcpyHostToDevice,
+                                             res.copy_stream));
+        RETURN_IF_CUDA_ERROR(cudaEventRecord(res.uploaded[slot], res.copy_stream));
+
+        // Compute the chunk, once it has been uploaded
+        RETURN_IF_CUDA_ERROR(cudaStreamWaitEvent(stream, res.uploaded[slot], 0));
+
+        hipsparseSpMatDescr_t chunk;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&chunk,
+                                                     rows,
+                                                     n,
+                                                     chunk_nnz,
+                                                     res.d_row_ptr[slot],
+                                                     res.d_col_ind[slot],
+                                                     res.d_val[slot],
+                                                     row_type,
+                                                     col_type,
+                                                     base,
+                                                     val_type));
+
+        status = func(handle, chunk, row_begin, &res, data, nullptr);
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroySpMat(chunk));
+        RETURN_IF_HIPSPARSE_ERROR(status);
+
+        RETURN_IF_CUDA_ERROR(cudaEventRecord(res.consumed[slot], stream));
+
+        row_begin = row_end;
+        slot ^= 1;
     }
+
+    // Staging memory is released on return, thus wait for the computation to finish
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseOrder_t CudaOrderToHIPOrder(cusparseOrder_t op)
-{
-    switch(op)
+// The work space is allocated up front for the largest chunk, such that it counts
+// against the device memory limit. A chunk must not require more than that.
+static hipsparseStatus_t hipsparseStreamedBuffer(const hipsparseStreamedCsr* res, size_t size)
+{
+    return (size > res->buffer_size) ? HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES
+                                     : HIPSPARSE_STATUS_SUCCESS;
+}
+
+struct hipsparseStreamedSpMVData
+{
+    hipsparseOperation_t  opA;
+    const void*           alpha;
+    hipsparseDnVecDescr_t vecX;
+    const void*           beta;
+    char*                 y;
+    size_t                y_size;
+    hipDataType           y_type;
+    hipDataType           computeType;
+    hipsparseSpMVAlg_t    alg;
+};
+
+static hipsparseStatus_t hipsparseStreamedSpMVChunk(hipsparseHandle_t     handle,
+                                                    hipsparseSpMatDescr_t chunk,
+                                                    int64_t               row_begin,
+                                                    hipsparseStreamedCsr* res,
+                                                    void*                 data,
+                                                    size_t*               bufferSize)
+{
+    hipsparseStreamedSpMVData* args = (hipsparseStreamedSpMVData*)data;
+
+    int64_t rows;
+    int64_t cols;
+    int64_t nnz;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetSize(chunk, &rows, &cols, &nnz));
+
+    // Rows of y that belong to this chunk
+    hipsparseDnVecDescr_t vecY;
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseCreateDnVec(&vecY, rows, args->y + args->y_size * row_begin, args->y_type));
+
+    size_t            size;
+    hipsparseStatus_t status = hipsparseSpMV_bufferSize(handle,
+                                                        args->opA,
+                                                        args->alpha,
+                                                        chunk,
+                                                        args->vecX,
+                                                        args->beta,
+                                                        vecY,
+                                                        args->computeType,
+                                                        args->alg,
+                                                        &size);
+
+    // Work space query only
+    if(status == HIPSPARSE_STATUS_SUCCESS && bufferSize != nullptr)
     {
-    case CUSPARSE_ORDER_ROW:
-        return HIPSPARSE_ORDER_ROW;
-    case CUSPARSE_ORDER_COL:
-        return HIPSPARSE_ORDER_COLUMN;
-    default:
-        throw "Non existent cusparseOrder_t";
+        *bufferSize = size;
+    }
+    else if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseStreamedBuffer(res, size);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS && bufferSize == nullptr)
+    {
+        status = hipsparseSpMV(handle,
+                               args->opA,
+                               args->alpha,
+                               chunk,
+                               args->vecX,
+                               args->beta,
+                               vecY,
+                               args->computeType,
+                               args->alg,
+                               res->buffer);
     }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyDnVec(vecY));
+
+    return status;
 }
-#elif(CUDART_VERSION >= 10010)
-cusparseOrder_t hipOrderToCudaOrder(hipsparseOrder_t op)
+
+hipsparseStatus_t hipsparseSpMV_streamed(hipsparseHandle_t           handle,
+                                         hipsparseOperation_t        opA,
+                                         const void*                 alpha,
+                                         const hipsparseSpMatDescr_t matA,
+                                         const hipsparseDnVecDescr_t vecX,
+                                         const void*                 beta,
+                                         const hipsparseDnVecDescr_t vecY,
+                                         hipDataType                 computeType,
+                                         hipsparseSpMVAlg_t          alg,
+                                         size_t                      deviceMemoryLimit)
 {
-    switch(op)
+    if(handle == nullptr)
     {
-    case HIPSPARSE_ORDER_COLUMN:
-        return CUSPARSE_ORDER_COL;
-    default:
-        throw "Non existent hipsparseOrder_t";
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(matA == nullptr || vecX == nullptr || vecY == nullptr || alpha == nullptr
+       || beta == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Row chunks of A only map to contiguous parts of y for non-transposed A
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t     size;
+    void*       values;
+    hipDataType type;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDnVecGet(vecY, &size, &values, &type));
+
+    hipsparseStreamedSpMVData data;
+    data.opA         = opA;
+    data.alpha       = alpha;
+    data.vecX        = vecX;
+    data.beta        = beta;
+    data.y           = (char*)values;
+    data.y_size      = hipsparseDataTypeSize(type);
+    data.y_type      = type;
+    data.computeType = computeType;
+    data.alg         = alg;
+
+    if(data.y_size == 0)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparseStreamCsrRows(
+        handle, matA, deviceMemoryLimit, hipsparseStreamedSpMVChunk, &data);
+}
+
+struct hipsparseStreamedSpMMData
+{
+    hipsparseOperation_t  opA;
+    hipsparseOperation_t  opB;
+    const void*           alpha;
+    hipsparseDnMatDescr_t matB;
+    const void*           beta;
+    char*                 C;
+    int64_t               C_cols;
+    int64_t               ldc;
+    size_t                C_size;
+    hipDataType           C_type;
+    hipsparseOrder_t      C_order;
+    hipDataType           computeType;
+    hipsparseSpMMAlg_t    alg;
+};
+
+static hipsparseStatus_t hipsparseStreamedSpMMChunk(hipsparseHandle_t     handle,
+                                                    hipsparseSpMatDescr_t chunk,
+                                                    int64_t               row_begin,
+                                                    hipsparseStreamedCsr* res,
+                                                    void*                 data,
+                                                    size_t*               bufferSize)
+{
+    hipsparseStreamedSpMMData* args = (hipsparseStreamedSpMMData*)data;
+
+    int64_t rows;
+    int64_t cols;
+    int64_t nnz;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetSize(chunk, &rows, &cols, &nnz));
+
+    // Rows of C that belong to this chunk, the leading dimension is kept
+    int64_t offset
+        = (args->C_order == HIPSPARSE_ORDER_COLUMN) ? row_begin : row_begin * args->ldc;
+
+    hipsparseDnMatDescr_t matC;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateDnMat(&matC,
+                                                   rows,
+                                                   args->C_cols,
+                                                   args->ldc,
+                                                   args->C + args->C_size * offset,
+                                                   args->C_type,
+                                                   args->C_order));
+
+    size_t            size;
+    hipsparseStatus_t status = hipsparseSpMM_bufferSize(handle,
+                                                        args->opA,
+                                                        args->opB,
+                                                        args->alpha,
+                                                        chunk,
+                                                        args->matB,
+                                                        args->beta,
+                                                        matC,
+                                                        args->computeType,
+                                                        args->alg,
+                                                        &size);
+
+    // Work space query only
+    if(status == HIPSPARSE_STATUS_SUCCESS && bufferSize != nullptr)
+    {
+        *bufferSize = size;
+    }
+    else if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseStreamedBuffer(res, size);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS && bufferSize == nullptr)
+    {
+        status = hipsparseSpMM(handle,
+                               args->opA,
+                               args->opB,
+                               args->alpha,
+                               chunk,
+                               args->matB,
+                               args->beta,
+                               matC,
+                               args->computeType,
+                               args->alg,
+                               res->buffer);
     }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matC));
+
+    return status;
 }
 
-hipsparseOrder_t CudaOrderToHIPOrder(cusparseOrder_t op)
+hipsparseStatus_t hipsparseSpMM_streamed(hipsparseHandle_t           handle,
+                                         hipsparseOperation_t        opA,
+                                         hipsparseOperation_t        opB,
+                                         const void*                 alpha,
+                                         const hipsparseSpMatDescr_t matA,
+                                         const hipsparseDnMatDescr_t matB,
+                                         const void*                 beta,
+                                         const hipsparseDnMatDescr_t matC,
+                                         hipDataType                 computeType,
+                                         hipsparseSpMMAlg_t          alg,
+                                         size_t                      deviceMemoryLimit)
 {
-    switch(op)
+    if(handle == nullptr)
     {
-    case CUSPARSE_ORDER_COL:
-        return HIPSPARSE_ORDER_COLUMN;
-    default:
-        throw "Non existent cusparseOrder_t";
+        return HIPSPARSE_STATUS_INVALID_VALUE;
     }
+
+    if(matA == nullptr || matB == nullptr || matC == nullptr || alpha == nullptr
+       || beta == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Row chunks of A only map to row blocks of C for non-transposed A
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t          rows;
+    int64_t          cols;
+    int64_t          ld;
+    void*            values;
+    hipDataType      type;
+    hipsparseOrder_t order;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDnMatGet(matC, &rows, &cols, &ld, &values, &type, &order));
+
+    hipsparseStreamedSpMMData data;
+    data.opA         = opA;
+    data.opB         = opB;
+    data.alpha       = alpha;
+    data.matB        = matB;
+    data.beta        = beta;
+    data.C           = (char*)values;
+    data.C_cols      = cols;
+    data.ldc         = ld;
+    data.C_size      = hipsparseDataTypeSize(type);
+    data.C_type      = type;
+    data.C_order     = order;
+    data.computeType = computeType;
+    data.alg         = alg;
+
+    if(data.C_size == 0)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparseStreamCsrRows(
+        handle, matA, deviceMemoryLimit, hipsparseStreamedSpMMChunk, &data);
+}
+#endif
+
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMM_createDescr((cusparseSpGEMMDescr_t*)descr));
+}
+#endif
+
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMM_destroyDescr((cusparseSpGEMMDescr_t)descr));
+}
+#endif
+
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t      handle,
+                                                 hipsparseOperation_t   opA,
+                                                 hipsparseOperation_t   opB,
+                                                 const void*            alpha,
+                                                 hipsparseSpMatDescr_t  matA,
+                                                 hipsparseSpMatDescr_t  matB,
+                                                 const void*            beta,
+                                                 hipsparseSpMatDescr_t  matC,
+                                                 hipDataType            computeType,
+                                                 hipsparseSpGEMMAlg_t   alg,
+                                                 hipsparseSpGEMMDescr_t spgemmDescr,
+                                                 size_t*                bufferSize1,
+                                                 void*                  externalBuffer1)
+{
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpGEMM_workEstimation((cusparseHandle_t)handle,
+                                      hipOperationToCudaOperation(opA),
+                                      hipOperationToCudaOperation(opB),
+                                      alpha,
+                                      (cusparseSpMatDescr_t)matA,
+                                      (cusparseSpMatDescr_t)matB,
+                                      beta,
+                                      (cusparseSpMatDescr_t)matC,
+                                      computeType,
+                                      hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                      (cusparseSpGEMMDescr_t)spgemmDescr,
+                                      bufferSize1,
+                                      externalBuffer1));
+}
+#endif
+
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t      handle,
+                                          hipsparseOperation_t   opA,
+                                          hipsparseOperation_t   opB,
+                                          const void*            alpha,
+                                          hipsparseSpMatDescr_t  matA,
+                                          hipsparseSpMatDescr_t  matB,
+                                          const void*            beta,
+                                          hipsparseSpMatDescr_t  matC,
+                                          hipDataType            computeType,
+                                          hipsparseSpGEMMAlg_t   alg,
+                                          hipsparseSpGEMMDescr_t spgemmDescr,
+                                          size_t*                bufferSize2,
+                                          void*                  externalBuffer2)
+{
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMM_compute((cusparseHandle_t)handle,
+                                                               hipOperationToCudaOperation(opA),
+                                                               hipOperationToCudaOperation(opB),
+                                                               alpha,
+                                                               (cusparseSpMatDescr_t)matA,
+                                                               (cusparseSpMatDescr_t)matB,
+                                                               beta,
+                                                               (cusparseSpMatDescr_t)matC,
+                                                               computeType,
+                                                               hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                                               (cusparseSpGEMMDescr_t)spgemmDescr,
+                                                               bufferSize2,
+                                                               externalBuffer2));
 }
 #endif
 
-#if(CUDART_VERSION >= 10010)
-cusparseIndexType_t hipIndexTypeToCudaIndexType(hipsparseIndexType_t type)
+#if(CUDART_VERSION >= 11000)
+hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t      handle,
+                                       hipsparseOperation_t   opA,
+                                       hipsparseOperation_t   opB,
+                                       const void*            alpha,
+                                       hipsparseSpMatDescr_t  matA,
+                                       hipsparseSpMatDescr_t  matB,
+                                       const void*            beta,
+                                       hipsparseSpMatDescr_t  matC,
+                                       hipDataType            computeType,
+                                       hipsparseSpGEMMAlg_t   alg,
+                                       hipsparseSpGEMMDescr_t spgemmDescr)
 {
-    switch(type)
-    {
-    case HIPSPARSE_INDEX_16U:
-        return CUSPARSE_INDEX_16U;
-    case HIPSPARSE_INDEX_32I:
-        return CUSPARSE_INDEX_32I;
-    case HIPSPARSE_INDEX_64I:
-        return CUSPARSE_INDEX_64I;
-    default:
-        throw "Non existant hipsparseIndexType_t";
-    }
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMM_copy((cusparseHandle_t)handle,
+                                                            hipOperationToCudaOperation(opA),
+                                                            hipOperationToCudaOperation(opB),
+                                                            alpha,
+                                                            (cusparseSpMatDescr_t)matA,
+                                                            (cusparseSpMatDescr_t)matB,
+                                                            beta,
+                                                            (cusparseSpMatDescr_t)matC,
+                                                            computeType,
+                                                            hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                                            (cusparseSpGEMMDescr_t)spgemmDescr));
 }
+#endif
 
-hipsparseIndexType_t CudaIndexTypeToHIPIndexType(cusparseIndexType_t type)
-{
-    switch(type)
+#if(CUDART_VERSION >= 11000)
+// Device resources of the memory bounded SpGEMM routines
+struct hipsparseChunkedSpGEMM
+{
+    void*                 d_A_row_ptr = nullptr;
+    void*                 d_C_row_ptr = nullptr;
+    hipsparseSpMatDescr_t A_panel     = nullptr;
+    hipsparseSpMatDescr_t C_panel     = nullptr;
+    cusparseSpGEMMDescr_t descr       = nullptr;
+    void*                 buffer1     = nullptr;
+    void*                 buffer2     = nullptr;
+    void*                 d_zero      = nullptr;
+
+    void release_panel()
     {
-    case CUSPARSE_INDEX_16U:
-        return HIPSPARSE_INDEX_16U;
-    case CUSPARSE_INDEX_32I:
-        return HIPSPARSE_INDEX_32I;
-    case CUSPARSE_INDEX_64I:
-        return HIPSPARSE_INDEX_64I;
-    default:
-        throw "Non existant cusparseIndexType_t";
+        if(A_panel != nullptr)
+            hipsparseDestroySpMat(A_panel);
+        if(C_panel != nullptr)
+            hipsparseDestroySpMat(C_panel);
+        if(descr != nullptr)
+            cusparseSpGEMM_destroyDescr(descr);
+        if(buffer1 != nullptr)
+            cudaFree(buffer1);
+        if(buffer2 != nullptr)
+            cudaFree(buffer2);
+
+        A_panel = nullptr;
+        C_panel = nullptr;
+        descr   = nullptr;
+        buffer1 = nullptr;
+        buffer2 = nullptr;
     }
-}
-#endif
 
-#if(CUDART_VERSION >= 11021)
-cusparseSpMVAlg_t hipSpMVAlgToCudaSpMVAlg(hipsparseSpMVAlg_t alg)
-{
-    switch(alg)
+    ~hipsparseChunkedSpGEMM()
     {
-    case HIPSPARSE_MV_ALG_DEFAULT:
-        return CUSPARSE_MV_ALG_DEFAULT;
-    case HIPSPARSE_SPMV_ALG_DEFAULT:
-        return CUSPARSE_SPMV_ALG_DEFAULT;
-    case HIPSPARSE_COOMV_ALG:
-        return CUSPARSE_COOMV_ALG;
-    case HIPSPARSE_SPMV_COO_ALG1:
-        return CUSPARSE_SPMV_COO_ALG1;
-    case HIPSPARSE_SPMV_COO_ALG2:
-        return CUSPARSE_SPMV_COO_ALG2;
-    case HIPSPARSE_CSRMV_ALG1:
-        return CUSPARSE_CSRMV_ALG1;
-    case HIPSPARSE_SPMV_CSR_ALG1:
-        return CUSPARSE_SPMV_CSR_ALG1;
-    case HIPSPARSE_CSRMV_ALG2:
-        return CUSPARSE_CSRMV_ALG2;
-    case HIPSPARSE_SPMV_CSR_ALG2:
-        return CUSPARSE_SPMV_CSR_ALG2;
-    default:
-        throw "Non existant hipsparseSpMVAlg_t";
+        release_panel();
+
+        if(d_A_row_ptr != nullptr)
+            cudaFree(d_A_row_ptr);
+        if(d_C_row_ptr != nullptr)
+            cudaFree(d_C_row_ptr);
+        if(d_zero != nullptr)
+            cudaFree(d_zero);
     }
-}
-#elif(CUDART_VERSION >= 10010)
-cusparseSpMVAlg_t hipSpMVAlgToCudaSpMVAlg(hipsparseSpMVAlg_t alg)
-{
-    switch(alg)
+};
+
+// Computes C = alpha * A * B row panel wise, such that the temporary device memory of a
+// single panel does not exceed the device memory limit. If nnzC is not a null pointer,
+// only the number of non-zero entries of C is determined. Otherwise, the row pointer,
+// column indices and values of C are computed.
+static hipsparseStatus_t hipsparseSpGEMMChunked(hipsparseHandle_t     handle,
+                                                hipsparseOperation_t  opA,
+                                                hipsparseOperation_t  opB,
+                                                const void*           alpha,
+                                                hipsparseSpMatDescr_t matA,
+                                                hipsparseSpMatDescr_t matB,
+                                                hipsparseSpMatDescr_t matC,
+                                                hipDataType           computeType,
+                                                hipsparseSpGEMMAlg_t  alg,
+                                                size_t                deviceMemoryLimit,
+                                                int64_t*              nnzC)
+{
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || matC == nullptr)
     {
-    case HIPSPARSE_MV_ALG_DEFAULT:
-        return CUSPARSE_MV_ALG_DEFAULT;
-    case HIPSPARSE_COOMV_ALG:
-        return CUSPARSE_COOMV_ALG;
-    case HIPSPARSE_CSRMV_ALG1:
-        return CUSPARSE_CSRMV_ALG1;
-    case HIPSPARSE_CSRMV_ALG2:
-        return CUSPARSE_CSRMV_ALG2;
-    default:
-        throw "Non existant hipsparseSpMVAlg_t";
+        return HIPSPARSE_STATUS_INVALID_VALUE;
     }
-}
-#endif
 
-#if(CUDART_VERSION >= 11021)
-cusparseSpMMAlg_t hipSpMMAlgToCudaSpMMAlg(hipsparseSpMMAlg_t alg)
-{
-    switch(alg)
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE || opB != HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
-    case HIPSPARSE_MM_ALG_DEFAULT:
-        return CUSPARSE_MM_ALG_DEFAULT;
-    case HIPSPARSE_COOMM_ALG1:
-        return CUSPARSE_COOMM_ALG1;
-    case HIPSPARSE_COOMM_ALG2:
-        return CUSPARSE_COOMM_ALG2;
-    case HIPSPARSE_COOMM_ALG3:
-        return CUSPARSE_COOMM_ALG3;
-    case HIPSPARSE_CSRMM_ALG1:
-        return CUSPARSE_CSRMM_ALG1;
-    case HIPSPARSE_SPMM_ALG_DEFAULT:
-        return CUSPARSE_SPMM_ALG_DEFAULT;
-    case HIPSPARSE_SPMM_COO_ALG1:
-        return CUSPARSE_SPMM_COO_ALG1;
-    case HIPSPARSE_SPMM_COO_ALG2:
-        return CUSPARSE_SPMM_COO_ALG2;
-    case HIPSPARSE_SPMM_COO_ALG3:
-        return CUSPARSE_SPMM_COO_ALG3;
-    case HIPSPARSE_SPMM_COO_ALG4:
-        return CUSPARSE_SPMM_COO_ALG4;
-    case HIPSPARSE_SPMM_CSR_ALG1:
-        return CUSPARSE_SPMM_CSR_ALG1;
-    case HIPSPARSE_SPMM_CSR_ALG2:
-        return CUSPARSE_SPMM_CSR_ALG2;
-    case HIPSPARSE_SPMM_CSR_ALG3:
-        return CUSPARSE_SPMM_CSR_ALG3;
-    case HIPSPARSE_SPMM_BLOCKED_ELL_ALG1:
-        return CUSPARSE_SPMM_BLOCKED_ELL_ALG1;
-    default:
-        throw "Non existant hipsparseSpMMAlg_t";
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
     }
-}
-#elif(CUDART_VERSION >= 11003)
-cusparseSpMMAlg_t hipSpMMAlgToCudaSpMMAlg(hipsparseSpMMAlg_t alg)
-{
-    switch(alg)
+
+    hipsparseFormat_t format_A;
+    hipsparseFormat_t format_B;
+    hipsparseFormat_t format_C;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matA, &format_A));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matB, &format_B));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matC, &format_C));
+
+    if(format_A != HIPSPARSE_FORMAT_CSR || format_B != HIPSPARSE_FORMAT_CSR
+       || format_C != HIPSPARSE_FORMAT_CSR)
     {
-    case HIPSPARSE_MM_ALG_DEFAULT:
-        return CUSPARSE_MM_ALG_DEFAULT;
-    case HIPSPARSE_COOMM_ALG1:
-        return CUSPARSE_COOMM_ALG1;
-    case HIPSPARSE_COOMM_ALG2:
-        return CUSPARSE_COOMM_ALG2;
-    case HIPSPARSE_COOMM_ALG3:
-        return CUSPARSE_COOMM_ALG3;
-    case HIPSPARSE_CSRMM_ALG1:
-        return CUSPARSE_CSRMM_ALG1;
-    case HIPSPARSE_SPMM_ALG_DEFAULT:
-        return CUSPARSE_SPMM_ALG_DEFAULT;
-    case HIPSPARSE_SPMM_COO_ALG1:
-        return CUSPARSE_SPMM_COO_ALG1;
-    case HIPSPARSE_SPMM_COO_ALG2:
-        return CUSPARSE_SPMM_COO_ALG2;
-    case HIPSPARSE_SPMM_COO_ALG3:
-        return CUSPARSE_SPMM_COO_ALG3;
-    case HIPSPARSE_SPMM_COO_ALG4:
-        return CUSPARSE_SPMM_COO_ALG4;
-    case HIPSPARSE_SPMM_CSR_ALG1:
-        return CUSPARSE_SPMM_CSR_ALG1;
-    case HIPSPARSE_SPMM_CSR_ALG2:
-        return CUSPARSE_SPMM_CSR_ALG2;
-    case HIPSPARSE_SPMM_BLOCKED_ELL_ALG1:
-        return CUSPARSE_SPMM_BLOCKED_ELL_ALG1;
-    default:
-        throw "Non existant hipsparseSpMMAlg_t";
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
     }
-}
-#elif(CUDART_VERSION >= 10010)
-cusparseSpMMAlg_t hipSpMMAlgToCudaSpMMAlg(hipsparseSpMMAlg_t alg)
-{
-    switch(alg)
+
+    int64_t              m;
+    int64_t              k;
+    int64_t              nnz_A;
+    void*                A_row_ptr;
+    void*                A_col_ind;
+    void*                A_val;
+    hipsparseIndexType_t A_row_type;
+    hipsparseIndexType_t A_col_type;
+    hipsparseIndexBase_t A_base;
+    hipDataType          A_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matA,
+                                              &m,
+                                              &k,
+                                              &nnz_A,
+                                              &A_row_ptr,
+                                              &A_col_ind,
+                                              &A_val,
+                                              &A_row_type,
+                                              &A_col_type,
+                                              &A_base,
+                                              &A_val_type));
+
+    int64_t              k_B;
+    int64_t              n;
+    int64_t              nnz_B;
+    void*                B_row_ptr;
+    void*                B_col_ind;
+    void*                B_val;
+    hipsparseIndexType_t B_row_type;
+    hipsparseIndexType_t B_col_type;
+    hipsparseIndexBase_t B_base;
+    hipDataType          B_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matB,
+                                              &k_B,
+                                              &n,
+                                              &nnz_B,
+                                              &B_row_ptr,
+                                              &B_col_ind,
+                                              &B_val,
+                                              &B_row_type,
+                                              &B_col_type,
+                                              &B_base,
+                                              &B_val_type));
+
+    int64_t              m_C;
+    int64_t              n_C;
+    int64_t              nnz_C;
+    void*                C_row_ptr;
+    void*                C_col_ind;
+    void*                C_val;
+    hipsparseIndexType_t C_row_type;
+    hipsparseIndexType_t C_col_type;
+    hipsparseIndexBase_t C_base;
+    hipDataType          C_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matC,
+                                              &m_C,
+                                              &n_C,
+                                              &nnz_C,
+                                              &C_row_ptr,
+                                              &C_col_ind,
+                                              &C_val,
+                                              &C_row_type,
+                                              &C_col_type,
+                                              &C_base,
+                                              &C_val_type));
+
+    if(A_row_type != HIPSPARSE_INDEX_32I || A_col_type != HIPSPARSE_INDEX_32I
+       || B_row_type != HIPSPARSE_INDEX_32I || B_col_type != HIPSPARSE_INDEX_32I
+       || C_row_type != HIPSPARSE_INDEX_32I || C_col_type != HIPSPARSE_INDEX_32I)
     {
-    case HIPSPARSE_MM_ALG_DEFAULT:
-        return CUSPARSE_MM_ALG_DEFAULT;
-    case HIPSPARSE_COOMM_ALG1:
-        return CUSPARSE_COOMM_ALG1;
-    case HIPSPARSE_COOMM_ALG2:
-        return CUSPARSE_COOMM_ALG2;
-    case HIPSPARSE_COOMM_ALG3:
-        return CUSPARSE_COOMM_ALG3;
-    case HIPSPARSE_CSRMM_ALG1:
-        return CUSPARSE_CSRMM_ALG1;
-    default:
-        throw "Non existant hipsparseSpMMAlg_t";
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
     }
-}
-#endif
 
-#if(CUDART_VERSION >= 11031)
-cusparseSpGEMMAlg_t hipSpGEMMAlgToCudaSpGEMMAlg(hipsparseSpGEMMAlg_t alg)
-{
-    switch(alg)
+    if(k != k_B || m != m_C || n != n_C)
     {
-    case HIPSPARSE_SPGEMM_DEFAULT:
-        return CUSPARSE_SPGEMM_DEFAULT;
-    case HIPSPARSE_SPGEMM_CSR_ALG_NONDETERMINISTIC:
-        return CUSPARSE_SPGEMM_CSR_ALG_NONDETERMINITIC;
-    case HIPSPARSE_SPGEMM_CSR_ALG_DETERMINISTIC:
-        return CUSPARSE_SPGEMM_CSR_ALG_NONDETERMINITIC;
-    default:
-        throw "Non existant cusparseSpGEMMAlg_t";
+        return HIPSPARSE_STATUS_INVALID_VALUE;
     }
-}
-#elif(CUDART_VERSION >= 11000)
-cusparseSpGEMMAlg_t hipSpGEMMAlgToCudaSpGEMMAlg(hipsparseSpGEMMAlg_t alg)
-{
-    switch(alg)
+
+    // Quick return
+    if(m == 0)
     {
-    case HIPSPARSE_SPGEMM_DEFAULT:
-        return CUSPARSE_SPGEMM_DEFAULT;
-    default:
-        throw "Non existant cusparseSpGEMMAlg_t";
+        if(nnzC != nullptr)
+        {
+            *nnzC = 0;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
     }
-}
-#endif
 
-#if(CUDART_VERSION >= 11020)
-cusparseSparseToDenseAlg_t hipSpToDnAlgToCudaSpToDnAlg(hipsparseSparseToDenseAlg_t alg)
-{
-    switch(alg)
+    size_t A_val_size = hipsparseDataTypeSize(A_val_type);
+    size_t C_val_size = hipsparseDataTypeSize(C_val_type);
+
+    if(A_val_size == 0 || C_val_size == 0)
     {
-    case HIPSPARSE_SPARSETODENSE_ALG_DEFAULT:
-        return CUSPARSE_SPARSETODENSE_ALG_DEFAULT;
-    default:
-        throw "Non existent hipsparseSparseToDenseAlg_t";
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
     }
-}
 
-hipsparseSparseToDenseAlg_t CudaSpToDnAlgToHipSpToDnAlg(cusparseSparseToDenseAlg_t alg)
-{
-    switch(alg)
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    // Sparsity patterns of A and B on the host (this blocks the host)
+    std::vector<int> hA_row_ptr(m + 1);
+    std::vector<int> hA_col_ind(nnz_A);
+    std::vector<int> hB_row_ptr(k + 1);
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        hA_row_ptr.data(), A_row_ptr, sizeof(int) * (m + 1), cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        hA_col_ind.data(), A_col_ind, sizeof(int) * nnz_A, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        hB_row_ptr.data(), B_row_ptr, sizeof(int) * (k + 1), cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    // Plan the row panels up front. The number of intermediate products of a row bounds
+    // both, the number of non-zero entries and the temporary storage of the row of C.
+    size_t product_size = sizeof(int) + C_val_size;
+
+    std::vector<int64_t> panels;
+    int64_t              max_panel_rows = 0;
+    int64_t              panel_begin    = 0;
+    size_t               panel_bytes    = 0;
+
+    for(int64_t i = 0; i < m; ++i)
     {
-    case CUSPARSE_SPARSETODENSE_ALG_DEFAULT:
-        return HIPSPARSE_SPARSETODENSE_ALG_DEFAULT;
-    default:
-        throw "Non existent cusparseSparseToDenseAlg_t";
+        int64_t products = 0;
+        for(int j = hA_row_ptr[i] - A_base; j < hA_row_ptr[i + 1] - A_base; ++j)
+        {
+            int col = hA_col_ind[j] - A_base;
+
+            if(col < 0 || col >= k)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            products += hB_row_ptr[col + 1] - hB_row_ptr[col];
+        }
+
+        size_t row_bytes = products * product_size + 2 * sizeof(int);
+
+        if(i > panel_begin && panel_bytes + row_bytes > deviceMemoryLimit)
+        {
+            panels.push_back(panel_begin);
+            max_panel_rows = std::max(max_panel_rows, i - panel_begin);
+            panel_begin    = i;
+            panel_bytes    = 0;
+        }
+
+        panel_bytes += row_bytes;
     }
-}
-#endif
 
-#if(CUDART_VERSION >= 11020)
-cusparseDenseToSparseAlg_t hipDnToSpAlgToCudaDnToSpAlg(hipsparseDenseToSparseAlg_t alg)
-{
-    switch(alg)
-    {
-    case HIPSPARSE_DENSETOSPARSE_ALG_DEFAULT:
-        return CUSPARSE_DENSETOSPARSE_ALG_DEFAULT;
-    default:
-        throw "Non existent hipsparseDenseToSparseAlg_t";
+    panels.push_back(panel_begin);
+    max_panel_rows = std::max(max_panel_rows, m - panel_begin);
+
+    // Panels are processed in row order from a stack of [begin, end) pairs, such that
+    // a panel that exceeds the limit can be split in place
+    std::vector<int64_t> stack;
+    for(size_t i = panels.size(); i > 0; --i)
+    {
+        stack.push_back((i == panels.size()) ? m : panels[i]);
+        stack.push_back(panels[i - 1]);
     }
-}
 
-hipsparseDenseToSparseAlg_t CudaDnToSpAlgToHipDnToSpAlg(cusparseDenseToSparseAlg_t alg)
-{
-    switch(alg)
+    hipsparseChunkedSpGEMM res;
+
+    // cuSPARSE requires beta, which is zero in the compute type
+    const double zero[2] = {0.0, 0.0};
+    const void*  beta    = zero;
+
+    cusparsePointerMode_t mode;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetPointerMode((cusparseHandle_t)handle, &mode));
+
+    if(mode == CUSPARSE_POINTER_MODE_DEVICE)
     {
-    case CUSPARSE_DENSETOSPARSE_ALG_DEFAULT:
-        return HIPSPARSE_DENSETOSPARSE_ALG_DEFAULT;
-    default:
-        throw "Non existent cusparseDenseToSparseAlg_t";
+        RETURN_IF_CUDA_ERROR(cudaMalloc(&res.d_zero, sizeof(zero)));
+        RETURN_IF_CUDA_ERROR(cudaMemsetAsync(res.d_zero, 0, sizeof(zero), stream));
+
+        beta = res.d_zero;
     }
-}
-#endif
 
-#if(CUDART_VERSION >= 11022)
-cusparseSDDMMAlg_t hipSDDMMAlgToCudaSDDMMAlg(hipsparseSDDMMAlg_t alg)
-{
-    switch(alg)
+    size_t row_ptr_bytes = sizeof(int) * (max_panel_rows + 1);
+    size_t buffer_limit
+        = (deviceMemoryLimit > 2 * row_ptr_bytes) ? deviceMemoryLimit - 2 * row_ptr_bytes : 0;
+
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&res.d_A_row_ptr, row_ptr_bytes));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&res.d_C_row_ptr, row_ptr_bytes));
+
+    std::vector<int> panel_row_ptr(max_panel_rows + 1);
+    std::vector<int> hC_row_ptr((nnzC == nullptr) ? m + 1 : 0);
+    int64_t          C_offset = 0;
+
+    while(!stack.empty())
     {
-    case HIPSPARSE_SDDMM_ALG_DEFAULT:
-        return CUSPARSE_SDDMM_ALG_DEFAULT;
-    default:
-        throw "Non existant cusparseSDDMMAlg_t";
+        int64_t row_begin = stack.back();
+        stack.pop_back();
+        int64_t row_end = stack.back();
+        stack.pop_back();
+
+        int64_t rows     = row_end - row_begin;
+        int     A_offset = hA_row_ptr[row_begin] - A_base;
+
+        for(int64_t i = 0; i <= rows; ++i)
+        {
+            panel_row_ptr[i] = hA_row_ptr[row_begin + i] - A_offset;
+        }
+
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(res.d_A_row_ptr,
+                                           panel_row_ptr.data(),
+                                           sizeof(int) * (rows + 1),
+                                           cudaMemcpyHostToDevice,
+                                           stream));
+        RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&res.A_panel,
+                                                     rows,
+                                                     k,
+                                                     hA_row_ptr[row_end] - hA_row_ptr[row_begin],
+                                                     res.d_A_row_ptr,
+                                                     (int*)A_col_ind + A_offset,
+                                                     (char*)A_val + A_val_size * A_offset,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     A_base,
+                                                     A_val_type));
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&res.C_panel,
+                                                     rows,
+                                                     n,
+                                                     0,
+                                                     res.d_C_row_ptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     C_base,
+                                                     C_val_type));
+
+        RETURN_IF_CUSPARSE_ERROR(cusparseSpGEMM_createDescr(&res.descr));
+
+        size_t buffer_size1 = 0;
+        size_t buffer_size2 = 0;
+        RETURN_IF_CUSPARSE_ERROR(
+            cusparseSpGEMM_workEstimation((cusparseHandle_t)handle,
+                                          CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                          CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                          alpha,
+                                          (cusparseSpMatDescr_t)res.A_panel,
+                                          (cusparseSpMatDescr_t)matB,
+                                          beta,
+                                          (cusparseSpMatDescr_t)res.C_panel,
+                                          computeType,
+                                          hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                          res.descr,
+                                          &buffer_size1,
+                                          nullptr));
+
+        bool fits = (buffer_size1 <= buffer_limit);
+
+        if(fits)
+        {
+            RETURN_IF_CUDA_ERROR(cudaMalloc(&res.buffer1, buffer_size1));
+            RETURN_IF_CUSPARSE_ERROR(
+                cusparseSpGEMM_workEstimation((cusparseHandle_t)handle,
+                                              CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                              CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                              alpha,
+                                              (cusparseSpMatDescr_t)res.A_panel,
+                                              (cusparseSpMatDescr_t)matB,
+                                              beta,
+                                              (cusparseSpMatDescr_t)res.C_panel,
+                                              computeType,
+                                              hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                              res.descr,
+                                              &buffer_size1,
+                                              res.buffer1));
+
+            RETURN_IF_CUSPARSE_ERROR(cusparseSpGEMM_compute((cusparseHandle_t)handle,
+                                                            CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                            CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                            alpha,
+                                                            (cusparseSpMatDescr_t)res.A_panel,
+                                                            (cusparseSpMatDescr_t)matB,
+                                                            beta,
+                                                            (cusparseSpMatDescr_t)res.C_panel,
+                                                            computeType,
+                                                            hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                                            res.descr,
+                                                            &buffer_size2,
+                                                            nullptr));
+
+            fits = (buffer_size1 + buffer_size2 <= buffer_limit);
+        }
+
+        // Split the panel into halves, if it exceeds the device memory limit
+        if(!fits)
+        {
+            res.release_panel();
+
+            if(rows == 1)
+            {
+                return HIPSPARSE_STATUS_ALLOC_FAILED;
+            }
+
+            int64_t row_mid = row_begin + rows / 2;
+
+            stack.push_back(row_end);
+            stack.push_back(row_mid);
+            stack.push_back(row_mid);
+            stack.push_back(row_begin);
+
+            continue;
+        }
+
+        RETURN_IF_CUDA_ERROR(cudaMalloc(&res.buffer2, buffer_size2));
+        RETURN_IF_CUSPARSE_ERROR(cusparseSpGEMM_compute((cusparseHandle_t)handle,
+                                                        CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                        CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                        alpha,
+                                                        (cusparseSpMatDescr_t)res.A_panel,
+                                                        (cusparseSpMatDescr_t)matB,
+                                                        beta,
+                                                        (cusparseSpMatDescr_t)res.C_panel,
+                                                        computeType,
+                                                        hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                                        res.descr,
+                                                        &buffer_size2,
+                                                        res.buffer2));
+
+        int64_t panel_rows;
+        int64_t panel_cols;
+        int64_t panel_nnz;
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparseSpMatGetSize(res.C_panel, &panel_rows, &panel_cols, &panel_nnz));
+
+        if(C_offset + panel_nnz > std::numeric_limits<int>::max())
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(nnzC == nullptr)
+        {
+            if(C_offset + panel_nnz > nnz_C)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(
+                hipsparseCsrSetPointers(res.C_panel,
+                                        res.d_C_row_ptr,
+                                        (int*)C_col_ind + C_offset,
+                                        (char*)C_val + C_val_size * C_offset));
+
+            RETURN_IF_CUSPARSE_ERROR(cusparseSpGEMM_copy((cusparseHandle_t)handle,
+                                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                         alpha,
+                                                         (cusparseSpMatDescr_t)res.A_panel,
+                                                         (cusparseSpMatDescr_t)matB,
+                                                         beta,
+                                                         (cusparseSpMatDescr_t)res.C_panel,
+                                                         computeType,
+                                                         hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                                         res.descr));
+
+            // Shift the panel row pointer to the global row pointer of C
+            RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(panel_row_ptr.data(),
+                                               res.d_C_row_ptr,
+                                               sizeof(int) * (rows + 1),
+                                               cudaMemcpyDeviceToHost,
+                                               stream));
+            RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+            for(int64_t i = 0; i <= rows; ++i)
+            {
+                hC_row_ptr[row_begin + i] = panel_row_ptr[i] + (int)C_offset;
+            }
+        }
+
+        C_offset += panel_nnz;
+
+        res.release_panel();
     }
-}
-#endif
 
-#if(CUDART_VERSION >= 11030)
-cusparseSpSVAlg_t hipSpSVAlgToCudaSpSVAlg(hipsparseSpSVAlg_t alg)
-{
-    switch(alg)
+    if(nnzC != nullptr)
     {
-    case HIPSPARSE_SPSV_ALG_DEFAULT:
-        return CUSPARSE_SPSV_ALG_DEFAULT;
-    default:
-        throw "Non existant cusparseSpSVAlg_t";
+        *nnzC = C_offset;
+
+        return HIPSPARSE_STATUS_SUCCESS;
     }
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        C_row_ptr, hC_row_ptr.data(), sizeof(int) * (m + 1), cudaMemcpyHostToDevice, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 11031)
-cusparseSpSMAlg_t hipSpSMAlgToCudaSpSMAlg(hipsparseSpSMAlg_t alg)
+hipsparseStatus_t hipsparseSpGEMM_chunkedNnz(hipsparseHandle_t     handle,
+                                             hipsparseOperation_t  opA,
+                                             hipsparseOperation_t  opB,
+                                             const void*           alpha,
+                                             hipsparseSpMatDescr_t matA,
+                                             hipsparseSpMatDescr_t matB,
+                                             hipsparseSpMatDescr_t matC,
+                                             hipDataType           computeType,
+                                             hipsparseSpGEMMAlg_t  alg,
+                                             size_t                deviceMemoryLimit,
+                                             int64_t*              nnzC)
 {
-    switch(alg)
+    if(nnzC == nullptr)
     {
-    case HIPSPARSE_SPSM_ALG_DEFAULT:
-        return CUSPARSE_SPSM_ALG_DEFAULT;
-    default:
-        throw "Non existant cusparseSpSMAlg_t";
+        return HIPSPARSE_STATUS_INVALID_VALUE;
     }
-}
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
-                                       int64_t                size,
-                                       int64_t                nnz,
-                                       void*                  indices,
-                                       void*                  values,
-                                       hipsparseIndexType_t   idxType,
-                                       hipsparseIndexBase_t   idxBase,
-                                       hipDataType            valueType)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseCreateSpVec((cusparseSpVecDescr_t*)spVecDescr,
-                                                            size,
-                                                            nnz,
-                                                            indices,
-                                                            values,
-                                                            hipIndexTypeToCudaIndexType(idxType),
-                                                            hipIndexBaseToCudaIndexBase(idxBase),
-                                                            hipDataTypeToCudaDataType(valueType)));
+    return hipsparseSpGEMMChunked(handle,
+                                  opA,
+                                  opB,
+                                  alpha,
+                                  matA,
+                                  matB,
+                                  matC,
+                                  computeType,
+                                  alg,
+                                  deviceMemoryLimit,
+                                  nnzC);
+}
+
+hipsparseStatus_t hipsparseSpGEMM_chunkedCompute(hipsparseHandle_t     handle,
+                                                 hipsparseOperation_t  opA,
+                                                 hipsparseOperation_t  opB,
+                                                 const void*           alpha,
+                                                 hipsparseSpMatDescr_t matA,
+                                                 hipsparseSpMatDescr_t matB,
+                                                 hipsparseSpMatDescr_t matC,
+                                                 hipDataType           computeType,
+                                                 hipsparseSpGEMMAlg_t  alg,
+                                                 size_t                deviceMemoryLimit)
+{
+    return hipsparseSpGEMMChunked(handle,
+                                  opA,
+                                  opB,
+                                  alpha,
+                                  matA,
+                                  matB,
+                                  matC,
+                                  computeType,
+                                  alg,
+                                  deviceMemoryLimit,
+                                  nullptr);
 }
 #endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDestroySpVec(hipsparseSpVecDescr_t spVecDescr)
+#if(CUDART_VERSION >= 11031)
+hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t      handle,
+                                                      hipsparseOperation_t   opA,
+                                                      hipsparseOperation_t   opB,
+                                                      hipsparseSpMatDescr_t  matA,
+                                                      hipsparseSpMatDescr_t  matB,
+                                                      hipsparseSpMatDescr_t  matC,
+                                                      hipsparseSpGEMMAlg_t   alg,
+                                                      hipsparseSpGEMMDescr_t spgemmDescr,
+                                                      size_t*                bufferSize1,
+                                                      void*                  externalBuffer1)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDestroySpVec((cusparseSpVecDescr_t)spVecDescr));
+    return hipCUSPARSEStatusToHIPStatus(
+        cusparseSpGEMMreuse_workEstimation((cusparseHandle_t)handle,
+                                           hipOperationToCudaOperation(opA),
+                                           hipOperationToCudaOperation(opB),
+                                           (cusparseSpMatDescr_t)matA,
+                                           (cusparseSpMatDescr_t)matB,
+                                           (cusparseSpMatDescr_t)matC,
+                                           hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                           (cusparseSpGEMMDescr_t)spgemmDescr,
+                                           bufferSize1,
+                                           externalBuffer1));
 }
 #endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
-                                    int64_t*                    size,
-                                    int64_t*                    nnz,
-                                    void**                      indices,
-                                    void**                      values,
-                                    hipsparseIndexType_t*       idxType,
-                                    hipsparseIndexBase_t*       idxBase,
-                                    hipDataType*                valueType)
+#if(CUDART_VERSION >= 11031)
+hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t      handle,
+                                           hipsparseOperation_t   opA,
+                                           hipsparseOperation_t   opB,
+                                           hipsparseSpMatDescr_t  matA,
+                                           hipsparseSpMatDescr_t  matB,
+                                           hipsparseSpMatDescr_t  matC,
+                                           hipsparseSpGEMMAlg_t   alg,
+                                           hipsparseSpGEMMDescr_t spgemmDescr,
+                                           size_t*                bufferSize2,
+                                           void*                  externalBuffer2,
+                                           size_t*                bufferSize3,
+                                           void*                  externalBuffer3,
+                                           size_t*                bufferSize4,
+                                           void*                  externalBuffer4)
 {
-    cusparseIndexType_t cuda_index_type;
-    cusparseIndexBase_t cuda_index_base;
-    cudaDataType        cuda_data_type;
-
-    RETURN_IF_CUSPARSE_ERROR(cusparseSpVecGet((const cusparseSpVecDescr_t)spVecDescr,
-                                              size,
-                                              nnz,
-                                              indices,
-                                              values,
-                                              idxType != nullptr ? &cuda_index_type : nullptr,
-                                              idxBase != nullptr ? &cuda_index_base : nullptr,
-                                              valueType != nullptr ? &cuda_data_type : nullptr));
-
-    *idxType   = CudaIndexTypeToHIPIndexType(cuda_index_type);
-    *idxBase   = CudaIndexBaseToHIPIndexBase(cuda_index_base);
-    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
-
-    return HIPSPARSE_STATUS_SUCCESS;
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMMreuse_nnz((cusparseHandle_t)handle,
+                                                                hipOperationToCudaOperation(opA),
+                                                                hipOperationToCudaOperation(opB),
+                                                                (cusparseSpMatDescr_t)matA,
+                                                                (cusparseSpMatDescr_t)matB,
+                                                                (cusparseSpMatDescr_t)matC,
+                                                                hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                                                (cusparseSpGEMMDescr_t)spgemmDescr,
+                                                                bufferSize2,
+                                                                externalBuffer2,
+                                                                bufferSize3,
+                                                                externalBuffer3,
+                                                                bufferSize4,
+                                                                externalBuffer4));
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpVecGetIndexBase(const hipsparseSpVecDescr_t spVecDescr,
-                                             hipsparseIndexBase_t*       idxBase)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpVecGetIndexBase(
-        (const cusparseSpVecDescr_t)spVecDescr, (cusparseIndexBase_t*)idxBase));
-}
 #endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpVecGetValues(const hipsparseSpVecDescr_t spVecDescr, void** values)
+#if(CUDART_VERSION >= 11031)
+hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t      handle,
+                                               hipsparseOperation_t   opA,
+                                               hipsparseOperation_t   opB,
+                                               const void*            alpha,
+                                               hipsparseSpMatDescr_t  matA,
+                                               hipsparseSpMatDescr_t  matB,
+                                               const void*            beta,
+                                               hipsparseSpMatDescr_t  matC,
+                                               hipDataType            computeType,
+                                               hipsparseSpGEMMAlg_t   alg,
+                                               hipsparseSpGEMMDescr_t spgemmDescr)
 {
     return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpVecGetValues((const cusparseSpVecDescr_t)spVecDescr, values));
+        cusparseSpGEMMreuse_compute((cusparseHandle_t)handle,
+                                    hipOperationToCudaOperation(opA),
+                                    hipOperationToCudaOperation(opB),
+                                    alpha,
+                                    (cusparseSpMatDescr_t)matA,
+                                    (cusparseSpMatDescr_t)matB,
+                                    beta,
+                                    (cusparseSpMatDescr_t)matC,
+                                    computeType,
+                                    hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                    (cusparseSpGEMMDescr_t)spgemmDescr));
 }
 #endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpVecSetValues(hipsparseSpVecDescr_t spVecDescr, void* values)
+#if(CUDART_VERSION >= 11031)
+hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t      handle,
+                                            hipsparseOperation_t   opA,
+                                            hipsparseOperation_t   opB,
+                                            hipsparseSpMatDescr_t  matA,
+                                            hipsparseSpMatDescr_t  matB,
+                                            hipsparseSpMatDescr_t  matC,
+                                            hipsparseSpGEMMAlg_t   alg,
+                                            hipsparseSpGEMMDescr_t spgemmDescr,
+                                            size_t*                bufferSize5,
+                                            void*                  externalBuffer5)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpVecSetValues((const cusparseSpVecDescr_t)spVecDescr, values));
+    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMMreuse_copy((cusparseHandle_t)handle,
+                                                                 hipOperationToCudaOperation(opA),
+                                                                 hipOperationToCudaOperation(opB),
+                                                                 (cusparseSpMatDescr_t)matA,
+                                                                 (cusparseSpMatDescr_t)matB,
+                                                                 (cusparseSpMatDescr_t)matC,
+                                                                 hipSpGEMMAlgToCudaSpGEMMAlg(alg),
+                                                                 (cusparseSpGEMMDescr_t)spgemmDescr,
+                                                                 bufferSize5,
+                                                                 externalBuffer5));
 }
+
 #endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
-                                     int64_t                rows,
-                                     int64_t                cols,
-                                     int64_t                nnz,
-                                     void*                  cooRowInd,
-                                     void*                  cooColInd,
-                                     void*                  cooValues,
-                                     hipsparseIndexType_t   cooIdxType,
-                                     hipsparseIndexBase_t   idxBase,
-                                     hipDataType            valueType)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseCreateCoo((cusparseSpMatDescr_t*)spMatDescr,
-                                                          rows,
-                                                          cols,
-                                                          nnz,
-                                                          cooRowInd,
-                                                          cooColInd,
-                                                          cooValues,
-                                                          hipIndexTypeToCudaIndexType(cooIdxType),
-                                                          hipIndexBaseToCudaIndexBase(idxBase),
-                                                          hipDataTypeToCudaDataType(valueType)));
+#if(CUDART_VERSION >= 11031)
+// Galerkin triple product descriptor. It holds the intermediate product A * P, as well as
+// the SpGEMM descriptors and the persistent buffers of both products.
+struct hipsparseSpRAPDescr
+{
+    hipsparseSpGEMMDescr_t descr_AP      = nullptr;
+    hipsparseSpGEMMDescr_t descr_RAP     = nullptr;
+    hipsparseSpMatDescr_t  AP            = nullptr;
+    void*                  AP_row_ptr    = nullptr;
+    void*                  AP_col_ind    = nullptr;
+    void*                  AP_val        = nullptr;
+    void*                  buffer_AP[5]  = {nullptr, nullptr, nullptr, nullptr, nullptr};
+    void*                  buffer_RAP[5] = {nullptr, nullptr, nullptr, nullptr, nullptr};
+
+    void clear()
+    {
+        for(int i = 0; i < 5; ++i)
+        {
+            if(buffer_AP[i] != nullptr)
+                cudaFree(buffer_AP[i]);
+            if(buffer_RAP[i] != nullptr)
+                cudaFree(buffer_RAP[i]);
+
+            buffer_AP[i]  = nullptr;
+            buffer_RAP[i] = nullptr;
+        }
+
+        if(descr_AP != nullptr)
+            hipsparseSpGEMM_destroyDescr(descr_AP);
+        if(descr_RAP != nullptr)
+            hipsparseSpGEMM_destroyDescr(descr_RAP);
+        if(AP != nullptr)
+            hipsparseDestroySpMat(AP);
+        if(AP_row_ptr != nullptr)
+            cudaFree(AP_row_ptr);
+        if(AP_col_ind != nullptr)
+            cudaFree(AP_col_ind);
+        if(AP_val != nullptr)
+            cudaFree(AP_val);
+
+        descr_AP   = nullptr;
+        descr_RAP  = nullptr;
+        AP         = nullptr;
+        AP_row_ptr = nullptr;
+        AP_col_ind = nullptr;
+        AP_val     = nullptr;
+    }
+
+    ~hipsparseSpRAPDescr()
+    {
+        clear();
+    }
+};
+
+// Work estimation and nnz stages of a reusable SpGEMM. Buffers 1 and 2 are released once
+// the non-zero pattern of C has been determined.
+static hipsparseStatus_t hipsparseSpRAPNnz(hipsparseHandle_t      handle,
+                                           hipsparseSpMatDescr_t  matA,
+                                           hipsparseSpMatDescr_t  matB,
+                                           hipsparseSpMatDescr_t  matC,
+                                           hipsparseSpGEMMAlg_t   alg,
+                                           hipsparseSpGEMMDescr_t spgemmDescr,
+                                           void**                 buffer)
+{
+    hipsparseOperation_t op = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+    size_t buffer_size1;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_workEstimation(
+        handle, op, op, matA, matB, matC, alg, spgemmDescr, &buffer_size1, nullptr));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&buffer[0], buffer_size1));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_workEstimation(
+        handle, op, op, matA, matB, matC, alg, spgemmDescr, &buffer_size1, buffer[0]));
+
+    size_t buffer_size2;
+    size_t buffer_size3;
+    size_t buffer_size4;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_nnz(handle,
+                                                       op,
+                                                       op,
+                                                       matA,
+                                                       matB,
+                                                       matC,
+                                                       alg,
+                                                       spgemmDescr,
+                                                       &buffer_size2,
+                                                       nullptr,
+                                                       &buffer_size3,
+                                                       nullptr,
+                                                       &buffer_size4,
+                                                       nullptr));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&buffer[1], buffer_size2));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&buffer[2], buffer_size3));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&buffer[3], buffer_size4));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_nnz(handle,
+                                                       op,
+                                                       op,
+                                                       matA,
+                                                       matB,
+                                                       matC,
+                                                       alg,
+                                                       spgemmDescr,
+                                                       &buffer_size2,
+                                                       buffer[1],
+                                                       &buffer_size3,
+                                                       buffer[2],
+                                                       &buffer_size4,
+                                                       buffer[3]));
+
+    RETURN_IF_CUDA_ERROR(cudaFree(buffer[0]));
+    RETURN_IF_CUDA_ERROR(cudaFree(buffer[1]));
+
+    buffer[0] = nullptr;
+    buffer[1] = nullptr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
-                                        int64_t                rows,
-                                        int64_t                cols,
-                                        int64_t                nnz,
-                                        void*                  cooInd,
-                                        void*                  cooValues,
-                                        hipsparseIndexType_t   cooIdxType,
-                                        hipsparseIndexBase_t   idxBase,
-                                        hipDataType            valueType)
+// Copy stage of a reusable SpGEMM, which fills the column indices of C. Buffer 3 is
+// released afterwards, buffers 4 and 5 are kept for the numerical stage.
+static hipsparseStatus_t hipsparseSpRAPCopy(hipsparseHandle_t      handle,
+                                            hipsparseSpMatDescr_t  matA,
+                                            hipsparseSpMatDescr_t  matB,
+                                            hipsparseSpMatDescr_t  matC,
+                                            hipsparseSpGEMMAlg_t   alg,
+                                            hipsparseSpGEMMDescr_t spgemmDescr,
+                                            void**                 buffer)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateCooAoS((cusparseSpMatDescr_t*)spMatDescr,
-                             rows,
-                             cols,
-                             nnz,
-                             cooInd,
-                             cooValues,
-                             hipIndexTypeToCudaIndexType(cooIdxType),
-                             hipIndexBaseToCudaIndexBase(idxBase),
-                             hipDataTypeToCudaDataType(valueType)));
+    hipsparseOperation_t op = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+    size_t buffer_size5;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_copy(
+        handle, op, op, matA, matB, matC, alg, spgemmDescr, &buffer_size5, nullptr));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&buffer[4], buffer_size5));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_copy(
+        handle, op, op, matA, matB, matC, alg, spgemmDescr, &buffer_size5, buffer[4]));
+
+    RETURN_IF_CUDA_ERROR(cudaFree(buffer[2]));
+
+    buffer[2] = nullptr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
-                                     int64_t                rows,
-                                     int64_t                cols,
-                                     int64_t                nnz,
-                                     void*                  csrRowOffsets,
-                                     void*                  csrColInd,
-                                     void*                  csrValues,
-                                     hipsparseIndexType_t   csrRowOffsetsType,
-                                     hipsparseIndexType_t   csrColIndType,
-                                     hipsparseIndexBase_t   idxBase,
-                                     hipDataType            valueType)
+hipsparseStatus_t hipsparseSpRAP_createDescr(hipsparseSpRAPDescr_t* descr)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateCsr((cusparseSpMatDescr_t*)spMatDescr,
-                          rows,
-                          cols,
-                          nnz,
-                          csrRowOffsets,
-                          csrColInd,
-                          csrValues,
-                          hipIndexTypeToCudaIndexType(csrRowOffsetsType),
-                          hipIndexTypeToCudaIndexType(csrColIndType),
-                          hipIndexBaseToCudaIndexBase(idxBase),
-                          hipDataTypeToCudaDataType(valueType)));
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new hipsparseSpRAPDescr;
+    return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 11020)
-hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
-                                     int64_t                rows,
-                                     int64_t                cols,
-                                     int64_t                nnz,
-                                     void*                  cscColOffsets,
-                                     void*                  cscRowInd,
-                                     void*                  cscValues,
-                                     hipsparseIndexType_t   cscColOffsetsType,
-                                     hipsparseIndexType_t   cscRowIndType,
-                                     hipsparseIndexBase_t   idxBase,
-                                     hipDataType            valueType)
+hipsparseStatus_t hipsparseSpRAP_destroyDescr(hipsparseSpRAPDescr_t descr)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateCsc((cusparseSpMatDescr_t*)spMatDescr,
-                          rows,
-                          cols,
-                          nnz,
-                          cscColOffsets,
-                          cscRowInd,
-                          cscValues,
-                          hipIndexTypeToCudaIndexType(cscColOffsetsType),
-                          hipIndexTypeToCudaIndexType(cscRowIndType),
-                          hipIndexBaseToCudaIndexBase(idxBase),
-                          hipDataTypeToCudaDataType(valueType)));
+    if(descr != nullptr)
+    {
+        delete descr;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 11021)
-hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
-                                            int64_t                rows,
-                                            int64_t                cols,
-                                            int64_t                ellBlockSize,
-                                            int64_t                ellCols,
-                                            void*                  ellColInd,
-                                            void*                  ellValue,
-                                            hipsparseIndexType_t   ellIdxType,
-                                            hipsparseIndexBase_t   idxBase,
-                                            hipDataType            valueType)
+hipsparseStatus_t hipsparseSpRAP_nnz(hipsparseHandle_t     handle,
+                                     hipsparseSpMatDescr_t matR,
+                                     hipsparseSpMatDescr_t matA,
+                                     hipsparseSpMatDescr_t matP,
+                                     hipsparseSpMatDescr_t matC,
+                                     hipsparseSpGEMMAlg_t  alg,
+                                     hipsparseSpRAPDescr_t rapDescr)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateBlockedEll((cusparseSpMatDescr_t*)spMatDescr,
-                                 rows,
-                                 cols,
-                                 ellBlockSize,
-                                 ellCols,
-                                 ellColInd,
-                                 ellValue,
-                                 hipIndexTypeToCudaIndexType(ellIdxType),
-                                 hipIndexBaseToCudaIndexBase(idxBase),
-                                 hipDataTypeToCudaDataType(valueType)));
+    if(handle == nullptr || matR == nullptr || matA == nullptr || matP == nullptr
+       || matC == nullptr || rapDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t              m;
+    int64_t              k;
+    int64_t              nnz_A;
+    void*                A_row_ptr;
+    void*                A_col_ind;
+    void*                A_val;
+    hipsparseIndexType_t A_row_type;
+    hipsparseIndexType_t A_col_type;
+    hipsparseIndexBase_t A_base;
+    hipDataType          A_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matA,
+                                              &m,
+                                              &k,
+                                              &nnz_A,
+                                              &A_row_ptr,
+                                              &A_col_ind,
+                                              &A_val,
+                                              &A_row_type,
+                                              &A_col_type,
+                                              &A_base,
+                                              &A_val_type));
+
+    int64_t              k_P;
+    int64_t              n;
+    int64_t              nnz_P;
+    void*                P_row_ptr;
+    void*                P_col_ind;
+    void*                P_val;
+    hipsparseIndexType_t P_row_type;
+    hipsparseIndexType_t P_col_type;
+    hipsparseIndexBase_t P_base;
+    hipDataType          P_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matP,
+                                              &k_P,
+                                              &n,
+                                              &nnz_P,
+                                              &P_row_ptr,
+                                              &P_col_ind,
+                                              &P_val,
+                                              &P_row_type,
+                                              &P_col_type,
+                                              &P_base,
+                                              &P_val_type));
+
+    if(k != k_P)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Release the data of a previous analysis
+    rapDescr->clear();
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGEMM_createDescr(&rapDescr->descr_AP));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGEMM_createDescr(&rapDescr->descr_RAP));
+
+    // Intermediate product A * P, using the row pointer type of A and the column index
+    // type of P
+    size_t row_size = (A_row_type == HIPSPARSE_INDEX_32I) ? sizeof(int32_t) : sizeof(int64_t);
+    size_t col_size = (P_col_type == HIPSPARSE_INDEX_32I) ? sizeof(int32_t) : sizeof(int64_t);
+    size_t val_size = hipsparseDataTypeSize(A_val_type);
+
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&rapDescr->AP_row_ptr, row_size * (m + 1)));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&rapDescr->AP,
+                                                 m,
+                                                 n,
+                                                 0,
+                                                 rapDescr->AP_row_ptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 A_row_type,
+                                                 P_col_type,
+                                                 A_base,
+                                                 A_val_type));
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpRAPNnz(
+        handle, matA, matP, rapDescr->AP, alg, rapDescr->descr_AP, rapDescr->buffer_AP));
+
+    int64_t AP_rows;
+    int64_t AP_cols;
+    int64_t AP_nnz;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetSize(rapDescr->AP, &AP_rows, &AP_cols, &AP_nnz));
+
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&rapDescr->AP_col_ind, col_size * AP_nnz));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&rapDescr->AP_val, val_size * AP_nnz));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrSetPointers(
+        rapDescr->AP, rapDescr->AP_row_ptr, rapDescr->AP_col_ind, rapDescr->AP_val));
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpRAPCopy(
+        handle, matA, matP, rapDescr->AP, alg, rapDescr->descr_AP, rapDescr->buffer_AP));
+
+    // Non-zero pattern of R * (A * P)
+    return hipsparseSpRAPNnz(
+        handle, matR, rapDescr->AP, matC, alg, rapDescr->descr_RAP, rapDescr->buffer_RAP);
+}
+
+hipsparseStatus_t hipsparseSpRAP_copy(hipsparseHandle_t     handle,
+                                      hipsparseSpMatDescr_t matR,
+                                      hipsparseSpMatDescr_t matA,
+                                      hipsparseSpMatDescr_t matP,
+                                      hipsparseSpMatDescr_t matC,
+                                      hipsparseSpGEMMAlg_t  alg,
+                                      hipsparseSpRAPDescr_t rapDescr)
+{
+    if(handle == nullptr || matR == nullptr || matA == nullptr || matP == nullptr
+       || matC == nullptr || rapDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // hipsparseSpRAP_nnz has to be called first
+    if(rapDescr->AP == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparseSpRAPCopy(
+        handle, matR, rapDescr->AP, matC, alg, rapDescr->descr_RAP, rapDescr->buffer_RAP);
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDestroySpMat(hipsparseSpMatDescr_t spMatDescr)
+hipsparseStatus_t hipsparseSpRAP_compute(hipsparseHandle_t     handle,
+                                         const void*           alpha,
+                                         hipsparseSpMatDescr_t matR,
+                                         hipsparseSpMatDescr_t matA,
+                                         hipsparseSpMatDescr_t matP,
+                                         const void*           beta,
+                                         hipsparseSpMatDescr_t matC,
+                                         hipDataType           computeType,
+                                         hipsparseSpGEMMAlg_t  alg,
+                                         hipsparseSpRAPDescr_t rapDescr)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseDestroySpMat((cusparseSpMatDescr_t)spMatDescr));
+    if(handle == nullptr || alpha == nullptr || matR == nullptr || matA == nullptr
+       || matP == nullptr || beta == nullptr || matC == nullptr || rapDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // hipsparseSpRAP_nnz and hipsparseSpRAP_copy have to be called first
+    if(rapDescr->AP == nullptr || rapDescr->buffer_RAP[4] == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Unit and zero scalars in the compute type, where complex scalars store the real
+    // part first
+    char one[16]{};
+    char zero[16]{};
+
+    switch(computeType)
+    {
+    case HIP_R_32F:
+    case HIP_C_32F:
+        *(float*)one = 1.0f;
+        break;
+    case HIP_R_64F:
+    case HIP_C_64F:
+        *(double*)one = 1.0;
+        break;
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipsparseOperation_t op = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+    // A * P is computed with host scalars, independently of the pointer mode of the handle
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    hipsparseStatus_t status = hipsparseSpGEMMreuse_compute(handle,
+                                                            op,
+                                                            op,
+                                                            one,
+                                                            matA,
+                                                            matP,
+                                                            zero,
+                                                            rapDescr->AP,
+                                                            computeType,
+                                                            alg,
+                                                            rapDescr->descr_AP);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+    RETURN_IF_HIPSPARSE_ERROR(status);
+
+    return hipsparseSpGEMMreuse_compute(handle,
+                                        op,
+                                        op,
+                                        alpha,
+                                        matR,
+                                        rapDescr->AP,
+                                        beta,
+                                        matC,
+                                        computeType,
+                                        alg,
+                                        rapDescr->descr_RAP);
 }
 #endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
-                                  int64_t*                    rows,
-                                  int64_t*                    cols,
-                                  int64_t*                    nnz,
-                                  void**                      cooRowInd,
-                                  void**                      cooColInd,
-                                  void**                      cooValues,
-                                  hipsparseIndexType_t*       idxType,
-                                  hipsparseIndexBase_t*       idxBase,
-                                  hipDataType*                valueType)
-{
-    cusparseIndexType_t cuda_index_type;
-    cusparseIndexBase_t cuda_index_base;
-    cudaDataType        cuda_data_type;
+#if(CUDART_VERSION >= 11000)
+// Computes B = P * A * P^T for square CSR matrices with 32 bit indices, where row p[i] of
+// A becomes row i of B. The column indices of each row of B are sorted.
+static hipsparseStatus_t hipsparseCsrSymPermute(hipsparseHandle_t       handle,
+                                                hipsparseSpMatDescr_t   matA,
+                                                const std::vector<int>& p,
+                                                hipsparseSpMatDescr_t   matB)
+{
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    void*                A_row_ptr;
+    void*                A_col_ind;
+    void*                A_val;
+    hipsparseIndexType_t A_row_type;
+    hipsparseIndexType_t A_col_type;
+    hipsparseIndexBase_t A_base;
+    hipDataType          A_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matA,
+                                              &m,
+                                              &n,
+                                              &nnz,
+                                              &A_row_ptr,
+                                              &A_col_ind,
+                                              &A_val,
+                                              &A_row_type,
+                                              &A_col_type,
+                                              &A_base,
+                                              &A_val_type));
+
+    int64_t              m_B;
+    int64_t              n_B;
+    int64_t              nnz_B;
+    void*                B_row_ptr;
+    void*                B_col_ind;
+    void*                B_val;
+    hipsparseIndexType_t B_row_type;
+    hipsparseIndexType_t B_col_type;
+    hipsparseIndexBase_t B_base;
+    hipDataType          B_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matB,
+                                              &m_B,
+                                              &n_B,
+                                              &nnz_B,
+                                              &B_row_ptr,
+                                              &B_col_ind,
+                                              &B_val,
+                                              &B_row_type,
+                                              &B_col_type,
+                                              &B_base,
+                                              &B_val_type));
+
+    if(m != n || m_B != m || n_B != n || nnz_B != nnz || A_val_type != B_val_type
+       || (int64_t)p.size() != m)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
 
-    RETURN_IF_CUSPARSE_ERROR(cusparseCooGet((const cusparseSpMatDescr_t)spMatDescr,
-                                            rows,
-                                            cols,
-                                            nnz,
-                                            cooRowInd,
-                                            cooColInd,
-                                            cooValues,
-                                            idxType != nullptr ? &cuda_index_type : nullptr,
-                                            idxBase != nullptr ? &cuda_index_base : nullptr,
-                                            valueType != nullptr ? &cuda_data_type : nullptr));
+    if(A_row_type != HIPSPARSE_INDEX_32I || A_col_type != HIPSPARSE_INDEX_32I
+       || B_row_type != HIPSPARSE_INDEX_32I || B_col_type != HIPSPARSE_INDEX_32I)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
 
-    *idxType   = CudaIndexTypeToHIPIndexType(cuda_index_type);
-    *idxBase   = CudaIndexBaseToHIPIndexBase(cuda_index_base);
-    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
+    // Quick return
+    if(m == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(A_row_ptr == nullptr || A_col_ind == nullptr || A_val == nullptr || B_row_ptr == nullptr
+       || B_col_ind == nullptr || B_val == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    size_t val_size = hipsparseDataTypeSize(A_val_type);
+
+    std::vector<int>  row_ptr(m + 1);
+    std::vector<int>  col_ind(nnz);
+    std::vector<char> val(val_size * nnz);
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        row_ptr.data(), A_row_ptr, sizeof(int) * (m + 1), cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        col_ind.data(), A_col_ind, sizeof(int) * nnz, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(
+        cudaMemcpyAsync(val.data(), A_val, val_size * nnz, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    // q is the inverse of p
+    std::vector<int> q(m);
+
+    for(int64_t i = 0; i < m; ++i)
+    {
+        q[p[i]] = (int)i;
+    }
+
+    // B = P * A * P^T, with the column indices of each row sorted
+    std::vector<int>  B_ptr(m + 1);
+    std::vector<int>  B_col(nnz);
+    std::vector<char> B_v(val_size * nnz);
+    std::vector<int>  order;
+
+    B_ptr[0] = B_base;
+
+    for(int64_t i = 0; i < m; ++i)
+    {
+        int row_begin = row_ptr[p[i]] - A_base;
+        int row_end   = row_ptr[p[i] + 1] - A_base;
+        int offset    = B_ptr[i] - B_base;
+
+        order.resize(row_end - row_begin);
+
+        for(int j = row_begin; j < row_end; ++j)
+        {
+            order[j - row_begin] = j;
+        }
+
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            return q[col_ind[a] - A_base] < q[col_ind[b] - A_base];
+        });
+
+        for(size_t j = 0; j < order.size(); ++j)
+        {
+            B_col[offset + j] = q[col_ind[order[j]] - A_base] + B_base;
+            memcpy(&B_v[val_size * (offset + j)], &val[val_size * order[j]], val_size);
+        }
+
+        B_ptr[i + 1] = B_ptr[i] + (row_end - row_begin);
+    }
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        B_row_ptr, B_ptr.data(), sizeof(int) * (m + 1), cudaMemcpyHostToDevice, stream));
+    RETURN_IF_CUDA_ERROR(
+        cudaMemcpyAsync(B_col_ind, B_col.data(), sizeof(int) * nnz, cudaMemcpyHostToDevice, stream));
+    RETURN_IF_CUDA_ERROR(
+        cudaMemcpyAsync(B_val, B_v.data(), val_size * nnz, cudaMemcpyHostToDevice, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
-                                     int64_t*                    rows,
-                                     int64_t*                    cols,
-                                     int64_t*                    nnz,
-                                     void**                      cooInd,
-                                     void**                      cooValues,
-                                     hipsparseIndexType_t*       idxType,
-                                     hipsparseIndexBase_t*       idxBase,
-                                     hipDataType*                valueType)
+hipsparseStatus_t hipsparseCsrColorPermute(hipsparseHandle_t     handle,
+                                           hipsparseSpMatDescr_t matA,
+                                           int                   ncolors,
+                                           const int*            coloring,
+                                           int*                  perm,
+                                           int*                  colorPtr,
+                                           hipsparseSpMatDescr_t matB)
 {
-    cusparseIndexType_t cuda_index_type;
-    cusparseIndexBase_t cuda_index_base;
-    cudaDataType        cuda_data_type;
+    if(handle == nullptr || matA == nullptr || coloring == nullptr || colorPtr == nullptr
+       || matB == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(ncolors < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetSize(matA, &m, &n, &nnz));
+
+    // The coloring is computed on square matrices
+    if(m != n)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
 
-    RETURN_IF_CUSPARSE_ERROR(cusparseCooAoSGet((const cusparseSpMatDescr_t)spMatDescr,
-                                               rows,
-                                               cols,
-                                               nnz,
-                                               cooInd,
-                                               cooValues,
-                                               idxType != nullptr ? &cuda_index_type : nullptr,
-                                               idxBase != nullptr ? &cuda_index_base : nullptr,
-                                               valueType != nullptr ? &cuda_data_type : nullptr));
+    for(int c = 0; c <= ncolors; ++c)
+    {
+        colorPtr[c] = 0;
+    }
 
-    *idxType   = CudaIndexTypeToHIPIndexType(cuda_index_type);
-    *idxBase   = CudaIndexBaseToHIPIndexBase(cuda_index_base);
-    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
-}
-#endif
+    std::vector<int> color(m);
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
-                                  int64_t*                    rows,
-                                  int64_t*                    cols,
-                                  int64_t*                    nnz,
-                                  void**                      csrRowOffsets,
-                                  void**                      csrColInd,
-                                  void**                      csrValues,
-                                  hipsparseIndexType_t*       csrRowOffsetsType,
-                                  hipsparseIndexType_t*       csrColIndType,
-                                  hipsparseIndexBase_t*       idxBase,
-                                  hipDataType*                valueType)
-{
-    cusparseIndexType_t cuda_row_index_type;
-    cusparseIndexType_t cuda_col_index_type;
-    cusparseIndexBase_t cuda_index_base;
-    cudaDataType        cuda_data_type;
+    if(m > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            color.data(), coloring, sizeof(int) * m, cudaMemcpyDeviceToHost, stream));
+        RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+    }
 
-    RETURN_IF_CUSPARSE_ERROR(
-        cusparseCsrGet((const cusparseSpMatDescr_t)spMatDescr,
-                       rows,
-                       cols,
-                       nnz,
-                       csrRowOffsets,
-                       csrColInd,
-                       csrValues,
-                       csrRowOffsetsType != nullptr ? &cuda_row_index_type : nullptr,
-                       csrColIndType != nullptr ? &cuda_col_index_type : nullptr,
-                       idxBase != nullptr ? &cuda_index_base : nullptr,
-                       valueType != nullptr ? &cuda_data_type : nullptr));
+    // Stable counting sort of the rows by color, such that the row order within each
+    // color is preserved
+    for(int64_t i = 0; i < m; ++i)
+    {
+        if(color[i] < 0 || color[i] >= ncolors)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
 
-    *csrRowOffsetsType = CudaIndexTypeToHIPIndexType(cuda_row_index_type);
-    *csrColIndType     = CudaIndexTypeToHIPIndexType(cuda_col_index_type);
-    *idxBase           = CudaIndexBaseToHIPIndexBase(cuda_index_base);
-    *valueType         = CudaDataTypeToHIPDataType(cuda_data_type);
+        ++colorPtr[color[i] + 1];
+    }
+
+    for(int c = 0; c < ncolors; ++c)
+    {
+        colorPtr[c + 1] += colorPtr[c];
+    }
+
+    // p[i] is the row of A that becomes row i of B
+    std::vector<int> p(m);
+    std::vector<int> next(colorPtr, colorPtr + ncolors);
+
+    for(int64_t i = 0; i < m; ++i)
+    {
+        p[next[color[i]]++] = (int)i;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrSymPermute(handle, matA, p, matB));
+
+    if(perm != nullptr && m > 0)
+    {
+        RETURN_IF_CUDA_ERROR(
+            cudaMemcpyAsync(perm, p.data(), sizeof(int) * m, cudaMemcpyHostToDevice, stream));
+        RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+    }
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 11021)
-hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
-                                         int64_t*                    rows,
-                                         int64_t*                    cols,
-                                         int64_t*                    ellBlockSize,
-                                         int64_t*                    ellCols,
-                                         void**                      ellColInd,
-                                         void**                      ellValue,
-                                         hipsparseIndexType_t*       ellIdxType,
-                                         hipsparseIndexBase_t*       idxBase,
-                                         hipDataType*                valueType)
+// Breadth first search through the unnumbered nodes connected to root. Returns the number
+// of levels and, in last, the node of least degree in the last level.
+static int hipsparseRcmLevels(int                      root,
+                              const std::vector<int>&  adj_ptr,
+                              const std::vector<int>&  adj_ind,
+                              const std::vector<char>& numbered,
+                              std::vector<int>&        level,
+                              std::vector<int>&        nodes,
+                              int*                     last)
 {
-    // As of cusparse 11.4.1, this routine does not actually exist as a symbol in the cusparse
-    // library (the documentation indicates that it should exist starting at cusparse 11.2.1).
-    // Uncomment once it has been added
-    // cusparseIndexType_t cuda_index_type;
-    // cusparseIndexBase_t cuda_index_base;
-    // cudaDataType        cuda_data_type;
+    nodes.clear();
+    nodes.push_back(root);
+    level[root] = 0;
 
-    // RETURN_IF_CUSPARSE_ERROR(
-    //     cusparseBlockedEllGet((cusparseSpMatDescr_t)spMatDescr,
-    //                           rows,
-    //                           cols,
-    //                           ellBlockSize,
-    //                           ellCols,
-    //                           ellColInd,
-    //                           ellValue,
-    //                           ellIdxType != nullptr ? &cuda_index_type : nullptr,
-    //                           idxBase != nullptr ? &cuda_index_base : nullptr,
-    //                           valueType != nullptr ? &cuda_data_type : nullptr));
+    for(size_t k = 0; k < nodes.size(); ++k)
+    {
+        int i = nodes[k];
+
+        for(int j = adj_ptr[i]; j < adj_ptr[i + 1]; ++j)
+        {
+            int c = adj_ind[j];
+
+            if(!numbered[c] && level[c] < 0)
+            {
+                level[c] = level[i] + 1;
+                nodes.push_back(c);
+            }
+        }
+    }
 
-    // *ellIdxType = CudaIndexTypeToHIPIndexType(cuda_index_type);
-    // *idxBase    = CudaIndexBaseToHIPIndexBase(cuda_index_base);
-    // *valueType  = CudaDataTypeToHIPDataType(cuda_data_type);
+    int depth = level[nodes.back()];
 
-    // return HIPSPARSE_STATUS_SUCCESS;
-    return HIPSPARSE_STATUS_NOT_SUPPORTED;
-}
-#endif
+    *last = nodes.back();
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
-                                          void*                 csrRowOffsets,
-                                          void*                 csrColInd,
-                                          void*                 csrValues)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseCsrSetPointers(
-        (cusparseSpMatDescr_t)spMatDescr, csrRowOffsets, csrColInd, csrValues));
-}
-#endif
+    for(size_t k = nodes.size(); k-- > 0 && level[nodes[k]] == depth;)
+    {
+        int i = nodes[k];
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseSpMatGetSize(hipsparseSpMatDescr_t spMatDescr,
-                                        int64_t*              rows,
-                                        int64_t*              cols,
-                                        int64_t*              nnz)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatGetSize((cusparseSpMatDescr_t)spMatDescr, rows, cols, nnz));
+        if(adj_ptr[i + 1] - adj_ptr[i] <= adj_ptr[*last + 1] - adj_ptr[*last])
+        {
+            *last = i;
+        }
+    }
+
+    // Reset the levels for the next search
+    for(size_t k = 0; k < nodes.size(); ++k)
+    {
+        level[nodes[k]] = -1;
+    }
+
+    return depth + 1;
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMatGetFormat(const hipsparseSpMatDescr_t spMatDescr,
-                                          hipsparseFormat_t*          format)
+hipsparseStatus_t hipsparseCsrRcm(hipsparseHandle_t handle, hipsparseSpMatDescr_t matA, int* perm)
 {
-    cusparseFormat_t cuda_format;
+    if(handle == nullptr || matA == nullptr || perm == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
 
-    RETURN_IF_CUSPARSE_ERROR(cusparseSpMatGetFormat((const cusparseSpMatDescr_t)spMatDescr,
-                                                    format != nullptr ? &cuda_format : nullptr));
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    void*                A_row_ptr;
+    void*                A_col_ind;
+    void*                A_val;
+    hipsparseIndexType_t A_row_type;
+    hipsparseIndexType_t A_col_type;
+    hipsparseIndexBase_t A_base;
+    hipDataType          A_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matA,
+                                              &m,
+                                              &n,
+                                              &nnz,
+                                              &A_row_ptr,
+                                              &A_col_ind,
+                                              &A_val,
+                                              &A_row_type,
+                                              &A_col_type,
+                                              &A_base,
+                                              &A_val_type));
+
+    if(m != n)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
 
-    *format = CudaFormatToHIPFormat(cuda_format);
+    if(A_row_type != HIPSPARSE_INDEX_32I || A_col_type != HIPSPARSE_INDEX_32I)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
 
-    return HIPSPARSE_STATUS_SUCCESS;
-}
-#endif
+    // Quick return
+    if(m == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMatGetIndexBase(const hipsparseSpMatDescr_t spMatDescr,
-                                             hipsparseIndexBase_t*       idxBase)
-{
-    cusparseIndexBase_t cuda_index_base;
+    if(A_row_ptr == nullptr || (nnz > 0 && A_col_ind == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
 
-    RETURN_IF_CUSPARSE_ERROR(cusparseSpMatGetIndexBase(
-        (const cusparseSpMatDescr_t)spMatDescr, idxBase != nullptr ? &cuda_index_base : nullptr));
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
 
-    *idxBase = CudaIndexBaseToHIPIndexBase(cuda_index_base);
+    std::vector<int> row_ptr(m + 1);
+    std::vector<int> col_ind(nnz);
 
-    return HIPSPARSE_STATUS_SUCCESS;
-}
-#endif
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        row_ptr.data(), A_row_ptr, sizeof(int) * (m + 1), cudaMemcpyDeviceToHost, stream));
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void** values)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatGetValues((cusparseSpMatDescr_t)spMatDescr, values));
-}
-#endif
+    if(nnz > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            col_ind.data(), A_col_ind, sizeof(int) * nnz, cudaMemcpyDeviceToHost, stream));
+    }
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void* values)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatSetValues((cusparseSpMatDescr_t)spMatDescr, values));
-}
-#endif
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMatGetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int* batchCount)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatGetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount));
-}
-#endif
+    // Graph of A + A^T without self loops
+    std::vector<int> adj_ptr(m + 1, 0);
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMatSetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int batchCount)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatSetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount));
-}
-#endif
+    for(int64_t i = 0; i < m; ++i)
+    {
+        for(int j = row_ptr[i] - A_base; j < row_ptr[i + 1] - A_base; ++j)
+        {
+            int c = col_ind[j] - A_base;
+
+            if(c < 0 || c >= m)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            if(c != i)
+            {
+                ++adj_ptr[i + 1];
+                ++adj_ptr[c + 1];
+            }
+        }
+    }
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseCooSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
-                                              int                   batchCount,
-                                              int64_t               batchStride)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseCooSetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount, batchStride));
-}
-#endif
+    for(int64_t i = 0; i < m; ++i)
+    {
+        adj_ptr[i + 1] += adj_ptr[i];
+    }
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
-                                              int                   batchCount,
-                                              int64_t               offsetsBatchStride,
-                                              int64_t               columnsValuesBatchStride)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseCsrSetStridedBatch((cusparseSpMatDescr_t)spMatDescr,
-                                                                   batchCount,
-                                                                   offsetsBatchStride,
-                                                                   columnsValuesBatchStride));
-}
-#endif
+    std::vector<int> adj_ind(adj_ptr[m]);
+    std::vector<int> next(adj_ptr.begin(), adj_ptr.end() - 1);
 
-#if(CUDART_VERSION >= 11031)
-hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseSpMatDescr_t     spMatDescr,
-                                             hipsparseSpMatAttribute_t attribute,
-                                             void*                     data,
-                                             size_t                    dataSize)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpMatGetAttribute(
-        (cusparseSpMatDescr_t)spMatDescr, (cusparseSpMatAttribute_t)attribute, data, dataSize));
-}
-#endif
+    for(int64_t i = 0; i < m; ++i)
+    {
+        for(int j = row_ptr[i] - A_base; j < row_ptr[i + 1] - A_base; ++j)
+        {
+            int c = col_ind[j] - A_base;
+
+            if(c != i)
+            {
+                adj_ind[next[i]++] = c;
+                adj_ind[next[c]++] = (int)i;
+            }
+        }
+    }
 
-#if(CUDART_VERSION >= 11031)
-hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDescr,
-                                             hipsparseSpMatAttribute_t attribute,
-                                             const void*               data,
-                                             size_t                    dataSize)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatSetAttribute((cusparseSpMatDescr_t)spMatDescr,
-                                  (cusparseSpMatAttribute_t)attribute,
-                                  const_cast<void*>(data),
-                                  dataSize));
-}
-#endif
+    // Remove duplicated edges, e.g. of entries that are stored in both triangles
+    int nedges = 0;
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
-                                       int64_t                size,
-                                       void*                  values,
-                                       hipDataType            valueType)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseCreateDnVec(
-        (cusparseDnVecDescr_t*)dnVecDescr, size, values, hipDataTypeToCudaDataType(valueType)));
-}
-#endif
+    for(int64_t i = 0; i < m; ++i)
+    {
+        auto begin = adj_ind.begin() + adj_ptr[i];
+        auto end   = adj_ind.begin() + adj_ptr[i + 1];
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDestroyDnVec(hipsparseDnVecDescr_t dnVecDescr)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseDestroyDnVec((cusparseDnVecDescr_t)dnVecDescr));
-}
-#endif
+        std::sort(begin, end);
+        end = std::unique(begin, end);
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
-                                    int64_t*                    size,
-                                    void**                      values,
-                                    hipDataType*                valueType)
-{
-    cudaDataType cuda_data_type;
+        adj_ptr[i] = nedges;
+        nedges     = (int)(std::copy(begin, end, adj_ind.begin() + nedges) - adj_ind.begin());
+    }
 
-    RETURN_IF_CUSPARSE_ERROR(cusparseDnVecGet((const cusparseDnVecDescr_t)dnVecDescr,
-                                              size,
-                                              values,
-                                              valueType != nullptr ? &cuda_data_type : nullptr));
+    adj_ptr[m] = nedges;
 
-    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
+    // Start nodes of the components are taken in order of increasing degree
+    std::vector<int> by_degree(m);
 
-    return HIPSPARSE_STATUS_SUCCESS;
-}
-#endif
+    for(int64_t i = 0; i < m; ++i)
+    {
+        by_degree[i] = (int)i;
+    }
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDnVecGetValues(const hipsparseDnVecDescr_t dnVecDescr, void** values)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDnVecGetValues((const cusparseDnVecDescr_t)dnVecDescr, values));
-}
-#endif
+    std::stable_sort(by_degree.begin(), by_degree.end(), [&](int a, int b) {
+        return adj_ptr[a + 1] - adj_ptr[a] < adj_ptr[b + 1] - adj_ptr[b];
+    });
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDnVecSetValues(hipsparseDnVecDescr_t dnVecDescr, void* values)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDnVecSetValues((cusparseDnVecDescr_t)dnVecDescr, values));
-}
-#endif
+    std::vector<char> numbered(m, 0);
+    std::vector<int>  level(m, -1);
+    std::vector<int>  nodes;
+    std::vector<int>  order;
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseCreateDnMat(hipsparseDnMatDescr_t* dnMatDescr,
-                                       int64_t                rows,
-                                       int64_t                cols,
-                                       int64_t                ld,
-                                       void*                  values,
-                                       hipDataType            valueType,
-                                       hipsparseOrder_t       order)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseCreateDnMat((cusparseDnMatDescr_t*)dnMatDescr,
-                                                            rows,
-                                                            cols,
-                                                            ld,
-                                                            values,
-                                                            hipDataTypeToCudaDataType(valueType),
-                                                            hipOrderToCudaOrder(order)));
-}
-#endif
+    order.reserve(m);
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDestroyDnMat(hipsparseDnMatDescr_t dnMatDescr)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseDestroyDnMat((cusparseDnMatDescr_t)dnMatDescr));
-}
-#endif
+    for(int64_t s = 0; s < m; ++s)
+    {
+        if(numbered[by_degree[s]])
+        {
+            continue;
+        }
+
+        // Pseudo-peripheral root, i.e. a node of large eccentricity, following George and Liu
+        int root = by_degree[s];
+        int last;
+        int depth = hipsparseRcmLevels(root, adj_ptr, adj_ind, numbered, level, nodes, &last);
+
+        while(true)
+        {
+            int candidate = last;
+            int candidate_depth
+                = hipsparseRcmLevels(candidate, adj_ptr, adj_ind, numbered, level, nodes, &last);
+
+            if(candidate_depth <= depth)
+            {
+                break;
+            }
+
+            root  = candidate;
+            depth = candidate_depth;
+        }
+
+        // Cuthill-McKee numbering, visiting the neighbors in order of increasing degree
+        size_t first = order.size();
+
+        numbered[root] = 1;
+        order.push_back(root);
+
+        for(size_t k = first; k < order.size(); ++k)
+        {
+            int    i     = order[k];
+            size_t begin = order.size();
+
+            for(int j = adj_ptr[i]; j < adj_ptr[i + 1]; ++j)
+            {
+                int c = adj_ind[j];
+
+                if(!numbered[c])
+                {
+                    numbered[c] = 1;
+                    order.push_back(c);
+                }
+            }
+
+            std::stable_sort(order.begin() + begin, order.end(), [&](int a, int b) {
+                return adj_ptr[a + 1] - adj_ptr[a] < adj_ptr[b + 1] - adj_ptr[b];
+            });
+        }
+    }
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
-                                    int64_t*                    rows,
-                                    int64_t*                    cols,
-                                    int64_t*                    ld,
-                                    void**                      values,
-                                    hipDataType*                valueType,
-                                    hipsparseOrder_t*           order)
-{
-    cudaDataType    cuda_data_type;
-    cusparseOrder_t cusparse_order;
-    hipCUSPARSEStatusToHIPStatus(cusparseDnMatGet((const cusparseDnMatDescr_t)dnMatDescr,
-                                                  rows,
-                                                  cols,
-                                                  ld,
-                                                  values,
-                                                  valueType != nullptr ? &cuda_data_type : nullptr,
-                                                  order != nullptr ? &cusparse_order : nullptr));
+    // Reversing the order reduces the fill of a subsequent factorization
+    std::reverse(order.begin(), order.end());
 
-    *valueType = CudaDataTypeToHIPDataType(cuda_data_type);
-    *order     = CudaOrderToHIPOrder(cusparse_order);
+    RETURN_IF_CUDA_ERROR(
+        cudaMemcpyAsync(perm, order.data(), sizeof(int) * m, cudaMemcpyHostToDevice, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDnMatGetValues(const hipsparseDnMatDescr_t dnMatDescr, void** values)
+hipsparseStatus_t hipsparseCsrPermute(hipsparseHandle_t     handle,
+                                      hipsparseSpMatDescr_t matA,
+                                      const int*            perm,
+                                      hipsparseSpMatDescr_t matB)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDnMatGetValues((const cusparseDnMatDescr_t)dnMatDescr, values));
-}
-#endif
+    if(handle == nullptr || matA == nullptr || perm == nullptr || matB == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDnMatSetValues(hipsparseDnMatDescr_t dnMatDescr, void* values)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDnMatSetValues((cusparseDnMatDescr_t)dnMatDescr, values));
-}
-#endif
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDnMatGetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
-                                                int*                  batchCount,
-                                                int64_t*              batchStride)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDnMatGetStridedBatch((cusparseDnMatDescr_t)dnMatDescr, batchCount, batchStride));
-}
-#endif
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetSize(matA, &m, &n, &nnz));
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseDnMatSetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
-                                                int                   batchCount,
-                                                int64_t               batchStride)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDnMatSetStridedBatch((cusparseDnMatDescr_t)dnMatDescr, batchCount, batchStride));
-}
-#endif
+    if(m != n)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t     handle,
-                                 const void*           alpha,
-                                 hipsparseSpVecDescr_t vecX,
-                                 const void*           beta,
-                                 hipsparseDnVecDescr_t vecY)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseAxpby((cusparseHandle_t)handle,
-                                                      alpha,
-                                                      (cusparseSpVecDescr_t)vecX,
-                                                      beta,
-                                                      (cusparseDnVecDescr_t)vecY));
-}
-#endif
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseGather(hipsparseHandle_t     handle,
-                                  hipsparseDnVecDescr_t vecY,
-                                  hipsparseSpVecDescr_t vecX)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseGather(
-        (cusparseHandle_t)handle, (cusparseDnVecDescr_t)vecY, (cusparseSpVecDescr_t)vecX));
-}
-#endif
+    std::vector<int> p(m);
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseScatter(hipsparseHandle_t     handle,
-                                   hipsparseSpVecDescr_t vecX,
-                                   hipsparseDnVecDescr_t vecY)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseScatter(
-        (cusparseHandle_t)handle, (cusparseSpVecDescr_t)vecX, (cusparseDnVecDescr_t)vecY));
-}
-#endif
+    if(m > 0)
+    {
+        RETURN_IF_CUDA_ERROR(
+            cudaMemcpyAsync(p.data(), perm, sizeof(int) * m, cudaMemcpyDeviceToHost, stream));
+        RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+    }
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
-                               const void*           c_coeff,
-                               const void*           s_coeff,
-                               hipsparseSpVecDescr_t vecX,
-                               hipsparseDnVecDescr_t vecY)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseRot((cusparseHandle_t)handle,
-                                                    c_coeff,
-                                                    s_coeff,
-                                                    (cusparseSpVecDescr_t)vecX,
-                                                    (cusparseDnVecDescr_t)vecY));
-}
-#endif
+    // perm has to be a permutation of 0, ..., m - 1
+    std::vector<char> seen(m, 0);
 
-#if(CUDART_VERSION >= 11020)
-hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t           handle,
-                                                    hipsparseSpMatDescr_t       matA,
-                                                    hipsparseDnMatDescr_t       matB,
-                                                    hipsparseSparseToDenseAlg_t alg,
-                                                    size_t*                     bufferSize)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSparseToDense_bufferSize((cusparseHandle_t)handle,
-                                         (cusparseSpMatDescr_t)matA,
-                                         (cusparseDnMatDescr_t)matB,
-                                         hipSpToDnAlgToCudaSpToDnAlg(alg),
-                                         bufferSize));
-}
-#endif
+    for(int64_t i = 0; i < m; ++i)
+    {
+        if(p[i] < 0 || p[i] >= m || seen[p[i]])
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
 
-#if(CUDART_VERSION >= 11020)
-hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
-                                         hipsparseSpMatDescr_t       matA,
-                                         hipsparseDnMatDescr_t       matB,
-                                         hipsparseSparseToDenseAlg_t alg,
-                                         void*                       externalBuffer)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseSparseToDense((cusparseHandle_t)handle,
-                                                              (cusparseSpMatDescr_t)matA,
-                                                              (cusparseDnMatDescr_t)matB,
-                                                              hipSpToDnAlgToCudaSpToDnAlg(alg),
-                                                              externalBuffer));
-}
-#endif
+        seen[p[i]] = 1;
+    }
 
-#if(CUDART_VERSION >= 11020)
-hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t           handle,
-                                                    hipsparseDnMatDescr_t       matA,
-                                                    hipsparseSpMatDescr_t       matB,
-                                                    hipsparseDenseToSparseAlg_t alg,
-                                                    size_t*                     bufferSize)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDenseToSparse_bufferSize((cusparseHandle_t)handle,
-                                         (cusparseDnMatDescr_t)matA,
-                                         (cusparseSpMatDescr_t)matB,
-                                         hipDnToSpAlgToCudaDnToSpAlg(alg),
-                                         bufferSize));
+    return hipsparseCsrSymPermute(handle, matA, p, matB);
 }
-#endif
 
-#if(CUDART_VERSION >= 11020)
-hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           handle,
-                                                  hipsparseDnMatDescr_t       matA,
-                                                  hipsparseSpMatDescr_t       matB,
-                                                  hipsparseDenseToSparseAlg_t alg,
-                                                  void*                       externalBuffer)
+// Multicolor Gauss-Seidel descriptor. Rows of each color form an independent block, whose
+// update x_c += omega * D_c^-1 * (b_c - A_c * x) consists of two SpMVs. A_c is a view into
+// the rows of A with a rebased row pointer, D_c^-1 a diagonal CSR matrix.
+struct hipsparseSpGSDescr
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDenseToSparse_analysis((cusparseHandle_t)handle,
-                                       (cusparseDnMatDescr_t)matA,
-                                       (cusparseSpMatDescr_t)matB,
-                                       hipDnToSpAlgToCudaDnToSpAlg(alg),
-                                       externalBuffer));
-}
-#endif
+    int                                ncolors = 0;
+    std::vector<int>                   color_ptr;
+    std::vector<hipsparseSpMatDescr_t> A_c;
+    std::vector<hipsparseSpMatDescr_t> D_c;
+    hipDataType                        compute_type = HIP_R_32F;
+    int*                               row_ptr      = nullptr;
+    int*                               identity     = nullptr;
+    void*                              inv_diag     = nullptr;
+    void*                              r            = nullptr;
+    std::vector<void*>                 buffer;
 
-#if(CUDART_VERSION >= 11020)
-hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           handle,
-                                                 hipsparseDnMatDescr_t       matA,
-                                                 hipsparseSpMatDescr_t       matB,
-                                                 hipsparseDenseToSparseAlg_t alg,
-                                                 void*                       externalBuffer)
+    void clear()
+    {
+        for(size_t c = 0; c < A_c.size(); ++c)
+        {
+            if(A_c[c] != nullptr)
+                hipsparseDestroySpMat(A_c[c]);
+            if(D_c[c] != nullptr)
+                hipsparseDestroySpMat(D_c[c]);
+        }
+
+        for(size_t i = 0; i < buffer.size(); ++i)
+        {
+            if(buffer[i] != nullptr)
+                cudaFree(buffer[i]);
+        }
+
+        if(row_ptr != nullptr)
+            cudaFree(row_ptr);
+        if(identity != nullptr)
+            cudaFree(identity);
+        if(inv_diag != nullptr)
+            cudaFree(inv_diag);
+        if(r != nullptr)
+            cudaFree(r);
+
+        ncolors = 0;
+        color_ptr.clear();
+        A_c.clear();
+        D_c.clear();
+        buffer.clear();
+        row_ptr  = nullptr;
+        identity = nullptr;
+        inv_diag = nullptr;
+        r        = nullptr;
+    }
+
+    ~hipsparseSpGSDescr()
+    {
+        clear();
+    }
+};
+
+// Unit and negative unit scalars in the compute type, where complex scalars store the
+// real part first
+static hipsparseStatus_t hipsparseSpGSScalars(hipDataType computeType, char* one, char* minus_one)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseDenseToSparse_convert((cusparseHandle_t)handle,
-                                      (cusparseDnMatDescr_t)matA,
-                                      (cusparseSpMatDescr_t)matB,
-                                      hipDnToSpAlgToCudaDnToSpAlg(alg),
-                                      externalBuffer));
+    switch(computeType)
+    {
+    case HIP_R_32F:
+    case HIP_C_32F:
+        *(float*)one       = 1.0f;
+        *(float*)minus_one = -1.0f;
+        return HIPSPARSE_STATUS_SUCCESS;
+    case HIP_R_64F:
+    case HIP_C_64F:
+        *(double*)one       = 1.0;
+        *(double*)minus_one = -1.0;
+        return HIPSPARSE_STATUS_SUCCESS;
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t     handle,
-                                           hipsparseOperation_t  opX,
-                                           hipsparseSpVecDescr_t vecX,
-                                           hipsparseDnVecDescr_t vecY,
-                                           void*                 result,
-                                           hipDataType           computeType,
-                                           size_t*               bufferSize)
+// Inverts a diagonal entry on the host, returns false for a zero entry
+static bool hipsparseSpGSInvert(hipDataType computeType, const char* d, char* inv)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpVV_bufferSize((cusparseHandle_t)handle,
-                                hipOperationToCudaOperation(opX),
-                                (cusparseSpVecDescr_t)vecX,
-                                (cusparseDnVecDescr_t)vecY,
-                                result,
-                                hipDataTypeToCudaDataType(computeType),
-                                bufferSize));
+    switch(computeType)
+    {
+    case HIP_R_32F:
+    {
+        float v = *(const float*)d;
+        if(v == 0.0f)
+            return false;
+        *(float*)inv = 1.0f / v;
+        return true;
+    }
+    case HIP_R_64F:
+    {
+        double v = *(const double*)d;
+        if(v == 0.0)
+            return false;
+        *(double*)inv = 1.0 / v;
+        return true;
+    }
+    case HIP_C_32F:
+    {
+        const float* v = (const float*)d;
+        float        s = v[0] * v[0] + v[1] * v[1];
+        if(s == 0.0f)
+            return false;
+        ((float*)inv)[0] = v[0] / s;
+        ((float*)inv)[1] = -v[1] / s;
+        return true;
+    }
+    case HIP_C_64F:
+    {
+        const double* v = (const double*)d;
+        double        s = v[0] * v[0] + v[1] * v[1];
+        if(s == 0.0)
+            return false;
+        ((double*)inv)[0] = v[0] / s;
+        ((double*)inv)[1] = -v[1] / s;
+        return true;
+    }
+    default:
+        return false;
+    }
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t     handle,
-                                hipsparseOperation_t  opX,
-                                hipsparseSpVecDescr_t vecX,
-                                hipsparseDnVecDescr_t vecY,
-                                void*                 result,
-                                hipDataType           computeType,
-                                void*                 externalBuffer)
+hipsparseStatus_t hipsparseSpGS_createDescr(hipsparseSpGSDescr_t* descr)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpVV((cusparseHandle_t)handle,
-                                                     hipOperationToCudaOperation(opX),
-                                                     (cusparseSpVecDescr_t)vecX,
-                                                     (cusparseDnVecDescr_t)vecY,
-                                                     result,
-                                                     hipDataTypeToCudaDataType(computeType),
-                                                     externalBuffer));
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new hipsparseSpGSDescr;
+    return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
-                                           hipsparseOperation_t        opA,
-                                           const void*                 alpha,
-                                           const hipsparseSpMatDescr_t matA,
-                                           const hipsparseDnVecDescr_t vecX,
-                                           const void*                 beta,
-                                           const hipsparseDnVecDescr_t vecY,
-                                           hipDataType                 computeType,
-                                           hipsparseSpMVAlg_t          alg,
-                                           size_t*                     bufferSize)
+hipsparseStatus_t hipsparseSpGS_destroyDescr(hipsparseSpGSDescr_t descr)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMV_bufferSize((cusparseHandle_t)handle,
-                                hipOperationToCudaOperation(opA),
-                                alpha,
-                                (const cusparseSpMatDescr_t)matA,
-                                (const cusparseDnVecDescr_t)vecX,
-                                beta,
-                                (const cusparseDnVecDescr_t)vecY,
-                                hipDataTypeToCudaDataType(computeType),
-                                hipSpMVAlgToCudaSpMVAlg(alg),
-                                bufferSize));
+    if(descr != nullptr)
+    {
+        delete descr;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
-                                           hipsparseOperation_t        opA,
-                                           const void*                 alpha,
-                                           const hipsparseSpMatDescr_t matA,
-                                           const hipsparseDnVecDescr_t vecX,
-                                           const void*                 beta,
-                                           const hipsparseDnVecDescr_t vecY,
-                                           hipDataType                 computeType,
-                                           hipsparseSpMVAlg_t          alg,
-                                           void*                       externalBuffer)
+hipsparseStatus_t hipsparseSpGS_analysis(hipsparseHandle_t     handle,
+                                         hipsparseSpMatDescr_t matA,
+                                         int                   ncolors,
+                                         const int*            colorPtr,
+                                         hipDataType           computeType,
+                                         hipsparseSpGSDescr_t  gsDescr)
 {
-    if(handle == nullptr)
+    if(handle == nullptr || matA == nullptr || colorPtr == nullptr || gsDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    if(matA == nullptr || vecX == nullptr || vecY == nullptr || alpha == nullptr || beta == nullptr
-       || externalBuffer == nullptr)
+    if(ncolors < 0)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    void*                A_row_ptr;
+    void*                A_col_ind;
+    void*                A_val;
+    hipsparseIndexType_t A_row_type;
+    hipsparseIndexType_t A_col_type;
+    hipsparseIndexBase_t A_base;
+    hipDataType          A_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matA,
+                                              &m,
+                                              &n,
+                                              &nnz,
+                                              &A_row_ptr,
+                                              &A_col_ind,
+                                              &A_val,
+                                              &A_row_type,
+                                              &A_col_type,
+                                              &A_base,
+                                              &A_val_type));
+
+    if(m != n || colorPtr[0] != 0 || colorPtr[ncolors] != m)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(A_row_type != HIPSPARSE_INDEX_32I || A_col_type != HIPSPARSE_INDEX_32I
+       || A_val_type != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    char one[16]{};
+    char minus_one[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGSScalars(computeType, one, minus_one));
+
+    int max_rows = 0;
+    for(int c = 0; c < ncolors; ++c)
+    {
+        if(colorPtr[c + 1] < colorPtr[c])
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        max_rows = std::max(max_rows, colorPtr[c + 1] - colorPtr[c]);
+    }
+
+    // Release the data of a previous analysis
+    gsDescr->clear();
+
+    gsDescr->ncolors      = ncolors;
+    gsDescr->compute_type = computeType;
+    gsDescr->color_ptr.assign(colorPtr, colorPtr + ncolors + 1);
+
+    // Quick return
+    if(m == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    size_t val_size = hipsparseDataTypeSize(computeType);
+
+    std::vector<int>  row_ptr(m + 1);
+    std::vector<int>  col_ind(nnz);
+    std::vector<char> val(val_size * nnz);
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        row_ptr.data(), A_row_ptr, sizeof(int) * (m + 1), cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        col_ind.data(), A_col_ind, sizeof(int) * nnz, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(
+        cudaMemcpyAsync(val.data(), A_val, val_size * nnz, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    // Extract the inverse diagonal and check that rows of the same color are decoupled
+    std::vector<char> inv_diag(val_size * m);
+
+    for(int c = 0; c < ncolors; ++c)
+    {
+        for(int i = colorPtr[c]; i < colorPtr[c + 1]; ++i)
+        {
+            bool diag = false;
+
+            for(int j = row_ptr[i] - A_base; j < row_ptr[i + 1] - A_base; ++j)
+            {
+                int col = col_ind[j] - A_base;
+
+                if(col == i)
+                {
+                    char* inv = &inv_diag[val_size * i];
+
+                    if(!hipsparseSpGSInvert(computeType, &val[val_size * j], inv))
+                    {
+                        return HIPSPARSE_STATUS_ZERO_PIVOT;
+                    }
+
+                    diag = true;
+                }
+                else if(col >= colorPtr[c] && col < colorPtr[c + 1])
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+            }
+
+            if(!diag)
+            {
+                return HIPSPARSE_STATUS_ZERO_PIVOT;
+            }
+        }
+    }
+
+    // Rebased row pointer of each color block, stored one after another
+    std::vector<int> color_row_ptr(m + ncolors);
+    std::vector<int> identity(max_rows + 1);
+
+    for(int c = 0; c < ncolors; ++c)
+    {
+        int first = colorPtr[c];
+
+        for(int i = first; i <= colorPtr[c + 1]; ++i)
+        {
+            color_row_ptr[c + i] = row_ptr[i] - row_ptr[first] + A_base;
+        }
+    }
+
+    for(int i = 0; i <= max_rows; ++i)
+    {
+        identity[i] = i;
+    }
+
+    RETURN_IF_CUDA_ERROR(cudaMalloc((void**)&gsDescr->row_ptr, sizeof(int) * (m + ncolors)));
+    RETURN_IF_CUDA_ERROR(cudaMalloc((void**)&gsDescr->identity, sizeof(int) * (max_rows + 1)));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&gsDescr->inv_diag, val_size * m));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&gsDescr->r, val_size * m));
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(gsDescr->row_ptr,
+                                       color_row_ptr.data(),
+                                       sizeof(int) * (m + ncolors),
+                                       cudaMemcpyHostToDevice,
+                                       stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(gsDescr->identity,
+                                       identity.data(),
+                                       sizeof(int) * (max_rows + 1),
+                                       cudaMemcpyHostToDevice,
+                                       stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        gsDescr->inv_diag, inv_diag.data(), val_size * m, cudaMemcpyHostToDevice, stream));
+
+    // Block descriptors of each color. Column indices and values of A_c point into A.
+    gsDescr->A_c.resize(ncolors, nullptr);
+    gsDescr->D_c.resize(ncolors, nullptr);
+
+    for(int c = 0; c < ncolors; ++c)
+    {
+        int rows = colorPtr[c + 1] - colorPtr[c];
+
+        if(rows == 0)
+        {
+            continue;
+        }
+
+        int   offset     = row_ptr[colorPtr[c]] - A_base;
+        int   nnz_c      = row_ptr[colorPtr[c + 1]] - row_ptr[colorPtr[c]];
+        char* inv_diag_c = (char*)gsDescr->inv_diag + val_size * colorPtr[c];
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&gsDescr->A_c[c],
+                                                     rows,
+                                                     n,
+                                                     nnz_c,
+                                                     gsDescr->row_ptr + colorPtr[c] + c,
+                                                     (int*)A_col_ind + offset,
+                                                     (char*)A_val + val_size * offset,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     A_base,
+                                                     computeType));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&gsDescr->D_c[c],
+                                                     rows,
+                                                     rows,
+                                                     rows,
+                                                     gsDescr->identity,
+                                                     gsDescr->identity,
+                                                     inv_diag_c,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_BASE_ZERO,
+                                                     computeType));
+    }
+
+    // Buffer size and preprocessing of all SpMVs, using r as placeholder for the vectors.
+    // Each preprocessed SpMV keeps its analysis in its own buffer, buffer[2 * c] belongs to
+    // A_c and buffer[2 * c + 1] to D_c.
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    gsDescr->buffer.resize(2 * ncolors, nullptr);
+
+    hipsparseStatus_t     status = HIPSPARSE_STATUS_SUCCESS;
+    hipsparseOperation_t  op     = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseDnVecDescr_t vec_x  = nullptr;
+    hipsparseDnVecDescr_t vec_r  = nullptr;
+
+    for(int c = 0; c < ncolors && status == HIPSPARSE_STATUS_SUCCESS; ++c)
+    {
+        int rows = colorPtr[c + 1] - colorPtr[c];
+
+        if(rows == 0)
+        {
+            continue;
+        }
+
+        status = hipsparseCreateDnVec(&vec_x, n, gsDescr->r, computeType);
+
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            status = hipsparseCreateDnVec(&vec_r, rows, gsDescr->r, computeType);
+        }
+
+        hipsparseSpMatDescr_t mat[2] = {gsDescr->A_c[c], gsDescr->D_c[c]};
+        hipsparseDnVecDescr_t in[2]  = {vec_x, vec_r};
+
+        for(int k = 0; k < 2 && status == HIPSPARSE_STATUS_SUCCESS; ++k)
+        {
+            size_t size;
+            status = hipsparseSpMV_bufferSize(handle,
+                                              op,
+                                              minus_one,
+                                              mat[k],
+                                              in[k],
+                                              one,
+                                              vec_r,
+                                              computeType,
+                                              HIPSPARSE_MV_ALG_DEFAULT,
+                                              &size);
+
+            if(status == HIPSPARSE_STATUS_SUCCESS)
+            {
+                status = hipCUDAErrorToHIPSPARSEStatus(cudaMalloc(&gsDescr->buffer[2 * c + k], size));
+            }
+
+            if(status == HIPSPARSE_STATUS_SUCCESS)
+            {
+                status = hipsparseSpMV_preprocess(handle,
+                                                  op,
+                                                  minus_one,
+                                                  mat[k],
+                                                  in[k],
+                                                  one,
+                                                  vec_r,
+                                                  computeType,
+                                                  HIPSPARSE_MV_ALG_DEFAULT,
+                                                  gsDescr->buffer[2 * c + k]);
+            }
+        }
+
+        if(vec_x != nullptr)
+            hipsparseDestroyDnVec(vec_x);
+        if(vec_r != nullptr)
+            hipsparseDestroyDnVec(vec_r);
+
+        vec_x = nullptr;
+        vec_r = nullptr;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+    RETURN_IF_HIPSPARSE_ERROR(status);
+
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
     return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
-                                hipsparseOperation_t        opA,
-                                const void*                 alpha,
-                                const hipsparseSpMatDescr_t matA,
-                                const hipsparseDnVecDescr_t vecX,
-                                const void*                 beta,
-                                const hipsparseDnVecDescr_t vecY,
-                                hipDataType                 computeType,
-                                hipsparseSpMVAlg_t          alg,
-                                void*                       externalBuffer)
+// Updates the rows of color c, x_c += omega * D_c^-1 * (b_c - A_c * x). Scalars are
+// expected on the host.
+static hipsparseStatus_t hipsparseSpGSColor(hipsparseHandle_t     handle,
+                                            hipsparseSpGSDescr_t  gsDescr,
+                                            int                   c,
+                                            const char*           omega,
+                                            const char*           one,
+                                            const char*           minus_one,
+                                            hipsparseDnVecDescr_t vecX,
+                                            const char*           b,
+                                            char*                 x,
+                                            cudaStream_t          stream)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpMV((cusparseHandle_t)handle,
-                                                     hipOperationToCudaOperation(opA),
-                                                     alpha,
-                                                     (const cusparseSpMatDescr_t)matA,
-                                                     (const cusparseDnVecDescr_t)vecX,
-                                                     beta,
-                                                     (const cusparseDnVecDescr_t)vecY,
-                                                     hipDataTypeToCudaDataType(computeType),
-                                                     hipSpMVAlgToCudaSpMVAlg(alg),
-                                                     externalBuffer));
-}
-#endif
+    int rows = gsDescr->color_ptr[c + 1] - gsDescr->color_ptr[c];
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
-                                           hipsparseOperation_t        opA,
-                                           hipsparseOperation_t        opB,
-                                           const void*                 alpha,
-                                           const hipsparseSpMatDescr_t matA,
-                                           const hipsparseDnMatDescr_t matB,
-                                           const void*                 beta,
-                                           const hipsparseDnMatDescr_t matC,
-                                           hipDataType                 computeType,
-                                           hipsparseSpMMAlg_t          alg,
-                                           size_t*                     bufferSize)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMM_bufferSize((cusparseHandle_t)handle,
-                                hipOperationToCudaOperation(opA),
-                                hipOperationToCudaOperation(opB),
-                                alpha,
-                                (const cusparseSpMatDescr_t)matA,
-                                (const cusparseDnMatDescr_t)matB,
-                                beta,
-                                (const cusparseDnMatDescr_t)matC,
-                                hipDataTypeToCudaDataType(computeType),
-                                hipSpMMAlgToCudaSpMMAlg(alg),
-                                bufferSize));
-}
-#endif
+    if(rows == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
 
-#if(CUDART_VERSION >= 11021)
-hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
-                                           hipsparseOperation_t        opA,
-                                           hipsparseOperation_t        opB,
-                                           const void*                 alpha,
-                                           const hipsparseSpMatDescr_t matA,
-                                           const hipsparseDnMatDescr_t matB,
-                                           const void*                 beta,
-                                           const hipsparseDnMatDescr_t matC,
-                                           hipDataType                 computeType,
-                                           hipsparseSpMMAlg_t          alg,
-                                           void*                       externalBuffer)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMM_preprocess((cusparseHandle_t)handle,
-                                hipOperationToCudaOperation(opA),
-                                hipOperationToCudaOperation(opB),
-                                alpha,
-                                (const cusparseSpMatDescr_t)matA,
-                                (const cusparseDnMatDescr_t)matB,
-                                beta,
-                                (const cusparseDnMatDescr_t)matC,
-                                hipDataTypeToCudaDataType(computeType),
-                                hipSpMMAlgToCudaSpMMAlg(alg),
-                                externalBuffer));
-}
-#endif
+    hipDataType          type     = gsDescr->compute_type;
+    size_t               val_size = hipsparseDataTypeSize(type);
+    size_t               offset   = val_size * gsDescr->color_ptr[c];
+    hipsparseOperation_t op       = HIPSPARSE_OPERATION_NON_TRANSPOSE;
 
-#if(CUDART_VERSION >= 10010)
-hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
-                                hipsparseOperation_t        opA,
-                                hipsparseOperation_t        opB,
-                                const void*                 alpha,
-                                const hipsparseSpMatDescr_t matA,
-                                const hipsparseDnMatDescr_t matB,
-                                const void*                 beta,
-                                const hipsparseDnMatDescr_t matC,
-                                hipDataType                 computeType,
-                                hipsparseSpMMAlg_t          alg,
-                                void*                       externalBuffer)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpMM((cusparseHandle_t)handle,
-                                                     hipOperationToCudaOperation(opA),
-                                                     hipOperationToCudaOperation(opB),
-                                                     alpha,
-                                                     (const cusparseSpMatDescr_t)matA,
-                                                     (const cusparseDnMatDescr_t)matB,
-                                                     beta,
-                                                     (const cusparseDnMatDescr_t)matC,
-                                                     hipDataTypeToCudaDataType(computeType),
-                                                     hipSpMMAlgToCudaSpMMAlg(alg),
-                                                     externalBuffer));
-}
-#endif
+    // r_c = b_c
+    RETURN_IF_CUDA_ERROR(
+        cudaMemcpyAsync(gsDescr->r, b + offset, val_size * rows, cudaMemcpyDeviceToDevice, stream));
+
+    hipsparseDnVecDescr_t vec_r;
+    hipsparseDnVecDescr_t vec_x_c;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateDnVec(&vec_r, rows, gsDescr->r, type));
+
+    hipsparseStatus_t status = hipsparseCreateDnVec(&vec_x_c, rows, x + offset, type);
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        hipsparseDestroyDnVec(vec_r);
+        return status;
+    }
+
+    // r_c = b_c - A_c * x
+    status = hipsparseSpMV(handle,
+                           op,
+                           minus_one,
+                           gsDescr->A_c[c],
+                           vecX,
+                           one,
+                           vec_r,
+                           type,
+                           HIPSPARSE_MV_ALG_DEFAULT,
+                           gsDescr->buffer[2 * c]);
+
+    // x_c = x_c + omega * D_c^-1 * r_c
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseSpMV(handle,
+                               op,
+                               omega,
+                               gsDescr->D_c[c],
+                               vec_r,
+                               one,
+                               vec_x_c,
+                               type,
+                               HIPSPARSE_MV_ALG_DEFAULT,
+                               gsDescr->buffer[2 * c + 1]);
+    }
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMM_createDescr((cusparseSpGEMMDescr_t*)descr));
-}
-#endif
+    hipsparseDestroyDnVec(vec_r);
+    hipsparseDestroyDnVec(vec_x_c);
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMM_destroyDescr((cusparseSpGEMMDescr_t)descr));
+    return status;
 }
-#endif
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t      handle,
-                                                 hipsparseOperation_t   opA,
-                                                 hipsparseOperation_t   opB,
-                                                 const void*            alpha,
-                                                 hipsparseSpMatDescr_t  matA,
-                                                 hipsparseSpMatDescr_t  matB,
-                                                 const void*            beta,
-                                                 hipsparseSpMatDescr_t  matC,
-                                                 hipDataType            computeType,
-                                                 hipsparseSpGEMMAlg_t   alg,
-                                                 hipsparseSpGEMMDescr_t spgemmDescr,
-                                                 size_t*                bufferSize1,
-                                                 void*                  externalBuffer1)
+hipsparseStatus_t hipsparseSpGS_sweep(hipsparseHandle_t     handle,
+                                      hipsparseSpGSSweep_t  sweep,
+                                      const void*           omega,
+                                      hipsparseSpMatDescr_t matA,
+                                      hipsparseDnVecDescr_t vecB,
+                                      hipsparseDnVecDescr_t vecX,
+                                      hipDataType           computeType,
+                                      hipsparseSpGSDescr_t  gsDescr)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpGEMM_workEstimation((cusparseHandle_t)handle,
-                                      hipOperationToCudaOperation(opA),
-                                      hipOperationToCudaOperation(opB),
-                                      alpha,
-                                      (cusparseSpMatDescr_t)matA,
-                                      (cusparseSpMatDescr_t)matB,
-                                      beta,
-                                      (cusparseSpMatDescr_t)matC,
-                                      computeType,
-                                      hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                                      (cusparseSpGEMMDescr_t)spgemmDescr,
-                                      bufferSize1,
-                                      externalBuffer1));
-}
-#endif
+    if(handle == nullptr || omega == nullptr || matA == nullptr || vecB == nullptr
+       || vecX == nullptr || gsDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t      handle,
-                                          hipsparseOperation_t   opA,
-                                          hipsparseOperation_t   opB,
-                                          const void*            alpha,
-                                          hipsparseSpMatDescr_t  matA,
-                                          hipsparseSpMatDescr_t  matB,
-                                          const void*            beta,
-                                          hipsparseSpMatDescr_t  matC,
-                                          hipDataType            computeType,
-                                          hipsparseSpGEMMAlg_t   alg,
-                                          hipsparseSpGEMMDescr_t spgemmDescr,
-                                          size_t*                bufferSize2,
-                                          void*                  externalBuffer2)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMM_compute((cusparseHandle_t)handle,
-                                                               hipOperationToCudaOperation(opA),
-                                                               hipOperationToCudaOperation(opB),
-                                                               alpha,
-                                                               (cusparseSpMatDescr_t)matA,
-                                                               (cusparseSpMatDescr_t)matB,
-                                                               beta,
-                                                               (cusparseSpMatDescr_t)matC,
-                                                               computeType,
-                                                               hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                                                               (cusparseSpGEMMDescr_t)spgemmDescr,
-                                                               bufferSize2,
-                                                               externalBuffer2));
+    if(sweep != HIPSPARSE_SPGS_SWEEP_FORWARD && sweep != HIPSPARSE_SPGS_SWEEP_BACKWARD
+       && sweep != HIPSPARSE_SPGS_SWEEP_SYMMETRIC)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // hipsparseSpGS_analysis has to be called first
+    if(gsDescr->color_ptr.empty() || gsDescr->compute_type != computeType)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t     size_b;
+    int64_t     size_x;
+    void*       b;
+    void*       x;
+    hipDataType type_b;
+    hipDataType type_x;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDnVecGet(vecB, &size_b, &b, &type_b));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDnVecGet(vecX, &size_x, &x, &type_x));
+
+    int ncolors = gsDescr->ncolors;
+
+    if(size_b != gsDescr->color_ptr[ncolors] || size_x != gsDescr->color_ptr[ncolors]
+       || type_b != computeType || type_x != computeType)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Quick return
+    if(size_x == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    char one[16]{};
+    char minus_one[16]{};
+    char alpha[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGSScalars(computeType, one, minus_one));
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    // The sweep runs with host scalars, independently of the pointer mode of the handle
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+
+    if(mode == HIPSPARSE_POINTER_MODE_DEVICE)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            alpha, omega, hipsparseDataTypeSize(computeType), cudaMemcpyDeviceToHost, stream));
+        RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+    }
+    else
+    {
+        memcpy(alpha, omega, hipsparseDataTypeSize(computeType));
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    hipsparseStatus_t status = HIPSPARSE_STATUS_SUCCESS;
+
+    // Forward sweep over all colors
+    if(sweep != HIPSPARSE_SPGS_SWEEP_BACKWARD)
+    {
+        for(int c = 0; c < ncolors && status == HIPSPARSE_STATUS_SUCCESS; ++c)
+        {
+            status = hipsparseSpGSColor(
+                handle, gsDescr, c, alpha, one, minus_one, vecX, (char*)b, (char*)x, stream);
+        }
+    }
+
+    // Backward sweep over all colors. The symmetric sweep has just updated the last color
+    // and continues with the one before.
+    if(sweep != HIPSPARSE_SPGS_SWEEP_FORWARD)
+    {
+        int last = (sweep == HIPSPARSE_SPGS_SWEEP_SYMMETRIC) ? ncolors - 2 : ncolors - 1;
+
+        for(int c = last; c >= 0 && status == HIPSPARSE_STATUS_SUCCESS; --c)
+        {
+            status = hipsparseSpGSColor(
+                handle, gsDescr, c, alpha, one, minus_one, vecX, (char*)b, (char*)x, stream);
+        }
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+
+    return status;
 }
-#endif
 
-#if(CUDART_VERSION >= 11000)
-hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t      handle,
-                                       hipsparseOperation_t   opA,
-                                       hipsparseOperation_t   opB,
-                                       const void*            alpha,
-                                       hipsparseSpMatDescr_t  matA,
-                                       hipsparseSpMatDescr_t  matB,
-                                       const void*            beta,
-                                       hipsparseSpMatDescr_t  matC,
-                                       hipDataType            computeType,
-                                       hipsparseSpGEMMAlg_t   alg,
-                                       hipsparseSpGEMMDescr_t spgemmDescr)
+// Assembly descriptor. The map from the COO entries into the CSR pattern is a sparse
+// matrix P with a unit entry P(k, e) for each COO entry e that is summed into the
+// non-zero k of the pattern. Its rows are the segments of COO entries per non-zero, such
+// that a single SpMV, csrVal = alpha * P * cooVal + beta * csrVal, assembles the values.
+struct hipsparseSpAssembleDescr
+{
+    int64_t               nnz_coo      = -1;
+    int64_t               nnz_A        = -1;
+    hipDataType           compute_type = HIP_R_32F;
+    int*                  seg_ptr      = nullptr;
+    int*                  perm         = nullptr;
+    void*                 ones         = nullptr;
+    void*                 buffer       = nullptr;
+    void*                 zero         = nullptr;
+    hipsparseSpMatDescr_t P            = nullptr;
+    hipsparseSpVecDescr_t Z            = nullptr;
+
+    void clear()
+    {
+        if(P != nullptr)
+            hipsparseDestroySpMat(P);
+        if(Z != nullptr)
+            hipsparseDestroySpVec(Z);
+        if(seg_ptr != nullptr)
+            cudaFree(seg_ptr);
+        if(perm != nullptr)
+            cudaFree(perm);
+        if(ones != nullptr)
+            cudaFree(ones);
+        if(buffer != nullptr)
+            cudaFree(buffer);
+        if(zero != nullptr)
+            cudaFree(zero);
+
+        nnz_coo = -1;
+        nnz_A   = -1;
+        seg_ptr = nullptr;
+        perm    = nullptr;
+        ones    = nullptr;
+        buffer  = nullptr;
+        zero    = nullptr;
+        P       = nullptr;
+        Z       = nullptr;
+    }
+
+    ~hipsparseSpAssembleDescr()
+    {
+        clear();
+    }
+};
+
+hipsparseStatus_t hipsparseSpAssemble_createDescr(hipsparseSpAssembleDescr_t* descr)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMM_copy((cusparseHandle_t)handle,
-                                                            hipOperationToCudaOperation(opA),
-                                                            hipOperationToCudaOperation(opB),
-                                                            alpha,
-                                                            (cusparseSpMatDescr_t)matA,
-                                                            (cusparseSpMatDescr_t)matB,
-                                                            beta,
-                                                            (cusparseSpMatDescr_t)matC,
-                                                            computeType,
-                                                            hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                                                            (cusparseSpGEMMDescr_t)spgemmDescr));
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new hipsparseSpAssembleDescr;
+    return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 11031)
-hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t      handle,
-                                                      hipsparseOperation_t   opA,
-                                                      hipsparseOperation_t   opB,
-                                                      hipsparseSpMatDescr_t  matA,
-                                                      hipsparseSpMatDescr_t  matB,
-                                                      hipsparseSpMatDescr_t  matC,
-                                                      hipsparseSpGEMMAlg_t   alg,
-                                                      hipsparseSpGEMMDescr_t spgemmDescr,
-                                                      size_t*                bufferSize1,
-                                                      void*                  externalBuffer1)
+hipsparseStatus_t hipsparseSpAssemble_destroyDescr(hipsparseSpAssembleDescr_t descr)
 {
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpGEMMreuse_workEstimation((cusparseHandle_t)handle,
-                                           hipOperationToCudaOperation(opA),
-                                           hipOperationToCudaOperation(opB),
-                                           (cusparseSpMatDescr_t)matA,
-                                           (cusparseSpMatDescr_t)matB,
-                                           (cusparseSpMatDescr_t)matC,
-                                           hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                                           (cusparseSpGEMMDescr_t)spgemmDescr,
-                                           bufferSize1,
-                                           externalBuffer1));
+    if(descr != nullptr)
+    {
+        delete descr;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
-#endif
 
-#if(CUDART_VERSION >= 11031)
-hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t      handle,
-                                           hipsparseOperation_t   opA,
-                                           hipsparseOperation_t   opB,
-                                           hipsparseSpMatDescr_t  matA,
-                                           hipsparseSpMatDescr_t  matB,
-                                           hipsparseSpMatDescr_t  matC,
-                                           hipsparseSpGEMMAlg_t   alg,
-                                           hipsparseSpGEMMDescr_t spgemmDescr,
-                                           size_t*                bufferSize2,
-                                           void*                  externalBuffer2,
-                                           size_t*                bufferSize3,
-                                           void*                  externalBuffer3,
-                                           size_t*                bufferSize4,
-                                           void*                  externalBuffer4)
+hipsparseStatus_t hipsparseSpAssemble_analysis(hipsparseHandle_t          handle,
+                                               hipsparseSpMatDescr_t      matCoo,
+                                               hipsparseSpMatDescr_t      matA,
+                                               hipDataType                computeType,
+                                               hipsparseSpAssembleDescr_t asmDescr)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMMreuse_nnz((cusparseHandle_t)handle,
-                                                                hipOperationToCudaOperation(opA),
-                                                                hipOperationToCudaOperation(opB),
-                                                                (cusparseSpMatDescr_t)matA,
-                                                                (cusparseSpMatDescr_t)matB,
-                                                                (cusparseSpMatDescr_t)matC,
-                                                                hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                                                                (cusparseSpGEMMDescr_t)spgemmDescr,
-                                                                bufferSize2,
-                                                                externalBuffer2,
-                                                                bufferSize3,
-                                                                externalBuffer3,
-                                                                bufferSize4,
-                                                                externalBuffer4));
+    if(handle == nullptr || matCoo == nullptr || matA == nullptr || asmDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t              m_coo;
+    int64_t              n_coo;
+    int64_t              nnz_coo;
+    void*                coo_row_ind;
+    void*                coo_col_ind;
+    void*                coo_val;
+    hipsparseIndexType_t coo_idx_type;
+    hipsparseIndexBase_t coo_base;
+    hipDataType          coo_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCooGet(matCoo,
+                                              &m_coo,
+                                              &n_coo,
+                                              &nnz_coo,
+                                              &coo_row_ind,
+                                              &coo_col_ind,
+                                              &coo_val,
+                                              &coo_idx_type,
+                                              &coo_base,
+                                              &coo_val_type));
+
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    void*                A_row_ptr;
+    void*                A_col_ind;
+    void*                A_val;
+    hipsparseIndexType_t A_row_type;
+    hipsparseIndexType_t A_col_type;
+    hipsparseIndexBase_t A_base;
+    hipDataType          A_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matA,
+                                              &m,
+                                              &n,
+                                              &nnz,
+                                              &A_row_ptr,
+                                              &A_col_ind,
+                                              &A_val,
+                                              &A_row_type,
+                                              &A_col_type,
+                                              &A_base,
+                                              &A_val_type));
+
+    if(m_coo != m || n_coo != n)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(coo_idx_type != HIPSPARSE_INDEX_32I || A_row_type != HIPSPARSE_INDEX_32I
+       || A_col_type != HIPSPARSE_INDEX_32I || coo_val_type != computeType
+       || A_val_type != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    size_t val_size;
+    char   one[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTypeScalars(computeType, &val_size, one));
+
+    // Release the data of a previous analysis
+    asmDescr->clear();
+
+    // Quick return. No entry can hit an empty pattern.
+    if(nnz == 0)
+    {
+        if(nnz_coo != 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        asmDescr->nnz_coo      = nnz_coo;
+        asmDescr->nnz_A        = nnz;
+        asmDescr->compute_type = computeType;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Without entries, the assembly reduces to csrVal = beta * csrVal. This is computed by
+    // axpby with a sparse vector that holds a single explicit zero at index 0.
+    if(nnz_coo == 0)
+    {
+        cudaStream_t stream;
+        RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+        // Index at offset 0, value at offset 256
+        RETURN_IF_CUDA_ERROR(cudaMalloc(&asmDescr->zero, 256 + 16));
+        RETURN_IF_CUDA_ERROR(cudaMemsetAsync(asmDescr->zero, 0, 256 + 16, stream));
+        RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateSpVec(&asmDescr->Z,
+                                                       nnz,
+                                                       1,
+                                                       asmDescr->zero,
+                                                       (char*)asmDescr->zero + 256,
+                                                       HIPSPARSE_INDEX_32I,
+                                                       HIPSPARSE_INDEX_BASE_ZERO,
+                                                       computeType));
+
+        asmDescr->nnz_coo      = nnz_coo;
+        asmDescr->nnz_A        = nnz;
+        asmDescr->compute_type = computeType;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(coo_row_ind == nullptr || coo_col_ind == nullptr || coo_val == nullptr
+       || A_row_ptr == nullptr || A_col_ind == nullptr || A_val == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    std::vector<int> row_ind(nnz_coo);
+    std::vector<int> col_ind(nnz_coo);
+    std::vector<int> row_ptr(m + 1);
+    std::vector<int> csr_col_ind(nnz);
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        row_ind.data(), coo_row_ind, sizeof(int) * nnz_coo, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        col_ind.data(), coo_col_ind, sizeof(int) * nnz_coo, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        row_ptr.data(), A_row_ptr, sizeof(int) * (m + 1), cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        csr_col_ind.data(), A_col_ind, sizeof(int) * nnz, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    // (column, non-zero) pairs of each row sorted by column, such that the non-zero of an
+    // entry can be found by bisection, also for unsorted patterns
+    std::vector<std::pair<int, int>> pattern(nnz);
+
+    for(int i = 0; i < m; ++i)
+    {
+        int row_begin = row_ptr[i] - A_base;
+        int row_end   = row_ptr[i + 1] - A_base;
+
+        for(int j = row_begin; j < row_end; ++j)
+        {
+            pattern[j] = std::make_pair(csr_col_ind[j] - A_base, j);
+        }
+
+        std::sort(pattern.begin() + row_begin, pattern.begin() + row_end);
+
+        for(int j = row_begin + 1; j < row_end; ++j)
+        {
+            if(pattern[j].first == pattern[j - 1].first)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+        }
+    }
+
+    // Non-zero of each COO entry, entries outside of the pattern are rejected
+    std::vector<int> slot(nnz_coo);
+    std::vector<int> seg_ptr(nnz + 1, 0);
+
+    for(int e = 0; e < nnz_coo; ++e)
+    {
+        int row = row_ind[e] - coo_base;
+        int col = col_ind[e] - coo_base;
+
+        if(row < 0 || row >= m)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        auto begin = pattern.begin() + (row_ptr[row] - A_base);
+        auto end   = pattern.begin() + (row_ptr[row + 1] - A_base);
+        auto it    = std::lower_bound(begin, end, std::make_pair(col, 0));
+
+        if(it == end || it->first != col)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        slot[e] = it->second;
+        ++seg_ptr[slot[e] + 1];
+    }
+
+    // Stable counting sort of the entries by non-zero, which keeps the summation order of
+    // each segment deterministic
+    for(int k = 0; k < nnz; ++k)
+    {
+        seg_ptr[k + 1] += seg_ptr[k];
+    }
+
+    std::vector<int> perm(nnz_coo);
+    std::vector<int> next(seg_ptr.begin(), seg_ptr.end() - 1);
+
+    for(int e = 0; e < nnz_coo; ++e)
+    {
+        perm[next[slot[e]]++] = e;
+    }
+
+    std::vector<char> ones(val_size * nnz_coo);
+
+    for(int e = 0; e < nnz_coo; ++e)
+    {
+        memcpy(&ones[val_size * e], one, val_size);
+    }
+
+    asmDescr->nnz_coo      = nnz_coo;
+    asmDescr->nnz_A        = nnz;
+    asmDescr->compute_type = computeType;
+
+    RETURN_IF_CUDA_ERROR(cudaMalloc((void**)&asmDescr->seg_ptr, sizeof(int) * (nnz + 1)));
+    RETURN_IF_CUDA_ERROR(cudaMalloc((void**)&asmDescr->perm, sizeof(int) * nnz_coo));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&asmDescr->ones, val_size * nnz_coo));
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(asmDescr->seg_ptr,
+                                       seg_ptr.data(),
+                                       sizeof(int) * (nnz + 1),
+                                       cudaMemcpyHostToDevice,
+                                       stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        asmDescr->perm, perm.data(), sizeof(int) * nnz_coo, cudaMemcpyHostToDevice, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        asmDescr->ones, ones.data(), val_size * nnz_coo, cudaMemcpyHostToDevice, stream));
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&asmDescr->P,
+                                                 nnz,
+                                                 nnz_coo,
+                                                 nnz_coo,
+                                                 asmDescr->seg_ptr,
+                                                 asmDescr->perm,
+                                                 asmDescr->ones,
+                                                 HIPSPARSE_INDEX_32I,
+                                                 HIPSPARSE_INDEX_32I,
+                                                 HIPSPARSE_INDEX_BASE_ZERO,
+                                                 computeType));
+
+    // Buffer size and preprocessing of the SpMV with P
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    hipsparseStatus_t     status      = HIPSPARSE_STATUS_SUCCESS;
+    hipsparseOperation_t  op          = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseDnVecDescr_t vec_x       = nullptr;
+    hipsparseDnVecDescr_t vec_y       = nullptr;
+    size_t                buffer_size = 0;
+
+    status = hipsparseCreateDnVec(&vec_x, nnz_coo, coo_val, computeType);
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseCreateDnVec(&vec_y, nnz, A_val, computeType);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseSpMV_bufferSize(handle,
+                                          op,
+                                          one,
+                                          asmDescr->P,
+                                          vec_x,
+                                          one,
+                                          vec_y,
+                                          computeType,
+                                          HIPSPARSE_MV_ALG_DEFAULT,
+                                          &buffer_size);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipCUDAErrorToHIPSPARSEStatus(cudaMalloc(&asmDescr->buffer, buffer_size));
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseSpMV_preprocess(handle,
+                                          op,
+                                          one,
+                                          asmDescr->P,
+                                          vec_x,
+                                          one,
+                                          vec_y,
+                                          computeType,
+                                          HIPSPARSE_MV_ALG_DEFAULT,
+                                          asmDescr->buffer);
+    }
+
+    if(vec_x != nullptr)
+        hipsparseDestroyDnVec(vec_x);
+    if(vec_y != nullptr)
+        hipsparseDestroyDnVec(vec_y);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+    RETURN_IF_HIPSPARSE_ERROR(status);
+
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
-#endif
+hipsparseStatus_t hipsparseSpAssemble_compute(hipsparseHandle_t          handle,
+                                              const void*                alpha,
+                                              hipsparseSpMatDescr_t      matCoo,
+                                              const void*                beta,
+                                              hipsparseSpMatDescr_t      matA,
+                                              hipDataType                computeType,
+                                              hipsparseSpAssembleDescr_t asmDescr)
+{
+    if(handle == nullptr || alpha == nullptr || matCoo == nullptr || beta == nullptr
+       || matA == nullptr || asmDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t              m_coo;
+    int64_t              n_coo;
+    int64_t              nnz_coo;
+    void*                coo_row_ind;
+    void*                coo_col_ind;
+    void*                coo_val;
+    hipsparseIndexType_t coo_idx_type;
+    hipsparseIndexBase_t coo_base;
+    hipDataType          coo_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCooGet(matCoo,
+                                              &m_coo,
+                                              &n_coo,
+                                              &nnz_coo,
+                                              &coo_row_ind,
+                                              &coo_col_ind,
+                                              &coo_val,
+                                              &coo_idx_type,
+                                              &coo_base,
+                                              &coo_val_type));
+
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    void*                A_row_ptr;
+    void*                A_col_ind;
+    void*                A_val;
+    hipsparseIndexType_t A_row_type;
+    hipsparseIndexType_t A_col_type;
+    hipsparseIndexBase_t A_base;
+    hipDataType          A_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matA,
+                                              &m,
+                                              &n,
+                                              &nnz,
+                                              &A_row_ptr,
+                                              &A_col_ind,
+                                              &A_val,
+                                              &A_row_type,
+                                              &A_col_type,
+                                              &A_base,
+                                              &A_val_type));
+
+    // hipsparseSpAssemble_analysis has to be called first
+    if(asmDescr->nnz_coo != nnz_coo || asmDescr->nnz_A != nnz
+       || asmDescr->compute_type != computeType || coo_val_type != computeType
+       || A_val_type != computeType)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Quick return
+    if(nnz == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(A_val == nullptr || (nnz_coo > 0 && coo_val == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
 
 #if(CUDART_VERSION >= 11031)
-hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t      handle,
-                                               hipsparseOperation_t   opA,
-                                               hipsparseOperation_t   opB,
-                                               const void*            alpha,
-                                               hipsparseSpMatDescr_t  matA,
-                                               hipsparseSpMatDescr_t  matB,
-                                               const void*            beta,
-                                               hipsparseSpMatDescr_t  matC,
-                                               hipDataType            computeType,
-                                               hipsparseSpGEMMAlg_t   alg,
-                                               hipsparseSpGEMMDescr_t spgemmDescr)
-{
-    return hipCUSPARSEStatusToHIPStatus(
-        cusparseSpGEMMreuse_compute((cusparseHandle_t)handle,
-                                    hipOperationToCudaOperation(opA),
-                                    hipOperationToCudaOperation(opB),
-                                    alpha,
-                                    (cusparseSpMatDescr_t)matA,
-                                    (cusparseSpMatDescr_t)matB,
-                                    beta,
-                                    (cusparseSpMatDescr_t)matC,
-                                    computeType,
-                                    hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                                    (cusparseSpGEMMDescr_t)spgemmDescr));
-}
+    // The values of A change, a cached transpose has to be rebuilt
+    hipsparseTransposeCacheInvalidate(matA);
 #endif
 
-#if(CUDART_VERSION >= 11031)
-hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t      handle,
-                                            hipsparseOperation_t   opA,
-                                            hipsparseOperation_t   opB,
-                                            hipsparseSpMatDescr_t  matA,
-                                            hipsparseSpMatDescr_t  matB,
-                                            hipsparseSpMatDescr_t  matC,
-                                            hipsparseSpGEMMAlg_t   alg,
-                                            hipsparseSpGEMMDescr_t spgemmDescr,
-                                            size_t*                bufferSize5,
-                                            void*                  externalBuffer5)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpGEMMreuse_copy((cusparseHandle_t)handle,
-                                                                 hipOperationToCudaOperation(opA),
-                                                                 hipOperationToCudaOperation(opB),
-                                                                 (cusparseSpMatDescr_t)matA,
-                                                                 (cusparseSpMatDescr_t)matB,
-                                                                 (cusparseSpMatDescr_t)matC,
-                                                                 hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                                                                 (cusparseSpGEMMDescr_t)spgemmDescr,
-                                                                 bufferSize5,
-                                                                 externalBuffer5));
-}
+    // csrVal = beta * csrVal
+    if(nnz_coo == 0)
+    {
+        hipsparseDnVecDescr_t vec_y;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateDnVec(&vec_y, nnz, A_val, computeType));
+
+        hipsparseStatus_t status = hipsparseAxpby(handle, alpha, asmDescr->Z, beta, vec_y);
+
+        hipsparseDestroyDnVec(vec_y);
+
+        return status;
+    }
 
+    hipsparseDnVecDescr_t vec_x;
+    hipsparseDnVecDescr_t vec_y;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateDnVec(&vec_x, nnz_coo, coo_val, computeType));
+
+    hipsparseStatus_t status = hipsparseCreateDnVec(&vec_y, nnz, A_val, computeType);
+
+    // csrVal = alpha * P * cooVal + beta * csrVal
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseSpMV(handle,
+                               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                               alpha,
+                               asmDescr->P,
+                               vec_x,
+                               beta,
+                               vec_y,
+                               computeType,
+                               HIPSPARSE_MV_ALG_DEFAULT,
+                               asmDescr->buffer);
+
+        hipsparseDestroyDnVec(vec_y);
+    }
+
+    hipsparseDestroyDnVec(vec_x);
+
+    return status;
+}
 #endif
 
 #if(CUDART_VERSION >= 11022)
@@ -11770,17 +18484,592 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t           handle,
 }
 #endif
 
+#if(CUDART_VERSION >= 11030)
+// SpSV descriptor, wrapping the cuSPARSE descriptor of the level scheduled solve together
+// with the state of the Jacobi iteration. With A = D + N,
+// where N is strictly triangular, the iteration y_k+1 = D^-1 * alpha * x - D^-1 * N * y_k
+// is one SpMV with M = D^-1 * N per sweep. It is exact after as many sweeps as the
+// dependency chain of A is long.
+struct hipsparseSpSVDescr
+{
+    cusparseSpSVDescr_t   descr        = nullptr;
+    int                   sweeps       = 5;
+    bool                  analysed     = false;
+    int64_t               m            = 0;
+    hipDataType           compute_type = HIP_R_32F;
+    hipsparseSpMatDescr_t M            = nullptr;
+    hipsparseSpMatDescr_t D_inv        = nullptr;
+    hipsparseDnVecDescr_t vec_b        = nullptr;
+    hipsparseDnVecDescr_t vec_w        = nullptr;
+    int*                  row_ptr      = nullptr;
+    int*                  col_ind      = nullptr;
+    void*                 val          = nullptr;
+    int*                  identity     = nullptr;
+    void*                 inv_diag     = nullptr;
+    void*                 b            = nullptr;
+    void*                 w            = nullptr;
+    void*                 buffer[2]    = {nullptr, nullptr};
+    size_t                memory       = 0;
+
+    void clear()
+    {
+        if(M != nullptr)
+            hipsparseDestroySpMat(M);
+        if(D_inv != nullptr)
+            hipsparseDestroySpMat(D_inv);
+        if(vec_b != nullptr)
+            hipsparseDestroyDnVec(vec_b);
+        if(vec_w != nullptr)
+            hipsparseDestroyDnVec(vec_w);
+
+        if(row_ptr != nullptr)
+            cudaFree(row_ptr);
+        if(col_ind != nullptr)
+            cudaFree(col_ind);
+        if(val != nullptr)
+            cudaFree(val);
+        if(identity != nullptr)
+            cudaFree(identity);
+        if(inv_diag != nullptr)
+            cudaFree(inv_diag);
+        if(b != nullptr)
+            cudaFree(b);
+        if(w != nullptr)
+            cudaFree(w);
+        if(buffer[0] != nullptr)
+            cudaFree(buffer[0]);
+        if(buffer[1] != nullptr)
+            cudaFree(buffer[1]);
+
+        analysed = false;
+        m        = 0;
+        M        = nullptr;
+        D_inv    = nullptr;
+        vec_b    = nullptr;
+        vec_w    = nullptr;
+        row_ptr  = nullptr;
+        col_ind  = nullptr;
+        val      = nullptr;
+        identity = nullptr;
+        inv_diag = nullptr;
+        b        = nullptr;
+        w        = nullptr;
+        buffer[0] = nullptr;
+        buffer[1] = nullptr;
+        memory   = 0;
+    }
+
+    ~hipsparseSpSVDescr()
+    {
+        clear();
+    }
+};
+
+#endif
+
+#if(CUDART_VERSION >= 11031)
+// Multiplies v by s on the host, where complex values store the real part first
+static void hipsparseSpSVJacobiScale(hipDataType computeType, const char* s, char* v)
+{
+    switch(computeType)
+    {
+    case HIP_R_32F:
+        *(float*)v *= *(const float*)s;
+        break;
+    case HIP_R_64F:
+        *(double*)v *= *(const double*)s;
+        break;
+    case HIP_C_32F:
+    {
+        const float* a  = (const float*)s;
+        float*       c  = (float*)v;
+        float        re = a[0] * c[0] - a[1] * c[1];
+        c[1]            = a[0] * c[1] + a[1] * c[0];
+        c[0]            = re;
+        break;
+    }
+    case HIP_C_64F:
+    {
+        const double* a  = (const double*)s;
+        double*       c  = (double*)v;
+        double        re = a[0] * c[0] - a[1] * c[1];
+        c[1]             = a[0] * c[1] + a[1] * c[0];
+        c[0]             = re;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static hipsparseStatus_t hipsparseSpSVJacobiAnalysis(hipsparseHandle_t     handle,
+                                                     hipsparseOperation_t  opA,
+                                                     hipsparseSpMatDescr_t matA,
+                                                     hipDataType           computeType,
+                                                     hipsparseSpSVDescr_t  spsvDescr)
+{
+    // The sweeps only run on the stored triangle
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    void*                A_row_ptr;
+    void*                A_col_ind;
+    void*                A_val;
+    hipsparseIndexType_t A_row_type;
+    hipsparseIndexType_t A_col_type;
+    hipsparseIndexBase_t A_base;
+    hipDataType          A_val_type;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matA,
+                                              &m,
+                                              &n,
+                                              &nnz,
+                                              &A_row_ptr,
+                                              &A_col_ind,
+                                              &A_val,
+                                              &A_row_type,
+                                              &A_col_type,
+                                              &A_base,
+                                              &A_val_type));
+
+    if(m != n)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(A_row_type != HIPSPARSE_INDEX_32I || A_col_type != HIPSPARSE_INDEX_32I
+       || A_val_type != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipsparseFillMode_t fill;
+    hipsparseDiagType_t diag;
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseSpMatGetAttribute(matA, HIPSPARSE_SPMAT_FILL_MODE, &fill, sizeof(fill)));
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseSpMatGetAttribute(matA, HIPSPARSE_SPMAT_DIAG_TYPE, &diag, sizeof(diag)));
+
+    char one[16]{};
+    char minus_one[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGSScalars(computeType, one, minus_one));
+
+    // Release the data of a previous analysis
+    spsvDescr->clear();
+
+    spsvDescr->m            = m;
+    spsvDescr->compute_type = computeType;
+
+    // Quick return
+    if(m == 0)
+    {
+        spsvDescr->analysed = true;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    size_t val_size = hipsparseDataTypeSize(computeType);
+
+    std::vector<int>  row_ptr(m + 1);
+    std::vector<int>  col_ind(nnz);
+    std::vector<char> val(val_size * nnz);
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        row_ptr.data(), A_row_ptr, sizeof(int) * (m + 1), cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        col_ind.data(), A_col_ind, sizeof(int) * nnz, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(
+        cudaMemcpyAsync(val.data(), A_val, val_size * nnz, cudaMemcpyDeviceToHost, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    // Inverse diagonal and M = D^-1 * N, entries of the other triangle are ignored
+    std::vector<char> inv_diag(val_size * m);
+    std::vector<int>  M_ptr(m + 1);
+    std::vector<int>  M_col;
+    std::vector<char> M_val;
+    std::vector<int>  identity(m + 1);
+
+    M_ptr[0] = 0;
+
+    for(int64_t i = 0; i < m; ++i)
+    {
+        char* inv       = &inv_diag[val_size * i];
+        bool  have_diag = false;
+
+        if(diag == HIPSPARSE_DIAG_TYPE_UNIT)
+        {
+            memcpy(inv, one, val_size);
+            have_diag = true;
+        }
+        else
+        {
+            for(int j = row_ptr[i] - A_base; j < row_ptr[i + 1] - A_base; ++j)
+            {
+                if(col_ind[j] - A_base == i)
+                {
+                    if(!hipsparseSpGSInvert(computeType, &val[val_size * j], inv))
+                    {
+                        return HIPSPARSE_STATUS_ZERO_PIVOT;
+                    }
+
+                    have_diag = true;
+                }
+            }
+        }
+
+        if(!have_diag)
+        {
+            return HIPSPARSE_STATUS_ZERO_PIVOT;
+        }
+
+        for(int j = row_ptr[i] - A_base; j < row_ptr[i + 1] - A_base; ++j)
+        {
+            int col = col_ind[j] - A_base;
+
+            if((fill == HIPSPARSE_FILL_MODE_LOWER && col < i)
+               || (fill == HIPSPARSE_FILL_MODE_UPPER && col > i))
+            {
+                size_t offset = M_val.size();
+
+                M_col.push_back(col);
+                M_val.insert(M_val.end(), &val[val_size * j], &val[val_size * (j + 1)]);
+                hipsparseSpSVJacobiScale(computeType, inv, &M_val[offset]);
+            }
+        }
+
+        M_ptr[i + 1] = (int)M_col.size();
+    }
+
+    for(int64_t i = 0; i <= m; ++i)
+    {
+        identity[i] = (int)i;
+    }
+
+    int nnz_M = M_ptr[m];
+
+    // Keep the allocations non-empty for a diagonal matrix
+    RETURN_IF_CUDA_ERROR(cudaMalloc((void**)&spsvDescr->row_ptr, sizeof(int) * (m + 1)));
+    RETURN_IF_CUDA_ERROR(
+        cudaMalloc((void**)&spsvDescr->col_ind, sizeof(int) * std::max(nnz_M, 1)));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&spsvDescr->val, val_size * std::max(nnz_M, 1)));
+    RETURN_IF_CUDA_ERROR(cudaMalloc((void**)&spsvDescr->identity, sizeof(int) * (m + 1)));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&spsvDescr->inv_diag, val_size * m));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&spsvDescr->b, val_size * m));
+    RETURN_IF_CUDA_ERROR(cudaMalloc(&spsvDescr->w, val_size * m));
+
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        spsvDescr->row_ptr, M_ptr.data(), sizeof(int) * (m + 1), cudaMemcpyHostToDevice, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(spsvDescr->identity,
+                                       identity.data(),
+                                       sizeof(int) * (m + 1),
+                                       cudaMemcpyHostToDevice,
+                                       stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        spsvDescr->inv_diag, inv_diag.data(), val_size * m, cudaMemcpyHostToDevice, stream));
+
+    if(nnz_M > 0)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(spsvDescr->col_ind,
+                                           M_col.data(),
+                                           sizeof(int) * nnz_M,
+                                           cudaMemcpyHostToDevice,
+                                           stream));
+        RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+            spsvDescr->val, M_val.data(), val_size * nnz_M, cudaMemcpyHostToDevice, stream));
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&spsvDescr->M,
+                                                 m,
+                                                 m,
+                                                 nnz_M,
+                                                 spsvDescr->row_ptr,
+                                                 spsvDescr->col_ind,
+                                                 spsvDescr->val,
+                                                 HIPSPARSE_INDEX_32I,
+                                                 HIPSPARSE_INDEX_32I,
+                                                 HIPSPARSE_INDEX_BASE_ZERO,
+                                                 computeType));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&spsvDescr->D_inv,
+                                                 m,
+                                                 m,
+                                                 m,
+                                                 spsvDescr->identity,
+                                                 spsvDescr->identity,
+                                                 spsvDescr->inv_diag,
+                                                 HIPSPARSE_INDEX_32I,
+                                                 HIPSPARSE_INDEX_32I,
+                                                 HIPSPARSE_INDEX_BASE_ZERO,
+                                                 computeType));
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseCreateDnVec(&spsvDescr->vec_b, m, spsvDescr->b, computeType));
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseCreateDnVec(&spsvDescr->vec_w, m, spsvDescr->w, computeType));
+
+    // Buffer size and preprocessing of both SpMVs. Each SpMV keeps its analysis in its own
+    // buffer, buffer[0] belongs to M and buffer[1] to D_inv.
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    hipsparseStatus_t     status      = HIPSPARSE_STATUS_SUCCESS;
+    hipsparseSpMatDescr_t mat[2]      = {spsvDescr->M, spsvDescr->D_inv};
+    size_t                buffer_size = 0;
+
+    for(int k = 0; k < 2 && status == HIPSPARSE_STATUS_SUCCESS; ++k)
+    {
+        size_t size;
+        status = hipsparseSpMV_bufferSize(handle,
+                                          opA,
+                                          minus_one,
+                                          mat[k],
+                                          spsvDescr->vec_b,
+                                          one,
+                                          spsvDescr->vec_w,
+                                          computeType,
+                                          HIPSPARSE_MV_ALG_DEFAULT,
+                                          &size);
+
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            status = hipCUDAErrorToHIPSPARSEStatus(cudaMalloc(&spsvDescr->buffer[k], size));
+            buffer_size += size;
+        }
+
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            status = hipsparseSpMV_preprocess(handle,
+                                              opA,
+                                              minus_one,
+                                              mat[k],
+                                              spsvDescr->vec_b,
+                                              one,
+                                              spsvDescr->vec_w,
+                                              computeType,
+                                              HIPSPARSE_MV_ALG_DEFAULT,
+                                              spsvDescr->buffer[k]);
+        }
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+    RETURN_IF_HIPSPARSE_ERROR(status);
+
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    // Device memory held by the descriptor, reported by hipsparseSpSV_getMemoryUsage
+    spsvDescr->memory = sizeof(int) * (2 * (m + 1) + std::max(nnz_M, 1))
+                        + val_size * (std::max(nnz_M, 1) + 3 * m) + buffer_size;
+
+    spsvDescr->analysed = true;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+static hipsparseStatus_t hipsparseSpSVJacobiSolve(hipsparseHandle_t     handle,
+                                                  hipsparseOperation_t  opA,
+                                                  const void*           alpha,
+                                                  hipsparseDnVecDescr_t x,
+                                                  hipsparseDnVecDescr_t y,
+                                                  hipDataType           computeType,
+                                                  hipsparseSpSVDescr_t  spsvDescr)
+{
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // hipsparseSpSV_analysis has to be called first
+    if(!spsvDescr->analysed || spsvDescr->compute_type != computeType)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t     size_x;
+    int64_t     size_y;
+    void*       x_val;
+    void*       y_val;
+    hipDataType type_x;
+    hipDataType type_y;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDnVecGet(x, &size_x, &x_val, &type_x));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDnVecGet(y, &size_y, &y_val, &type_y));
+
+    int64_t m = spsvDescr->m;
+
+    if(size_x != m || size_y != m || type_x != computeType || type_y != computeType)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Quick return
+    if(m == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    char one[16]{};
+    char minus_one[16]{};
+    char zero[16]{};
+    char h_alpha[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpGSScalars(computeType, one, minus_one));
+
+    size_t val_size = hipsparseDataTypeSize(computeType);
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    // The sweeps run with host scalars, independently of the pointer mode of the handle
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+
+    if(mode == HIPSPARSE_POINTER_MODE_DEVICE)
+    {
+        RETURN_IF_CUDA_ERROR(
+            cudaMemcpyAsync(h_alpha, alpha, val_size, cudaMemcpyDeviceToHost, stream));
+        RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+    }
+    else
+    {
+        memcpy(h_alpha, alpha, val_size);
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    // b = D^-1 * alpha * x
+    hipsparseStatus_t status = hipsparseSpMV(handle,
+                                             opA,
+                                             h_alpha,
+                                             spsvDescr->D_inv,
+                                             x,
+                                             zero,
+                                             spsvDescr->vec_b,
+                                             computeType,
+                                             HIPSPARSE_MV_ALG_DEFAULT,
+                                             spsvDescr->buffer[1]);
+
+    // y_0 = b
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipCUDAErrorToHIPSPARSEStatus(cudaMemcpyAsync(
+            y_val, spsvDescr->b, val_size * m, cudaMemcpyDeviceToDevice, stream));
+    }
+
+    // y_k+1 = b - M * y_k, alternating between y and w
+    hipsparseDnVecDescr_t src     = y;
+    hipsparseDnVecDescr_t dst     = spsvDescr->vec_w;
+    void*                 dst_val = spsvDescr->w;
+
+    for(int k = 0; k < spsvDescr->sweeps && status == HIPSPARSE_STATUS_SUCCESS; ++k)
+    {
+        status = hipCUDAErrorToHIPSPARSEStatus(cudaMemcpyAsync(
+            dst_val, spsvDescr->b, val_size * m, cudaMemcpyDeviceToDevice, stream));
+
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            status = hipsparseSpMV(handle,
+                                   opA,
+                                   minus_one,
+                                   spsvDescr->M,
+                                   src,
+                                   one,
+                                   dst,
+                                   computeType,
+                                   HIPSPARSE_MV_ALG_DEFAULT,
+                                   spsvDescr->buffer[0]);
+        }
+
+        std::swap(src, dst);
+        dst_val = (dst == y) ? y_val : spsvDescr->w;
+    }
+
+    // An odd number of sweeps leaves the result in w
+    if(status == HIPSPARSE_STATUS_SUCCESS && src != y)
+    {
+        status = hipCUDAErrorToHIPSPARSEStatus(
+            cudaMemcpyAsync(y_val, spsvDescr->w, val_size * m, cudaMemcpyDeviceToDevice, stream));
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+
+    return status;
+}
+#endif
+
 #if(CUDART_VERSION >= 11030)
 hipsparseStatus_t hipsparseSpSV_createDescr(hipsparseSpSVDescr_t* descr)
 {
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpSV_createDescr((cusparseSpSVDescr_t*)descr));
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseSpSVDescr_t spsv = new hipsparseSpSVDescr;
+
+    cusparseStatus_t status = cusparseSpSV_createDescr(&spsv->descr);
+
+    if(status != CUSPARSE_STATUS_SUCCESS)
+    {
+        delete spsv;
+        return hipCUSPARSEStatusToHIPStatus(status);
+    }
+
+    *descr = spsv;
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
+#if(CUDART_VERSION >= 11030)
+hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    cusparseStatus_t status = cusparseSpSV_destroyDescr(descr->descr);
+    delete descr;
+
+    return hipCUSPARSEStatusToHIPStatus(status);
+}
+#endif
+
+#if(CUDART_VERSION >= 11031)
+hipsparseStatus_t hipsparseSpSV_setJacobiSweeps(hipsparseSpSVDescr_t descr, int sweeps)
+{
+    if(descr == nullptr || sweeps < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->sweeps = sweeps;
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 #endif
 
-#if(CUDART_VERSION >= 11030)
-hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr)
-{
-    return hipCUSPARSEStatusToHIPStatus(cusparseSpSV_destroyDescr((cusparseSpSVDescr_t)descr));
+#if(CUDART_VERSION >= 11031)
+hipsparseStatus_t hipsparseSpSV_getMemoryUsage(hipsparseSpSVDescr_t descr, size_t* bytes)
+{
+    if(descr == nullptr || bytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Only the Jacobi analysis is held by the descriptor, the level scheduled analysis is
+    // kept by the backend
+    if(!descr->analysed)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    *bytes = descr->memory;
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 #endif
 
@@ -11796,6 +19085,21 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSVDescr_t        spsvDescr,
                                            size_t*                     bufferSize)
 {
+#if(CUDART_VERSION >= 11031)
+    if(alg == HIPSPARSE_SPSV_ALG_JACOBI)
+    {
+        if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr
+           || y == nullptr || spsvDescr == nullptr || bufferSize == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // The Jacobi sweeps keep their work arrays in the descriptor
+        *bufferSize = 0;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+#endif
+
     return hipCUSPARSEStatusToHIPStatus(
         cusparseSpSV_bufferSize((cusparseHandle_t)handle,
                                 hipOperationToCudaOperation(opA),
@@ -11805,7 +19109,7 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                 (const cusparseDnVecDescr_t)y,
                                 hipDataTypeToCudaDataType(computeType),
                                 hipSpSVAlgToCudaSpSVAlg(alg),
-                                (cusparseSpSVDescr_t)spsvDescr,
+                                spsvDescr != nullptr ? spsvDescr->descr : nullptr,
                                 bufferSize));
 }
 #endif
@@ -11822,6 +19126,19 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSVDescr_t        spsvDescr,
                                          void*                       externalBuffer)
 {
+#if(CUDART_VERSION >= 11031)
+    if(alg == HIPSPARSE_SPSV_ALG_JACOBI)
+    {
+        if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr
+           || y == nullptr || spsvDescr == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return hipsparseSpSVJacobiAnalysis(handle, opA, matA, computeType, spsvDescr);
+    }
+#endif
+
     return hipCUSPARSEStatusToHIPStatus(
         cusparseSpSV_analysis((cusparseHandle_t)handle,
                               hipOperationToCudaOperation(opA),
@@ -11831,7 +19148,7 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                               (const cusparseDnVecDescr_t)y,
                               hipDataTypeToCudaDataType(computeType),
                               hipSpSVAlgToCudaSpSVAlg(alg),
-                              (cusparseSpSVDescr_t)spsvDescr,
+                              spsvDescr != nullptr ? spsvDescr->descr : nullptr,
                               externalBuffer));
 }
 #endif
@@ -11848,6 +19165,19 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSVDescr_t        spsvDescr,
                                       void*                       externalBuffer)
 {
+#if(CUDART_VERSION >= 11031)
+    if(alg == HIPSPARSE_SPSV_ALG_JACOBI)
+    {
+        if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr
+           || y == nullptr || spsvDescr == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return hipsparseSpSVJacobiSolve(handle, opA, alpha, x, y, computeType, spsvDescr);
+    }
+#endif
+
     return hipCUSPARSEStatusToHIPStatus(cusparseSpSV_solve((cusparseHandle_t)handle,
                                                            hipOperationToCudaOperation(opA),
                                                            alpha,
@@ -11856,7 +19186,8 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                                                            (const cusparseDnVecDescr_t)y,
                                                            hipDataTypeToCudaDataType(computeType),
                                                            hipSpSVAlgToCudaSpSVAlg(alg),
-                                                           (cusparseSpSVDescr_t)spsvDescr));
+                                                           spsvDescr != nullptr ? spsvDescr->descr
+                                                                                : nullptr));
 }
 #endif
 
@@ -12663,6 +19994,1266 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
         (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer));
 }
 
+// Type dispatch of the block ILU0 and block triangular solves used by gtsvBlockStridedBatch
+static hipsparseStatus_t hipsparseGtsvBlockIluBufferSize(hipsparseHandle_t         handle,
+                                                         hipDataType               type,
+                                                         hipsparseDirection_t      dir,
+                                                         int                       mb,
+                                                         int                       nnzb,
+                                                         const hipsparseMatDescr_t descr,
+                                                         void*                     val,
+                                                         const int*                row_ptr,
+                                                         const int*                col_ind,
+                                                         int                       block_dim,
+                                                         bsrilu02Info_t            info,
+                                                         int*                      size)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipsparseSbsrilu02_bufferSize(
+            handle, dir, mb, nnzb, descr, (float*)val, row_ptr, col_ind, block_dim, info, size);
+    case HIP_R_64F:
+        return hipsparseDbsrilu02_bufferSize(
+            handle, dir, mb, nnzb, descr, (double*)val, row_ptr, col_ind, block_dim, info, size);
+    case HIP_C_32F:
+        return hipsparseCbsrilu02_bufferSize(handle,
+                                             dir,
+                                             mb,
+                                             nnzb,
+                                             descr,
+                                             (hipComplex*)val,
+                                             row_ptr,
+                                             col_ind,
+                                             block_dim,
+                                             info,
+                                             size);
+    case HIP_C_64F:
+        return hipsparseZbsrilu02_bufferSize(handle,
+                                             dir,
+                                             mb,
+                                             nnzb,
+                                             descr,
+                                             (hipDoubleComplex*)val,
+                                             row_ptr,
+                                             col_ind,
+                                             block_dim,
+                                             info,
+                                             size);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static hipsparseStatus_t hipsparseGtsvBlockIluAnalysis(hipsparseHandle_t         handle,
+                                                       hipDataType               type,
+                                                       hipsparseDirection_t      dir,
+                                                       int                       mb,
+                                                       int                       nnzb,
+                                                       const hipsparseMatDescr_t descr,
+                                                       void*                     val,
+                                                       const int*                row_ptr,
+                                                       const int*                col_ind,
+                                                       int                       block_dim,
+                                                       bsrilu02Info_t            info,
+                                                       void*                     buffer)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipsparseSbsrilu02_analysis(handle,
+                                           dir,
+                                           mb,
+                                           nnzb,
+                                           descr,
+                                           (float*)val,
+                                           row_ptr,
+                                           col_ind,
+                                           block_dim,
+                                           info,
+                                           HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                           buffer);
+    case HIP_R_64F:
+        return hipsparseDbsrilu02_analysis(handle,
+                                           dir,
+                                           mb,
+                                           nnzb,
+                                           descr,
+                                           (double*)val,
+                                           row_ptr,
+                                           col_ind,
+                                           block_dim,
+                                           info,
+                                           HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                           buffer);
+    case HIP_C_32F:
+        return hipsparseCbsrilu02_analysis(handle,
+                                           dir,
+                                           mb,
+                                           nnzb,
+                                           descr,
+                                           (hipComplex*)val,
+                                           row_ptr,
+                                           col_ind,
+                                           block_dim,
+                                           info,
+                                           HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                           buffer);
+    case HIP_C_64F:
+        return hipsparseZbsrilu02_analysis(handle,
+                                           dir,
+                                           mb,
+                                           nnzb,
+                                           descr,
+                                           (hipDoubleComplex*)val,
+                                           row_ptr,
+                                           col_ind,
+                                           block_dim,
+                                           info,
+                                           HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                           buffer);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static hipsparseStatus_t hipsparseGtsvBlockIlu(hipsparseHandle_t         handle,
+                                               hipDataType               type,
+                                               hipsparseDirection_t      dir,
+                                               int                       mb,
+                                               int                       nnzb,
+                                               const hipsparseMatDescr_t descr,
+                                               void*                     val,
+                                               const int*                row_ptr,
+                                               const int*                col_ind,
+                                               int                       block_dim,
+                                               bsrilu02Info_t            info,
+                                               void*                     buffer)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipsparseSbsrilu02(handle,
+                                  dir,
+                                  mb,
+                                  nnzb,
+                                  descr,
+                                  (float*)val,
+                                  row_ptr,
+                                  col_ind,
+                                  block_dim,
+                                  info,
+                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                  buffer);
+    case HIP_R_64F:
+        return hipsparseDbsrilu02(handle,
+                                  dir,
+                                  mb,
+                                  nnzb,
+                                  descr,
+                                  (double*)val,
+                                  row_ptr,
+                                  col_ind,
+                                  block_dim,
+                                  info,
+                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                  buffer);
+    case HIP_C_32F:
+        return hipsparseCbsrilu02(handle,
+                                  dir,
+                                  mb,
+                                  nnzb,
+                                  descr,
+                                  (hipComplex*)val,
+                                  row_ptr,
+                                  col_ind,
+                                  block_dim,
+                                  info,
+                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                  buffer);
+    case HIP_C_64F:
+        return hipsparseZbsrilu02(handle,
+                                  dir,
+                                  mb,
+                                  nnzb,
+                                  descr,
+                                  (hipDoubleComplex*)val,
+                                  row_ptr,
+                                  col_ind,
+                                  block_dim,
+                                  info,
+                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                  buffer);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static hipsparseStatus_t hipsparseGtsvBlockSvBufferSize(hipsparseHandle_t         handle,
+                                                        hipDataType               type,
+                                                        hipsparseDirection_t      dir,
+                                                        int                       mb,
+                                                        int                       nnzb,
+                                                        const hipsparseMatDescr_t descr,
+                                                        void*                     val,
+                                                        const int*                row_ptr,
+                                                        const int*                col_ind,
+                                                        int                       block_dim,
+                                                        bsrsv2Info_t              info,
+                                                        int*                      size)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipsparseSbsrsv2_bufferSize(handle,
+                                           dir,
+                                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                           mb,
+                                           nnzb,
+                                           descr,
+                                           (float*)val,
+                                           row_ptr,
+                                           col_ind,
+                                           block_dim,
+                                           info,
+                                           size);
+    case HIP_R_64F:
+        return hipsparseDbsrsv2_bufferSize(handle,
+                                           dir,
+                                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                           mb,
+                                           nnzb,
+                                           descr,
+                                           (double*)val,
+                                           row_ptr,
+                                           col_ind,
+                                           block_dim,
+                                           info,
+                                           size);
+    case HIP_C_32F:
+        return hipsparseCbsrsv2_bufferSize(handle,
+                                           dir,
+                                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                           mb,
+                                           nnzb,
+                                           descr,
+                                           (hipComplex*)val,
+                                           row_ptr,
+                                           col_ind,
+                                           block_dim,
+                                           info,
+                                           size);
+    case HIP_C_64F:
+        return hipsparseZbsrsv2_bufferSize(handle,
+                                           dir,
+                                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                           mb,
+                                           nnzb,
+                                           descr,
+                                           (hipDoubleComplex*)val,
+                                           row_ptr,
+                                           col_ind,
+                                           block_dim,
+                                           info,
+                                           size);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static hipsparseStatus_t hipsparseGtsvBlockSvAnalysis(hipsparseHandle_t         handle,
+                                                      hipDataType               type,
+                                                      hipsparseDirection_t      dir,
+                                                      int                       mb,
+                                                      int                       nnzb,
+                                                      const hipsparseMatDescr_t descr,
+                                                      void*                     val,
+                                                      const int*                row_ptr,
+                                                      const int*                col_ind,
+                                                      int                       block_dim,
+                                                      bsrsv2Info_t              info,
+                                                      void*                     buffer)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipsparseSbsrsv2_analysis(handle,
+                                         dir,
+                                         HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                         mb,
+                                         nnzb,
+                                         descr,
+                                         (float*)val,
+                                         row_ptr,
+                                         col_ind,
+                                         block_dim,
+                                         info,
+                                         HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                         buffer);
+    case HIP_R_64F:
+        return hipsparseDbsrsv2_analysis(handle,
+                                         dir,
+                                         HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                         mb,
+                                         nnzb,
+                                         descr,
+                                         (double*)val,
+                                         row_ptr,
+                                         col_ind,
+                                         block_dim,
+                                         info,
+                                         HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                         buffer);
+    case HIP_C_32F:
+        return hipsparseCbsrsv2_analysis(handle,
+                                         dir,
+                                         HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                         mb,
+                                         nnzb,
+                                         descr,
+                                         (hipComplex*)val,
+                                         row_ptr,
+                                         col_ind,
+                                         block_dim,
+                                         info,
+                                         HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                         buffer);
+    case HIP_C_64F:
+        return hipsparseZbsrsv2_analysis(handle,
+                                         dir,
+                                         HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                         mb,
+                                         nnzb,
+                                         descr,
+                                         (hipDoubleComplex*)val,
+                                         row_ptr,
+                                         col_ind,
+                                         block_dim,
+                                         info,
+                                         HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                         buffer);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static hipsparseStatus_t hipsparseGtsvBlockSvSolve(hipsparseHandle_t         handle,
+                                                   hipDataType               type,
+                                                   hipsparseDirection_t      dir,
+                                                   int                       mb,
+                                                   int                       nnzb,
+                                                   const hipsparseMatDescr_t descr,
+                                                   void*                     val,
+                                                   const int*                row_ptr,
+                                                   const int*                col_ind,
+                                                   int                       block_dim,
+                                                   bsrsv2Info_t              info,
+                                                   const char*               one,
+                                                   const void*               f,
+                                                   void*                     x,
+                                                   void*                     buffer)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipsparseSbsrsv2_solve(handle,
+                                      dir,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      mb,
+                                      nnzb,
+                                      (const float*)one,
+                                      descr,
+                                      (const float*)val,
+                                      row_ptr,
+                                      col_ind,
+                                      block_dim,
+                                      info,
+                                      (const float*)f,
+                                      (float*)x,
+                                      HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                      buffer);
+    case HIP_R_64F:
+        return hipsparseDbsrsv2_solve(handle,
+                                      dir,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      mb,
+                                      nnzb,
+                                      (const double*)one,
+                                      descr,
+                                      (const double*)val,
+                                      row_ptr,
+                                      col_ind,
+                                      block_dim,
+                                      info,
+                                      (const double*)f,
+                                      (double*)x,
+                                      HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                      buffer);
+    case HIP_C_32F:
+        return hipsparseCbsrsv2_solve(handle,
+                                      dir,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      mb,
+                                      nnzb,
+                                      (const hipComplex*)one,
+                                      descr,
+                                      (const hipComplex*)val,
+                                      row_ptr,
+                                      col_ind,
+                                      block_dim,
+                                      info,
+                                      (const hipComplex*)f,
+                                      (hipComplex*)x,
+                                      HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                      buffer);
+    case HIP_C_64F:
+        return hipsparseZbsrsv2_solve(handle,
+                                      dir,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      mb,
+                                      nnzb,
+                                      (const hipDoubleComplex*)one,
+                                      descr,
+                                      (const hipDoubleComplex*)val,
+                                      row_ptr,
+                                      col_ind,
+                                      block_dim,
+                                      info,
+                                      (const hipDoubleComplex*)f,
+                                      (hipDoubleComplex*)x,
+                                      HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                      buffer);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// gtsvBlock struct - to hold the descriptors and info structures of the block LU
+// factorization and the triangular solves
+struct gtsvBlockInfo
+{
+    hipsparseMatDescr_t descr   = nullptr;
+    hipsparseMatDescr_t descr_L = nullptr;
+    hipsparseMatDescr_t descr_U = nullptr;
+    bsrilu02Info_t      ilu     = nullptr;
+    bsrsv2Info_t        info_L  = nullptr;
+    bsrsv2Info_t        info_U  = nullptr;
+
+    hipsparseStatus_t create()
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateMatDescr(&descr));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateMatDescr(&descr_L));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateMatDescr(&descr_U));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateBsrilu02Info(&ilu));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateBsrsv2Info(&info_L));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateBsrsv2Info(&info_U));
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatFillMode(descr_L, HIPSPARSE_FILL_MODE_LOWER));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatDiagType(descr_L, HIPSPARSE_DIAG_TYPE_UNIT));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatFillMode(descr_U, HIPSPARSE_FILL_MODE_UPPER));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSetMatDiagType(descr_U, HIPSPARSE_DIAG_TYPE_NON_UNIT));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    ~gtsvBlockInfo()
+    {
+        if(descr != nullptr)
+            hipsparseDestroyMatDescr(descr);
+        if(descr_L != nullptr)
+            hipsparseDestroyMatDescr(descr_L);
+        if(descr_U != nullptr)
+            hipsparseDestroyMatDescr(descr_U);
+        if(ilu != nullptr)
+            hipsparseDestroyBsrilu02Info(ilu);
+        if(info_L != nullptr)
+            hipsparseDestroyBsrsv2Info(info_L);
+        if(info_U != nullptr)
+            hipsparseDestroyBsrsv2Info(info_U);
+    }
+};
+
+hipsparseStatus_t hipsparseCreateGtsvBlockInfo(gtsvBlockInfo_t* info)
+{
+    if(info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *info = new gtsvBlockInfo;
+
+    hipsparseStatus_t status = (*info)->create();
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        hipsparseDestroyGtsvBlockInfo(*info);
+        *info = nullptr;
+    }
+
+    return status;
+}
+
+hipsparseStatus_t hipsparseDestroyGtsvBlockInfo(gtsvBlockInfo_t info)
+{
+    delete info;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseXgtsvBlockStridedBatch_zeroPivot(hipsparseHandle_t handle,
+                                                            gtsvBlockInfo_t   info,
+                                                            int*              position)
+{
+    if(info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparseXbsrilu02_zeroPivot(handle, info->ilu, position);
+}
+
+// Offsets into the temporary storage buffer of gtsvBlockStridedBatch. It holds the assembled
+// BSR matrix, the intermediate solution, a contiguous copy of strided right-hand sides and
+// the buffer of the block ILU0 and the triangular solves.
+static void hipsparseGtsvBlockLayout(size_t  val_size,
+                                     int     block_dim,
+                                     int64_t nrow,
+                                     int64_t nnzb,
+                                     bool    strided,
+                                     size_t* offset)
+{
+    size_t bb   = (size_t)block_dim * block_dim;
+    size_t size = 0;
+
+    // Values, row pointer, column indices, z and rhs
+    size_t bytes[5] = {val_size * bb * nnzb,
+                       sizeof(int) * (nrow + 1),
+                       sizeof(int) * nnzb,
+                       val_size * block_dim * nrow,
+                       strided ? val_size * block_dim * nrow : 0};
+
+    for(int k = 0; k < 5; ++k)
+    {
+        offset[k] = size;
+        size += (bytes[k] + 255) / 256 * 256;
+    }
+
+    offset[5] = size;
+}
+
+static hipsparseStatus_t hipsparseGtsvBlockCheck(hipsparseHandle_t    handle,
+                                                 hipsparseDirection_t dir,
+                                                 int                  block_dim,
+                                                 int                  m,
+                                                 int                  batchCount,
+                                                 int                  batchStride)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(dir != HIPSPARSE_DIRECTION_ROW && dir != HIPSPARSE_DIRECTION_COLUMN)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(block_dim <= 0 || m < 0 || batchCount < 0 || batchStride < m)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The assembled matrix is indexed with 32 bit integers
+    if(3 * (int64_t)m * batchCount > std::numeric_limits<int>::max())
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Block diagonal pattern of the batch, where each system is block tridiagonal. Systems are
+// not coupled, such that the level scheduling of the factorization and the triangular
+// solves processes all systems of the batch together, with a depth of m levels.
+static void hipsparseGtsvBlockPattern(int m, int batchCount, int* row_ptr, int* col_ind)
+{
+    int idx = 0;
+
+    row_ptr[0] = 0;
+
+    for(int b = 0; b < batchCount; ++b)
+    {
+        for(int i = 0; i < m; ++i)
+        {
+            for(int j = std::max(i - 1, 0); j <= std::min(i + 1, m - 1); ++j)
+            {
+                col_ind[idx++] = m * b + j;
+            }
+
+            row_ptr[m * b + i + 1] = idx;
+        }
+    }
+}
+
+static hipsparseStatus_t hipsparseGtsvBlockStridedBatchBufferSize(hipsparseHandle_t    handle,
+                                                                  hipDataType          type,
+                                                                  hipsparseDirection_t dir,
+                                                                  int                  block_dim,
+                                                                  int                  m,
+                                                                  const void*          d,
+                                                                  int                  batchCount,
+                                                                  int                  batchStride,
+                                                                  size_t*              size)
+{
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseGtsvBlockCheck(handle, dir, block_dim, m, batchCount, batchStride));
+
+    if(size == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Quick return
+    if(m == 0 || batchCount == 0)
+    {
+        *size = 0;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(d == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    size_t val_size;
+    char   one[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTypeScalars(type, &val_size, one));
+
+    int    nrow = m * batchCount;
+    int    nnzb = (3 * m - 2) * batchCount;
+    size_t offset[6];
+    hipsparseGtsvBlockLayout(val_size, block_dim, nrow, nnzb, batchStride != m, offset);
+
+    gtsvBlockInfo data;
+    RETURN_IF_HIPSPARSE_ERROR(data.create());
+
+    // The buffer sizes are queried for the pattern that the analysis assembles. The values are
+    // not accessed, d stands in for them.
+    std::vector<int> hrow_ptr(nrow + 1);
+    std::vector<int> hcol_ind(nnzb);
+    hipsparseGtsvBlockPattern(m, batchCount, hrow_ptr.data(), hcol_ind.data());
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    int* pattern;
+    RETURN_IF_CUDA_ERROR(cudaMalloc((void**)&pattern, sizeof(int) * (nrow + 1 + nnzb)));
+
+    void* val     = (void*)d;
+    int*  row_ptr = pattern;
+    int*  col_ind = pattern + nrow + 1;
+    int   work[3];
+
+    hipsparseStatus_t status = hipCUDAErrorToHIPSPARSEStatus(cudaMemcpyAsync(
+        row_ptr, hrow_ptr.data(), sizeof(int) * (nrow + 1), cudaMemcpyHostToDevice, stream));
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipCUDAErrorToHIPSPARSEStatus(cudaMemcpyAsync(
+            col_ind, hcol_ind.data(), sizeof(int) * nnzb, cudaMemcpyHostToDevice, stream));
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseGtsvBlockIluBufferSize(handle,
+                                                 type,
+                                                 dir,
+                                                 nrow,
+                                                 nnzb,
+                                                 data.descr,
+                                                 val,
+                                                 row_ptr,
+                                                 col_ind,
+                                                 block_dim,
+                                                 data.ilu,
+                                                 &work[0]);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseGtsvBlockSvBufferSize(handle,
+                                                type,
+                                                dir,
+                                                nrow,
+                                                nnzb,
+                                                data.descr_L,
+                                                val,
+                                                row_ptr,
+                                                col_ind,
+                                                block_dim,
+                                                data.info_L,
+                                                &work[1]);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseGtsvBlockSvBufferSize(handle,
+                                                type,
+                                                dir,
+                                                nrow,
+                                                nnzb,
+                                                data.descr_U,
+                                                val,
+                                                row_ptr,
+                                                col_ind,
+                                                block_dim,
+                                                data.info_U,
+                                                &work[2]);
+    }
+
+    // The pattern is released on return, thus wait for the queries to finish
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+    RETURN_IF_CUDA_ERROR(cudaFree(pattern));
+    RETURN_IF_HIPSPARSE_ERROR(status);
+
+    *size = offset[5] + std::max(work[0], std::max(work[1], work[2]));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Analysis of a batch of block tridiagonal systems, see hipsparseGtsvBlockStridedBatch. The
+// block diagonal pattern of the batch is written into the buffer once, and the level
+// scheduling of the factorization and of both triangular solves is stored in info. Only the
+// pattern is accessed, such that the values do not need to be assembled.
+static hipsparseStatus_t hipsparseGtsvBlockStridedBatchAnalysis(hipsparseHandle_t    handle,
+                                                                hipDataType          type,
+                                                                hipsparseDirection_t dir,
+                                                                int                  block_dim,
+                                                                int                  m,
+                                                                int                  batchCount,
+                                                                int                  batchStride,
+                                                                gtsvBlockInfo_t      info,
+                                                                void*                pBuffer)
+{
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseGtsvBlockCheck(handle, dir, block_dim, m, batchCount, batchStride));
+
+    // Quick return
+    if(m == 0 || batchCount == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(info == nullptr || pBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    size_t val_size;
+    char   one[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTypeScalars(type, &val_size, one));
+
+    int    nrow = m * batchCount;
+    int    nnzb = (3 * m - 2) * batchCount;
+    size_t offset[6];
+    hipsparseGtsvBlockLayout(val_size, block_dim, nrow, nnzb, batchStride != m, offset);
+
+    char* val     = (char*)pBuffer + offset[0];
+    int*  row_ptr = (int*)((char*)pBuffer + offset[1]);
+    int*  col_ind = (int*)((char*)pBuffer + offset[2]);
+    char* work    = (char*)pBuffer + offset[5];
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    std::vector<int> hrow_ptr(nrow + 1);
+    std::vector<int> hcol_ind(nnzb);
+    hipsparseGtsvBlockPattern(m, batchCount, hrow_ptr.data(), hcol_ind.data());
+
+    // The host pattern is released on return, thus wait for the copies to finish
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        row_ptr, hrow_ptr.data(), sizeof(int) * (nrow + 1), cudaMemcpyHostToDevice, stream));
+    RETURN_IF_CUDA_ERROR(cudaMemcpyAsync(
+        col_ind, hcol_ind.data(), sizeof(int) * nnzb, cudaMemcpyHostToDevice, stream));
+    RETURN_IF_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGtsvBlockIluAnalysis(handle,
+                                                            type,
+                                                            dir,
+                                                            nrow,
+                                                            nnzb,
+                                                            info->descr,
+                                                            val,
+                                                            row_ptr,
+                                                            col_ind,
+                                                            block_dim,
+                                                            info->ilu,
+                                                            work));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGtsvBlockSvAnalysis(handle,
+                                                           type,
+                                                           dir,
+                                                           nrow,
+                                                           nnzb,
+                                                           info->descr_L,
+                                                           val,
+                                                           row_ptr,
+                                                           col_ind,
+                                                           block_dim,
+                                                           info->info_L,
+                                                           work));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGtsvBlockSvAnalysis(handle,
+                                                           type,
+                                                           dir,
+                                                           nrow,
+                                                           nnzb,
+                                                           info->descr_U,
+                                                           val,
+                                                           row_ptr,
+                                                           col_ind,
+                                                           block_dim,
+                                                           info->info_U,
+                                                           work));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Solves a batch of block tridiagonal systems by an exact block LU factorization (block
+// Thomas algorithm) without pivoting. All systems are assembled into one block diagonal
+// BSR matrix, whose diagonal blocks are the block tridiagonal systems. As the block ILU0 of
+// a block tridiagonal matrix has no fill-in, it is its exact LU factorization, and the batch
+// is factorized and solved by a single bsrilu02 and two bsrsv2 calls. The pattern and the
+// analysis are reused from hipsparseGtsvBlockStridedBatchAnalysis, such that a solve does not
+// synchronize with the host.
+static hipsparseStatus_t hipsparseGtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                        hipDataType          type,
+                                                        hipsparseDirection_t dir,
+                                                        int                  block_dim,
+                                                        int                  m,
+                                                        const void*          dl,
+                                                        const void*          d,
+                                                        const void*          du,
+                                                        void*                x,
+                                                        int                  batchCount,
+                                                        int                  batchStride,
+                                                        gtsvBlockInfo_t      info,
+                                                        void*                pBuffer)
+{
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseGtsvBlockCheck(handle, dir, block_dim, m, batchCount, batchStride));
+
+    // Quick return
+    if(m == 0 || batchCount == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(dl == nullptr || d == nullptr || du == nullptr || x == nullptr || info == nullptr
+       || pBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    size_t val_size;
+    char   one[16]{};
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseTypeScalars(type, &val_size, one));
+
+    bool   strided  = batchStride != m;
+    int    nrow     = m * batchCount;
+    int    sys_nnzb = 3 * m - 2;
+    int    nnzb     = sys_nnzb * batchCount;
+    size_t bb       = val_size * block_dim * block_dim;
+    size_t offset[6];
+    hipsparseGtsvBlockLayout(val_size, block_dim, nrow, nnzb, strided, offset);
+
+    char* val     = (char*)pBuffer + offset[0];
+    int*  row_ptr = (int*)((char*)pBuffer + offset[1]);
+    int*  col_ind = (int*)((char*)pBuffer + offset[2]);
+    char* z       = (char*)pBuffer + offset[3];
+    char* rhs     = strided ? (char*)pBuffer + offset[4] : (char*)x;
+    char* work    = (char*)pBuffer + offset[5];
+
+    // Get stream
+    cudaStream_t stream;
+    RETURN_IF_CUSPARSE_ERROR(cusparseGetStream((cusparseHandle_t)handle, &stream));
+
+    // Gather the blocks into BSR order. The values of a system are d_0, du_0, dl_1, d_1, du_1,
+    // ..., dl_m-1, d_m-1, i.e. block k of dl, d and du of row i of system b is stored at
+    // position sys_nnzb * b + 3 * i + k - 1. Each block type is gathered by 2D copies along
+    // the rows of a system or along the systems, whichever needs fewer copies.
+    const void* blocks[3] = {dl, d, du};
+
+    for(int k = 0; k < 3; ++k)
+    {
+        // The first row has no lower and the last row no upper block
+        int first = (k == 0) ? 1 : 0;
+        int last  = (k == 2) ? m - 1 : m;
+
+        if(batchCount <= last - first)
+        {
+            for(int b = 0; b < batchCount; ++b)
+            {
+                RETURN_IF_CUDA_ERROR(cudaMemcpy2DAsync(
+                    val + ((int64_t)sys_nnzb * b + 3 * first + k - 1) * bb,
+                    3 * bb,
+                    (const char*)blocks[k] + ((int64_t)batchStride * b + first) * bb,
+                    bb,
+                    bb,
+                    last - first,
+                    cudaMemcpyDeviceToDevice,
+                    stream));
+            }
+        }
+        else
+        {
+            for(int i = first; i < last; ++i)
+            {
+                RETURN_IF_CUDA_ERROR(cudaMemcpy2DAsync(val + ((int64_t)3 * i + k - 1) * bb,
+                                                     sys_nnzb * bb,
+                                                     (const char*)blocks[k] + i * bb,
+                                                     batchStride * bb,
+                                                     bb,
+                                                     batchCount,
+                                                     cudaMemcpyDeviceToDevice,
+                                                     stream));
+            }
+        }
+    }
+
+    // Contiguous copy of the right-hand sides
+    size_t row_size = val_size * block_dim * m;
+
+    if(strided)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpy2DAsync(rhs,
+                                             row_size,
+                                             x,
+                                             val_size * block_dim * batchStride,
+                                             row_size,
+                                             batchCount,
+                                             cudaMemcpyDeviceToDevice,
+                                             stream));
+    }
+
+    // Block LU factorization. A singular diagonal block is reported by
+    // hipsparseXgtsvBlockStridedBatch_zeroPivot
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGtsvBlockIlu(handle,
+                                                    type,
+                                                    dir,
+                                                    nrow,
+                                                    nnzb,
+                                                    info->descr,
+                                                    val,
+                                                    row_ptr,
+                                                    col_ind,
+                                                    block_dim,
+                                                    info->ilu,
+                                                    work));
+
+    // Forward and backward substitution, L * z = rhs and U * rhs = z
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    hipsparseStatus_t status = hipsparseGtsvBlockSvSolve(handle,
+                                                         type,
+                                                         dir,
+                                                         nrow,
+                                                         nnzb,
+                                                         info->descr_L,
+                                                         val,
+                                                         row_ptr,
+                                                         col_ind,
+                                                         block_dim,
+                                                         info->info_L,
+                                                         one,
+                                                         rhs,
+                                                         z,
+                                                         work);
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseGtsvBlockSvSolve(handle,
+                                           type,
+                                           dir,
+                                           nrow,
+                                           nnzb,
+                                           info->descr_U,
+                                           val,
+                                           row_ptr,
+                                           col_ind,
+                                           block_dim,
+                                           info->info_U,
+                                           one,
+                                           z,
+                                           rhs,
+                                           work);
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+    RETURN_IF_HIPSPARSE_ERROR(status);
+
+    // Scatter the solution back into x
+    if(strided)
+    {
+        RETURN_IF_CUDA_ERROR(cudaMemcpy2DAsync(x,
+                                             val_size * block_dim * batchStride,
+                                             rhs,
+                                             row_size,
+                                             row_size,
+                                             batchCount,
+                                             cudaMemcpyDeviceToDevice,
+                                             stream));
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                hipsparseDirection_t dirA,
+                                                                int                  blockDim,
+                                                                int                  m,
+                                                                const float*         dl,
+                                                                const float*         d,
+                                                                const float*         du,
+                                                                const float*         x,
+                                                                int                  batchCount,
+                                                                int                  batchStride,
+                                                                size_t* pBufferSizeInBytes)
+{
+    return hipsparseGtsvBlockStridedBatchBufferSize(
+        handle, HIP_R_32F, dirA, blockDim, m, d, batchCount, batchStride, pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseDgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                hipsparseDirection_t dirA,
+                                                                int                  blockDim,
+                                                                int                  m,
+                                                                const double*        dl,
+                                                                const double*        d,
+                                                                const double*        du,
+                                                                const double*        x,
+                                                                int                  batchCount,
+                                                                int                  batchStride,
+                                                                size_t* pBufferSizeInBytes)
+{
+    return hipsparseGtsvBlockStridedBatchBufferSize(
+        handle, HIP_R_64F, dirA, blockDim, m, d, batchCount, batchStride, pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseCgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t    handle,
+                                                                hipsparseDirection_t dirA,
+                                                                int                  blockDim,
+                                                                int                  m,
+                                                                const hipComplex*    dl,
+                                                                const hipComplex*    d,
+                                                                const hipComplex*    du,
+                                                                const hipComplex*    x,
+                                                                int                  batchCount,
+                                                                int                  batchStride,
+                                                                size_t* pBufferSizeInBytes)
+{
+    return hipsparseGtsvBlockStridedBatchBufferSize(
+        handle, HIP_C_32F, dirA, blockDim, m, d, batchCount, batchStride, pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseZgtsvBlockStridedBatch_bufferSizeExt(hipsparseHandle_t       handle,
+                                                                hipsparseDirection_t    dirA,
+                                                                int                     blockDim,
+                                                                int                     m,
+                                                                const hipDoubleComplex* dl,
+                                                                const hipDoubleComplex* d,
+                                                                const hipDoubleComplex* du,
+                                                                const hipDoubleComplex* x,
+                                                                int                     batchCount,
+                                                                int                     batchStride,
+                                                                size_t* pBufferSizeInBytes)
+{
+    return hipsparseGtsvBlockStridedBatchBufferSize(
+        handle, HIP_C_64F, dirA, blockDim, m, d, batchCount, batchStride, pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseSgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                           hipsparseDirection_t dirA,
+                                                           int                  blockDim,
+                                                           int                  m,
+                                                           const float*         dl,
+                                                           const float*         d,
+                                                           const float*         du,
+                                                           const float*         x,
+                                                           int                  batchCount,
+                                                           int                  batchStride,
+                                                           gtsvBlockInfo_t      info,
+                                                           void*                pBuffer)
+{
+    return hipsparseGtsvBlockStridedBatchAnalysis(
+        handle, HIP_R_32F, dirA, blockDim, m, batchCount, batchStride, info, pBuffer);
+}
+
+hipsparseStatus_t hipsparseSgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                  hipsparseDirection_t dirA,
+                                                  int                  blockDim,
+                                                  int                  m,
+                                                  const float*         dl,
+                                                  const float*         d,
+                                                  const float*         du,
+                                                  float*               x,
+                                                  int                  batchCount,
+                                                  int                  batchStride,
+                                                  gtsvBlockInfo_t      info,
+                                                  void*                pBuffer)
+{
+    return hipsparseGtsvBlockStridedBatch(handle,
+                                          HIP_R_32F,
+                                          dirA,
+                                          blockDim,
+                                          m,
+                                          dl,
+                                          d,
+                                          du,
+                                          x,
+                                          batchCount,
+                                          batchStride,
+                                          info,
+                                          pBuffer);
+}
+
+hipsparseStatus_t hipsparseDgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                           hipsparseDirection_t dirA,
+                                                           int                  blockDim,
+                                                           int                  m,
+                                                           const double*        dl,
+                                                           const double*        d,
+                                                           const double*        du,
+                                                           const double*        x,
+                                                           int                  batchCount,
+                                                           int                  batchStride,
+                                                           gtsvBlockInfo_t      info,
+                                                           void*                pBuffer)
+{
+    return hipsparseGtsvBlockStridedBatchAnalysis(
+        handle, HIP_R_64F, dirA, blockDim, m, batchCount, batchStride, info, pBuffer);
+}
+
+hipsparseStatus_t hipsparseDgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                  hipsparseDirection_t dirA,
+                                                  int                  blockDim,
+                                                  int                  m,
+                                                  const double*        dl,
+                                                  const double*        d,
+                                                  const double*        du,
+                                                  double*              x,
+                                                  int                  batchCount,
+                                                  int                  batchStride,
+                                                  gtsvBlockInfo_t      info,
+                                                  void*                pBuffer)
+{
+    return hipsparseGtsvBlockStridedBatch(handle,
+                                          HIP_R_64F,
+                                          dirA,
+                                          blockDim,
+                                          m,
+                                          dl,
+                                          d,
+                                          du,
+                                          x,
+                                          batchCount,
+                                          batchStride,
+                                          info,
+                                          pBuffer);
+}
+
+hipsparseStatus_t hipsparseCgtsvBlockStridedBatch_analysis(hipsparseHandle_t    handle,
+                                                           hipsparseDirection_t dirA,
+                                                           int                  blockDim,
+                                                           int                  m,
+                                                           const hipComplex*    dl,
+                                                           const hipComplex*    d,
+                                                           const hipComplex*    du,
+                                                           const hipComplex*    x,
+                                                           int                  batchCount,
+                                                           int                  batchStride,
+                                                           gtsvBlockInfo_t      info,
+                                                           void*                pBuffer)
+{
+    return hipsparseGtsvBlockStridedBatchAnalysis(
+        handle, HIP_C_32F, dirA, blockDim, m, batchCount, batchStride, info, pBuffer);
+}
+
+hipsparseStatus_t hipsparseCgtsvBlockStridedBatch(hipsparseHandle_t    handle,
+                                                  hipsparseDirection_t dirA,
+                                                  int                  blockDim,
+                                                  int                  m,
+                                                  const hipComplex*    dl,
+                                                  const hipComplex*    d,
+                                                  const hipComplex*    du,
+                                                  hipComplex*          x,
+                                                  int                  batchCount,
+                                                  int                  batchStride,
+                                                  gtsvBlockInfo_t      info,
+                                                  void*                pBuffer)
+{
+    return hipsparseGtsvBlockStridedBatch(handle,
+                                          HIP_C_32F,
+                                          dirA,
+                                          blockDim,
+                                          m,
+                                          dl,
+                                          d,
+                                          du,
+                                          x,
+                                          batchCount,
+                                          batchStride,
+                                          info,
+                                          pBuffer);
+}
+
+hipsparseStatus_t hipsparseZgtsvBlockStridedBatch_analysis(hipsparseHandle_t       handle,
+                                                           hipsparseDirection_t    dirA,
+                                                           int                     blockDim,
+                                                           int                     m,
+                                                           const hipDoubleComplex* dl,
+                                                           const hipDoubleComplex* d,
+                                                           const hipDoubleComplex* du,
+                                                           const hipDoubleComplex* x,
+                                                           int                     batchCount,
+                                                           int                     batchStride,
+                                                           gtsvBlockInfo_t         info,
+                                                           void*                   pBuffer)
+{
+    return hipsparseGtsvBlockStridedBatchAnalysis(
+        handle, HIP_C_64F, dirA, blockDim, m, batchCount, batchStride, info, pBuffer);
+}
+
+hipsparseStatus_t hipsparseZgtsvBlockStridedBatch(hipsparseHandle_t       handle,
+                                                  hipsparseDirection_t    dirA,
+                                                  int                     blockDim,
+                                                  int                     m,
+                                                  const hipDoubleComplex* dl,
+                                                  const hipDoubleComplex* d,
+                                                  const hipDoubleComplex* du,
+                                                  hipDoubleComplex*       x,
+                                                  int                     batchCount,
+                                                  int                     batchStride,
+                                                  gtsvBlockInfo_t         info,
+                                                  void*                   pBuffer)
+{
+    return hipsparseGtsvBlockStridedBatch(handle,
+                                          HIP_C_64F,
+                                          dirA,
+                                          blockDim,
+                                          m,
+                                          dl,
+                                          d,
+                                          du,
+                                          x,
+                                          batchCount,
+                                          batchStride,
+                                          info,
+                                          pBuffer);
+}
+
 hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
                                      int                       m,
                                      int                       nnz,